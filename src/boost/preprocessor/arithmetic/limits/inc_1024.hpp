@@ -1,536 +0,0 @@
-# /* Copyright (C) 2001
-#  * Housemarque Oy
-#  * http://www.housemarque.com
-#  *
-#  * Distributed under the Boost Software License, Version 1.0. (See
-#  * accompanying file LICENSE_1_0.txt or copy at
-#  * http://www.boost.org/LICENSE_1_0.txt)
-#  */
-#
-# /* Revised by Paul Mensonides (2002) */
-# /* Revised by Edward Diener (2020) */
-#
-# /* See http://www.boost.org for most recent version. */
-#
-# ifndef BOOST_PREPROCESSOR_ARITHMETIC_INC_1024_HPP
-# define BOOST_PREPROCESSOR_ARITHMETIC_INC_1024_HPP
-#
-# if defined(BOOST_PP_INC_512)
-# undef BOOST_PP_INC_512
-# endif
-#
-# define BOOST_PP_INC_512 513
-# define BOOST_PP_INC_513 514
-# define BOOST_PP_INC_514 515
-# define BOOST_PP_INC_515 516
-# define BOOST_PP_INC_516 517
-# define BOOST_PP_INC_517 518
-# define BOOST_PP_INC_518 519
-# define BOOST_PP_INC_519 520
-# define BOOST_PP_INC_520 521
-# define BOOST_PP_INC_521 522
-# define BOOST_PP_INC_522 523
-# define BOOST_PP_INC_523 524
-# define BOOST_PP_INC_524 525
-# define BOOST_PP_INC_525 526
-# define BOOST_PP_INC_526 527
-# define BOOST_PP_INC_527 528
-# define BOOST_PP_INC_528 529
-# define BOOST_PP_INC_529 530
-# define BOOST_PP_INC_530 531
-# define BOOST_PP_INC_531 532
-# define BOOST_PP_INC_532 533
-# define BOOST_PP_INC_533 534
-# define BOOST_PP_INC_534 535
-# define BOOST_PP_INC_535 536
-# define BOOST_PP_INC_536 537
-# define BOOST_PP_INC_537 538
-# define BOOST_PP_INC_538 539
-# define BOOST_PP_INC_539 540
-# define BOOST_PP_INC_540 541
-# define BOOST_PP_INC_541 542
-# define BOOST_PP_INC_542 543
-# define BOOST_PP_INC_543 544
-# define BOOST_PP_INC_544 545
-# define BOOST_PP_INC_545 546
-# define BOOST_PP_INC_546 547
-# define BOOST_PP_INC_547 548
-# define BOOST_PP_INC_548 549
-# define BOOST_PP_INC_549 550
-# define BOOST_PP_INC_550 551
-# define BOOST_PP_INC_551 552
-# define BOOST_PP_INC_552 553
-# define BOOST_PP_INC_553 554
-# define BOOST_PP_INC_554 555
-# define BOOST_PP_INC_555 556
-# define BOOST_PP_INC_556 557
-# define BOOST_PP_INC_557 558
-# define BOOST_PP_INC_558 559
-# define BOOST_PP_INC_559 560
-# define BOOST_PP_INC_560 561
-# define BOOST_PP_INC_561 562
-# define BOOST_PP_INC_562 563
-# define BOOST_PP_INC_563 564
-# define BOOST_PP_INC_564 565
-# define BOOST_PP_INC_565 566
-# define BOOST_PP_INC_566 567
-# define BOOST_PP_INC_567 568
-# define BOOST_PP_INC_568 569
-# define BOOST_PP_INC_569 570
-# define BOOST_PP_INC_570 571
-# define BOOST_PP_INC_571 572
-# define BOOST_PP_INC_572 573
-# define BOOST_PP_INC_573 574
-# define BOOST_PP_INC_574 575
-# define BOOST_PP_INC_575 576
-# define BOOST_PP_INC_576 577
-# define BOOST_PP_INC_577 578
-# define BOOST_PP_INC_578 579
-# define BOOST_PP_INC_579 580
-# define BOOST_PP_INC_580 581
-# define BOOST_PP_INC_581 582
-# define BOOST_PP_INC_582 583
-# define BOOST_PP_INC_583 584
-# define BOOST_PP_INC_584 585
-# define BOOST_PP_INC_585 586
-# define BOOST_PP_INC_586 587
-# define BOOST_PP_INC_587 588
-# define BOOST_PP_INC_588 589
-# define BOOST_PP_INC_589 590
-# define BOOST_PP_INC_590 591
-# define BOOST_PP_INC_591 592
-# define BOOST_PP_INC_592 593
-# define BOOST_PP_INC_593 594
-# define BOOST_PP_INC_594 595
-# define BOOST_PP_INC_595 596
-# define BOOST_PP_INC_596 597
-# define BOOST_PP_INC_597 598
-# define BOOST_PP_INC_598 599
-# define BOOST_PP_INC_599 600
-# define BOOST_PP_INC_600 601
-# define BOOST_PP_INC_601 602
-# define BOOST_PP_INC_602 603
-# define BOOST_PP_INC_603 604
-# define BOOST_PP_INC_604 605
-# define BOOST_PP_INC_605 606
-# define BOOST_PP_INC_606 607
-# define BOOST_PP_INC_607 608
-# define BOOST_PP_INC_608 609
-# define BOOST_PP_INC_609 610
-# define BOOST_PP_INC_610 611
-# define BOOST_PP_INC_611 612
-# define BOOST_PP_INC_612 613
-# define BOOST_PP_INC_613 614
-# define BOOST_PP_INC_614 615
-# define BOOST_PP_INC_615 616
-# define BOOST_PP_INC_616 617
-# define BOOST_PP_INC_617 618
-# define BOOST_PP_INC_618 619
-# define BOOST_PP_INC_619 620
-# define BOOST_PP_INC_620 621
-# define BOOST_PP_INC_621 622
-# define BOOST_PP_INC_622 623
-# define BOOST_PP_INC_623 624
-# define BOOST_PP_INC_624 625
-# define BOOST_PP_INC_625 626
-# define BOOST_PP_INC_626 627
-# define BOOST_PP_INC_627 628
-# define BOOST_PP_INC_628 629
-# define BOOST_PP_INC_629 630
-# define BOOST_PP_INC_630 631
-# define BOOST_PP_INC_631 632
-# define BOOST_PP_INC_632 633
-# define BOOST_PP_INC_633 634
-# define BOOST_PP_INC_634 635
-# define BOOST_PP_INC_635 636
-# define BOOST_PP_INC_636 637
-# define BOOST_PP_INC_637 638
-# define BOOST_PP_INC_638 639
-# define BOOST_PP_INC_639 640
-# define BOOST_PP_INC_640 641
-# define BOOST_PP_INC_641 642
-# define BOOST_PP_INC_642 643
-# define BOOST_PP_INC_643 644
-# define BOOST_PP_INC_644 645
-# define BOOST_PP_INC_645 646
-# define BOOST_PP_INC_646 647
-# define BOOST_PP_INC_647 648
-# define BOOST_PP_INC_648 649
-# define BOOST_PP_INC_649 650
-# define BOOST_PP_INC_650 651
-# define BOOST_PP_INC_651 652
-# define BOOST_PP_INC_652 653
-# define BOOST_PP_INC_653 654
-# define BOOST_PP_INC_654 655
-# define BOOST_PP_INC_655 656
-# define BOOST_PP_INC_656 657
-# define BOOST_PP_INC_657 658
-# define BOOST_PP_INC_658 659
-# define BOOST_PP_INC_659 660
-# define BOOST_PP_INC_660 661
-# define BOOST_PP_INC_661 662
-# define BOOST_PP_INC_662 663
-# define BOOST_PP_INC_663 664
-# define BOOST_PP_INC_664 665
-# define BOOST_PP_INC_665 666
-# define BOOST_PP_INC_666 667
-# define BOOST_PP_INC_667 668
-# define BOOST_PP_INC_668 669
-# define BOOST_PP_INC_669 670
-# define BOOST_PP_INC_670 671
-# define BOOST_PP_INC_671 672
-# define BOOST_PP_INC_672 673
-# define BOOST_PP_INC_673 674
-# define BOOST_PP_INC_674 675
-# define BOOST_PP_INC_675 676
-# define BOOST_PP_INC_676 677
-# define BOOST_PP_INC_677 678
-# define BOOST_PP_INC_678 679
-# define BOOST_PP_INC_679 680
-# define BOOST_PP_INC_680 681
-# define BOOST_PP_INC_681 682
-# define BOOST_PP_INC_682 683
-# define BOOST_PP_INC_683 684
-# define BOOST_PP_INC_684 685
-# define BOOST_PP_INC_685 686
-# define BOOST_PP_INC_686 687
-# define BOOST_PP_INC_687 688
-# define BOOST_PP_INC_688 689
-# define BOOST_PP_INC_689 690
-# define BOOST_PP_INC_690 691
-# define BOOST_PP_INC_691 692
-# define BOOST_PP_INC_692 693
-# define BOOST_PP_INC_693 694
-# define BOOST_PP_INC_694 695
-# define BOOST_PP_INC_695 696
-# define BOOST_PP_INC_696 697
-# define BOOST_PP_INC_697 698
-# define BOOST_PP_INC_698 699
-# define BOOST_PP_INC_699 700
-# define BOOST_PP_INC_700 701
-# define BOOST_PP_INC_701 702
-# define BOOST_PP_INC_702 703
-# define BOOST_PP_INC_703 704
-# define BOOST_PP_INC_704 705
-# define BOOST_PP_INC_705 706
-# define BOOST_PP_INC_706 707
-# define BOOST_PP_INC_707 708
-# define BOOST_PP_INC_708 709
-# define BOOST_PP_INC_709 710
-# define BOOST_PP_INC_710 711
-# define BOOST_PP_INC_711 712
-# define BOOST_PP_INC_712 713
-# define BOOST_PP_INC_713 714
-# define BOOST_PP_INC_714 715
-# define BOOST_PP_INC_715 716
-# define BOOST_PP_INC_716 717
-# define BOOST_PP_INC_717 718
-# define BOOST_PP_INC_718 719
-# define BOOST_PP_INC_719 720
-# define BOOST_PP_INC_720 721
-# define BOOST_PP_INC_721 722
-# define BOOST_PP_INC_722 723
-# define BOOST_PP_INC_723 724
-# define BOOST_PP_INC_724 725
-# define BOOST_PP_INC_725 726
-# define BOOST_PP_INC_726 727
-# define BOOST_PP_INC_727 728
-# define BOOST_PP_INC_728 729
-# define BOOST_PP_INC_729 730
-# define BOOST_PP_INC_730 731
-# define BOOST_PP_INC_731 732
-# define BOOST_PP_INC_732 733
-# define BOOST_PP_INC_733 734
-# define BOOST_PP_INC_734 735
-# define BOOST_PP_INC_735 736
-# define BOOST_PP_INC_736 737
-# define BOOST_PP_INC_737 738
-# define BOOST_PP_INC_738 739
-# define BOOST_PP_INC_739 740
-# define BOOST_PP_INC_740 741
-# define BOOST_PP_INC_741 742
-# define BOOST_PP_INC_742 743
-# define BOOST_PP_INC_743 744
-# define BOOST_PP_INC_744 745
-# define BOOST_PP_INC_745 746
-# define BOOST_PP_INC_746 747
-# define BOOST_PP_INC_747 748
-# define BOOST_PP_INC_748 749
-# define BOOST_PP_INC_749 750
-# define BOOST_PP_INC_750 751
-# define BOOST_PP_INC_751 752
-# define BOOST_PP_INC_752 753
-# define BOOST_PP_INC_753 754
-# define BOOST_PP_INC_754 755
-# define BOOST_PP_INC_755 756
-# define BOOST_PP_INC_756 757
-# define BOOST_PP_INC_757 758
-# define BOOST_PP_INC_758 759
-# define BOOST_PP_INC_759 760
-# define BOOST_PP_INC_760 761
-# define BOOST_PP_INC_761 762
-# define BOOST_PP_INC_762 763
-# define BOOST_PP_INC_763 764
-# define BOOST_PP_INC_764 765
-# define BOOST_PP_INC_765 766
-# define BOOST_PP_INC_766 767
-# define BOOST_PP_INC_767 768
-# define BOOST_PP_INC_768 769
-# define BOOST_PP_INC_769 770
-# define BOOST_PP_INC_770 771
-# define BOOST_PP_INC_771 772
-# define BOOST_PP_INC_772 773
-# define BOOST_PP_INC_773 774
-# define BOOST_PP_INC_774 775
-# define BOOST_PP_INC_775 776
-# define BOOST_PP_INC_776 777
-# define BOOST_PP_INC_777 778
-# define BOOST_PP_INC_778 779
-# define BOOST_PP_INC_779 780
-# define BOOST_PP_INC_780 781
-# define BOOST_PP_INC_781 782
-# define BOOST_PP_INC_782 783
-# define BOOST_PP_INC_783 784
-# define BOOST_PP_INC_784 785
-# define BOOST_PP_INC_785 786
-# define BOOST_PP_INC_786 787
-# define BOOST_PP_INC_787 788
-# define BOOST_PP_INC_788 789
-# define BOOST_PP_INC_789 790
-# define BOOST_PP_INC_790 791
-# define BOOST_PP_INC_791 792
-# define BOOST_PP_INC_792 793
-# define BOOST_PP_INC_793 794
-# define BOOST_PP_INC_794 795
-# define BOOST_PP_INC_795 796
-# define BOOST_PP_INC_796 797
-# define BOOST_PP_INC_797 798
-# define BOOST_PP_INC_798 799
-# define BOOST_PP_INC_799 800
-# define BOOST_PP_INC_800 801
-# define BOOST_PP_INC_801 802
-# define BOOST_PP_INC_802 803
-# define BOOST_PP_INC_803 804
-# define BOOST_PP_INC_804 805
-# define BOOST_PP_INC_805 806
-# define BOOST_PP_INC_806 807
-# define BOOST_PP_INC_807 808
-# define BOOST_PP_INC_808 809
-# define BOOST_PP_INC_809 810
-# define BOOST_PP_INC_810 811
-# define BOOST_PP_INC_811 812
-# define BOOST_PP_INC_812 813
-# define BOOST_PP_INC_813 814
-# define BOOST_PP_INC_814 815
-# define BOOST_PP_INC_815 816
-# define BOOST_PP_INC_816 817
-# define BOOST_PP_INC_817 818
-# define BOOST_PP_INC_818 819
-# define BOOST_PP_INC_819 820
-# define BOOST_PP_INC_820 821
-# define BOOST_PP_INC_821 822
-# define BOOST_PP_INC_822 823
-# define BOOST_PP_INC_823 824
-# define BOOST_PP_INC_824 825
-# define BOOST_PP_INC_825 826
-# define BOOST_PP_INC_826 827
-# define BOOST_PP_INC_827 828
-# define BOOST_PP_INC_828 829
-# define BOOST_PP_INC_829 830
-# define BOOST_PP_INC_830 831
-# define BOOST_PP_INC_831 832
-# define BOOST_PP_INC_832 833
-# define BOOST_PP_INC_833 834
-# define BOOST_PP_INC_834 835
-# define BOOST_PP_INC_835 836
-# define BOOST_PP_INC_836 837
-# define BOOST_PP_INC_837 838
-# define BOOST_PP_INC_838 839
-# define BOOST_PP_INC_839 840
-# define BOOST_PP_INC_840 841
-# define BOOST_PP_INC_841 842
-# define BOOST_PP_INC_842 843
-# define BOOST_PP_INC_843 844
-# define BOOST_PP_INC_844 845
-# define BOOST_PP_INC_845 846
-# define BOOST_PP_INC_846 847
-# define BOOST_PP_INC_847 848
-# define BOOST_PP_INC_848 849
-# define BOOST_PP_INC_849 850
-# define BOOST_PP_INC_850 851
-# define BOOST_PP_INC_851 852
-# define BOOST_PP_INC_852 853
-# define BOOST_PP_INC_853 854
-# define BOOST_PP_INC_854 855
-# define BOOST_PP_INC_855 856
-# define BOOST_PP_INC_856 857
-# define BOOST_PP_INC_857 858
-# define BOOST_PP_INC_858 859
-# define BOOST_PP_INC_859 860
-# define BOOST_PP_INC_860 861
-# define BOOST_PP_INC_861 862
-# define BOOST_PP_INC_862 863
-# define BOOST_PP_INC_863 864
-# define BOOST_PP_INC_864 865
-# define BOOST_PP_INC_865 866
-# define BOOST_PP_INC_866 867
-# define BOOST_PP_INC_867 868
-# define BOOST_PP_INC_868 869
-# define BOOST_PP_INC_869 870
-# define BOOST_PP_INC_870 871
-# define BOOST_PP_INC_871 872
-# define BOOST_PP_INC_872 873
-# define BOOST_PP_INC_873 874
-# define BOOST_PP_INC_874 875
-# define BOOST_PP_INC_875 876
-# define BOOST_PP_INC_876 877
-# define BOOST_PP_INC_877 878
-# define BOOST_PP_INC_878 879
-# define BOOST_PP_INC_879 880
-# define BOOST_PP_INC_880 881
-# define BOOST_PP_INC_881 882
-# define BOOST_PP_INC_882 883
-# define BOOST_PP_INC_883 884
-# define BOOST_PP_INC_884 885
-# define BOOST_PP_INC_885 886
-# define BOOST_PP_INC_886 887
-# define BOOST_PP_INC_887 888
-# define BOOST_PP_INC_888 889
-# define BOOST_PP_INC_889 890
-# define BOOST_PP_INC_890 891
-# define BOOST_PP_INC_891 892
-# define BOOST_PP_INC_892 893
-# define BOOST_PP_INC_893 894
-# define BOOST_PP_INC_894 895
-# define BOOST_PP_INC_895 896
-# define BOOST_PP_INC_896 897
-# define BOOST_PP_INC_897 898
-# define BOOST_PP_INC_898 899
-# define BOOST_PP_INC_899 900
-# define BOOST_PP_INC_900 901
-# define BOOST_PP_INC_901 902
-# define BOOST_PP_INC_902 903
-# define BOOST_PP_INC_903 904
-# define BOOST_PP_INC_904 905
-# define BOOST_PP_INC_905 906
-# define BOOST_PP_INC_906 907
-# define BOOST_PP_INC_907 908
-# define BOOST_PP_INC_908 909
-# define BOOST_PP_INC_909 910
-# define BOOST_PP_INC_910 911
-# define BOOST_PP_INC_911 912
-# define BOOST_PP_INC_912 913
-# define BOOST_PP_INC_913 914
-# define BOOST_PP_INC_914 915
-# define BOOST_PP_INC_915 916
-# define BOOST_PP_INC_916 917
-# define BOOST_PP_INC_917 918
-# define BOOST_PP_INC_918 919
-# define BOOST_PP_INC_919 920
-# define BOOST_PP_INC_920 921
-# define BOOST_PP_INC_921 922
-# define BOOST_PP_INC_922 923
-# define BOOST_PP_INC_923 924
-# define BOOST_PP_INC_924 925
-# define BOOST_PP_INC_925 926
-# define BOOST_PP_INC_926 927
-# define BOOST_PP_INC_927 928
-# define BOOST_PP_INC_928 929
-# define BOOST_PP_INC_929 930
-# define BOOST_PP_INC_930 931
-# define BOOST_PP_INC_931 932
-# define BOOST_PP_INC_932 933
-# define BOOST_PP_INC_933 934
-# define BOOST_PP_INC_934 935
-# define BOOST_PP_INC_935 936
-# define BOOST_PP_INC_936 937
-# define BOOST_PP_INC_937 938
-# define BOOST_PP_INC_938 939
-# define BOOST_PP_INC_939 940
-# define BOOST_PP_INC_940 941
-# define BOOST_PP_INC_941 942
-# define BOOST_PP_INC_942 943
-# define BOOST_PP_INC_943 944
-# define BOOST_PP_INC_944 945
-# define BOOST_PP_INC_945 946
-# define BOOST_PP_INC_946 947
-# define BOOST_PP_INC_947 948
-# define BOOST_PP_INC_948 949
-# define BOOST_PP_INC_949 950
-# define BOOST_PP_INC_950 951
-# define BOOST_PP_INC_951 952
-# define BOOST_PP_INC_952 953
-# define BOOST_PP_INC_953 954
-# define BOOST_PP_INC_954 955
-# define BOOST_PP_INC_955 956
-# define BOOST_PP_INC_956 957
-# define BOOST_PP_INC_957 958
-# define BOOST_PP_INC_958 959
-# define BOOST_PP_INC_959 960
-# define BOOST_PP_INC_960 961
-# define BOOST_PP_INC_961 962
-# define BOOST_PP_INC_962 963
-# define BOOST_PP_INC_963 964
-# define BOOST_PP_INC_964 965
-# define BOOST_PP_INC_965 966
-# define BOOST_PP_INC_966 967
-# define BOOST_PP_INC_967 968
-# define BOOST_PP_INC_968 969
-# define BOOST_PP_INC_969 970
-# define BOOST_PP_INC_970 971
-# define BOOST_PP_INC_971 972
-# define BOOST_PP_INC_972 973
-# define BOOST_PP_INC_973 974
-# define BOOST_PP_INC_974 975
-# define BOOST_PP_INC_975 976
-# define BOOST_PP_INC_976 977
-# define BOOST_PP_INC_977 978
-# define BOOST_PP_INC_978 979
-# define BOOST_PP_INC_979 980
-# define BOOST_PP_INC_980 981
-# define BOOST_PP_INC_981 982
-# define BOOST_PP_INC_982 983
-# define BOOST_PP_INC_983 984
-# define BOOST_PP_INC_984 985
-# define BOOST_PP_INC_985 986
-# define BOOST_PP_INC_986 987
-# define BOOST_PP_INC_987 988
-# define BOOST_PP_INC_988 989
-# define BOOST_PP_INC_989 990
-# define BOOST_PP_INC_990 991
-# define BOOST_PP_INC_991 992
-# define BOOST_PP_INC_992 993
-# define BOOST_PP_INC_993 994
-# define BOOST_PP_INC_994 995
-# define BOOST_PP_INC_995 996
-# define BOOST_PP_INC_996 997
-# define BOOST_PP_INC_997 998
-# define BOOST_PP_INC_998 999
-# define BOOST_PP_INC_999 1000
-# define BOOST_PP_INC_1000 1001
-# define BOOST_PP_INC_1001 1002
-# define BOOST_PP_INC_1002 1003
-# define BOOST_PP_INC_1003 1004
-# define BOOST_PP_INC_1004 1005
-# define BOOST_PP_INC_1005 1006
-# define BOOST_PP_INC_1006 1007
-# define BOOST_PP_INC_1007 1008
-# define BOOST_PP_INC_1008 1009
-# define BOOST_PP_INC_1009 1010
-# define BOOST_PP_INC_1010 1011
-# define BOOST_PP_INC_1011 1012
-# define BOOST_PP_INC_1012 1013
-# define BOOST_PP_INC_1013 1014
-# define BOOST_PP_INC_1014 1015
-# define BOOST_PP_INC_1015 1016
-# define BOOST_PP_INC_1016 1017
-# define BOOST_PP_INC_1017 1018
-# define BOOST_PP_INC_1018 1019
-# define BOOST_PP_INC_1019 1020
-# define BOOST_PP_INC_1020 1021
-# define BOOST_PP_INC_1021 1022
-# define BOOST_PP_INC_1022 1023
-# define BOOST_PP_INC_1023 1024
-# define BOOST_PP_INC_1024 1024
-#
-# endif
@@ -1,280 +0,0 @@
-# /* Copyright (C) 2001
-#  * Housemarque Oy
-#  * http://www.housemarque.com
-#  *
-#  * Distributed under the Boost Software License, Version 1.0. (See
-#  * accompanying file LICENSE_1_0.txt or copy at
-#  * http://www.boost.org/LICENSE_1_0.txt)
-#  */
-#
-# /* Revised by Paul Mensonides (2002) */
-# /* Revised by Edward Diener (2020) */
-#
-# /* See http://www.boost.org for most recent version. */
-#
-# ifndef BOOST_PREPROCESSOR_ARITHMETIC_INC_512_HPP
-# define BOOST_PREPROCESSOR_ARITHMETIC_INC_512_HPP
-#
-# if defined(BOOST_PP_INC_256)
-# undef BOOST_PP_INC_256
-# endif
-#
-# define BOOST_PP_INC_256 257
-# define BOOST_PP_INC_257 258
-# define BOOST_PP_INC_258 259
-# define BOOST_PP_INC_259 260
-# define BOOST_PP_INC_260 261
-# define BOOST_PP_INC_261 262
-# define BOOST_PP_INC_262 263
-# define BOOST_PP_INC_263 264
-# define BOOST_PP_INC_264 265
-# define BOOST_PP_INC_265 266
-# define BOOST_PP_INC_266 267
-# define BOOST_PP_INC_267 268
-# define BOOST_PP_INC_268 269
-# define BOOST_PP_INC_269 270
-# define BOOST_PP_INC_270 271
-# define BOOST_PP_INC_271 272
-# define BOOST_PP_INC_272 273
-# define BOOST_PP_INC_273 274
-# define BOOST_PP_INC_274 275
-# define BOOST_PP_INC_275 276
-# define BOOST_PP_INC_276 277
-# define BOOST_PP_INC_277 278
-# define BOOST_PP_INC_278 279
-# define BOOST_PP_INC_279 280
-# define BOOST_PP_INC_280 281
-# define BOOST_PP_INC_281 282
-# define BOOST_PP_INC_282 283
-# define BOOST_PP_INC_283 284
-# define BOOST_PP_INC_284 285
-# define BOOST_PP_INC_285 286
-# define BOOST_PP_INC_286 287
-# define BOOST_PP_INC_287 288
-# define BOOST_PP_INC_288 289
-# define BOOST_PP_INC_289 290
-# define BOOST_PP_INC_290 291
-# define BOOST_PP_INC_291 292
-# define BOOST_PP_INC_292 293
-# define BOOST_PP_INC_293 294
-# define BOOST_PP_INC_294 295
-# define BOOST_PP_INC_295 296
-# define BOOST_PP_INC_296 297
-# define BOOST_PP_INC_297 298
-# define BOOST_PP_INC_298 299
-# define BOOST_PP_INC_299 300
-# define BOOST_PP_INC_300 301
-# define BOOST_PP_INC_301 302
-# define BOOST_PP_INC_302 303
-# define BOOST_PP_INC_303 304
-# define BOOST_PP_INC_304 305
-# define BOOST_PP_INC_305 306
-# define BOOST_PP_INC_306 307
-# define BOOST_PP_INC_307 308
-# define BOOST_PP_INC_308 309
-# define BOOST_PP_INC_309 310
-# define BOOST_PP_INC_310 311
-# define BOOST_PP_INC_311 312
-# define BOOST_PP_INC_312 313
-# define BOOST_PP_INC_313 314
-# define BOOST_PP_INC_314 315
-# define BOOST_PP_INC_315 316
-# define BOOST_PP_INC_316 317
-# define BOOST_PP_INC_317 318
-# define BOOST_PP_INC_318 319
-# define BOOST_PP_INC_319 320
-# define BOOST_PP_INC_320 321
-# define BOOST_PP_INC_321 322
-# define BOOST_PP_INC_322 323
-# define BOOST_PP_INC_323 324
-# define BOOST_PP_INC_324 325
-# define BOOST_PP_INC_325 326
-# define BOOST_PP_INC_326 327
-# define BOOST_PP_INC_327 328
-# define BOOST_PP_INC_328 329
-# define BOOST_PP_INC_329 330
-# define BOOST_PP_INC_330 331
-# define BOOST_PP_INC_331 332
-# define BOOST_PP_INC_332 333
-# define BOOST_PP_INC_333 334
-# define BOOST_PP_INC_334 335
-# define BOOST_PP_INC_335 336
-# define BOOST_PP_INC_336 337
-# define BOOST_PP_INC_337 338
-# define BOOST_PP_INC_338 339
-# define BOOST_PP_INC_339 340
-# define BOOST_PP_INC_340 341
-# define BOOST_PP_INC_341 342
-# define BOOST_PP_INC_342 343
-# define BOOST_PP_INC_343 344
-# define BOOST_PP_INC_344 345
-# define BOOST_PP_INC_345 346
-# define BOOST_PP_INC_346 347
-# define BOOST_PP_INC_347 348
-# define BOOST_PP_INC_348 349
-# define BOOST_PP_INC_349 350
-# define BOOST_PP_INC_350 351
-# define BOOST_PP_INC_351 352
-# define BOOST_PP_INC_352 353
-# define BOOST_PP_INC_353 354
-# define BOOST_PP_INC_354 355
-# define BOOST_PP_INC_355 356
-# define BOOST_PP_INC_356 357
-# define BOOST_PP_INC_357 358
-# define BOOST_PP_INC_358 359
-# define BOOST_PP_INC_359 360
-# define BOOST_PP_INC_360 361
-# define BOOST_PP_INC_361 362
-# define BOOST_PP_INC_362 363
-# define BOOST_PP_INC_363 364
-# define BOOST_PP_INC_364 365
-# define BOOST_PP_INC_365 366
-# define BOOST_PP_INC_366 367
-# define BOOST_PP_INC_367 368
-# define BOOST_PP_INC_368 369
-# define BOOST_PP_INC_369 370
-# define BOOST_PP_INC_370 371
-# define BOOST_PP_INC_371 372
-# define BOOST_PP_INC_372 373
-# define BOOST_PP_INC_373 374
-# define BOOST_PP_INC_374 375
-# define BOOST_PP_INC_375 376
-# define BOOST_PP_INC_376 377
-# define BOOST_PP_INC_377 378
-# define BOOST_PP_INC_378 379
-# define BOOST_PP_INC_379 380
-# define BOOST_PP_INC_380 381
-# define BOOST_PP_INC_381 382
-# define BOOST_PP_INC_382 383
-# define BOOST_PP_INC_383 384
-# define BOOST_PP_INC_384 385
-# define BOOST_PP_INC_385 386
-# define BOOST_PP_INC_386 387
-# define BOOST_PP_INC_387 388
-# define BOOST_PP_INC_388 389
-# define BOOST_PP_INC_389 390
-# define BOOST_PP_INC_390 391
-# define BOOST_PP_INC_391 392
-# define BOOST_PP_INC_392 393
-# define BOOST_PP_INC_393 394
-# define BOOST_PP_INC_394 395
-# define BOOST_PP_INC_395 396
-# define BOOST_PP_INC_396 397
-# define BOOST_PP_INC_397 398
-# define BOOST_PP_INC_398 399
-# define BOOST_PP_INC_399 400
-# define BOOST_PP_INC_400 401
-# define BOOST_PP_INC_401 402
-# define BOOST_PP_INC_402 403
-# define BOOST_PP_INC_403 404
-# define BOOST_PP_INC_404 405
-# define BOOST_PP_INC_405 406
-# define BOOST_PP_INC_406 407
-# define BOOST_PP_INC_407 408
-# define BOOST_PP_INC_408 409
-# define BOOST_PP_INC_409 410
-# define BOOST_PP_INC_410 411
-# define BOOST_PP_INC_411 412
-# define BOOST_PP_INC_412 413
-# define BOOST_PP_INC_413 414
-# define BOOST_PP_INC_414 415
-# define BOOST_PP_INC_415 416
-# define BOOST_PP_INC_416 417
-# define BOOST_PP_INC_417 418
-# define BOOST_PP_INC_418 419
-# define BOOST_PP_INC_419 420
-# define BOOST_PP_INC_420 421
-# define BOOST_PP_INC_421 422
-# define BOOST_PP_INC_422 423
-# define BOOST_PP_INC_423 424
-# define BOOST_PP_INC_424 425
-# define BOOST_PP_INC_425 426
-# define BOOST_PP_INC_426 427
-# define BOOST_PP_INC_427 428
-# define BOOST_PP_INC_428 429
-# define BOOST_PP_INC_429 430
-# define BOOST_PP_INC_430 431
-# define BOOST_PP_INC_431 432
-# define BOOST_PP_INC_432 433
-# define BOOST_PP_INC_433 434
-# define BOOST_PP_INC_434 435
-# define BOOST_PP_INC_435 436
-# define BOOST_PP_INC_436 437
-# define BOOST_PP_INC_437 438
-# define BOOST_PP_INC_438 439
-# define BOOST_PP_INC_439 440
-# define BOOST_PP_INC_440 441
-# define BOOST_PP_INC_441 442
-# define BOOST_PP_INC_442 443
-# define BOOST_PP_INC_443 444
-# define BOOST_PP_INC_444 445
-# define BOOST_PP_INC_445 446
-# define BOOST_PP_INC_446 447
-# define BOOST_PP_INC_447 448
-# define BOOST_PP_INC_448 449
-# define BOOST_PP_INC_449 450
-# define BOOST_PP_INC_450 451
-# define BOOST_PP_INC_451 452
-# define BOOST_PP_INC_452 453
-# define BOOST_PP_INC_453 454
-# define BOOST_PP_INC_454 455
-# define BOOST_PP_INC_455 456
-# define BOOST_PP_INC_456 457
-# define BOOST_PP_INC_457 458
-# define BOOST_PP_INC_458 459
-# define BOOST_PP_INC_459 460
-# define BOOST_PP_INC_460 461
-# define BOOST_PP_INC_461 462
-# define BOOST_PP_INC_462 463
-# define BOOST_PP_INC_463 464
-# define BOOST_PP_INC_464 465
-# define BOOST_PP_INC_465 466
-# define BOOST_PP_INC_466 467
-# define BOOST_PP_INC_467 468
-# define BOOST_PP_INC_468 469
-# define BOOST_PP_INC_469 470
-# define BOOST_PP_INC_470 471
-# define BOOST_PP_INC_471 472
-# define BOOST_PP_INC_472 473
-# define BOOST_PP_INC_473 474
-# define BOOST_PP_INC_474 475
-# define BOOST_PP_INC_475 476
-# define BOOST_PP_INC_476 477
-# define BOOST_PP_INC_477 478
-# define BOOST_PP_INC_478 479
-# define BOOST_PP_INC_479 480
-# define BOOST_PP_INC_480 481
-# define BOOST_PP_INC_481 482
-# define BOOST_PP_INC_482 483
-# define BOOST_PP_INC_483 484
-# define BOOST_PP_INC_484 485
-# define BOOST_PP_INC_485 486
-# define BOOST_PP_INC_486 487
-# define BOOST_PP_INC_487 488
-# define BOOST_PP_INC_488 489
-# define BOOST_PP_INC_489 490
-# define BOOST_PP_INC_490 491
-# define BOOST_PP_INC_491 492
-# define BOOST_PP_INC_492 493
-# define BOOST_PP_INC_493 494
-# define BOOST_PP_INC_494 495
-# define BOOST_PP_INC_495 496
-# define BOOST_PP_INC_496 497
-# define BOOST_PP_INC_497 498
-# define BOOST_PP_INC_498 499
-# define BOOST_PP_INC_499 500
-# define BOOST_PP_INC_500 501
-# define BOOST_PP_INC_501 502
-# define BOOST_PP_INC_502 503
-# define BOOST_PP_INC_503 504
-# define BOOST_PP_INC_504 505
-# define BOOST_PP_INC_505 506
-# define BOOST_PP_INC_506 507
-# define BOOST_PP_INC_507 508
-# define BOOST_PP_INC_508 509
-# define BOOST_PP_INC_509 510
-# define BOOST_PP_INC_510 511
-# define BOOST_PP_INC_511 512
-# define BOOST_PP_INC_512 512
-#
-# endif
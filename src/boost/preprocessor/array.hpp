@@ -1,32 +0,0 @@
-# /* **************************************************************************
-#  *                                                                          *
-#  *     (C) Copyright Paul Mensonides 2002-2011.                             *
-#  *     (C) Copyright Edward Diener 2011.                                    *
-#  *     Distributed under the Boost Software License, Version 1.0. (See      *
-#  *     accompanying file LICENSE_1_0.txt or copy at                         *
-#  *     http://www.boost.org/LICENSE_1_0.txt)                                *
-#  *                                                                          *
-#  ************************************************************************** */
-#
-# /* See http://www.boost.org for most recent version. */
-#
-# ifndef BOOST_PREPROCESSOR_ARRAY_HPP
-# define BOOST_PREPROCESSOR_ARRAY_HPP
-#
-# include <boost/preprocessor/array/data.hpp>
-# include <boost/preprocessor/array/elem.hpp>
-# include <boost/preprocessor/array/enum.hpp>
-# include <boost/preprocessor/array/insert.hpp>
-# include <boost/preprocessor/array/pop_back.hpp>
-# include <boost/preprocessor/array/pop_front.hpp>
-# include <boost/preprocessor/array/push_back.hpp>
-# include <boost/preprocessor/array/push_front.hpp>
-# include <boost/preprocessor/array/remove.hpp>
-# include <boost/preprocessor/array/replace.hpp>
-# include <boost/preprocessor/array/reverse.hpp>
-# include <boost/preprocessor/array/size.hpp>
-# include <boost/preprocessor/array/to_list.hpp>
-# include <boost/preprocessor/array/to_seq.hpp>
-# include <boost/preprocessor/array/to_tuple.hpp>
-#
-# endif
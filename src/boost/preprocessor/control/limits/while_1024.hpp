@@ -1,531 +0,0 @@
-# /* Copyright (C) 2001
-#  * Housemarque Oy
-#  * http://www.housemarque.com
-#  *
-#  * Distributed under the Boost Software License, Version 1.0. (See
-#  * accompanying file LICENSE_1_0.txt or copy at
-#  * http://www.boost.org/LICENSE_1_0.txt)
-#  */
-#
-# /* Revised by Paul Mensonides (2002) */
-# /* Revised by Edward Diener (2020) */
-#
-# /* See http://www.boost.org for most recent version. */
-#
-# ifndef BOOST_PREPROCESSOR_CONTROL_WHILE_1024_HPP
-# define BOOST_PREPROCESSOR_CONTROL_WHILE_1024_HPP
-#
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_513(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_514(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_515(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_516(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_517(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_518(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_519(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_520(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_521(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_522(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_523(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_524(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_525(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_526(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_527(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_528(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_529(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_530(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_531(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_532(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_533(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_534(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_535(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_536(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_537(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_538(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_539(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_540(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_541(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_542(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_543(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_544(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_545(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_546(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_547(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_548(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_549(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_550(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_551(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_552(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_553(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_554(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_555(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_556(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_557(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_558(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_559(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_560(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_561(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_562(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_563(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_564(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_565(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_566(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_567(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_568(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_569(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_570(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_571(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_572(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_573(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_574(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_575(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_576(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_577(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_578(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_579(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_580(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_581(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_582(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_583(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_584(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_585(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_586(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_587(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_588(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_589(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_590(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_591(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_592(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_593(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_594(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_595(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_596(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_597(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_598(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_599(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_600(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_601(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_602(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_603(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_604(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_605(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_606(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_607(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_608(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_609(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_610(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_611(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_612(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_613(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_614(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_615(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_616(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_617(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_618(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_619(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_620(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_621(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_622(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_623(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_624(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_625(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_626(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_627(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_628(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_629(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_630(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_631(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_632(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_633(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_634(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_635(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_636(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_637(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_638(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_639(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_640(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_641(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_642(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_643(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_644(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_645(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_646(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_647(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_648(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_649(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_650(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_651(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_652(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_653(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_654(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_655(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_656(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_657(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_658(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_659(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_660(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_661(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_662(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_663(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_664(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_665(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_666(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_667(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_668(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_669(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_670(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_671(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_672(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_673(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_674(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_675(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_676(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_677(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_678(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_679(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_680(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_681(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_682(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_683(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_684(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_685(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_686(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_687(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_688(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_689(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_690(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_691(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_692(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_693(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_694(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_695(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_696(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_697(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_698(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_699(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_700(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_701(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_702(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_703(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_704(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_705(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_706(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_707(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_708(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_709(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_710(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_711(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_712(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_713(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_714(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_715(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_716(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_717(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_718(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_719(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_720(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_721(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_722(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_723(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_724(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_725(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_726(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_727(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_728(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_729(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_730(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_731(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_732(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_733(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_734(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_735(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_736(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_737(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_738(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_739(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_740(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_741(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_742(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_743(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_744(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_745(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_746(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_747(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_748(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_749(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_750(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_751(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_752(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_753(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_754(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_755(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_756(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_757(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_758(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_759(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_760(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_761(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_762(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_763(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_764(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_765(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_766(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_767(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_768(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_769(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_770(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_771(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_772(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_773(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_774(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_775(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_776(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_777(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_778(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_779(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_780(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_781(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_782(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_783(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_784(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_785(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_786(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_787(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_788(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_789(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_790(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_791(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_792(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_793(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_794(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_795(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_796(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_797(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_798(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_799(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_800(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_801(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_802(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_803(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_804(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_805(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_806(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_807(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_808(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_809(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_810(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_811(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_812(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_813(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_814(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_815(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_816(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_817(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_818(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_819(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_820(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_821(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_822(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_823(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_824(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_825(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_826(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_827(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_828(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_829(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_830(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_831(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_832(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_833(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_834(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_835(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_836(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_837(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_838(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_839(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_840(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_841(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_842(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_843(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_844(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_845(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_846(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_847(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_848(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_849(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_850(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_851(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_852(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_853(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_854(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_855(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_856(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_857(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_858(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_859(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_860(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_861(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_862(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_863(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_864(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_865(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_866(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_867(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_868(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_869(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_870(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_871(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_872(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_873(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_874(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_875(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_876(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_877(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_878(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_879(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_880(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_881(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_882(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_883(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_884(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_885(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_886(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_887(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_888(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_889(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_890(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_891(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_892(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_893(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_894(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_895(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_896(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_897(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_898(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_899(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_900(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_901(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_902(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_903(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_904(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_905(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_906(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_907(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_908(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_909(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_910(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_911(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_912(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_913(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_914(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_915(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_916(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_917(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_918(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_919(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_920(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_921(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_922(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_923(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_924(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_925(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_926(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_927(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_928(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_929(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_930(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_931(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_932(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_933(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_934(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_935(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_936(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_937(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_938(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_939(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_940(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_941(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_942(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_943(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_944(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_945(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_946(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_947(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_948(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_949(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_950(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_951(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_952(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_953(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_954(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_955(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_956(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_957(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_958(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_959(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_960(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_961(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_962(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_963(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_964(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_965(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_966(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_967(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_968(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_969(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_970(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_971(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_972(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_973(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_974(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_975(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_976(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_977(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_978(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_979(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_980(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_981(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_982(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_983(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_984(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_985(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_986(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_987(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_988(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_989(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_990(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_991(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_992(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_993(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_994(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_995(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_996(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_997(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_998(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_999(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1000(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1001(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1002(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1003(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1004(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1005(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1006(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1007(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1008(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1009(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1010(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1011(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1012(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1013(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1014(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1015(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1016(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1017(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1018(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1019(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1020(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1021(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1022(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1023(p, o, s) 0
-# define BOOST_PP_WHILE_CHECK_BOOST_PP_WHILE_1024(p, o, s) 0
-#
-# endif
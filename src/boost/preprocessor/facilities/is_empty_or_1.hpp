@@ -1,31 +0,0 @@
-# /* **************************************************************************
-#  *                                                                          *
-#  *     (C) Copyright Paul Mensonides 2003.
-#  *     Distributed under the Boost Software License, Version 1.0. (See
-#  *     accompanying file LICENSE_1_0.txt or copy at
-#  *     http://www.boost.org/LICENSE_1_0.txt)
-#  *                                                                          *
-#  ************************************************************************** */
-#
-# /* See http://www.boost.org for most recent version. */
-#
-# ifndef BOOST_PREPROCESSOR_FACILITIES_IS_EMPTY_OR_1_HPP
-# define BOOST_PREPROCESSOR_FACILITIES_IS_EMPTY_OR_1_HPP
-#
-# include <boost/preprocessor/control/iif.hpp>
-# include <boost/preprocessor/facilities/empty.hpp>
-# include <boost/preprocessor/facilities/identity.hpp>
-# include <boost/preprocessor/facilities/is_1.hpp>
-# include <boost/preprocessor/facilities/is_empty.hpp>
-#
-# /* BOOST_PP_IS_EMPTY_OR_1 */
-#
-# define BOOST_PP_IS_EMPTY_OR_1(x) \
-    BOOST_PP_IIF( \
-        BOOST_PP_IS_EMPTY(x BOOST_PP_EMPTY()), \
-        BOOST_PP_IDENTITY(1), \
-        BOOST_PP_IS_1 \
-    )(x) \
-    /**/
-#
-# endif
@@ -1,1549 +0,0 @@
-# /* **************************************************************************
-#  *                                                                          *
-#  *     (C) Copyright Paul Mensonides 2002.
-#  *     Distributed under the Boost Software License, Version 1.0. (See
-#  *     accompanying file LICENSE_1_0.txt or copy at
-#  *     http://www.boost.org/LICENSE_1_0.txt)
-#  *                                                                          *
-#  ************************************************************************** */
-#
-# /* Revised by Edward Diener (2020) */
-#
-# /* See http://www.boost.org for most recent version. */
-#
-# if BOOST_PP_LOCAL_R(1024)
-    BOOST_PP_LOCAL_MACRO(1024)
-# endif
-# if BOOST_PP_LOCAL_R(1023)
-    BOOST_PP_LOCAL_MACRO(1023)
-# endif
-# if BOOST_PP_LOCAL_R(1022)
-    BOOST_PP_LOCAL_MACRO(1022)
-# endif
-# if BOOST_PP_LOCAL_R(1021)
-    BOOST_PP_LOCAL_MACRO(1021)
-# endif
-# if BOOST_PP_LOCAL_R(1020)
-    BOOST_PP_LOCAL_MACRO(1020)
-# endif
-# if BOOST_PP_LOCAL_R(1019)
-    BOOST_PP_LOCAL_MACRO(1019)
-# endif
-# if BOOST_PP_LOCAL_R(1018)
-    BOOST_PP_LOCAL_MACRO(1018)
-# endif
-# if BOOST_PP_LOCAL_R(1017)
-    BOOST_PP_LOCAL_MACRO(1017)
-# endif
-# if BOOST_PP_LOCAL_R(1016)
-    BOOST_PP_LOCAL_MACRO(1016)
-# endif
-# if BOOST_PP_LOCAL_R(1015)
-    BOOST_PP_LOCAL_MACRO(1015)
-# endif
-# if BOOST_PP_LOCAL_R(1014)
-    BOOST_PP_LOCAL_MACRO(1014)
-# endif
-# if BOOST_PP_LOCAL_R(1013)
-    BOOST_PP_LOCAL_MACRO(1013)
-# endif
-# if BOOST_PP_LOCAL_R(1012)
-    BOOST_PP_LOCAL_MACRO(1012)
-# endif
-# if BOOST_PP_LOCAL_R(1011)
-    BOOST_PP_LOCAL_MACRO(1011)
-# endif
-# if BOOST_PP_LOCAL_R(1010)
-    BOOST_PP_LOCAL_MACRO(1010)
-# endif
-# if BOOST_PP_LOCAL_R(1009)
-    BOOST_PP_LOCAL_MACRO(1009)
-# endif
-# if BOOST_PP_LOCAL_R(1008)
-    BOOST_PP_LOCAL_MACRO(1008)
-# endif
-# if BOOST_PP_LOCAL_R(1007)
-    BOOST_PP_LOCAL_MACRO(1007)
-# endif
-# if BOOST_PP_LOCAL_R(1006)
-    BOOST_PP_LOCAL_MACRO(1006)
-# endif
-# if BOOST_PP_LOCAL_R(1005)
-    BOOST_PP_LOCAL_MACRO(1005)
-# endif
-# if BOOST_PP_LOCAL_R(1004)
-    BOOST_PP_LOCAL_MACRO(1004)
-# endif
-# if BOOST_PP_LOCAL_R(1003)
-    BOOST_PP_LOCAL_MACRO(1003)
-# endif
-# if BOOST_PP_LOCAL_R(1002)
-    BOOST_PP_LOCAL_MACRO(1002)
-# endif
-# if BOOST_PP_LOCAL_R(1001)
-    BOOST_PP_LOCAL_MACRO(1001)
-# endif
-# if BOOST_PP_LOCAL_R(1000)
-    BOOST_PP_LOCAL_MACRO(1000)
-# endif
-# if BOOST_PP_LOCAL_R(999)
-    BOOST_PP_LOCAL_MACRO(999)
-# endif
-# if BOOST_PP_LOCAL_R(998)
-    BOOST_PP_LOCAL_MACRO(998)
-# endif
-# if BOOST_PP_LOCAL_R(997)
-    BOOST_PP_LOCAL_MACRO(997)
-# endif
-# if BOOST_PP_LOCAL_R(996)
-    BOOST_PP_LOCAL_MACRO(996)
-# endif
-# if BOOST_PP_LOCAL_R(995)
-    BOOST_PP_LOCAL_MACRO(995)
-# endif
-# if BOOST_PP_LOCAL_R(994)
-    BOOST_PP_LOCAL_MACRO(994)
-# endif
-# if BOOST_PP_LOCAL_R(993)
-    BOOST_PP_LOCAL_MACRO(993)
-# endif
-# if BOOST_PP_LOCAL_R(992)
-    BOOST_PP_LOCAL_MACRO(992)
-# endif
-# if BOOST_PP_LOCAL_R(991)
-    BOOST_PP_LOCAL_MACRO(991)
-# endif
-# if BOOST_PP_LOCAL_R(990)
-    BOOST_PP_LOCAL_MACRO(990)
-# endif
-# if BOOST_PP_LOCAL_R(989)
-    BOOST_PP_LOCAL_MACRO(989)
-# endif
-# if BOOST_PP_LOCAL_R(988)
-    BOOST_PP_LOCAL_MACRO(988)
-# endif
-# if BOOST_PP_LOCAL_R(987)
-    BOOST_PP_LOCAL_MACRO(987)
-# endif
-# if BOOST_PP_LOCAL_R(986)
-    BOOST_PP_LOCAL_MACRO(986)
-# endif
-# if BOOST_PP_LOCAL_R(985)
-    BOOST_PP_LOCAL_MACRO(985)
-# endif
-# if BOOST_PP_LOCAL_R(984)
-    BOOST_PP_LOCAL_MACRO(984)
-# endif
-# if BOOST_PP_LOCAL_R(983)
-    BOOST_PP_LOCAL_MACRO(983)
-# endif
-# if BOOST_PP_LOCAL_R(982)
-    BOOST_PP_LOCAL_MACRO(982)
-# endif
-# if BOOST_PP_LOCAL_R(981)
-    BOOST_PP_LOCAL_MACRO(981)
-# endif
-# if BOOST_PP_LOCAL_R(980)
-    BOOST_PP_LOCAL_MACRO(980)
-# endif
-# if BOOST_PP_LOCAL_R(979)
-    BOOST_PP_LOCAL_MACRO(979)
-# endif
-# if BOOST_PP_LOCAL_R(978)
-    BOOST_PP_LOCAL_MACRO(978)
-# endif
-# if BOOST_PP_LOCAL_R(977)
-    BOOST_PP_LOCAL_MACRO(977)
-# endif
-# if BOOST_PP_LOCAL_R(976)
-    BOOST_PP_LOCAL_MACRO(976)
-# endif
-# if BOOST_PP_LOCAL_R(975)
-    BOOST_PP_LOCAL_MACRO(975)
-# endif
-# if BOOST_PP_LOCAL_R(974)
-    BOOST_PP_LOCAL_MACRO(974)
-# endif
-# if BOOST_PP_LOCAL_R(973)
-    BOOST_PP_LOCAL_MACRO(973)
-# endif
-# if BOOST_PP_LOCAL_R(972)
-    BOOST_PP_LOCAL_MACRO(972)
-# endif
-# if BOOST_PP_LOCAL_R(971)
-    BOOST_PP_LOCAL_MACRO(971)
-# endif
-# if BOOST_PP_LOCAL_R(970)
-    BOOST_PP_LOCAL_MACRO(970)
-# endif
-# if BOOST_PP_LOCAL_R(969)
-    BOOST_PP_LOCAL_MACRO(969)
-# endif
-# if BOOST_PP_LOCAL_R(968)
-    BOOST_PP_LOCAL_MACRO(968)
-# endif
-# if BOOST_PP_LOCAL_R(967)
-    BOOST_PP_LOCAL_MACRO(967)
-# endif
-# if BOOST_PP_LOCAL_R(966)
-    BOOST_PP_LOCAL_MACRO(966)
-# endif
-# if BOOST_PP_LOCAL_R(965)
-    BOOST_PP_LOCAL_MACRO(965)
-# endif
-# if BOOST_PP_LOCAL_R(964)
-    BOOST_PP_LOCAL_MACRO(964)
-# endif
-# if BOOST_PP_LOCAL_R(963)
-    BOOST_PP_LOCAL_MACRO(963)
-# endif
-# if BOOST_PP_LOCAL_R(962)
-    BOOST_PP_LOCAL_MACRO(962)
-# endif
-# if BOOST_PP_LOCAL_R(961)
-    BOOST_PP_LOCAL_MACRO(961)
-# endif
-# if BOOST_PP_LOCAL_R(960)
-    BOOST_PP_LOCAL_MACRO(960)
-# endif
-# if BOOST_PP_LOCAL_R(959)
-    BOOST_PP_LOCAL_MACRO(959)
-# endif
-# if BOOST_PP_LOCAL_R(958)
-    BOOST_PP_LOCAL_MACRO(958)
-# endif
-# if BOOST_PP_LOCAL_R(957)
-    BOOST_PP_LOCAL_MACRO(957)
-# endif
-# if BOOST_PP_LOCAL_R(956)
-    BOOST_PP_LOCAL_MACRO(956)
-# endif
-# if BOOST_PP_LOCAL_R(955)
-    BOOST_PP_LOCAL_MACRO(955)
-# endif
-# if BOOST_PP_LOCAL_R(954)
-    BOOST_PP_LOCAL_MACRO(954)
-# endif
-# if BOOST_PP_LOCAL_R(953)
-    BOOST_PP_LOCAL_MACRO(953)
-# endif
-# if BOOST_PP_LOCAL_R(952)
-    BOOST_PP_LOCAL_MACRO(952)
-# endif
-# if BOOST_PP_LOCAL_R(951)
-    BOOST_PP_LOCAL_MACRO(951)
-# endif
-# if BOOST_PP_LOCAL_R(950)
-    BOOST_PP_LOCAL_MACRO(950)
-# endif
-# if BOOST_PP_LOCAL_R(949)
-    BOOST_PP_LOCAL_MACRO(949)
-# endif
-# if BOOST_PP_LOCAL_R(948)
-    BOOST_PP_LOCAL_MACRO(948)
-# endif
-# if BOOST_PP_LOCAL_R(947)
-    BOOST_PP_LOCAL_MACRO(947)
-# endif
-# if BOOST_PP_LOCAL_R(946)
-    BOOST_PP_LOCAL_MACRO(946)
-# endif
-# if BOOST_PP_LOCAL_R(945)
-    BOOST_PP_LOCAL_MACRO(945)
-# endif
-# if BOOST_PP_LOCAL_R(944)
-    BOOST_PP_LOCAL_MACRO(944)
-# endif
-# if BOOST_PP_LOCAL_R(943)
-    BOOST_PP_LOCAL_MACRO(943)
-# endif
-# if BOOST_PP_LOCAL_R(942)
-    BOOST_PP_LOCAL_MACRO(942)
-# endif
-# if BOOST_PP_LOCAL_R(941)
-    BOOST_PP_LOCAL_MACRO(941)
-# endif
-# if BOOST_PP_LOCAL_R(940)
-    BOOST_PP_LOCAL_MACRO(940)
-# endif
-# if BOOST_PP_LOCAL_R(939)
-    BOOST_PP_LOCAL_MACRO(939)
-# endif
-# if BOOST_PP_LOCAL_R(938)
-    BOOST_PP_LOCAL_MACRO(938)
-# endif
-# if BOOST_PP_LOCAL_R(937)
-    BOOST_PP_LOCAL_MACRO(937)
-# endif
-# if BOOST_PP_LOCAL_R(936)
-    BOOST_PP_LOCAL_MACRO(936)
-# endif
-# if BOOST_PP_LOCAL_R(935)
-    BOOST_PP_LOCAL_MACRO(935)
-# endif
-# if BOOST_PP_LOCAL_R(934)
-    BOOST_PP_LOCAL_MACRO(934)
-# endif
-# if BOOST_PP_LOCAL_R(933)
-    BOOST_PP_LOCAL_MACRO(933)
-# endif
-# if BOOST_PP_LOCAL_R(932)
-    BOOST_PP_LOCAL_MACRO(932)
-# endif
-# if BOOST_PP_LOCAL_R(931)
-    BOOST_PP_LOCAL_MACRO(931)
-# endif
-# if BOOST_PP_LOCAL_R(930)
-    BOOST_PP_LOCAL_MACRO(930)
-# endif
-# if BOOST_PP_LOCAL_R(929)
-    BOOST_PP_LOCAL_MACRO(929)
-# endif
-# if BOOST_PP_LOCAL_R(928)
-    BOOST_PP_LOCAL_MACRO(928)
-# endif
-# if BOOST_PP_LOCAL_R(927)
-    BOOST_PP_LOCAL_MACRO(927)
-# endif
-# if BOOST_PP_LOCAL_R(926)
-    BOOST_PP_LOCAL_MACRO(926)
-# endif
-# if BOOST_PP_LOCAL_R(925)
-    BOOST_PP_LOCAL_MACRO(925)
-# endif
-# if BOOST_PP_LOCAL_R(924)
-    BOOST_PP_LOCAL_MACRO(924)
-# endif
-# if BOOST_PP_LOCAL_R(923)
-    BOOST_PP_LOCAL_MACRO(923)
-# endif
-# if BOOST_PP_LOCAL_R(922)
-    BOOST_PP_LOCAL_MACRO(922)
-# endif
-# if BOOST_PP_LOCAL_R(921)
-    BOOST_PP_LOCAL_MACRO(921)
-# endif
-# if BOOST_PP_LOCAL_R(920)
-    BOOST_PP_LOCAL_MACRO(920)
-# endif
-# if BOOST_PP_LOCAL_R(919)
-    BOOST_PP_LOCAL_MACRO(919)
-# endif
-# if BOOST_PP_LOCAL_R(918)
-    BOOST_PP_LOCAL_MACRO(918)
-# endif
-# if BOOST_PP_LOCAL_R(917)
-    BOOST_PP_LOCAL_MACRO(917)
-# endif
-# if BOOST_PP_LOCAL_R(916)
-    BOOST_PP_LOCAL_MACRO(916)
-# endif
-# if BOOST_PP_LOCAL_R(915)
-    BOOST_PP_LOCAL_MACRO(915)
-# endif
-# if BOOST_PP_LOCAL_R(914)
-    BOOST_PP_LOCAL_MACRO(914)
-# endif
-# if BOOST_PP_LOCAL_R(913)
-    BOOST_PP_LOCAL_MACRO(913)
-# endif
-# if BOOST_PP_LOCAL_R(912)
-    BOOST_PP_LOCAL_MACRO(912)
-# endif
-# if BOOST_PP_LOCAL_R(911)
-    BOOST_PP_LOCAL_MACRO(911)
-# endif
-# if BOOST_PP_LOCAL_R(910)
-    BOOST_PP_LOCAL_MACRO(910)
-# endif
-# if BOOST_PP_LOCAL_R(909)
-    BOOST_PP_LOCAL_MACRO(909)
-# endif
-# if BOOST_PP_LOCAL_R(908)
-    BOOST_PP_LOCAL_MACRO(908)
-# endif
-# if BOOST_PP_LOCAL_R(907)
-    BOOST_PP_LOCAL_MACRO(907)
-# endif
-# if BOOST_PP_LOCAL_R(906)
-    BOOST_PP_LOCAL_MACRO(906)
-# endif
-# if BOOST_PP_LOCAL_R(905)
-    BOOST_PP_LOCAL_MACRO(905)
-# endif
-# if BOOST_PP_LOCAL_R(904)
-    BOOST_PP_LOCAL_MACRO(904)
-# endif
-# if BOOST_PP_LOCAL_R(903)
-    BOOST_PP_LOCAL_MACRO(903)
-# endif
-# if BOOST_PP_LOCAL_R(902)
-    BOOST_PP_LOCAL_MACRO(902)
-# endif
-# if BOOST_PP_LOCAL_R(901)
-    BOOST_PP_LOCAL_MACRO(901)
-# endif
-# if BOOST_PP_LOCAL_R(900)
-    BOOST_PP_LOCAL_MACRO(900)
-# endif
-# if BOOST_PP_LOCAL_R(899)
-    BOOST_PP_LOCAL_MACRO(899)
-# endif
-# if BOOST_PP_LOCAL_R(898)
-    BOOST_PP_LOCAL_MACRO(898)
-# endif
-# if BOOST_PP_LOCAL_R(897)
-    BOOST_PP_LOCAL_MACRO(897)
-# endif
-# if BOOST_PP_LOCAL_R(896)
-    BOOST_PP_LOCAL_MACRO(896)
-# endif
-# if BOOST_PP_LOCAL_R(895)
-    BOOST_PP_LOCAL_MACRO(895)
-# endif
-# if BOOST_PP_LOCAL_R(894)
-    BOOST_PP_LOCAL_MACRO(894)
-# endif
-# if BOOST_PP_LOCAL_R(893)
-    BOOST_PP_LOCAL_MACRO(893)
-# endif
-# if BOOST_PP_LOCAL_R(892)
-    BOOST_PP_LOCAL_MACRO(892)
-# endif
-# if BOOST_PP_LOCAL_R(891)
-    BOOST_PP_LOCAL_MACRO(891)
-# endif
-# if BOOST_PP_LOCAL_R(890)
-    BOOST_PP_LOCAL_MACRO(890)
-# endif
-# if BOOST_PP_LOCAL_R(889)
-    BOOST_PP_LOCAL_MACRO(889)
-# endif
-# if BOOST_PP_LOCAL_R(888)
-    BOOST_PP_LOCAL_MACRO(888)
-# endif
-# if BOOST_PP_LOCAL_R(887)
-    BOOST_PP_LOCAL_MACRO(887)
-# endif
-# if BOOST_PP_LOCAL_R(886)
-    BOOST_PP_LOCAL_MACRO(886)
-# endif
-# if BOOST_PP_LOCAL_R(885)
-    BOOST_PP_LOCAL_MACRO(885)
-# endif
-# if BOOST_PP_LOCAL_R(884)
-    BOOST_PP_LOCAL_MACRO(884)
-# endif
-# if BOOST_PP_LOCAL_R(883)
-    BOOST_PP_LOCAL_MACRO(883)
-# endif
-# if BOOST_PP_LOCAL_R(882)
-    BOOST_PP_LOCAL_MACRO(882)
-# endif
-# if BOOST_PP_LOCAL_R(881)
-    BOOST_PP_LOCAL_MACRO(881)
-# endif
-# if BOOST_PP_LOCAL_R(880)
-    BOOST_PP_LOCAL_MACRO(880)
-# endif
-# if BOOST_PP_LOCAL_R(879)
-    BOOST_PP_LOCAL_MACRO(879)
-# endif
-# if BOOST_PP_LOCAL_R(878)
-    BOOST_PP_LOCAL_MACRO(878)
-# endif
-# if BOOST_PP_LOCAL_R(877)
-    BOOST_PP_LOCAL_MACRO(877)
-# endif
-# if BOOST_PP_LOCAL_R(876)
-    BOOST_PP_LOCAL_MACRO(876)
-# endif
-# if BOOST_PP_LOCAL_R(875)
-    BOOST_PP_LOCAL_MACRO(875)
-# endif
-# if BOOST_PP_LOCAL_R(874)
-    BOOST_PP_LOCAL_MACRO(874)
-# endif
-# if BOOST_PP_LOCAL_R(873)
-    BOOST_PP_LOCAL_MACRO(873)
-# endif
-# if BOOST_PP_LOCAL_R(872)
-    BOOST_PP_LOCAL_MACRO(872)
-# endif
-# if BOOST_PP_LOCAL_R(871)
-    BOOST_PP_LOCAL_MACRO(871)
-# endif
-# if BOOST_PP_LOCAL_R(870)
-    BOOST_PP_LOCAL_MACRO(870)
-# endif
-# if BOOST_PP_LOCAL_R(869)
-    BOOST_PP_LOCAL_MACRO(869)
-# endif
-# if BOOST_PP_LOCAL_R(868)
-    BOOST_PP_LOCAL_MACRO(868)
-# endif
-# if BOOST_PP_LOCAL_R(867)
-    BOOST_PP_LOCAL_MACRO(867)
-# endif
-# if BOOST_PP_LOCAL_R(866)
-    BOOST_PP_LOCAL_MACRO(866)
-# endif
-# if BOOST_PP_LOCAL_R(865)
-    BOOST_PP_LOCAL_MACRO(865)
-# endif
-# if BOOST_PP_LOCAL_R(864)
-    BOOST_PP_LOCAL_MACRO(864)
-# endif
-# if BOOST_PP_LOCAL_R(863)
-    BOOST_PP_LOCAL_MACRO(863)
-# endif
-# if BOOST_PP_LOCAL_R(862)
-    BOOST_PP_LOCAL_MACRO(862)
-# endif
-# if BOOST_PP_LOCAL_R(861)
-    BOOST_PP_LOCAL_MACRO(861)
-# endif
-# if BOOST_PP_LOCAL_R(860)
-    BOOST_PP_LOCAL_MACRO(860)
-# endif
-# if BOOST_PP_LOCAL_R(859)
-    BOOST_PP_LOCAL_MACRO(859)
-# endif
-# if BOOST_PP_LOCAL_R(858)
-    BOOST_PP_LOCAL_MACRO(858)
-# endif
-# if BOOST_PP_LOCAL_R(857)
-    BOOST_PP_LOCAL_MACRO(857)
-# endif
-# if BOOST_PP_LOCAL_R(856)
-    BOOST_PP_LOCAL_MACRO(856)
-# endif
-# if BOOST_PP_LOCAL_R(855)
-    BOOST_PP_LOCAL_MACRO(855)
-# endif
-# if BOOST_PP_LOCAL_R(854)
-    BOOST_PP_LOCAL_MACRO(854)
-# endif
-# if BOOST_PP_LOCAL_R(853)
-    BOOST_PP_LOCAL_MACRO(853)
-# endif
-# if BOOST_PP_LOCAL_R(852)
-    BOOST_PP_LOCAL_MACRO(852)
-# endif
-# if BOOST_PP_LOCAL_R(851)
-    BOOST_PP_LOCAL_MACRO(851)
-# endif
-# if BOOST_PP_LOCAL_R(850)
-    BOOST_PP_LOCAL_MACRO(850)
-# endif
-# if BOOST_PP_LOCAL_R(849)
-    BOOST_PP_LOCAL_MACRO(849)
-# endif
-# if BOOST_PP_LOCAL_R(848)
-    BOOST_PP_LOCAL_MACRO(848)
-# endif
-# if BOOST_PP_LOCAL_R(847)
-    BOOST_PP_LOCAL_MACRO(847)
-# endif
-# if BOOST_PP_LOCAL_R(846)
-    BOOST_PP_LOCAL_MACRO(846)
-# endif
-# if BOOST_PP_LOCAL_R(845)
-    BOOST_PP_LOCAL_MACRO(845)
-# endif
-# if BOOST_PP_LOCAL_R(844)
-    BOOST_PP_LOCAL_MACRO(844)
-# endif
-# if BOOST_PP_LOCAL_R(843)
-    BOOST_PP_LOCAL_MACRO(843)
-# endif
-# if BOOST_PP_LOCAL_R(842)
-    BOOST_PP_LOCAL_MACRO(842)
-# endif
-# if BOOST_PP_LOCAL_R(841)
-    BOOST_PP_LOCAL_MACRO(841)
-# endif
-# if BOOST_PP_LOCAL_R(840)
-    BOOST_PP_LOCAL_MACRO(840)
-# endif
-# if BOOST_PP_LOCAL_R(839)
-    BOOST_PP_LOCAL_MACRO(839)
-# endif
-# if BOOST_PP_LOCAL_R(838)
-    BOOST_PP_LOCAL_MACRO(838)
-# endif
-# if BOOST_PP_LOCAL_R(837)
-    BOOST_PP_LOCAL_MACRO(837)
-# endif
-# if BOOST_PP_LOCAL_R(836)
-    BOOST_PP_LOCAL_MACRO(836)
-# endif
-# if BOOST_PP_LOCAL_R(835)
-    BOOST_PP_LOCAL_MACRO(835)
-# endif
-# if BOOST_PP_LOCAL_R(834)
-    BOOST_PP_LOCAL_MACRO(834)
-# endif
-# if BOOST_PP_LOCAL_R(833)
-    BOOST_PP_LOCAL_MACRO(833)
-# endif
-# if BOOST_PP_LOCAL_R(832)
-    BOOST_PP_LOCAL_MACRO(832)
-# endif
-# if BOOST_PP_LOCAL_R(831)
-    BOOST_PP_LOCAL_MACRO(831)
-# endif
-# if BOOST_PP_LOCAL_R(830)
-    BOOST_PP_LOCAL_MACRO(830)
-# endif
-# if BOOST_PP_LOCAL_R(829)
-    BOOST_PP_LOCAL_MACRO(829)
-# endif
-# if BOOST_PP_LOCAL_R(828)
-    BOOST_PP_LOCAL_MACRO(828)
-# endif
-# if BOOST_PP_LOCAL_R(827)
-    BOOST_PP_LOCAL_MACRO(827)
-# endif
-# if BOOST_PP_LOCAL_R(826)
-    BOOST_PP_LOCAL_MACRO(826)
-# endif
-# if BOOST_PP_LOCAL_R(825)
-    BOOST_PP_LOCAL_MACRO(825)
-# endif
-# if BOOST_PP_LOCAL_R(824)
-    BOOST_PP_LOCAL_MACRO(824)
-# endif
-# if BOOST_PP_LOCAL_R(823)
-    BOOST_PP_LOCAL_MACRO(823)
-# endif
-# if BOOST_PP_LOCAL_R(822)
-    BOOST_PP_LOCAL_MACRO(822)
-# endif
-# if BOOST_PP_LOCAL_R(821)
-    BOOST_PP_LOCAL_MACRO(821)
-# endif
-# if BOOST_PP_LOCAL_R(820)
-    BOOST_PP_LOCAL_MACRO(820)
-# endif
-# if BOOST_PP_LOCAL_R(819)
-    BOOST_PP_LOCAL_MACRO(819)
-# endif
-# if BOOST_PP_LOCAL_R(818)
-    BOOST_PP_LOCAL_MACRO(818)
-# endif
-# if BOOST_PP_LOCAL_R(817)
-    BOOST_PP_LOCAL_MACRO(817)
-# endif
-# if BOOST_PP_LOCAL_R(816)
-    BOOST_PP_LOCAL_MACRO(816)
-# endif
-# if BOOST_PP_LOCAL_R(815)
-    BOOST_PP_LOCAL_MACRO(815)
-# endif
-# if BOOST_PP_LOCAL_R(814)
-    BOOST_PP_LOCAL_MACRO(814)
-# endif
-# if BOOST_PP_LOCAL_R(813)
-    BOOST_PP_LOCAL_MACRO(813)
-# endif
-# if BOOST_PP_LOCAL_R(812)
-    BOOST_PP_LOCAL_MACRO(812)
-# endif
-# if BOOST_PP_LOCAL_R(811)
-    BOOST_PP_LOCAL_MACRO(811)
-# endif
-# if BOOST_PP_LOCAL_R(810)
-    BOOST_PP_LOCAL_MACRO(810)
-# endif
-# if BOOST_PP_LOCAL_R(809)
-    BOOST_PP_LOCAL_MACRO(809)
-# endif
-# if BOOST_PP_LOCAL_R(808)
-    BOOST_PP_LOCAL_MACRO(808)
-# endif
-# if BOOST_PP_LOCAL_R(807)
-    BOOST_PP_LOCAL_MACRO(807)
-# endif
-# if BOOST_PP_LOCAL_R(806)
-    BOOST_PP_LOCAL_MACRO(806)
-# endif
-# if BOOST_PP_LOCAL_R(805)
-    BOOST_PP_LOCAL_MACRO(805)
-# endif
-# if BOOST_PP_LOCAL_R(804)
-    BOOST_PP_LOCAL_MACRO(804)
-# endif
-# if BOOST_PP_LOCAL_R(803)
-    BOOST_PP_LOCAL_MACRO(803)
-# endif
-# if BOOST_PP_LOCAL_R(802)
-    BOOST_PP_LOCAL_MACRO(802)
-# endif
-# if BOOST_PP_LOCAL_R(801)
-    BOOST_PP_LOCAL_MACRO(801)
-# endif
-# if BOOST_PP_LOCAL_R(800)
-    BOOST_PP_LOCAL_MACRO(800)
-# endif
-# if BOOST_PP_LOCAL_R(799)
-    BOOST_PP_LOCAL_MACRO(799)
-# endif
-# if BOOST_PP_LOCAL_R(798)
-    BOOST_PP_LOCAL_MACRO(798)
-# endif
-# if BOOST_PP_LOCAL_R(797)
-    BOOST_PP_LOCAL_MACRO(797)
-# endif
-# if BOOST_PP_LOCAL_R(796)
-    BOOST_PP_LOCAL_MACRO(796)
-# endif
-# if BOOST_PP_LOCAL_R(795)
-    BOOST_PP_LOCAL_MACRO(795)
-# endif
-# if BOOST_PP_LOCAL_R(794)
-    BOOST_PP_LOCAL_MACRO(794)
-# endif
-# if BOOST_PP_LOCAL_R(793)
-    BOOST_PP_LOCAL_MACRO(793)
-# endif
-# if BOOST_PP_LOCAL_R(792)
-    BOOST_PP_LOCAL_MACRO(792)
-# endif
-# if BOOST_PP_LOCAL_R(791)
-    BOOST_PP_LOCAL_MACRO(791)
-# endif
-# if BOOST_PP_LOCAL_R(790)
-    BOOST_PP_LOCAL_MACRO(790)
-# endif
-# if BOOST_PP_LOCAL_R(789)
-    BOOST_PP_LOCAL_MACRO(789)
-# endif
-# if BOOST_PP_LOCAL_R(788)
-    BOOST_PP_LOCAL_MACRO(788)
-# endif
-# if BOOST_PP_LOCAL_R(787)
-    BOOST_PP_LOCAL_MACRO(787)
-# endif
-# if BOOST_PP_LOCAL_R(786)
-    BOOST_PP_LOCAL_MACRO(786)
-# endif
-# if BOOST_PP_LOCAL_R(785)
-    BOOST_PP_LOCAL_MACRO(785)
-# endif
-# if BOOST_PP_LOCAL_R(784)
-    BOOST_PP_LOCAL_MACRO(784)
-# endif
-# if BOOST_PP_LOCAL_R(783)
-    BOOST_PP_LOCAL_MACRO(783)
-# endif
-# if BOOST_PP_LOCAL_R(782)
-    BOOST_PP_LOCAL_MACRO(782)
-# endif
-# if BOOST_PP_LOCAL_R(781)
-    BOOST_PP_LOCAL_MACRO(781)
-# endif
-# if BOOST_PP_LOCAL_R(780)
-    BOOST_PP_LOCAL_MACRO(780)
-# endif
-# if BOOST_PP_LOCAL_R(779)
-    BOOST_PP_LOCAL_MACRO(779)
-# endif
-# if BOOST_PP_LOCAL_R(778)
-    BOOST_PP_LOCAL_MACRO(778)
-# endif
-# if BOOST_PP_LOCAL_R(777)
-    BOOST_PP_LOCAL_MACRO(777)
-# endif
-# if BOOST_PP_LOCAL_R(776)
-    BOOST_PP_LOCAL_MACRO(776)
-# endif
-# if BOOST_PP_LOCAL_R(775)
-    BOOST_PP_LOCAL_MACRO(775)
-# endif
-# if BOOST_PP_LOCAL_R(774)
-    BOOST_PP_LOCAL_MACRO(774)
-# endif
-# if BOOST_PP_LOCAL_R(773)
-    BOOST_PP_LOCAL_MACRO(773)
-# endif
-# if BOOST_PP_LOCAL_R(772)
-    BOOST_PP_LOCAL_MACRO(772)
-# endif
-# if BOOST_PP_LOCAL_R(771)
-    BOOST_PP_LOCAL_MACRO(771)
-# endif
-# if BOOST_PP_LOCAL_R(770)
-    BOOST_PP_LOCAL_MACRO(770)
-# endif
-# if BOOST_PP_LOCAL_R(769)
-    BOOST_PP_LOCAL_MACRO(769)
-# endif
-# if BOOST_PP_LOCAL_R(768)
-    BOOST_PP_LOCAL_MACRO(768)
-# endif
-# if BOOST_PP_LOCAL_R(767)
-    BOOST_PP_LOCAL_MACRO(767)
-# endif
-# if BOOST_PP_LOCAL_R(766)
-    BOOST_PP_LOCAL_MACRO(766)
-# endif
-# if BOOST_PP_LOCAL_R(765)
-    BOOST_PP_LOCAL_MACRO(765)
-# endif
-# if BOOST_PP_LOCAL_R(764)
-    BOOST_PP_LOCAL_MACRO(764)
-# endif
-# if BOOST_PP_LOCAL_R(763)
-    BOOST_PP_LOCAL_MACRO(763)
-# endif
-# if BOOST_PP_LOCAL_R(762)
-    BOOST_PP_LOCAL_MACRO(762)
-# endif
-# if BOOST_PP_LOCAL_R(761)
-    BOOST_PP_LOCAL_MACRO(761)
-# endif
-# if BOOST_PP_LOCAL_R(760)
-    BOOST_PP_LOCAL_MACRO(760)
-# endif
-# if BOOST_PP_LOCAL_R(759)
-    BOOST_PP_LOCAL_MACRO(759)
-# endif
-# if BOOST_PP_LOCAL_R(758)
-    BOOST_PP_LOCAL_MACRO(758)
-# endif
-# if BOOST_PP_LOCAL_R(757)
-    BOOST_PP_LOCAL_MACRO(757)
-# endif
-# if BOOST_PP_LOCAL_R(756)
-    BOOST_PP_LOCAL_MACRO(756)
-# endif
-# if BOOST_PP_LOCAL_R(755)
-    BOOST_PP_LOCAL_MACRO(755)
-# endif
-# if BOOST_PP_LOCAL_R(754)
-    BOOST_PP_LOCAL_MACRO(754)
-# endif
-# if BOOST_PP_LOCAL_R(753)
-    BOOST_PP_LOCAL_MACRO(753)
-# endif
-# if BOOST_PP_LOCAL_R(752)
-    BOOST_PP_LOCAL_MACRO(752)
-# endif
-# if BOOST_PP_LOCAL_R(751)
-    BOOST_PP_LOCAL_MACRO(751)
-# endif
-# if BOOST_PP_LOCAL_R(750)
-    BOOST_PP_LOCAL_MACRO(750)
-# endif
-# if BOOST_PP_LOCAL_R(749)
-    BOOST_PP_LOCAL_MACRO(749)
-# endif
-# if BOOST_PP_LOCAL_R(748)
-    BOOST_PP_LOCAL_MACRO(748)
-# endif
-# if BOOST_PP_LOCAL_R(747)
-    BOOST_PP_LOCAL_MACRO(747)
-# endif
-# if BOOST_PP_LOCAL_R(746)
-    BOOST_PP_LOCAL_MACRO(746)
-# endif
-# if BOOST_PP_LOCAL_R(745)
-    BOOST_PP_LOCAL_MACRO(745)
-# endif
-# if BOOST_PP_LOCAL_R(744)
-    BOOST_PP_LOCAL_MACRO(744)
-# endif
-# if BOOST_PP_LOCAL_R(743)
-    BOOST_PP_LOCAL_MACRO(743)
-# endif
-# if BOOST_PP_LOCAL_R(742)
-    BOOST_PP_LOCAL_MACRO(742)
-# endif
-# if BOOST_PP_LOCAL_R(741)
-    BOOST_PP_LOCAL_MACRO(741)
-# endif
-# if BOOST_PP_LOCAL_R(740)
-    BOOST_PP_LOCAL_MACRO(740)
-# endif
-# if BOOST_PP_LOCAL_R(739)
-    BOOST_PP_LOCAL_MACRO(739)
-# endif
-# if BOOST_PP_LOCAL_R(738)
-    BOOST_PP_LOCAL_MACRO(738)
-# endif
-# if BOOST_PP_LOCAL_R(737)
-    BOOST_PP_LOCAL_MACRO(737)
-# endif
-# if BOOST_PP_LOCAL_R(736)
-    BOOST_PP_LOCAL_MACRO(736)
-# endif
-# if BOOST_PP_LOCAL_R(735)
-    BOOST_PP_LOCAL_MACRO(735)
-# endif
-# if BOOST_PP_LOCAL_R(734)
-    BOOST_PP_LOCAL_MACRO(734)
-# endif
-# if BOOST_PP_LOCAL_R(733)
-    BOOST_PP_LOCAL_MACRO(733)
-# endif
-# if BOOST_PP_LOCAL_R(732)
-    BOOST_PP_LOCAL_MACRO(732)
-# endif
-# if BOOST_PP_LOCAL_R(731)
-    BOOST_PP_LOCAL_MACRO(731)
-# endif
-# if BOOST_PP_LOCAL_R(730)
-    BOOST_PP_LOCAL_MACRO(730)
-# endif
-# if BOOST_PP_LOCAL_R(729)
-    BOOST_PP_LOCAL_MACRO(729)
-# endif
-# if BOOST_PP_LOCAL_R(728)
-    BOOST_PP_LOCAL_MACRO(728)
-# endif
-# if BOOST_PP_LOCAL_R(727)
-    BOOST_PP_LOCAL_MACRO(727)
-# endif
-# if BOOST_PP_LOCAL_R(726)
-    BOOST_PP_LOCAL_MACRO(726)
-# endif
-# if BOOST_PP_LOCAL_R(725)
-    BOOST_PP_LOCAL_MACRO(725)
-# endif
-# if BOOST_PP_LOCAL_R(724)
-    BOOST_PP_LOCAL_MACRO(724)
-# endif
-# if BOOST_PP_LOCAL_R(723)
-    BOOST_PP_LOCAL_MACRO(723)
-# endif
-# if BOOST_PP_LOCAL_R(722)
-    BOOST_PP_LOCAL_MACRO(722)
-# endif
-# if BOOST_PP_LOCAL_R(721)
-    BOOST_PP_LOCAL_MACRO(721)
-# endif
-# if BOOST_PP_LOCAL_R(720)
-    BOOST_PP_LOCAL_MACRO(720)
-# endif
-# if BOOST_PP_LOCAL_R(719)
-    BOOST_PP_LOCAL_MACRO(719)
-# endif
-# if BOOST_PP_LOCAL_R(718)
-    BOOST_PP_LOCAL_MACRO(718)
-# endif
-# if BOOST_PP_LOCAL_R(717)
-    BOOST_PP_LOCAL_MACRO(717)
-# endif
-# if BOOST_PP_LOCAL_R(716)
-    BOOST_PP_LOCAL_MACRO(716)
-# endif
-# if BOOST_PP_LOCAL_R(715)
-    BOOST_PP_LOCAL_MACRO(715)
-# endif
-# if BOOST_PP_LOCAL_R(714)
-    BOOST_PP_LOCAL_MACRO(714)
-# endif
-# if BOOST_PP_LOCAL_R(713)
-    BOOST_PP_LOCAL_MACRO(713)
-# endif
-# if BOOST_PP_LOCAL_R(712)
-    BOOST_PP_LOCAL_MACRO(712)
-# endif
-# if BOOST_PP_LOCAL_R(711)
-    BOOST_PP_LOCAL_MACRO(711)
-# endif
-# if BOOST_PP_LOCAL_R(710)
-    BOOST_PP_LOCAL_MACRO(710)
-# endif
-# if BOOST_PP_LOCAL_R(709)
-    BOOST_PP_LOCAL_MACRO(709)
-# endif
-# if BOOST_PP_LOCAL_R(708)
-    BOOST_PP_LOCAL_MACRO(708)
-# endif
-# if BOOST_PP_LOCAL_R(707)
-    BOOST_PP_LOCAL_MACRO(707)
-# endif
-# if BOOST_PP_LOCAL_R(706)
-    BOOST_PP_LOCAL_MACRO(706)
-# endif
-# if BOOST_PP_LOCAL_R(705)
-    BOOST_PP_LOCAL_MACRO(705)
-# endif
-# if BOOST_PP_LOCAL_R(704)
-    BOOST_PP_LOCAL_MACRO(704)
-# endif
-# if BOOST_PP_LOCAL_R(703)
-    BOOST_PP_LOCAL_MACRO(703)
-# endif
-# if BOOST_PP_LOCAL_R(702)
-    BOOST_PP_LOCAL_MACRO(702)
-# endif
-# if BOOST_PP_LOCAL_R(701)
-    BOOST_PP_LOCAL_MACRO(701)
-# endif
-# if BOOST_PP_LOCAL_R(700)
-    BOOST_PP_LOCAL_MACRO(700)
-# endif
-# if BOOST_PP_LOCAL_R(699)
-    BOOST_PP_LOCAL_MACRO(699)
-# endif
-# if BOOST_PP_LOCAL_R(698)
-    BOOST_PP_LOCAL_MACRO(698)
-# endif
-# if BOOST_PP_LOCAL_R(697)
-    BOOST_PP_LOCAL_MACRO(697)
-# endif
-# if BOOST_PP_LOCAL_R(696)
-    BOOST_PP_LOCAL_MACRO(696)
-# endif
-# if BOOST_PP_LOCAL_R(695)
-    BOOST_PP_LOCAL_MACRO(695)
-# endif
-# if BOOST_PP_LOCAL_R(694)
-    BOOST_PP_LOCAL_MACRO(694)
-# endif
-# if BOOST_PP_LOCAL_R(693)
-    BOOST_PP_LOCAL_MACRO(693)
-# endif
-# if BOOST_PP_LOCAL_R(692)
-    BOOST_PP_LOCAL_MACRO(692)
-# endif
-# if BOOST_PP_LOCAL_R(691)
-    BOOST_PP_LOCAL_MACRO(691)
-# endif
-# if BOOST_PP_LOCAL_R(690)
-    BOOST_PP_LOCAL_MACRO(690)
-# endif
-# if BOOST_PP_LOCAL_R(689)
-    BOOST_PP_LOCAL_MACRO(689)
-# endif
-# if BOOST_PP_LOCAL_R(688)
-    BOOST_PP_LOCAL_MACRO(688)
-# endif
-# if BOOST_PP_LOCAL_R(687)
-    BOOST_PP_LOCAL_MACRO(687)
-# endif
-# if BOOST_PP_LOCAL_R(686)
-    BOOST_PP_LOCAL_MACRO(686)
-# endif
-# if BOOST_PP_LOCAL_R(685)
-    BOOST_PP_LOCAL_MACRO(685)
-# endif
-# if BOOST_PP_LOCAL_R(684)
-    BOOST_PP_LOCAL_MACRO(684)
-# endif
-# if BOOST_PP_LOCAL_R(683)
-    BOOST_PP_LOCAL_MACRO(683)
-# endif
-# if BOOST_PP_LOCAL_R(682)
-    BOOST_PP_LOCAL_MACRO(682)
-# endif
-# if BOOST_PP_LOCAL_R(681)
-    BOOST_PP_LOCAL_MACRO(681)
-# endif
-# if BOOST_PP_LOCAL_R(680)
-    BOOST_PP_LOCAL_MACRO(680)
-# endif
-# if BOOST_PP_LOCAL_R(679)
-    BOOST_PP_LOCAL_MACRO(679)
-# endif
-# if BOOST_PP_LOCAL_R(678)
-    BOOST_PP_LOCAL_MACRO(678)
-# endif
-# if BOOST_PP_LOCAL_R(677)
-    BOOST_PP_LOCAL_MACRO(677)
-# endif
-# if BOOST_PP_LOCAL_R(676)
-    BOOST_PP_LOCAL_MACRO(676)
-# endif
-# if BOOST_PP_LOCAL_R(675)
-    BOOST_PP_LOCAL_MACRO(675)
-# endif
-# if BOOST_PP_LOCAL_R(674)
-    BOOST_PP_LOCAL_MACRO(674)
-# endif
-# if BOOST_PP_LOCAL_R(673)
-    BOOST_PP_LOCAL_MACRO(673)
-# endif
-# if BOOST_PP_LOCAL_R(672)
-    BOOST_PP_LOCAL_MACRO(672)
-# endif
-# if BOOST_PP_LOCAL_R(671)
-    BOOST_PP_LOCAL_MACRO(671)
-# endif
-# if BOOST_PP_LOCAL_R(670)
-    BOOST_PP_LOCAL_MACRO(670)
-# endif
-# if BOOST_PP_LOCAL_R(669)
-    BOOST_PP_LOCAL_MACRO(669)
-# endif
-# if BOOST_PP_LOCAL_R(668)
-    BOOST_PP_LOCAL_MACRO(668)
-# endif
-# if BOOST_PP_LOCAL_R(667)
-    BOOST_PP_LOCAL_MACRO(667)
-# endif
-# if BOOST_PP_LOCAL_R(666)
-    BOOST_PP_LOCAL_MACRO(666)
-# endif
-# if BOOST_PP_LOCAL_R(665)
-    BOOST_PP_LOCAL_MACRO(665)
-# endif
-# if BOOST_PP_LOCAL_R(664)
-    BOOST_PP_LOCAL_MACRO(664)
-# endif
-# if BOOST_PP_LOCAL_R(663)
-    BOOST_PP_LOCAL_MACRO(663)
-# endif
-# if BOOST_PP_LOCAL_R(662)
-    BOOST_PP_LOCAL_MACRO(662)
-# endif
-# if BOOST_PP_LOCAL_R(661)
-    BOOST_PP_LOCAL_MACRO(661)
-# endif
-# if BOOST_PP_LOCAL_R(660)
-    BOOST_PP_LOCAL_MACRO(660)
-# endif
-# if BOOST_PP_LOCAL_R(659)
-    BOOST_PP_LOCAL_MACRO(659)
-# endif
-# if BOOST_PP_LOCAL_R(658)
-    BOOST_PP_LOCAL_MACRO(658)
-# endif
-# if BOOST_PP_LOCAL_R(657)
-    BOOST_PP_LOCAL_MACRO(657)
-# endif
-# if BOOST_PP_LOCAL_R(656)
-    BOOST_PP_LOCAL_MACRO(656)
-# endif
-# if BOOST_PP_LOCAL_R(655)
-    BOOST_PP_LOCAL_MACRO(655)
-# endif
-# if BOOST_PP_LOCAL_R(654)
-    BOOST_PP_LOCAL_MACRO(654)
-# endif
-# if BOOST_PP_LOCAL_R(653)
-    BOOST_PP_LOCAL_MACRO(653)
-# endif
-# if BOOST_PP_LOCAL_R(652)
-    BOOST_PP_LOCAL_MACRO(652)
-# endif
-# if BOOST_PP_LOCAL_R(651)
-    BOOST_PP_LOCAL_MACRO(651)
-# endif
-# if BOOST_PP_LOCAL_R(650)
-    BOOST_PP_LOCAL_MACRO(650)
-# endif
-# if BOOST_PP_LOCAL_R(649)
-    BOOST_PP_LOCAL_MACRO(649)
-# endif
-# if BOOST_PP_LOCAL_R(648)
-    BOOST_PP_LOCAL_MACRO(648)
-# endif
-# if BOOST_PP_LOCAL_R(647)
-    BOOST_PP_LOCAL_MACRO(647)
-# endif
-# if BOOST_PP_LOCAL_R(646)
-    BOOST_PP_LOCAL_MACRO(646)
-# endif
-# if BOOST_PP_LOCAL_R(645)
-    BOOST_PP_LOCAL_MACRO(645)
-# endif
-# if BOOST_PP_LOCAL_R(644)
-    BOOST_PP_LOCAL_MACRO(644)
-# endif
-# if BOOST_PP_LOCAL_R(643)
-    BOOST_PP_LOCAL_MACRO(643)
-# endif
-# if BOOST_PP_LOCAL_R(642)
-    BOOST_PP_LOCAL_MACRO(642)
-# endif
-# if BOOST_PP_LOCAL_R(641)
-    BOOST_PP_LOCAL_MACRO(641)
-# endif
-# if BOOST_PP_LOCAL_R(640)
-    BOOST_PP_LOCAL_MACRO(640)
-# endif
-# if BOOST_PP_LOCAL_R(639)
-    BOOST_PP_LOCAL_MACRO(639)
-# endif
-# if BOOST_PP_LOCAL_R(638)
-    BOOST_PP_LOCAL_MACRO(638)
-# endif
-# if BOOST_PP_LOCAL_R(637)
-    BOOST_PP_LOCAL_MACRO(637)
-# endif
-# if BOOST_PP_LOCAL_R(636)
-    BOOST_PP_LOCAL_MACRO(636)
-# endif
-# if BOOST_PP_LOCAL_R(635)
-    BOOST_PP_LOCAL_MACRO(635)
-# endif
-# if BOOST_PP_LOCAL_R(634)
-    BOOST_PP_LOCAL_MACRO(634)
-# endif
-# if BOOST_PP_LOCAL_R(633)
-    BOOST_PP_LOCAL_MACRO(633)
-# endif
-# if BOOST_PP_LOCAL_R(632)
-    BOOST_PP_LOCAL_MACRO(632)
-# endif
-# if BOOST_PP_LOCAL_R(631)
-    BOOST_PP_LOCAL_MACRO(631)
-# endif
-# if BOOST_PP_LOCAL_R(630)
-    BOOST_PP_LOCAL_MACRO(630)
-# endif
-# if BOOST_PP_LOCAL_R(629)
-    BOOST_PP_LOCAL_MACRO(629)
-# endif
-# if BOOST_PP_LOCAL_R(628)
-    BOOST_PP_LOCAL_MACRO(628)
-# endif
-# if BOOST_PP_LOCAL_R(627)
-    BOOST_PP_LOCAL_MACRO(627)
-# endif
-# if BOOST_PP_LOCAL_R(626)
-    BOOST_PP_LOCAL_MACRO(626)
-# endif
-# if BOOST_PP_LOCAL_R(625)
-    BOOST_PP_LOCAL_MACRO(625)
-# endif
-# if BOOST_PP_LOCAL_R(624)
-    BOOST_PP_LOCAL_MACRO(624)
-# endif
-# if BOOST_PP_LOCAL_R(623)
-    BOOST_PP_LOCAL_MACRO(623)
-# endif
-# if BOOST_PP_LOCAL_R(622)
-    BOOST_PP_LOCAL_MACRO(622)
-# endif
-# if BOOST_PP_LOCAL_R(621)
-    BOOST_PP_LOCAL_MACRO(621)
-# endif
-# if BOOST_PP_LOCAL_R(620)
-    BOOST_PP_LOCAL_MACRO(620)
-# endif
-# if BOOST_PP_LOCAL_R(619)
-    BOOST_PP_LOCAL_MACRO(619)
-# endif
-# if BOOST_PP_LOCAL_R(618)
-    BOOST_PP_LOCAL_MACRO(618)
-# endif
-# if BOOST_PP_LOCAL_R(617)
-    BOOST_PP_LOCAL_MACRO(617)
-# endif
-# if BOOST_PP_LOCAL_R(616)
-    BOOST_PP_LOCAL_MACRO(616)
-# endif
-# if BOOST_PP_LOCAL_R(615)
-    BOOST_PP_LOCAL_MACRO(615)
-# endif
-# if BOOST_PP_LOCAL_R(614)
-    BOOST_PP_LOCAL_MACRO(614)
-# endif
-# if BOOST_PP_LOCAL_R(613)
-    BOOST_PP_LOCAL_MACRO(613)
-# endif
-# if BOOST_PP_LOCAL_R(612)
-    BOOST_PP_LOCAL_MACRO(612)
-# endif
-# if BOOST_PP_LOCAL_R(611)
-    BOOST_PP_LOCAL_MACRO(611)
-# endif
-# if BOOST_PP_LOCAL_R(610)
-    BOOST_PP_LOCAL_MACRO(610)
-# endif
-# if BOOST_PP_LOCAL_R(609)
-    BOOST_PP_LOCAL_MACRO(609)
-# endif
-# if BOOST_PP_LOCAL_R(608)
-    BOOST_PP_LOCAL_MACRO(608)
-# endif
-# if BOOST_PP_LOCAL_R(607)
-    BOOST_PP_LOCAL_MACRO(607)
-# endif
-# if BOOST_PP_LOCAL_R(606)
-    BOOST_PP_LOCAL_MACRO(606)
-# endif
-# if BOOST_PP_LOCAL_R(605)
-    BOOST_PP_LOCAL_MACRO(605)
-# endif
-# if BOOST_PP_LOCAL_R(604)
-    BOOST_PP_LOCAL_MACRO(604)
-# endif
-# if BOOST_PP_LOCAL_R(603)
-    BOOST_PP_LOCAL_MACRO(603)
-# endif
-# if BOOST_PP_LOCAL_R(602)
-    BOOST_PP_LOCAL_MACRO(602)
-# endif
-# if BOOST_PP_LOCAL_R(601)
-    BOOST_PP_LOCAL_MACRO(601)
-# endif
-# if BOOST_PP_LOCAL_R(600)
-    BOOST_PP_LOCAL_MACRO(600)
-# endif
-# if BOOST_PP_LOCAL_R(599)
-    BOOST_PP_LOCAL_MACRO(599)
-# endif
-# if BOOST_PP_LOCAL_R(598)
-    BOOST_PP_LOCAL_MACRO(598)
-# endif
-# if BOOST_PP_LOCAL_R(597)
-    BOOST_PP_LOCAL_MACRO(597)
-# endif
-# if BOOST_PP_LOCAL_R(596)
-    BOOST_PP_LOCAL_MACRO(596)
-# endif
-# if BOOST_PP_LOCAL_R(595)
-    BOOST_PP_LOCAL_MACRO(595)
-# endif
-# if BOOST_PP_LOCAL_R(594)
-    BOOST_PP_LOCAL_MACRO(594)
-# endif
-# if BOOST_PP_LOCAL_R(593)
-    BOOST_PP_LOCAL_MACRO(593)
-# endif
-# if BOOST_PP_LOCAL_R(592)
-    BOOST_PP_LOCAL_MACRO(592)
-# endif
-# if BOOST_PP_LOCAL_R(591)
-    BOOST_PP_LOCAL_MACRO(591)
-# endif
-# if BOOST_PP_LOCAL_R(590)
-    BOOST_PP_LOCAL_MACRO(590)
-# endif
-# if BOOST_PP_LOCAL_R(589)
-    BOOST_PP_LOCAL_MACRO(589)
-# endif
-# if BOOST_PP_LOCAL_R(588)
-    BOOST_PP_LOCAL_MACRO(588)
-# endif
-# if BOOST_PP_LOCAL_R(587)
-    BOOST_PP_LOCAL_MACRO(587)
-# endif
-# if BOOST_PP_LOCAL_R(586)
-    BOOST_PP_LOCAL_MACRO(586)
-# endif
-# if BOOST_PP_LOCAL_R(585)
-    BOOST_PP_LOCAL_MACRO(585)
-# endif
-# if BOOST_PP_LOCAL_R(584)
-    BOOST_PP_LOCAL_MACRO(584)
-# endif
-# if BOOST_PP_LOCAL_R(583)
-    BOOST_PP_LOCAL_MACRO(583)
-# endif
-# if BOOST_PP_LOCAL_R(582)
-    BOOST_PP_LOCAL_MACRO(582)
-# endif
-# if BOOST_PP_LOCAL_R(581)
-    BOOST_PP_LOCAL_MACRO(581)
-# endif
-# if BOOST_PP_LOCAL_R(580)
-    BOOST_PP_LOCAL_MACRO(580)
-# endif
-# if BOOST_PP_LOCAL_R(579)
-    BOOST_PP_LOCAL_MACRO(579)
-# endif
-# if BOOST_PP_LOCAL_R(578)
-    BOOST_PP_LOCAL_MACRO(578)
-# endif
-# if BOOST_PP_LOCAL_R(577)
-    BOOST_PP_LOCAL_MACRO(577)
-# endif
-# if BOOST_PP_LOCAL_R(576)
-    BOOST_PP_LOCAL_MACRO(576)
-# endif
-# if BOOST_PP_LOCAL_R(575)
-    BOOST_PP_LOCAL_MACRO(575)
-# endif
-# if BOOST_PP_LOCAL_R(574)
-    BOOST_PP_LOCAL_MACRO(574)
-# endif
-# if BOOST_PP_LOCAL_R(573)
-    BOOST_PP_LOCAL_MACRO(573)
-# endif
-# if BOOST_PP_LOCAL_R(572)
-    BOOST_PP_LOCAL_MACRO(572)
-# endif
-# if BOOST_PP_LOCAL_R(571)
-    BOOST_PP_LOCAL_MACRO(571)
-# endif
-# if BOOST_PP_LOCAL_R(570)
-    BOOST_PP_LOCAL_MACRO(570)
-# endif
-# if BOOST_PP_LOCAL_R(569)
-    BOOST_PP_LOCAL_MACRO(569)
-# endif
-# if BOOST_PP_LOCAL_R(568)
-    BOOST_PP_LOCAL_MACRO(568)
-# endif
-# if BOOST_PP_LOCAL_R(567)
-    BOOST_PP_LOCAL_MACRO(567)
-# endif
-# if BOOST_PP_LOCAL_R(566)
-    BOOST_PP_LOCAL_MACRO(566)
-# endif
-# if BOOST_PP_LOCAL_R(565)
-    BOOST_PP_LOCAL_MACRO(565)
-# endif
-# if BOOST_PP_LOCAL_R(564)
-    BOOST_PP_LOCAL_MACRO(564)
-# endif
-# if BOOST_PP_LOCAL_R(563)
-    BOOST_PP_LOCAL_MACRO(563)
-# endif
-# if BOOST_PP_LOCAL_R(562)
-    BOOST_PP_LOCAL_MACRO(562)
-# endif
-# if BOOST_PP_LOCAL_R(561)
-    BOOST_PP_LOCAL_MACRO(561)
-# endif
-# if BOOST_PP_LOCAL_R(560)
-    BOOST_PP_LOCAL_MACRO(560)
-# endif
-# if BOOST_PP_LOCAL_R(559)
-    BOOST_PP_LOCAL_MACRO(559)
-# endif
-# if BOOST_PP_LOCAL_R(558)
-    BOOST_PP_LOCAL_MACRO(558)
-# endif
-# if BOOST_PP_LOCAL_R(557)
-    BOOST_PP_LOCAL_MACRO(557)
-# endif
-# if BOOST_PP_LOCAL_R(556)
-    BOOST_PP_LOCAL_MACRO(556)
-# endif
-# if BOOST_PP_LOCAL_R(555)
-    BOOST_PP_LOCAL_MACRO(555)
-# endif
-# if BOOST_PP_LOCAL_R(554)
-    BOOST_PP_LOCAL_MACRO(554)
-# endif
-# if BOOST_PP_LOCAL_R(553)
-    BOOST_PP_LOCAL_MACRO(553)
-# endif
-# if BOOST_PP_LOCAL_R(552)
-    BOOST_PP_LOCAL_MACRO(552)
-# endif
-# if BOOST_PP_LOCAL_R(551)
-    BOOST_PP_LOCAL_MACRO(551)
-# endif
-# if BOOST_PP_LOCAL_R(550)
-    BOOST_PP_LOCAL_MACRO(550)
-# endif
-# if BOOST_PP_LOCAL_R(549)
-    BOOST_PP_LOCAL_MACRO(549)
-# endif
-# if BOOST_PP_LOCAL_R(548)
-    BOOST_PP_LOCAL_MACRO(548)
-# endif
-# if BOOST_PP_LOCAL_R(547)
-    BOOST_PP_LOCAL_MACRO(547)
-# endif
-# if BOOST_PP_LOCAL_R(546)
-    BOOST_PP_LOCAL_MACRO(546)
-# endif
-# if BOOST_PP_LOCAL_R(545)
-    BOOST_PP_LOCAL_MACRO(545)
-# endif
-# if BOOST_PP_LOCAL_R(544)
-    BOOST_PP_LOCAL_MACRO(544)
-# endif
-# if BOOST_PP_LOCAL_R(543)
-    BOOST_PP_LOCAL_MACRO(543)
-# endif
-# if BOOST_PP_LOCAL_R(542)
-    BOOST_PP_LOCAL_MACRO(542)
-# endif
-# if BOOST_PP_LOCAL_R(541)
-    BOOST_PP_LOCAL_MACRO(541)
-# endif
-# if BOOST_PP_LOCAL_R(540)
-    BOOST_PP_LOCAL_MACRO(540)
-# endif
-# if BOOST_PP_LOCAL_R(539)
-    BOOST_PP_LOCAL_MACRO(539)
-# endif
-# if BOOST_PP_LOCAL_R(538)
-    BOOST_PP_LOCAL_MACRO(538)
-# endif
-# if BOOST_PP_LOCAL_R(537)
-    BOOST_PP_LOCAL_MACRO(537)
-# endif
-# if BOOST_PP_LOCAL_R(536)
-    BOOST_PP_LOCAL_MACRO(536)
-# endif
-# if BOOST_PP_LOCAL_R(535)
-    BOOST_PP_LOCAL_MACRO(535)
-# endif
-# if BOOST_PP_LOCAL_R(534)
-    BOOST_PP_LOCAL_MACRO(534)
-# endif
-# if BOOST_PP_LOCAL_R(533)
-    BOOST_PP_LOCAL_MACRO(533)
-# endif
-# if BOOST_PP_LOCAL_R(532)
-    BOOST_PP_LOCAL_MACRO(532)
-# endif
-# if BOOST_PP_LOCAL_R(531)
-    BOOST_PP_LOCAL_MACRO(531)
-# endif
-# if BOOST_PP_LOCAL_R(530)
-    BOOST_PP_LOCAL_MACRO(530)
-# endif
-# if BOOST_PP_LOCAL_R(529)
-    BOOST_PP_LOCAL_MACRO(529)
-# endif
-# if BOOST_PP_LOCAL_R(528)
-    BOOST_PP_LOCAL_MACRO(528)
-# endif
-# if BOOST_PP_LOCAL_R(527)
-    BOOST_PP_LOCAL_MACRO(527)
-# endif
-# if BOOST_PP_LOCAL_R(526)
-    BOOST_PP_LOCAL_MACRO(526)
-# endif
-# if BOOST_PP_LOCAL_R(525)
-    BOOST_PP_LOCAL_MACRO(525)
-# endif
-# if BOOST_PP_LOCAL_R(524)
-    BOOST_PP_LOCAL_MACRO(524)
-# endif
-# if BOOST_PP_LOCAL_R(523)
-    BOOST_PP_LOCAL_MACRO(523)
-# endif
-# if BOOST_PP_LOCAL_R(522)
-    BOOST_PP_LOCAL_MACRO(522)
-# endif
-# if BOOST_PP_LOCAL_R(521)
-    BOOST_PP_LOCAL_MACRO(521)
-# endif
-# if BOOST_PP_LOCAL_R(520)
-    BOOST_PP_LOCAL_MACRO(520)
-# endif
-# if BOOST_PP_LOCAL_R(519)
-    BOOST_PP_LOCAL_MACRO(519)
-# endif
-# if BOOST_PP_LOCAL_R(518)
-    BOOST_PP_LOCAL_MACRO(518)
-# endif
-# if BOOST_PP_LOCAL_R(517)
-    BOOST_PP_LOCAL_MACRO(517)
-# endif
-# if BOOST_PP_LOCAL_R(516)
-    BOOST_PP_LOCAL_MACRO(516)
-# endif
-# if BOOST_PP_LOCAL_R(515)
-    BOOST_PP_LOCAL_MACRO(515)
-# endif
-# if BOOST_PP_LOCAL_R(514)
-    BOOST_PP_LOCAL_MACRO(514)
-# endif
-# if BOOST_PP_LOCAL_R(513)
-    BOOST_PP_LOCAL_MACRO(513)
-# endif
@@ -1,532 +0,0 @@
-# /* Copyright (C) 2001
-#  * Housemarque Oy
-#  * http://www.housemarque.com
-#  *
-#  * Distributed under the Boost Software License, Version 1.0. (See
-#  * accompanying file LICENSE_1_0.txt or copy at
-#  * http://www.boost.org/LICENSE_1_0.txt)
-#  */
-#
-# /* Revised by Paul Mensonides (2002) */
-# /* Revised by Edward Diener (2020) */
-#
-# /* See http://www.boost.org for most recent version. */
-#
-# ifndef BOOST_PREPROCESSOR_REPETITION_DETAIL_EDG_FOR_512_HPP
-# define BOOST_PREPROCESSOR_REPETITION_DETAIL_EDG_FOR_512_HPP
-#
-# define BOOST_PP_FOR_257(s, p, o, m) BOOST_PP_FOR_257_I(s, p, o, m)
-# define BOOST_PP_FOR_258(s, p, o, m) BOOST_PP_FOR_258_I(s, p, o, m)
-# define BOOST_PP_FOR_259(s, p, o, m) BOOST_PP_FOR_259_I(s, p, o, m)
-# define BOOST_PP_FOR_260(s, p, o, m) BOOST_PP_FOR_260_I(s, p, o, m)
-# define BOOST_PP_FOR_261(s, p, o, m) BOOST_PP_FOR_261_I(s, p, o, m)
-# define BOOST_PP_FOR_262(s, p, o, m) BOOST_PP_FOR_262_I(s, p, o, m)
-# define BOOST_PP_FOR_263(s, p, o, m) BOOST_PP_FOR_263_I(s, p, o, m)
-# define BOOST_PP_FOR_264(s, p, o, m) BOOST_PP_FOR_264_I(s, p, o, m)
-# define BOOST_PP_FOR_265(s, p, o, m) BOOST_PP_FOR_265_I(s, p, o, m)
-# define BOOST_PP_FOR_266(s, p, o, m) BOOST_PP_FOR_266_I(s, p, o, m)
-# define BOOST_PP_FOR_267(s, p, o, m) BOOST_PP_FOR_267_I(s, p, o, m)
-# define BOOST_PP_FOR_268(s, p, o, m) BOOST_PP_FOR_268_I(s, p, o, m)
-# define BOOST_PP_FOR_269(s, p, o, m) BOOST_PP_FOR_269_I(s, p, o, m)
-# define BOOST_PP_FOR_270(s, p, o, m) BOOST_PP_FOR_270_I(s, p, o, m)
-# define BOOST_PP_FOR_271(s, p, o, m) BOOST_PP_FOR_271_I(s, p, o, m)
-# define BOOST_PP_FOR_272(s, p, o, m) BOOST_PP_FOR_272_I(s, p, o, m)
-# define BOOST_PP_FOR_273(s, p, o, m) BOOST_PP_FOR_273_I(s, p, o, m)
-# define BOOST_PP_FOR_274(s, p, o, m) BOOST_PP_FOR_274_I(s, p, o, m)
-# define BOOST_PP_FOR_275(s, p, o, m) BOOST_PP_FOR_275_I(s, p, o, m)
-# define BOOST_PP_FOR_276(s, p, o, m) BOOST_PP_FOR_276_I(s, p, o, m)
-# define BOOST_PP_FOR_277(s, p, o, m) BOOST_PP_FOR_277_I(s, p, o, m)
-# define BOOST_PP_FOR_278(s, p, o, m) BOOST_PP_FOR_278_I(s, p, o, m)
-# define BOOST_PP_FOR_279(s, p, o, m) BOOST_PP_FOR_279_I(s, p, o, m)
-# define BOOST_PP_FOR_280(s, p, o, m) BOOST_PP_FOR_280_I(s, p, o, m)
-# define BOOST_PP_FOR_281(s, p, o, m) BOOST_PP_FOR_281_I(s, p, o, m)
-# define BOOST_PP_FOR_282(s, p, o, m) BOOST_PP_FOR_282_I(s, p, o, m)
-# define BOOST_PP_FOR_283(s, p, o, m) BOOST_PP_FOR_283_I(s, p, o, m)
-# define BOOST_PP_FOR_284(s, p, o, m) BOOST_PP_FOR_284_I(s, p, o, m)
-# define BOOST_PP_FOR_285(s, p, o, m) BOOST_PP_FOR_285_I(s, p, o, m)
-# define BOOST_PP_FOR_286(s, p, o, m) BOOST_PP_FOR_286_I(s, p, o, m)
-# define BOOST_PP_FOR_287(s, p, o, m) BOOST_PP_FOR_287_I(s, p, o, m)
-# define BOOST_PP_FOR_288(s, p, o, m) BOOST_PP_FOR_288_I(s, p, o, m)
-# define BOOST_PP_FOR_289(s, p, o, m) BOOST_PP_FOR_289_I(s, p, o, m)
-# define BOOST_PP_FOR_290(s, p, o, m) BOOST_PP_FOR_290_I(s, p, o, m)
-# define BOOST_PP_FOR_291(s, p, o, m) BOOST_PP_FOR_291_I(s, p, o, m)
-# define BOOST_PP_FOR_292(s, p, o, m) BOOST_PP_FOR_292_I(s, p, o, m)
-# define BOOST_PP_FOR_293(s, p, o, m) BOOST_PP_FOR_293_I(s, p, o, m)
-# define BOOST_PP_FOR_294(s, p, o, m) BOOST_PP_FOR_294_I(s, p, o, m)
-# define BOOST_PP_FOR_295(s, p, o, m) BOOST_PP_FOR_295_I(s, p, o, m)
-# define BOOST_PP_FOR_296(s, p, o, m) BOOST_PP_FOR_296_I(s, p, o, m)
-# define BOOST_PP_FOR_297(s, p, o, m) BOOST_PP_FOR_297_I(s, p, o, m)
-# define BOOST_PP_FOR_298(s, p, o, m) BOOST_PP_FOR_298_I(s, p, o, m)
-# define BOOST_PP_FOR_299(s, p, o, m) BOOST_PP_FOR_299_I(s, p, o, m)
-# define BOOST_PP_FOR_300(s, p, o, m) BOOST_PP_FOR_300_I(s, p, o, m)
-# define BOOST_PP_FOR_301(s, p, o, m) BOOST_PP_FOR_301_I(s, p, o, m)
-# define BOOST_PP_FOR_302(s, p, o, m) BOOST_PP_FOR_302_I(s, p, o, m)
-# define BOOST_PP_FOR_303(s, p, o, m) BOOST_PP_FOR_303_I(s, p, o, m)
-# define BOOST_PP_FOR_304(s, p, o, m) BOOST_PP_FOR_304_I(s, p, o, m)
-# define BOOST_PP_FOR_305(s, p, o, m) BOOST_PP_FOR_305_I(s, p, o, m)
-# define BOOST_PP_FOR_306(s, p, o, m) BOOST_PP_FOR_306_I(s, p, o, m)
-# define BOOST_PP_FOR_307(s, p, o, m) BOOST_PP_FOR_307_I(s, p, o, m)
-# define BOOST_PP_FOR_308(s, p, o, m) BOOST_PP_FOR_308_I(s, p, o, m)
-# define BOOST_PP_FOR_309(s, p, o, m) BOOST_PP_FOR_309_I(s, p, o, m)
-# define BOOST_PP_FOR_310(s, p, o, m) BOOST_PP_FOR_310_I(s, p, o, m)
-# define BOOST_PP_FOR_311(s, p, o, m) BOOST_PP_FOR_311_I(s, p, o, m)
-# define BOOST_PP_FOR_312(s, p, o, m) BOOST_PP_FOR_312_I(s, p, o, m)
-# define BOOST_PP_FOR_313(s, p, o, m) BOOST_PP_FOR_313_I(s, p, o, m)
-# define BOOST_PP_FOR_314(s, p, o, m) BOOST_PP_FOR_314_I(s, p, o, m)
-# define BOOST_PP_FOR_315(s, p, o, m) BOOST_PP_FOR_315_I(s, p, o, m)
-# define BOOST_PP_FOR_316(s, p, o, m) BOOST_PP_FOR_316_I(s, p, o, m)
-# define BOOST_PP_FOR_317(s, p, o, m) BOOST_PP_FOR_317_I(s, p, o, m)
-# define BOOST_PP_FOR_318(s, p, o, m) BOOST_PP_FOR_318_I(s, p, o, m)
-# define BOOST_PP_FOR_319(s, p, o, m) BOOST_PP_FOR_319_I(s, p, o, m)
-# define BOOST_PP_FOR_320(s, p, o, m) BOOST_PP_FOR_320_I(s, p, o, m)
-# define BOOST_PP_FOR_321(s, p, o, m) BOOST_PP_FOR_321_I(s, p, o, m)
-# define BOOST_PP_FOR_322(s, p, o, m) BOOST_PP_FOR_322_I(s, p, o, m)
-# define BOOST_PP_FOR_323(s, p, o, m) BOOST_PP_FOR_323_I(s, p, o, m)
-# define BOOST_PP_FOR_324(s, p, o, m) BOOST_PP_FOR_324_I(s, p, o, m)
-# define BOOST_PP_FOR_325(s, p, o, m) BOOST_PP_FOR_325_I(s, p, o, m)
-# define BOOST_PP_FOR_326(s, p, o, m) BOOST_PP_FOR_326_I(s, p, o, m)
-# define BOOST_PP_FOR_327(s, p, o, m) BOOST_PP_FOR_327_I(s, p, o, m)
-# define BOOST_PP_FOR_328(s, p, o, m) BOOST_PP_FOR_328_I(s, p, o, m)
-# define BOOST_PP_FOR_329(s, p, o, m) BOOST_PP_FOR_329_I(s, p, o, m)
-# define BOOST_PP_FOR_330(s, p, o, m) BOOST_PP_FOR_330_I(s, p, o, m)
-# define BOOST_PP_FOR_331(s, p, o, m) BOOST_PP_FOR_331_I(s, p, o, m)
-# define BOOST_PP_FOR_332(s, p, o, m) BOOST_PP_FOR_332_I(s, p, o, m)
-# define BOOST_PP_FOR_333(s, p, o, m) BOOST_PP_FOR_333_I(s, p, o, m)
-# define BOOST_PP_FOR_334(s, p, o, m) BOOST_PP_FOR_334_I(s, p, o, m)
-# define BOOST_PP_FOR_335(s, p, o, m) BOOST_PP_FOR_335_I(s, p, o, m)
-# define BOOST_PP_FOR_336(s, p, o, m) BOOST_PP_FOR_336_I(s, p, o, m)
-# define BOOST_PP_FOR_337(s, p, o, m) BOOST_PP_FOR_337_I(s, p, o, m)
-# define BOOST_PP_FOR_338(s, p, o, m) BOOST_PP_FOR_338_I(s, p, o, m)
-# define BOOST_PP_FOR_339(s, p, o, m) BOOST_PP_FOR_339_I(s, p, o, m)
-# define BOOST_PP_FOR_340(s, p, o, m) BOOST_PP_FOR_340_I(s, p, o, m)
-# define BOOST_PP_FOR_341(s, p, o, m) BOOST_PP_FOR_341_I(s, p, o, m)
-# define BOOST_PP_FOR_342(s, p, o, m) BOOST_PP_FOR_342_I(s, p, o, m)
-# define BOOST_PP_FOR_343(s, p, o, m) BOOST_PP_FOR_343_I(s, p, o, m)
-# define BOOST_PP_FOR_344(s, p, o, m) BOOST_PP_FOR_344_I(s, p, o, m)
-# define BOOST_PP_FOR_345(s, p, o, m) BOOST_PP_FOR_345_I(s, p, o, m)
-# define BOOST_PP_FOR_346(s, p, o, m) BOOST_PP_FOR_346_I(s, p, o, m)
-# define BOOST_PP_FOR_347(s, p, o, m) BOOST_PP_FOR_347_I(s, p, o, m)
-# define BOOST_PP_FOR_348(s, p, o, m) BOOST_PP_FOR_348_I(s, p, o, m)
-# define BOOST_PP_FOR_349(s, p, o, m) BOOST_PP_FOR_349_I(s, p, o, m)
-# define BOOST_PP_FOR_350(s, p, o, m) BOOST_PP_FOR_350_I(s, p, o, m)
-# define BOOST_PP_FOR_351(s, p, o, m) BOOST_PP_FOR_351_I(s, p, o, m)
-# define BOOST_PP_FOR_352(s, p, o, m) BOOST_PP_FOR_352_I(s, p, o, m)
-# define BOOST_PP_FOR_353(s, p, o, m) BOOST_PP_FOR_353_I(s, p, o, m)
-# define BOOST_PP_FOR_354(s, p, o, m) BOOST_PP_FOR_354_I(s, p, o, m)
-# define BOOST_PP_FOR_355(s, p, o, m) BOOST_PP_FOR_355_I(s, p, o, m)
-# define BOOST_PP_FOR_356(s, p, o, m) BOOST_PP_FOR_356_I(s, p, o, m)
-# define BOOST_PP_FOR_357(s, p, o, m) BOOST_PP_FOR_357_I(s, p, o, m)
-# define BOOST_PP_FOR_358(s, p, o, m) BOOST_PP_FOR_358_I(s, p, o, m)
-# define BOOST_PP_FOR_359(s, p, o, m) BOOST_PP_FOR_359_I(s, p, o, m)
-# define BOOST_PP_FOR_360(s, p, o, m) BOOST_PP_FOR_360_I(s, p, o, m)
-# define BOOST_PP_FOR_361(s, p, o, m) BOOST_PP_FOR_361_I(s, p, o, m)
-# define BOOST_PP_FOR_362(s, p, o, m) BOOST_PP_FOR_362_I(s, p, o, m)
-# define BOOST_PP_FOR_363(s, p, o, m) BOOST_PP_FOR_363_I(s, p, o, m)
-# define BOOST_PP_FOR_364(s, p, o, m) BOOST_PP_FOR_364_I(s, p, o, m)
-# define BOOST_PP_FOR_365(s, p, o, m) BOOST_PP_FOR_365_I(s, p, o, m)
-# define BOOST_PP_FOR_366(s, p, o, m) BOOST_PP_FOR_366_I(s, p, o, m)
-# define BOOST_PP_FOR_367(s, p, o, m) BOOST_PP_FOR_367_I(s, p, o, m)
-# define BOOST_PP_FOR_368(s, p, o, m) BOOST_PP_FOR_368_I(s, p, o, m)
-# define BOOST_PP_FOR_369(s, p, o, m) BOOST_PP_FOR_369_I(s, p, o, m)
-# define BOOST_PP_FOR_370(s, p, o, m) BOOST_PP_FOR_370_I(s, p, o, m)
-# define BOOST_PP_FOR_371(s, p, o, m) BOOST_PP_FOR_371_I(s, p, o, m)
-# define BOOST_PP_FOR_372(s, p, o, m) BOOST_PP_FOR_372_I(s, p, o, m)
-# define BOOST_PP_FOR_373(s, p, o, m) BOOST_PP_FOR_373_I(s, p, o, m)
-# define BOOST_PP_FOR_374(s, p, o, m) BOOST_PP_FOR_374_I(s, p, o, m)
-# define BOOST_PP_FOR_375(s, p, o, m) BOOST_PP_FOR_375_I(s, p, o, m)
-# define BOOST_PP_FOR_376(s, p, o, m) BOOST_PP_FOR_376_I(s, p, o, m)
-# define BOOST_PP_FOR_377(s, p, o, m) BOOST_PP_FOR_377_I(s, p, o, m)
-# define BOOST_PP_FOR_378(s, p, o, m) BOOST_PP_FOR_378_I(s, p, o, m)
-# define BOOST_PP_FOR_379(s, p, o, m) BOOST_PP_FOR_379_I(s, p, o, m)
-# define BOOST_PP_FOR_380(s, p, o, m) BOOST_PP_FOR_380_I(s, p, o, m)
-# define BOOST_PP_FOR_381(s, p, o, m) BOOST_PP_FOR_381_I(s, p, o, m)
-# define BOOST_PP_FOR_382(s, p, o, m) BOOST_PP_FOR_382_I(s, p, o, m)
-# define BOOST_PP_FOR_383(s, p, o, m) BOOST_PP_FOR_383_I(s, p, o, m)
-# define BOOST_PP_FOR_384(s, p, o, m) BOOST_PP_FOR_384_I(s, p, o, m)
-# define BOOST_PP_FOR_385(s, p, o, m) BOOST_PP_FOR_385_I(s, p, o, m)
-# define BOOST_PP_FOR_386(s, p, o, m) BOOST_PP_FOR_386_I(s, p, o, m)
-# define BOOST_PP_FOR_387(s, p, o, m) BOOST_PP_FOR_387_I(s, p, o, m)
-# define BOOST_PP_FOR_388(s, p, o, m) BOOST_PP_FOR_388_I(s, p, o, m)
-# define BOOST_PP_FOR_389(s, p, o, m) BOOST_PP_FOR_389_I(s, p, o, m)
-# define BOOST_PP_FOR_390(s, p, o, m) BOOST_PP_FOR_390_I(s, p, o, m)
-# define BOOST_PP_FOR_391(s, p, o, m) BOOST_PP_FOR_391_I(s, p, o, m)
-# define BOOST_PP_FOR_392(s, p, o, m) BOOST_PP_FOR_392_I(s, p, o, m)
-# define BOOST_PP_FOR_393(s, p, o, m) BOOST_PP_FOR_393_I(s, p, o, m)
-# define BOOST_PP_FOR_394(s, p, o, m) BOOST_PP_FOR_394_I(s, p, o, m)
-# define BOOST_PP_FOR_395(s, p, o, m) BOOST_PP_FOR_395_I(s, p, o, m)
-# define BOOST_PP_FOR_396(s, p, o, m) BOOST_PP_FOR_396_I(s, p, o, m)
-# define BOOST_PP_FOR_397(s, p, o, m) BOOST_PP_FOR_397_I(s, p, o, m)
-# define BOOST_PP_FOR_398(s, p, o, m) BOOST_PP_FOR_398_I(s, p, o, m)
-# define BOOST_PP_FOR_399(s, p, o, m) BOOST_PP_FOR_399_I(s, p, o, m)
-# define BOOST_PP_FOR_400(s, p, o, m) BOOST_PP_FOR_400_I(s, p, o, m)
-# define BOOST_PP_FOR_401(s, p, o, m) BOOST_PP_FOR_401_I(s, p, o, m)
-# define BOOST_PP_FOR_402(s, p, o, m) BOOST_PP_FOR_402_I(s, p, o, m)
-# define BOOST_PP_FOR_403(s, p, o, m) BOOST_PP_FOR_403_I(s, p, o, m)
-# define BOOST_PP_FOR_404(s, p, o, m) BOOST_PP_FOR_404_I(s, p, o, m)
-# define BOOST_PP_FOR_405(s, p, o, m) BOOST_PP_FOR_405_I(s, p, o, m)
-# define BOOST_PP_FOR_406(s, p, o, m) BOOST_PP_FOR_406_I(s, p, o, m)
-# define BOOST_PP_FOR_407(s, p, o, m) BOOST_PP_FOR_407_I(s, p, o, m)
-# define BOOST_PP_FOR_408(s, p, o, m) BOOST_PP_FOR_408_I(s, p, o, m)
-# define BOOST_PP_FOR_409(s, p, o, m) BOOST_PP_FOR_409_I(s, p, o, m)
-# define BOOST_PP_FOR_410(s, p, o, m) BOOST_PP_FOR_410_I(s, p, o, m)
-# define BOOST_PP_FOR_411(s, p, o, m) BOOST_PP_FOR_411_I(s, p, o, m)
-# define BOOST_PP_FOR_412(s, p, o, m) BOOST_PP_FOR_412_I(s, p, o, m)
-# define BOOST_PP_FOR_413(s, p, o, m) BOOST_PP_FOR_413_I(s, p, o, m)
-# define BOOST_PP_FOR_414(s, p, o, m) BOOST_PP_FOR_414_I(s, p, o, m)
-# define BOOST_PP_FOR_415(s, p, o, m) BOOST_PP_FOR_415_I(s, p, o, m)
-# define BOOST_PP_FOR_416(s, p, o, m) BOOST_PP_FOR_416_I(s, p, o, m)
-# define BOOST_PP_FOR_417(s, p, o, m) BOOST_PP_FOR_417_I(s, p, o, m)
-# define BOOST_PP_FOR_418(s, p, o, m) BOOST_PP_FOR_418_I(s, p, o, m)
-# define BOOST_PP_FOR_419(s, p, o, m) BOOST_PP_FOR_419_I(s, p, o, m)
-# define BOOST_PP_FOR_420(s, p, o, m) BOOST_PP_FOR_420_I(s, p, o, m)
-# define BOOST_PP_FOR_421(s, p, o, m) BOOST_PP_FOR_421_I(s, p, o, m)
-# define BOOST_PP_FOR_422(s, p, o, m) BOOST_PP_FOR_422_I(s, p, o, m)
-# define BOOST_PP_FOR_423(s, p, o, m) BOOST_PP_FOR_423_I(s, p, o, m)
-# define BOOST_PP_FOR_424(s, p, o, m) BOOST_PP_FOR_424_I(s, p, o, m)
-# define BOOST_PP_FOR_425(s, p, o, m) BOOST_PP_FOR_425_I(s, p, o, m)
-# define BOOST_PP_FOR_426(s, p, o, m) BOOST_PP_FOR_426_I(s, p, o, m)
-# define BOOST_PP_FOR_427(s, p, o, m) BOOST_PP_FOR_427_I(s, p, o, m)
-# define BOOST_PP_FOR_428(s, p, o, m) BOOST_PP_FOR_428_I(s, p, o, m)
-# define BOOST_PP_FOR_429(s, p, o, m) BOOST_PP_FOR_429_I(s, p, o, m)
-# define BOOST_PP_FOR_430(s, p, o, m) BOOST_PP_FOR_430_I(s, p, o, m)
-# define BOOST_PP_FOR_431(s, p, o, m) BOOST_PP_FOR_431_I(s, p, o, m)
-# define BOOST_PP_FOR_432(s, p, o, m) BOOST_PP_FOR_432_I(s, p, o, m)
-# define BOOST_PP_FOR_433(s, p, o, m) BOOST_PP_FOR_433_I(s, p, o, m)
-# define BOOST_PP_FOR_434(s, p, o, m) BOOST_PP_FOR_434_I(s, p, o, m)
-# define BOOST_PP_FOR_435(s, p, o, m) BOOST_PP_FOR_435_I(s, p, o, m)
-# define BOOST_PP_FOR_436(s, p, o, m) BOOST_PP_FOR_436_I(s, p, o, m)
-# define BOOST_PP_FOR_437(s, p, o, m) BOOST_PP_FOR_437_I(s, p, o, m)
-# define BOOST_PP_FOR_438(s, p, o, m) BOOST_PP_FOR_438_I(s, p, o, m)
-# define BOOST_PP_FOR_439(s, p, o, m) BOOST_PP_FOR_439_I(s, p, o, m)
-# define BOOST_PP_FOR_440(s, p, o, m) BOOST_PP_FOR_440_I(s, p, o, m)
-# define BOOST_PP_FOR_441(s, p, o, m) BOOST_PP_FOR_441_I(s, p, o, m)
-# define BOOST_PP_FOR_442(s, p, o, m) BOOST_PP_FOR_442_I(s, p, o, m)
-# define BOOST_PP_FOR_443(s, p, o, m) BOOST_PP_FOR_443_I(s, p, o, m)
-# define BOOST_PP_FOR_444(s, p, o, m) BOOST_PP_FOR_444_I(s, p, o, m)
-# define BOOST_PP_FOR_445(s, p, o, m) BOOST_PP_FOR_445_I(s, p, o, m)
-# define BOOST_PP_FOR_446(s, p, o, m) BOOST_PP_FOR_446_I(s, p, o, m)
-# define BOOST_PP_FOR_447(s, p, o, m) BOOST_PP_FOR_447_I(s, p, o, m)
-# define BOOST_PP_FOR_448(s, p, o, m) BOOST_PP_FOR_448_I(s, p, o, m)
-# define BOOST_PP_FOR_449(s, p, o, m) BOOST_PP_FOR_449_I(s, p, o, m)
-# define BOOST_PP_FOR_450(s, p, o, m) BOOST_PP_FOR_450_I(s, p, o, m)
-# define BOOST_PP_FOR_451(s, p, o, m) BOOST_PP_FOR_451_I(s, p, o, m)
-# define BOOST_PP_FOR_452(s, p, o, m) BOOST_PP_FOR_452_I(s, p, o, m)
-# define BOOST_PP_FOR_453(s, p, o, m) BOOST_PP_FOR_453_I(s, p, o, m)
-# define BOOST_PP_FOR_454(s, p, o, m) BOOST_PP_FOR_454_I(s, p, o, m)
-# define BOOST_PP_FOR_455(s, p, o, m) BOOST_PP_FOR_455_I(s, p, o, m)
-# define BOOST_PP_FOR_456(s, p, o, m) BOOST_PP_FOR_456_I(s, p, o, m)
-# define BOOST_PP_FOR_457(s, p, o, m) BOOST_PP_FOR_457_I(s, p, o, m)
-# define BOOST_PP_FOR_458(s, p, o, m) BOOST_PP_FOR_458_I(s, p, o, m)
-# define BOOST_PP_FOR_459(s, p, o, m) BOOST_PP_FOR_459_I(s, p, o, m)
-# define BOOST_PP_FOR_460(s, p, o, m) BOOST_PP_FOR_460_I(s, p, o, m)
-# define BOOST_PP_FOR_461(s, p, o, m) BOOST_PP_FOR_461_I(s, p, o, m)
-# define BOOST_PP_FOR_462(s, p, o, m) BOOST_PP_FOR_462_I(s, p, o, m)
-# define BOOST_PP_FOR_463(s, p, o, m) BOOST_PP_FOR_463_I(s, p, o, m)
-# define BOOST_PP_FOR_464(s, p, o, m) BOOST_PP_FOR_464_I(s, p, o, m)
-# define BOOST_PP_FOR_465(s, p, o, m) BOOST_PP_FOR_465_I(s, p, o, m)
-# define BOOST_PP_FOR_466(s, p, o, m) BOOST_PP_FOR_466_I(s, p, o, m)
-# define BOOST_PP_FOR_467(s, p, o, m) BOOST_PP_FOR_467_I(s, p, o, m)
-# define BOOST_PP_FOR_468(s, p, o, m) BOOST_PP_FOR_468_I(s, p, o, m)
-# define BOOST_PP_FOR_469(s, p, o, m) BOOST_PP_FOR_469_I(s, p, o, m)
-# define BOOST_PP_FOR_470(s, p, o, m) BOOST_PP_FOR_470_I(s, p, o, m)
-# define BOOST_PP_FOR_471(s, p, o, m) BOOST_PP_FOR_471_I(s, p, o, m)
-# define BOOST_PP_FOR_472(s, p, o, m) BOOST_PP_FOR_472_I(s, p, o, m)
-# define BOOST_PP_FOR_473(s, p, o, m) BOOST_PP_FOR_473_I(s, p, o, m)
-# define BOOST_PP_FOR_474(s, p, o, m) BOOST_PP_FOR_474_I(s, p, o, m)
-# define BOOST_PP_FOR_475(s, p, o, m) BOOST_PP_FOR_475_I(s, p, o, m)
-# define BOOST_PP_FOR_476(s, p, o, m) BOOST_PP_FOR_476_I(s, p, o, m)
-# define BOOST_PP_FOR_477(s, p, o, m) BOOST_PP_FOR_477_I(s, p, o, m)
-# define BOOST_PP_FOR_478(s, p, o, m) BOOST_PP_FOR_478_I(s, p, o, m)
-# define BOOST_PP_FOR_479(s, p, o, m) BOOST_PP_FOR_479_I(s, p, o, m)
-# define BOOST_PP_FOR_480(s, p, o, m) BOOST_PP_FOR_480_I(s, p, o, m)
-# define BOOST_PP_FOR_481(s, p, o, m) BOOST_PP_FOR_481_I(s, p, o, m)
-# define BOOST_PP_FOR_482(s, p, o, m) BOOST_PP_FOR_482_I(s, p, o, m)
-# define BOOST_PP_FOR_483(s, p, o, m) BOOST_PP_FOR_483_I(s, p, o, m)
-# define BOOST_PP_FOR_484(s, p, o, m) BOOST_PP_FOR_484_I(s, p, o, m)
-# define BOOST_PP_FOR_485(s, p, o, m) BOOST_PP_FOR_485_I(s, p, o, m)
-# define BOOST_PP_FOR_486(s, p, o, m) BOOST_PP_FOR_486_I(s, p, o, m)
-# define BOOST_PP_FOR_487(s, p, o, m) BOOST_PP_FOR_487_I(s, p, o, m)
-# define BOOST_PP_FOR_488(s, p, o, m) BOOST_PP_FOR_488_I(s, p, o, m)
-# define BOOST_PP_FOR_489(s, p, o, m) BOOST_PP_FOR_489_I(s, p, o, m)
-# define BOOST_PP_FOR_490(s, p, o, m) BOOST_PP_FOR_490_I(s, p, o, m)
-# define BOOST_PP_FOR_491(s, p, o, m) BOOST_PP_FOR_491_I(s, p, o, m)
-# define BOOST_PP_FOR_492(s, p, o, m) BOOST_PP_FOR_492_I(s, p, o, m)
-# define BOOST_PP_FOR_493(s, p, o, m) BOOST_PP_FOR_493_I(s, p, o, m)
-# define BOOST_PP_FOR_494(s, p, o, m) BOOST_PP_FOR_494_I(s, p, o, m)
-# define BOOST_PP_FOR_495(s, p, o, m) BOOST_PP_FOR_495_I(s, p, o, m)
-# define BOOST_PP_FOR_496(s, p, o, m) BOOST_PP_FOR_496_I(s, p, o, m)
-# define BOOST_PP_FOR_497(s, p, o, m) BOOST_PP_FOR_497_I(s, p, o, m)
-# define BOOST_PP_FOR_498(s, p, o, m) BOOST_PP_FOR_498_I(s, p, o, m)
-# define BOOST_PP_FOR_499(s, p, o, m) BOOST_PP_FOR_499_I(s, p, o, m)
-# define BOOST_PP_FOR_500(s, p, o, m) BOOST_PP_FOR_500_I(s, p, o, m)
-# define BOOST_PP_FOR_501(s, p, o, m) BOOST_PP_FOR_501_I(s, p, o, m)
-# define BOOST_PP_FOR_502(s, p, o, m) BOOST_PP_FOR_502_I(s, p, o, m)
-# define BOOST_PP_FOR_503(s, p, o, m) BOOST_PP_FOR_503_I(s, p, o, m)
-# define BOOST_PP_FOR_504(s, p, o, m) BOOST_PP_FOR_504_I(s, p, o, m)
-# define BOOST_PP_FOR_505(s, p, o, m) BOOST_PP_FOR_505_I(s, p, o, m)
-# define BOOST_PP_FOR_506(s, p, o, m) BOOST_PP_FOR_506_I(s, p, o, m)
-# define BOOST_PP_FOR_507(s, p, o, m) BOOST_PP_FOR_507_I(s, p, o, m)
-# define BOOST_PP_FOR_508(s, p, o, m) BOOST_PP_FOR_508_I(s, p, o, m)
-# define BOOST_PP_FOR_509(s, p, o, m) BOOST_PP_FOR_509_I(s, p, o, m)
-# define BOOST_PP_FOR_510(s, p, o, m) BOOST_PP_FOR_510_I(s, p, o, m)
-# define BOOST_PP_FOR_511(s, p, o, m) BOOST_PP_FOR_511_I(s, p, o, m)
-# define BOOST_PP_FOR_512(s, p, o, m) BOOST_PP_FOR_512_I(s, p, o, m)
-#
-# define BOOST_PP_FOR_257_I(s, p, o, m) BOOST_PP_IF(p(258, s), m, BOOST_PP_TUPLE_EAT_2)(258, s) BOOST_PP_IF(p(258, s), BOOST_PP_FOR_258, BOOST_PP_TUPLE_EAT_4)(o(258, s), p, o, m)
-# define BOOST_PP_FOR_258_I(s, p, o, m) BOOST_PP_IF(p(259, s), m, BOOST_PP_TUPLE_EAT_2)(259, s) BOOST_PP_IF(p(259, s), BOOST_PP_FOR_259, BOOST_PP_TUPLE_EAT_4)(o(259, s), p, o, m)
-# define BOOST_PP_FOR_259_I(s, p, o, m) BOOST_PP_IF(p(260, s), m, BOOST_PP_TUPLE_EAT_2)(260, s) BOOST_PP_IF(p(260, s), BOOST_PP_FOR_260, BOOST_PP_TUPLE_EAT_4)(o(260, s), p, o, m)
-# define BOOST_PP_FOR_260_I(s, p, o, m) BOOST_PP_IF(p(261, s), m, BOOST_PP_TUPLE_EAT_2)(261, s) BOOST_PP_IF(p(261, s), BOOST_PP_FOR_261, BOOST_PP_TUPLE_EAT_4)(o(261, s), p, o, m)
-# define BOOST_PP_FOR_261_I(s, p, o, m) BOOST_PP_IF(p(262, s), m, BOOST_PP_TUPLE_EAT_2)(262, s) BOOST_PP_IF(p(262, s), BOOST_PP_FOR_262, BOOST_PP_TUPLE_EAT_4)(o(262, s), p, o, m)
-# define BOOST_PP_FOR_262_I(s, p, o, m) BOOST_PP_IF(p(263, s), m, BOOST_PP_TUPLE_EAT_2)(263, s) BOOST_PP_IF(p(263, s), BOOST_PP_FOR_263, BOOST_PP_TUPLE_EAT_4)(o(263, s), p, o, m)
-# define BOOST_PP_FOR_263_I(s, p, o, m) BOOST_PP_IF(p(264, s), m, BOOST_PP_TUPLE_EAT_2)(264, s) BOOST_PP_IF(p(264, s), BOOST_PP_FOR_264, BOOST_PP_TUPLE_EAT_4)(o(264, s), p, o, m)
-# define BOOST_PP_FOR_264_I(s, p, o, m) BOOST_PP_IF(p(265, s), m, BOOST_PP_TUPLE_EAT_2)(265, s) BOOST_PP_IF(p(265, s), BOOST_PP_FOR_265, BOOST_PP_TUPLE_EAT_4)(o(265, s), p, o, m)
-# define BOOST_PP_FOR_265_I(s, p, o, m) BOOST_PP_IF(p(266, s), m, BOOST_PP_TUPLE_EAT_2)(266, s) BOOST_PP_IF(p(266, s), BOOST_PP_FOR_266, BOOST_PP_TUPLE_EAT_4)(o(266, s), p, o, m)
-# define BOOST_PP_FOR_266_I(s, p, o, m) BOOST_PP_IF(p(267, s), m, BOOST_PP_TUPLE_EAT_2)(267, s) BOOST_PP_IF(p(267, s), BOOST_PP_FOR_267, BOOST_PP_TUPLE_EAT_4)(o(267, s), p, o, m)
-# define BOOST_PP_FOR_267_I(s, p, o, m) BOOST_PP_IF(p(268, s), m, BOOST_PP_TUPLE_EAT_2)(268, s) BOOST_PP_IF(p(268, s), BOOST_PP_FOR_268, BOOST_PP_TUPLE_EAT_4)(o(268, s), p, o, m)
-# define BOOST_PP_FOR_268_I(s, p, o, m) BOOST_PP_IF(p(269, s), m, BOOST_PP_TUPLE_EAT_2)(269, s) BOOST_PP_IF(p(269, s), BOOST_PP_FOR_269, BOOST_PP_TUPLE_EAT_4)(o(269, s), p, o, m)
-# define BOOST_PP_FOR_269_I(s, p, o, m) BOOST_PP_IF(p(270, s), m, BOOST_PP_TUPLE_EAT_2)(270, s) BOOST_PP_IF(p(270, s), BOOST_PP_FOR_270, BOOST_PP_TUPLE_EAT_4)(o(270, s), p, o, m)
-# define BOOST_PP_FOR_270_I(s, p, o, m) BOOST_PP_IF(p(271, s), m, BOOST_PP_TUPLE_EAT_2)(271, s) BOOST_PP_IF(p(271, s), BOOST_PP_FOR_271, BOOST_PP_TUPLE_EAT_4)(o(271, s), p, o, m)
-# define BOOST_PP_FOR_271_I(s, p, o, m) BOOST_PP_IF(p(272, s), m, BOOST_PP_TUPLE_EAT_2)(272, s) BOOST_PP_IF(p(272, s), BOOST_PP_FOR_272, BOOST_PP_TUPLE_EAT_4)(o(272, s), p, o, m)
-# define BOOST_PP_FOR_272_I(s, p, o, m) BOOST_PP_IF(p(273, s), m, BOOST_PP_TUPLE_EAT_2)(273, s) BOOST_PP_IF(p(273, s), BOOST_PP_FOR_273, BOOST_PP_TUPLE_EAT_4)(o(273, s), p, o, m)
-# define BOOST_PP_FOR_273_I(s, p, o, m) BOOST_PP_IF(p(274, s), m, BOOST_PP_TUPLE_EAT_2)(274, s) BOOST_PP_IF(p(274, s), BOOST_PP_FOR_274, BOOST_PP_TUPLE_EAT_4)(o(274, s), p, o, m)
-# define BOOST_PP_FOR_274_I(s, p, o, m) BOOST_PP_IF(p(275, s), m, BOOST_PP_TUPLE_EAT_2)(275, s) BOOST_PP_IF(p(275, s), BOOST_PP_FOR_275, BOOST_PP_TUPLE_EAT_4)(o(275, s), p, o, m)
-# define BOOST_PP_FOR_275_I(s, p, o, m) BOOST_PP_IF(p(276, s), m, BOOST_PP_TUPLE_EAT_2)(276, s) BOOST_PP_IF(p(276, s), BOOST_PP_FOR_276, BOOST_PP_TUPLE_EAT_4)(o(276, s), p, o, m)
-# define BOOST_PP_FOR_276_I(s, p, o, m) BOOST_PP_IF(p(277, s), m, BOOST_PP_TUPLE_EAT_2)(277, s) BOOST_PP_IF(p(277, s), BOOST_PP_FOR_277, BOOST_PP_TUPLE_EAT_4)(o(277, s), p, o, m)
-# define BOOST_PP_FOR_277_I(s, p, o, m) BOOST_PP_IF(p(278, s), m, BOOST_PP_TUPLE_EAT_2)(278, s) BOOST_PP_IF(p(278, s), BOOST_PP_FOR_278, BOOST_PP_TUPLE_EAT_4)(o(278, s), p, o, m)
-# define BOOST_PP_FOR_278_I(s, p, o, m) BOOST_PP_IF(p(279, s), m, BOOST_PP_TUPLE_EAT_2)(279, s) BOOST_PP_IF(p(279, s), BOOST_PP_FOR_279, BOOST_PP_TUPLE_EAT_4)(o(279, s), p, o, m)
-# define BOOST_PP_FOR_279_I(s, p, o, m) BOOST_PP_IF(p(280, s), m, BOOST_PP_TUPLE_EAT_2)(280, s) BOOST_PP_IF(p(280, s), BOOST_PP_FOR_280, BOOST_PP_TUPLE_EAT_4)(o(280, s), p, o, m)
-# define BOOST_PP_FOR_280_I(s, p, o, m) BOOST_PP_IF(p(281, s), m, BOOST_PP_TUPLE_EAT_2)(281, s) BOOST_PP_IF(p(281, s), BOOST_PP_FOR_281, BOOST_PP_TUPLE_EAT_4)(o(281, s), p, o, m)
-# define BOOST_PP_FOR_281_I(s, p, o, m) BOOST_PP_IF(p(282, s), m, BOOST_PP_TUPLE_EAT_2)(282, s) BOOST_PP_IF(p(282, s), BOOST_PP_FOR_282, BOOST_PP_TUPLE_EAT_4)(o(282, s), p, o, m)
-# define BOOST_PP_FOR_282_I(s, p, o, m) BOOST_PP_IF(p(283, s), m, BOOST_PP_TUPLE_EAT_2)(283, s) BOOST_PP_IF(p(283, s), BOOST_PP_FOR_283, BOOST_PP_TUPLE_EAT_4)(o(283, s), p, o, m)
-# define BOOST_PP_FOR_283_I(s, p, o, m) BOOST_PP_IF(p(284, s), m, BOOST_PP_TUPLE_EAT_2)(284, s) BOOST_PP_IF(p(284, s), BOOST_PP_FOR_284, BOOST_PP_TUPLE_EAT_4)(o(284, s), p, o, m)
-# define BOOST_PP_FOR_284_I(s, p, o, m) BOOST_PP_IF(p(285, s), m, BOOST_PP_TUPLE_EAT_2)(285, s) BOOST_PP_IF(p(285, s), BOOST_PP_FOR_285, BOOST_PP_TUPLE_EAT_4)(o(285, s), p, o, m)
-# define BOOST_PP_FOR_285_I(s, p, o, m) BOOST_PP_IF(p(286, s), m, BOOST_PP_TUPLE_EAT_2)(286, s) BOOST_PP_IF(p(286, s), BOOST_PP_FOR_286, BOOST_PP_TUPLE_EAT_4)(o(286, s), p, o, m)
-# define BOOST_PP_FOR_286_I(s, p, o, m) BOOST_PP_IF(p(287, s), m, BOOST_PP_TUPLE_EAT_2)(287, s) BOOST_PP_IF(p(287, s), BOOST_PP_FOR_287, BOOST_PP_TUPLE_EAT_4)(o(287, s), p, o, m)
-# define BOOST_PP_FOR_287_I(s, p, o, m) BOOST_PP_IF(p(288, s), m, BOOST_PP_TUPLE_EAT_2)(288, s) BOOST_PP_IF(p(288, s), BOOST_PP_FOR_288, BOOST_PP_TUPLE_EAT_4)(o(288, s), p, o, m)
-# define BOOST_PP_FOR_288_I(s, p, o, m) BOOST_PP_IF(p(289, s), m, BOOST_PP_TUPLE_EAT_2)(289, s) BOOST_PP_IF(p(289, s), BOOST_PP_FOR_289, BOOST_PP_TUPLE_EAT_4)(o(289, s), p, o, m)
-# define BOOST_PP_FOR_289_I(s, p, o, m) BOOST_PP_IF(p(290, s), m, BOOST_PP_TUPLE_EAT_2)(290, s) BOOST_PP_IF(p(290, s), BOOST_PP_FOR_290, BOOST_PP_TUPLE_EAT_4)(o(290, s), p, o, m)
-# define BOOST_PP_FOR_290_I(s, p, o, m) BOOST_PP_IF(p(291, s), m, BOOST_PP_TUPLE_EAT_2)(291, s) BOOST_PP_IF(p(291, s), BOOST_PP_FOR_291, BOOST_PP_TUPLE_EAT_4)(o(291, s), p, o, m)
-# define BOOST_PP_FOR_291_I(s, p, o, m) BOOST_PP_IF(p(292, s), m, BOOST_PP_TUPLE_EAT_2)(292, s) BOOST_PP_IF(p(292, s), BOOST_PP_FOR_292, BOOST_PP_TUPLE_EAT_4)(o(292, s), p, o, m)
-# define BOOST_PP_FOR_292_I(s, p, o, m) BOOST_PP_IF(p(293, s), m, BOOST_PP_TUPLE_EAT_2)(293, s) BOOST_PP_IF(p(293, s), BOOST_PP_FOR_293, BOOST_PP_TUPLE_EAT_4)(o(293, s), p, o, m)
-# define BOOST_PP_FOR_293_I(s, p, o, m) BOOST_PP_IF(p(294, s), m, BOOST_PP_TUPLE_EAT_2)(294, s) BOOST_PP_IF(p(294, s), BOOST_PP_FOR_294, BOOST_PP_TUPLE_EAT_4)(o(294, s), p, o, m)
-# define BOOST_PP_FOR_294_I(s, p, o, m) BOOST_PP_IF(p(295, s), m, BOOST_PP_TUPLE_EAT_2)(295, s) BOOST_PP_IF(p(295, s), BOOST_PP_FOR_295, BOOST_PP_TUPLE_EAT_4)(o(295, s), p, o, m)
-# define BOOST_PP_FOR_295_I(s, p, o, m) BOOST_PP_IF(p(296, s), m, BOOST_PP_TUPLE_EAT_2)(296, s) BOOST_PP_IF(p(296, s), BOOST_PP_FOR_296, BOOST_PP_TUPLE_EAT_4)(o(296, s), p, o, m)
-# define BOOST_PP_FOR_296_I(s, p, o, m) BOOST_PP_IF(p(297, s), m, BOOST_PP_TUPLE_EAT_2)(297, s) BOOST_PP_IF(p(297, s), BOOST_PP_FOR_297, BOOST_PP_TUPLE_EAT_4)(o(297, s), p, o, m)
-# define BOOST_PP_FOR_297_I(s, p, o, m) BOOST_PP_IF(p(298, s), m, BOOST_PP_TUPLE_EAT_2)(298, s) BOOST_PP_IF(p(298, s), BOOST_PP_FOR_298, BOOST_PP_TUPLE_EAT_4)(o(298, s), p, o, m)
-# define BOOST_PP_FOR_298_I(s, p, o, m) BOOST_PP_IF(p(299, s), m, BOOST_PP_TUPLE_EAT_2)(299, s) BOOST_PP_IF(p(299, s), BOOST_PP_FOR_299, BOOST_PP_TUPLE_EAT_4)(o(299, s), p, o, m)
-# define BOOST_PP_FOR_299_I(s, p, o, m) BOOST_PP_IF(p(300, s), m, BOOST_PP_TUPLE_EAT_2)(300, s) BOOST_PP_IF(p(300, s), BOOST_PP_FOR_300, BOOST_PP_TUPLE_EAT_4)(o(300, s), p, o, m)
-# define BOOST_PP_FOR_300_I(s, p, o, m) BOOST_PP_IF(p(301, s), m, BOOST_PP_TUPLE_EAT_2)(301, s) BOOST_PP_IF(p(301, s), BOOST_PP_FOR_301, BOOST_PP_TUPLE_EAT_4)(o(301, s), p, o, m)
-# define BOOST_PP_FOR_301_I(s, p, o, m) BOOST_PP_IF(p(302, s), m, BOOST_PP_TUPLE_EAT_2)(302, s) BOOST_PP_IF(p(302, s), BOOST_PP_FOR_302, BOOST_PP_TUPLE_EAT_4)(o(302, s), p, o, m)
-# define BOOST_PP_FOR_302_I(s, p, o, m) BOOST_PP_IF(p(303, s), m, BOOST_PP_TUPLE_EAT_2)(303, s) BOOST_PP_IF(p(303, s), BOOST_PP_FOR_303, BOOST_PP_TUPLE_EAT_4)(o(303, s), p, o, m)
-# define BOOST_PP_FOR_303_I(s, p, o, m) BOOST_PP_IF(p(304, s), m, BOOST_PP_TUPLE_EAT_2)(304, s) BOOST_PP_IF(p(304, s), BOOST_PP_FOR_304, BOOST_PP_TUPLE_EAT_4)(o(304, s), p, o, m)
-# define BOOST_PP_FOR_304_I(s, p, o, m) BOOST_PP_IF(p(305, s), m, BOOST_PP_TUPLE_EAT_2)(305, s) BOOST_PP_IF(p(305, s), BOOST_PP_FOR_305, BOOST_PP_TUPLE_EAT_4)(o(305, s), p, o, m)
-# define BOOST_PP_FOR_305_I(s, p, o, m) BOOST_PP_IF(p(306, s), m, BOOST_PP_TUPLE_EAT_2)(306, s) BOOST_PP_IF(p(306, s), BOOST_PP_FOR_306, BOOST_PP_TUPLE_EAT_4)(o(306, s), p, o, m)
-# define BOOST_PP_FOR_306_I(s, p, o, m) BOOST_PP_IF(p(307, s), m, BOOST_PP_TUPLE_EAT_2)(307, s) BOOST_PP_IF(p(307, s), BOOST_PP_FOR_307, BOOST_PP_TUPLE_EAT_4)(o(307, s), p, o, m)
-# define BOOST_PP_FOR_307_I(s, p, o, m) BOOST_PP_IF(p(308, s), m, BOOST_PP_TUPLE_EAT_2)(308, s) BOOST_PP_IF(p(308, s), BOOST_PP_FOR_308, BOOST_PP_TUPLE_EAT_4)(o(308, s), p, o, m)
-# define BOOST_PP_FOR_308_I(s, p, o, m) BOOST_PP_IF(p(309, s), m, BOOST_PP_TUPLE_EAT_2)(309, s) BOOST_PP_IF(p(309, s), BOOST_PP_FOR_309, BOOST_PP_TUPLE_EAT_4)(o(309, s), p, o, m)
-# define BOOST_PP_FOR_309_I(s, p, o, m) BOOST_PP_IF(p(310, s), m, BOOST_PP_TUPLE_EAT_2)(310, s) BOOST_PP_IF(p(310, s), BOOST_PP_FOR_310, BOOST_PP_TUPLE_EAT_4)(o(310, s), p, o, m)
-# define BOOST_PP_FOR_310_I(s, p, o, m) BOOST_PP_IF(p(311, s), m, BOOST_PP_TUPLE_EAT_2)(311, s) BOOST_PP_IF(p(311, s), BOOST_PP_FOR_311, BOOST_PP_TUPLE_EAT_4)(o(311, s), p, o, m)
-# define BOOST_PP_FOR_311_I(s, p, o, m) BOOST_PP_IF(p(312, s), m, BOOST_PP_TUPLE_EAT_2)(312, s) BOOST_PP_IF(p(312, s), BOOST_PP_FOR_312, BOOST_PP_TUPLE_EAT_4)(o(312, s), p, o, m)
-# define BOOST_PP_FOR_312_I(s, p, o, m) BOOST_PP_IF(p(313, s), m, BOOST_PP_TUPLE_EAT_2)(313, s) BOOST_PP_IF(p(313, s), BOOST_PP_FOR_313, BOOST_PP_TUPLE_EAT_4)(o(313, s), p, o, m)
-# define BOOST_PP_FOR_313_I(s, p, o, m) BOOST_PP_IF(p(314, s), m, BOOST_PP_TUPLE_EAT_2)(314, s) BOOST_PP_IF(p(314, s), BOOST_PP_FOR_314, BOOST_PP_TUPLE_EAT_4)(o(314, s), p, o, m)
-# define BOOST_PP_FOR_314_I(s, p, o, m) BOOST_PP_IF(p(315, s), m, BOOST_PP_TUPLE_EAT_2)(315, s) BOOST_PP_IF(p(315, s), BOOST_PP_FOR_315, BOOST_PP_TUPLE_EAT_4)(o(315, s), p, o, m)
-# define BOOST_PP_FOR_315_I(s, p, o, m) BOOST_PP_IF(p(316, s), m, BOOST_PP_TUPLE_EAT_2)(316, s) BOOST_PP_IF(p(316, s), BOOST_PP_FOR_316, BOOST_PP_TUPLE_EAT_4)(o(316, s), p, o, m)
-# define BOOST_PP_FOR_316_I(s, p, o, m) BOOST_PP_IF(p(317, s), m, BOOST_PP_TUPLE_EAT_2)(317, s) BOOST_PP_IF(p(317, s), BOOST_PP_FOR_317, BOOST_PP_TUPLE_EAT_4)(o(317, s), p, o, m)
-# define BOOST_PP_FOR_317_I(s, p, o, m) BOOST_PP_IF(p(318, s), m, BOOST_PP_TUPLE_EAT_2)(318, s) BOOST_PP_IF(p(318, s), BOOST_PP_FOR_318, BOOST_PP_TUPLE_EAT_4)(o(318, s), p, o, m)
-# define BOOST_PP_FOR_318_I(s, p, o, m) BOOST_PP_IF(p(319, s), m, BOOST_PP_TUPLE_EAT_2)(319, s) BOOST_PP_IF(p(319, s), BOOST_PP_FOR_319, BOOST_PP_TUPLE_EAT_4)(o(319, s), p, o, m)
-# define BOOST_PP_FOR_319_I(s, p, o, m) BOOST_PP_IF(p(320, s), m, BOOST_PP_TUPLE_EAT_2)(320, s) BOOST_PP_IF(p(320, s), BOOST_PP_FOR_320, BOOST_PP_TUPLE_EAT_4)(o(320, s), p, o, m)
-# define BOOST_PP_FOR_320_I(s, p, o, m) BOOST_PP_IF(p(321, s), m, BOOST_PP_TUPLE_EAT_2)(321, s) BOOST_PP_IF(p(321, s), BOOST_PP_FOR_321, BOOST_PP_TUPLE_EAT_4)(o(321, s), p, o, m)
-# define BOOST_PP_FOR_321_I(s, p, o, m) BOOST_PP_IF(p(322, s), m, BOOST_PP_TUPLE_EAT_2)(322, s) BOOST_PP_IF(p(322, s), BOOST_PP_FOR_322, BOOST_PP_TUPLE_EAT_4)(o(322, s), p, o, m)
-# define BOOST_PP_FOR_322_I(s, p, o, m) BOOST_PP_IF(p(323, s), m, BOOST_PP_TUPLE_EAT_2)(323, s) BOOST_PP_IF(p(323, s), BOOST_PP_FOR_323, BOOST_PP_TUPLE_EAT_4)(o(323, s), p, o, m)
-# define BOOST_PP_FOR_323_I(s, p, o, m) BOOST_PP_IF(p(324, s), m, BOOST_PP_TUPLE_EAT_2)(324, s) BOOST_PP_IF(p(324, s), BOOST_PP_FOR_324, BOOST_PP_TUPLE_EAT_4)(o(324, s), p, o, m)
-# define BOOST_PP_FOR_324_I(s, p, o, m) BOOST_PP_IF(p(325, s), m, BOOST_PP_TUPLE_EAT_2)(325, s) BOOST_PP_IF(p(325, s), BOOST_PP_FOR_325, BOOST_PP_TUPLE_EAT_4)(o(325, s), p, o, m)
-# define BOOST_PP_FOR_325_I(s, p, o, m) BOOST_PP_IF(p(326, s), m, BOOST_PP_TUPLE_EAT_2)(326, s) BOOST_PP_IF(p(326, s), BOOST_PP_FOR_326, BOOST_PP_TUPLE_EAT_4)(o(326, s), p, o, m)
-# define BOOST_PP_FOR_326_I(s, p, o, m) BOOST_PP_IF(p(327, s), m, BOOST_PP_TUPLE_EAT_2)(327, s) BOOST_PP_IF(p(327, s), BOOST_PP_FOR_327, BOOST_PP_TUPLE_EAT_4)(o(327, s), p, o, m)
-# define BOOST_PP_FOR_327_I(s, p, o, m) BOOST_PP_IF(p(328, s), m, BOOST_PP_TUPLE_EAT_2)(328, s) BOOST_PP_IF(p(328, s), BOOST_PP_FOR_328, BOOST_PP_TUPLE_EAT_4)(o(328, s), p, o, m)
-# define BOOST_PP_FOR_328_I(s, p, o, m) BOOST_PP_IF(p(329, s), m, BOOST_PP_TUPLE_EAT_2)(329, s) BOOST_PP_IF(p(329, s), BOOST_PP_FOR_329, BOOST_PP_TUPLE_EAT_4)(o(329, s), p, o, m)
-# define BOOST_PP_FOR_329_I(s, p, o, m) BOOST_PP_IF(p(330, s), m, BOOST_PP_TUPLE_EAT_2)(330, s) BOOST_PP_IF(p(330, s), BOOST_PP_FOR_330, BOOST_PP_TUPLE_EAT_4)(o(330, s), p, o, m)
-# define BOOST_PP_FOR_330_I(s, p, o, m) BOOST_PP_IF(p(331, s), m, BOOST_PP_TUPLE_EAT_2)(331, s) BOOST_PP_IF(p(331, s), BOOST_PP_FOR_331, BOOST_PP_TUPLE_EAT_4)(o(331, s), p, o, m)
-# define BOOST_PP_FOR_331_I(s, p, o, m) BOOST_PP_IF(p(332, s), m, BOOST_PP_TUPLE_EAT_2)(332, s) BOOST_PP_IF(p(332, s), BOOST_PP_FOR_332, BOOST_PP_TUPLE_EAT_4)(o(332, s), p, o, m)
-# define BOOST_PP_FOR_332_I(s, p, o, m) BOOST_PP_IF(p(333, s), m, BOOST_PP_TUPLE_EAT_2)(333, s) BOOST_PP_IF(p(333, s), BOOST_PP_FOR_333, BOOST_PP_TUPLE_EAT_4)(o(333, s), p, o, m)
-# define BOOST_PP_FOR_333_I(s, p, o, m) BOOST_PP_IF(p(334, s), m, BOOST_PP_TUPLE_EAT_2)(334, s) BOOST_PP_IF(p(334, s), BOOST_PP_FOR_334, BOOST_PP_TUPLE_EAT_4)(o(334, s), p, o, m)
-# define BOOST_PP_FOR_334_I(s, p, o, m) BOOST_PP_IF(p(335, s), m, BOOST_PP_TUPLE_EAT_2)(335, s) BOOST_PP_IF(p(335, s), BOOST_PP_FOR_335, BOOST_PP_TUPLE_EAT_4)(o(335, s), p, o, m)
-# define BOOST_PP_FOR_335_I(s, p, o, m) BOOST_PP_IF(p(336, s), m, BOOST_PP_TUPLE_EAT_2)(336, s) BOOST_PP_IF(p(336, s), BOOST_PP_FOR_336, BOOST_PP_TUPLE_EAT_4)(o(336, s), p, o, m)
-# define BOOST_PP_FOR_336_I(s, p, o, m) BOOST_PP_IF(p(337, s), m, BOOST_PP_TUPLE_EAT_2)(337, s) BOOST_PP_IF(p(337, s), BOOST_PP_FOR_337, BOOST_PP_TUPLE_EAT_4)(o(337, s), p, o, m)
-# define BOOST_PP_FOR_337_I(s, p, o, m) BOOST_PP_IF(p(338, s), m, BOOST_PP_TUPLE_EAT_2)(338, s) BOOST_PP_IF(p(338, s), BOOST_PP_FOR_338, BOOST_PP_TUPLE_EAT_4)(o(338, s), p, o, m)
-# define BOOST_PP_FOR_338_I(s, p, o, m) BOOST_PP_IF(p(339, s), m, BOOST_PP_TUPLE_EAT_2)(339, s) BOOST_PP_IF(p(339, s), BOOST_PP_FOR_339, BOOST_PP_TUPLE_EAT_4)(o(339, s), p, o, m)
-# define BOOST_PP_FOR_339_I(s, p, o, m) BOOST_PP_IF(p(340, s), m, BOOST_PP_TUPLE_EAT_2)(340, s) BOOST_PP_IF(p(340, s), BOOST_PP_FOR_340, BOOST_PP_TUPLE_EAT_4)(o(340, s), p, o, m)
-# define BOOST_PP_FOR_340_I(s, p, o, m) BOOST_PP_IF(p(341, s), m, BOOST_PP_TUPLE_EAT_2)(341, s) BOOST_PP_IF(p(341, s), BOOST_PP_FOR_341, BOOST_PP_TUPLE_EAT_4)(o(341, s), p, o, m)
-# define BOOST_PP_FOR_341_I(s, p, o, m) BOOST_PP_IF(p(342, s), m, BOOST_PP_TUPLE_EAT_2)(342, s) BOOST_PP_IF(p(342, s), BOOST_PP_FOR_342, BOOST_PP_TUPLE_EAT_4)(o(342, s), p, o, m)
-# define BOOST_PP_FOR_342_I(s, p, o, m) BOOST_PP_IF(p(343, s), m, BOOST_PP_TUPLE_EAT_2)(343, s) BOOST_PP_IF(p(343, s), BOOST_PP_FOR_343, BOOST_PP_TUPLE_EAT_4)(o(343, s), p, o, m)
-# define BOOST_PP_FOR_343_I(s, p, o, m) BOOST_PP_IF(p(344, s), m, BOOST_PP_TUPLE_EAT_2)(344, s) BOOST_PP_IF(p(344, s), BOOST_PP_FOR_344, BOOST_PP_TUPLE_EAT_4)(o(344, s), p, o, m)
-# define BOOST_PP_FOR_344_I(s, p, o, m) BOOST_PP_IF(p(345, s), m, BOOST_PP_TUPLE_EAT_2)(345, s) BOOST_PP_IF(p(345, s), BOOST_PP_FOR_345, BOOST_PP_TUPLE_EAT_4)(o(345, s), p, o, m)
-# define BOOST_PP_FOR_345_I(s, p, o, m) BOOST_PP_IF(p(346, s), m, BOOST_PP_TUPLE_EAT_2)(346, s) BOOST_PP_IF(p(346, s), BOOST_PP_FOR_346, BOOST_PP_TUPLE_EAT_4)(o(346, s), p, o, m)
-# define BOOST_PP_FOR_346_I(s, p, o, m) BOOST_PP_IF(p(347, s), m, BOOST_PP_TUPLE_EAT_2)(347, s) BOOST_PP_IF(p(347, s), BOOST_PP_FOR_347, BOOST_PP_TUPLE_EAT_4)(o(347, s), p, o, m)
-# define BOOST_PP_FOR_347_I(s, p, o, m) BOOST_PP_IF(p(348, s), m, BOOST_PP_TUPLE_EAT_2)(348, s) BOOST_PP_IF(p(348, s), BOOST_PP_FOR_348, BOOST_PP_TUPLE_EAT_4)(o(348, s), p, o, m)
-# define BOOST_PP_FOR_348_I(s, p, o, m) BOOST_PP_IF(p(349, s), m, BOOST_PP_TUPLE_EAT_2)(349, s) BOOST_PP_IF(p(349, s), BOOST_PP_FOR_349, BOOST_PP_TUPLE_EAT_4)(o(349, s), p, o, m)
-# define BOOST_PP_FOR_349_I(s, p, o, m) BOOST_PP_IF(p(350, s), m, BOOST_PP_TUPLE_EAT_2)(350, s) BOOST_PP_IF(p(350, s), BOOST_PP_FOR_350, BOOST_PP_TUPLE_EAT_4)(o(350, s), p, o, m)
-# define BOOST_PP_FOR_350_I(s, p, o, m) BOOST_PP_IF(p(351, s), m, BOOST_PP_TUPLE_EAT_2)(351, s) BOOST_PP_IF(p(351, s), BOOST_PP_FOR_351, BOOST_PP_TUPLE_EAT_4)(o(351, s), p, o, m)
-# define BOOST_PP_FOR_351_I(s, p, o, m) BOOST_PP_IF(p(352, s), m, BOOST_PP_TUPLE_EAT_2)(352, s) BOOST_PP_IF(p(352, s), BOOST_PP_FOR_352, BOOST_PP_TUPLE_EAT_4)(o(352, s), p, o, m)
-# define BOOST_PP_FOR_352_I(s, p, o, m) BOOST_PP_IF(p(353, s), m, BOOST_PP_TUPLE_EAT_2)(353, s) BOOST_PP_IF(p(353, s), BOOST_PP_FOR_353, BOOST_PP_TUPLE_EAT_4)(o(353, s), p, o, m)
-# define BOOST_PP_FOR_353_I(s, p, o, m) BOOST_PP_IF(p(354, s), m, BOOST_PP_TUPLE_EAT_2)(354, s) BOOST_PP_IF(p(354, s), BOOST_PP_FOR_354, BOOST_PP_TUPLE_EAT_4)(o(354, s), p, o, m)
-# define BOOST_PP_FOR_354_I(s, p, o, m) BOOST_PP_IF(p(355, s), m, BOOST_PP_TUPLE_EAT_2)(355, s) BOOST_PP_IF(p(355, s), BOOST_PP_FOR_355, BOOST_PP_TUPLE_EAT_4)(o(355, s), p, o, m)
-# define BOOST_PP_FOR_355_I(s, p, o, m) BOOST_PP_IF(p(356, s), m, BOOST_PP_TUPLE_EAT_2)(356, s) BOOST_PP_IF(p(356, s), BOOST_PP_FOR_356, BOOST_PP_TUPLE_EAT_4)(o(356, s), p, o, m)
-# define BOOST_PP_FOR_356_I(s, p, o, m) BOOST_PP_IF(p(357, s), m, BOOST_PP_TUPLE_EAT_2)(357, s) BOOST_PP_IF(p(357, s), BOOST_PP_FOR_357, BOOST_PP_TUPLE_EAT_4)(o(357, s), p, o, m)
-# define BOOST_PP_FOR_357_I(s, p, o, m) BOOST_PP_IF(p(358, s), m, BOOST_PP_TUPLE_EAT_2)(358, s) BOOST_PP_IF(p(358, s), BOOST_PP_FOR_358, BOOST_PP_TUPLE_EAT_4)(o(358, s), p, o, m)
-# define BOOST_PP_FOR_358_I(s, p, o, m) BOOST_PP_IF(p(359, s), m, BOOST_PP_TUPLE_EAT_2)(359, s) BOOST_PP_IF(p(359, s), BOOST_PP_FOR_359, BOOST_PP_TUPLE_EAT_4)(o(359, s), p, o, m)
-# define BOOST_PP_FOR_359_I(s, p, o, m) BOOST_PP_IF(p(360, s), m, BOOST_PP_TUPLE_EAT_2)(360, s) BOOST_PP_IF(p(360, s), BOOST_PP_FOR_360, BOOST_PP_TUPLE_EAT_4)(o(360, s), p, o, m)
-# define BOOST_PP_FOR_360_I(s, p, o, m) BOOST_PP_IF(p(361, s), m, BOOST_PP_TUPLE_EAT_2)(361, s) BOOST_PP_IF(p(361, s), BOOST_PP_FOR_361, BOOST_PP_TUPLE_EAT_4)(o(361, s), p, o, m)
-# define BOOST_PP_FOR_361_I(s, p, o, m) BOOST_PP_IF(p(362, s), m, BOOST_PP_TUPLE_EAT_2)(362, s) BOOST_PP_IF(p(362, s), BOOST_PP_FOR_362, BOOST_PP_TUPLE_EAT_4)(o(362, s), p, o, m)
-# define BOOST_PP_FOR_362_I(s, p, o, m) BOOST_PP_IF(p(363, s), m, BOOST_PP_TUPLE_EAT_2)(363, s) BOOST_PP_IF(p(363, s), BOOST_PP_FOR_363, BOOST_PP_TUPLE_EAT_4)(o(363, s), p, o, m)
-# define BOOST_PP_FOR_363_I(s, p, o, m) BOOST_PP_IF(p(364, s), m, BOOST_PP_TUPLE_EAT_2)(364, s) BOOST_PP_IF(p(364, s), BOOST_PP_FOR_364, BOOST_PP_TUPLE_EAT_4)(o(364, s), p, o, m)
-# define BOOST_PP_FOR_364_I(s, p, o, m) BOOST_PP_IF(p(365, s), m, BOOST_PP_TUPLE_EAT_2)(365, s) BOOST_PP_IF(p(365, s), BOOST_PP_FOR_365, BOOST_PP_TUPLE_EAT_4)(o(365, s), p, o, m)
-# define BOOST_PP_FOR_365_I(s, p, o, m) BOOST_PP_IF(p(366, s), m, BOOST_PP_TUPLE_EAT_2)(366, s) BOOST_PP_IF(p(366, s), BOOST_PP_FOR_366, BOOST_PP_TUPLE_EAT_4)(o(366, s), p, o, m)
-# define BOOST_PP_FOR_366_I(s, p, o, m) BOOST_PP_IF(p(367, s), m, BOOST_PP_TUPLE_EAT_2)(367, s) BOOST_PP_IF(p(367, s), BOOST_PP_FOR_367, BOOST_PP_TUPLE_EAT_4)(o(367, s), p, o, m)
-# define BOOST_PP_FOR_367_I(s, p, o, m) BOOST_PP_IF(p(368, s), m, BOOST_PP_TUPLE_EAT_2)(368, s) BOOST_PP_IF(p(368, s), BOOST_PP_FOR_368, BOOST_PP_TUPLE_EAT_4)(o(368, s), p, o, m)
-# define BOOST_PP_FOR_368_I(s, p, o, m) BOOST_PP_IF(p(369, s), m, BOOST_PP_TUPLE_EAT_2)(369, s) BOOST_PP_IF(p(369, s), BOOST_PP_FOR_369, BOOST_PP_TUPLE_EAT_4)(o(369, s), p, o, m)
-# define BOOST_PP_FOR_369_I(s, p, o, m) BOOST_PP_IF(p(370, s), m, BOOST_PP_TUPLE_EAT_2)(370, s) BOOST_PP_IF(p(370, s), BOOST_PP_FOR_370, BOOST_PP_TUPLE_EAT_4)(o(370, s), p, o, m)
-# define BOOST_PP_FOR_370_I(s, p, o, m) BOOST_PP_IF(p(371, s), m, BOOST_PP_TUPLE_EAT_2)(371, s) BOOST_PP_IF(p(371, s), BOOST_PP_FOR_371, BOOST_PP_TUPLE_EAT_4)(o(371, s), p, o, m)
-# define BOOST_PP_FOR_371_I(s, p, o, m) BOOST_PP_IF(p(372, s), m, BOOST_PP_TUPLE_EAT_2)(372, s) BOOST_PP_IF(p(372, s), BOOST_PP_FOR_372, BOOST_PP_TUPLE_EAT_4)(o(372, s), p, o, m)
-# define BOOST_PP_FOR_372_I(s, p, o, m) BOOST_PP_IF(p(373, s), m, BOOST_PP_TUPLE_EAT_2)(373, s) BOOST_PP_IF(p(373, s), BOOST_PP_FOR_373, BOOST_PP_TUPLE_EAT_4)(o(373, s), p, o, m)
-# define BOOST_PP_FOR_373_I(s, p, o, m) BOOST_PP_IF(p(374, s), m, BOOST_PP_TUPLE_EAT_2)(374, s) BOOST_PP_IF(p(374, s), BOOST_PP_FOR_374, BOOST_PP_TUPLE_EAT_4)(o(374, s), p, o, m)
-# define BOOST_PP_FOR_374_I(s, p, o, m) BOOST_PP_IF(p(375, s), m, BOOST_PP_TUPLE_EAT_2)(375, s) BOOST_PP_IF(p(375, s), BOOST_PP_FOR_375, BOOST_PP_TUPLE_EAT_4)(o(375, s), p, o, m)
-# define BOOST_PP_FOR_375_I(s, p, o, m) BOOST_PP_IF(p(376, s), m, BOOST_PP_TUPLE_EAT_2)(376, s) BOOST_PP_IF(p(376, s), BOOST_PP_FOR_376, BOOST_PP_TUPLE_EAT_4)(o(376, s), p, o, m)
-# define BOOST_PP_FOR_376_I(s, p, o, m) BOOST_PP_IF(p(377, s), m, BOOST_PP_TUPLE_EAT_2)(377, s) BOOST_PP_IF(p(377, s), BOOST_PP_FOR_377, BOOST_PP_TUPLE_EAT_4)(o(377, s), p, o, m)
-# define BOOST_PP_FOR_377_I(s, p, o, m) BOOST_PP_IF(p(378, s), m, BOOST_PP_TUPLE_EAT_2)(378, s) BOOST_PP_IF(p(378, s), BOOST_PP_FOR_378, BOOST_PP_TUPLE_EAT_4)(o(378, s), p, o, m)
-# define BOOST_PP_FOR_378_I(s, p, o, m) BOOST_PP_IF(p(379, s), m, BOOST_PP_TUPLE_EAT_2)(379, s) BOOST_PP_IF(p(379, s), BOOST_PP_FOR_379, BOOST_PP_TUPLE_EAT_4)(o(379, s), p, o, m)
-# define BOOST_PP_FOR_379_I(s, p, o, m) BOOST_PP_IF(p(380, s), m, BOOST_PP_TUPLE_EAT_2)(380, s) BOOST_PP_IF(p(380, s), BOOST_PP_FOR_380, BOOST_PP_TUPLE_EAT_4)(o(380, s), p, o, m)
-# define BOOST_PP_FOR_380_I(s, p, o, m) BOOST_PP_IF(p(381, s), m, BOOST_PP_TUPLE_EAT_2)(381, s) BOOST_PP_IF(p(381, s), BOOST_PP_FOR_381, BOOST_PP_TUPLE_EAT_4)(o(381, s), p, o, m)
-# define BOOST_PP_FOR_381_I(s, p, o, m) BOOST_PP_IF(p(382, s), m, BOOST_PP_TUPLE_EAT_2)(382, s) BOOST_PP_IF(p(382, s), BOOST_PP_FOR_382, BOOST_PP_TUPLE_EAT_4)(o(382, s), p, o, m)
-# define BOOST_PP_FOR_382_I(s, p, o, m) BOOST_PP_IF(p(383, s), m, BOOST_PP_TUPLE_EAT_2)(383, s) BOOST_PP_IF(p(383, s), BOOST_PP_FOR_383, BOOST_PP_TUPLE_EAT_4)(o(383, s), p, o, m)
-# define BOOST_PP_FOR_383_I(s, p, o, m) BOOST_PP_IF(p(384, s), m, BOOST_PP_TUPLE_EAT_2)(384, s) BOOST_PP_IF(p(384, s), BOOST_PP_FOR_384, BOOST_PP_TUPLE_EAT_4)(o(384, s), p, o, m)
-# define BOOST_PP_FOR_384_I(s, p, o, m) BOOST_PP_IF(p(385, s), m, BOOST_PP_TUPLE_EAT_2)(385, s) BOOST_PP_IF(p(385, s), BOOST_PP_FOR_385, BOOST_PP_TUPLE_EAT_4)(o(385, s), p, o, m)
-# define BOOST_PP_FOR_385_I(s, p, o, m) BOOST_PP_IF(p(386, s), m, BOOST_PP_TUPLE_EAT_2)(386, s) BOOST_PP_IF(p(386, s), BOOST_PP_FOR_386, BOOST_PP_TUPLE_EAT_4)(o(386, s), p, o, m)
-# define BOOST_PP_FOR_386_I(s, p, o, m) BOOST_PP_IF(p(387, s), m, BOOST_PP_TUPLE_EAT_2)(387, s) BOOST_PP_IF(p(387, s), BOOST_PP_FOR_387, BOOST_PP_TUPLE_EAT_4)(o(387, s), p, o, m)
-# define BOOST_PP_FOR_387_I(s, p, o, m) BOOST_PP_IF(p(388, s), m, BOOST_PP_TUPLE_EAT_2)(388, s) BOOST_PP_IF(p(388, s), BOOST_PP_FOR_388, BOOST_PP_TUPLE_EAT_4)(o(388, s), p, o, m)
-# define BOOST_PP_FOR_388_I(s, p, o, m) BOOST_PP_IF(p(389, s), m, BOOST_PP_TUPLE_EAT_2)(389, s) BOOST_PP_IF(p(389, s), BOOST_PP_FOR_389, BOOST_PP_TUPLE_EAT_4)(o(389, s), p, o, m)
-# define BOOST_PP_FOR_389_I(s, p, o, m) BOOST_PP_IF(p(390, s), m, BOOST_PP_TUPLE_EAT_2)(390, s) BOOST_PP_IF(p(390, s), BOOST_PP_FOR_390, BOOST_PP_TUPLE_EAT_4)(o(390, s), p, o, m)
-# define BOOST_PP_FOR_390_I(s, p, o, m) BOOST_PP_IF(p(391, s), m, BOOST_PP_TUPLE_EAT_2)(391, s) BOOST_PP_IF(p(391, s), BOOST_PP_FOR_391, BOOST_PP_TUPLE_EAT_4)(o(391, s), p, o, m)
-# define BOOST_PP_FOR_391_I(s, p, o, m) BOOST_PP_IF(p(392, s), m, BOOST_PP_TUPLE_EAT_2)(392, s) BOOST_PP_IF(p(392, s), BOOST_PP_FOR_392, BOOST_PP_TUPLE_EAT_4)(o(392, s), p, o, m)
-# define BOOST_PP_FOR_392_I(s, p, o, m) BOOST_PP_IF(p(393, s), m, BOOST_PP_TUPLE_EAT_2)(393, s) BOOST_PP_IF(p(393, s), BOOST_PP_FOR_393, BOOST_PP_TUPLE_EAT_4)(o(393, s), p, o, m)
-# define BOOST_PP_FOR_393_I(s, p, o, m) BOOST_PP_IF(p(394, s), m, BOOST_PP_TUPLE_EAT_2)(394, s) BOOST_PP_IF(p(394, s), BOOST_PP_FOR_394, BOOST_PP_TUPLE_EAT_4)(o(394, s), p, o, m)
-# define BOOST_PP_FOR_394_I(s, p, o, m) BOOST_PP_IF(p(395, s), m, BOOST_PP_TUPLE_EAT_2)(395, s) BOOST_PP_IF(p(395, s), BOOST_PP_FOR_395, BOOST_PP_TUPLE_EAT_4)(o(395, s), p, o, m)
-# define BOOST_PP_FOR_395_I(s, p, o, m) BOOST_PP_IF(p(396, s), m, BOOST_PP_TUPLE_EAT_2)(396, s) BOOST_PP_IF(p(396, s), BOOST_PP_FOR_396, BOOST_PP_TUPLE_EAT_4)(o(396, s), p, o, m)
-# define BOOST_PP_FOR_396_I(s, p, o, m) BOOST_PP_IF(p(397, s), m, BOOST_PP_TUPLE_EAT_2)(397, s) BOOST_PP_IF(p(397, s), BOOST_PP_FOR_397, BOOST_PP_TUPLE_EAT_4)(o(397, s), p, o, m)
-# define BOOST_PP_FOR_397_I(s, p, o, m) BOOST_PP_IF(p(398, s), m, BOOST_PP_TUPLE_EAT_2)(398, s) BOOST_PP_IF(p(398, s), BOOST_PP_FOR_398, BOOST_PP_TUPLE_EAT_4)(o(398, s), p, o, m)
-# define BOOST_PP_FOR_398_I(s, p, o, m) BOOST_PP_IF(p(399, s), m, BOOST_PP_TUPLE_EAT_2)(399, s) BOOST_PP_IF(p(399, s), BOOST_PP_FOR_399, BOOST_PP_TUPLE_EAT_4)(o(399, s), p, o, m)
-# define BOOST_PP_FOR_399_I(s, p, o, m) BOOST_PP_IF(p(400, s), m, BOOST_PP_TUPLE_EAT_2)(400, s) BOOST_PP_IF(p(400, s), BOOST_PP_FOR_400, BOOST_PP_TUPLE_EAT_4)(o(400, s), p, o, m)
-# define BOOST_PP_FOR_400_I(s, p, o, m) BOOST_PP_IF(p(401, s), m, BOOST_PP_TUPLE_EAT_2)(401, s) BOOST_PP_IF(p(401, s), BOOST_PP_FOR_401, BOOST_PP_TUPLE_EAT_4)(o(401, s), p, o, m)
-# define BOOST_PP_FOR_401_I(s, p, o, m) BOOST_PP_IF(p(402, s), m, BOOST_PP_TUPLE_EAT_2)(402, s) BOOST_PP_IF(p(402, s), BOOST_PP_FOR_402, BOOST_PP_TUPLE_EAT_4)(o(402, s), p, o, m)
-# define BOOST_PP_FOR_402_I(s, p, o, m) BOOST_PP_IF(p(403, s), m, BOOST_PP_TUPLE_EAT_2)(403, s) BOOST_PP_IF(p(403, s), BOOST_PP_FOR_403, BOOST_PP_TUPLE_EAT_4)(o(403, s), p, o, m)
-# define BOOST_PP_FOR_403_I(s, p, o, m) BOOST_PP_IF(p(404, s), m, BOOST_PP_TUPLE_EAT_2)(404, s) BOOST_PP_IF(p(404, s), BOOST_PP_FOR_404, BOOST_PP_TUPLE_EAT_4)(o(404, s), p, o, m)
-# define BOOST_PP_FOR_404_I(s, p, o, m) BOOST_PP_IF(p(405, s), m, BOOST_PP_TUPLE_EAT_2)(405, s) BOOST_PP_IF(p(405, s), BOOST_PP_FOR_405, BOOST_PP_TUPLE_EAT_4)(o(405, s), p, o, m)
-# define BOOST_PP_FOR_405_I(s, p, o, m) BOOST_PP_IF(p(406, s), m, BOOST_PP_TUPLE_EAT_2)(406, s) BOOST_PP_IF(p(406, s), BOOST_PP_FOR_406, BOOST_PP_TUPLE_EAT_4)(o(406, s), p, o, m)
-# define BOOST_PP_FOR_406_I(s, p, o, m) BOOST_PP_IF(p(407, s), m, BOOST_PP_TUPLE_EAT_2)(407, s) BOOST_PP_IF(p(407, s), BOOST_PP_FOR_407, BOOST_PP_TUPLE_EAT_4)(o(407, s), p, o, m)
-# define BOOST_PP_FOR_407_I(s, p, o, m) BOOST_PP_IF(p(408, s), m, BOOST_PP_TUPLE_EAT_2)(408, s) BOOST_PP_IF(p(408, s), BOOST_PP_FOR_408, BOOST_PP_TUPLE_EAT_4)(o(408, s), p, o, m)
-# define BOOST_PP_FOR_408_I(s, p, o, m) BOOST_PP_IF(p(409, s), m, BOOST_PP_TUPLE_EAT_2)(409, s) BOOST_PP_IF(p(409, s), BOOST_PP_FOR_409, BOOST_PP_TUPLE_EAT_4)(o(409, s), p, o, m)
-# define BOOST_PP_FOR_409_I(s, p, o, m) BOOST_PP_IF(p(410, s), m, BOOST_PP_TUPLE_EAT_2)(410, s) BOOST_PP_IF(p(410, s), BOOST_PP_FOR_410, BOOST_PP_TUPLE_EAT_4)(o(410, s), p, o, m)
-# define BOOST_PP_FOR_410_I(s, p, o, m) BOOST_PP_IF(p(411, s), m, BOOST_PP_TUPLE_EAT_2)(411, s) BOOST_PP_IF(p(411, s), BOOST_PP_FOR_411, BOOST_PP_TUPLE_EAT_4)(o(411, s), p, o, m)
-# define BOOST_PP_FOR_411_I(s, p, o, m) BOOST_PP_IF(p(412, s), m, BOOST_PP_TUPLE_EAT_2)(412, s) BOOST_PP_IF(p(412, s), BOOST_PP_FOR_412, BOOST_PP_TUPLE_EAT_4)(o(412, s), p, o, m)
-# define BOOST_PP_FOR_412_I(s, p, o, m) BOOST_PP_IF(p(413, s), m, BOOST_PP_TUPLE_EAT_2)(413, s) BOOST_PP_IF(p(413, s), BOOST_PP_FOR_413, BOOST_PP_TUPLE_EAT_4)(o(413, s), p, o, m)
-# define BOOST_PP_FOR_413_I(s, p, o, m) BOOST_PP_IF(p(414, s), m, BOOST_PP_TUPLE_EAT_2)(414, s) BOOST_PP_IF(p(414, s), BOOST_PP_FOR_414, BOOST_PP_TUPLE_EAT_4)(o(414, s), p, o, m)
-# define BOOST_PP_FOR_414_I(s, p, o, m) BOOST_PP_IF(p(415, s), m, BOOST_PP_TUPLE_EAT_2)(415, s) BOOST_PP_IF(p(415, s), BOOST_PP_FOR_415, BOOST_PP_TUPLE_EAT_4)(o(415, s), p, o, m)
-# define BOOST_PP_FOR_415_I(s, p, o, m) BOOST_PP_IF(p(416, s), m, BOOST_PP_TUPLE_EAT_2)(416, s) BOOST_PP_IF(p(416, s), BOOST_PP_FOR_416, BOOST_PP_TUPLE_EAT_4)(o(416, s), p, o, m)
-# define BOOST_PP_FOR_416_I(s, p, o, m) BOOST_PP_IF(p(417, s), m, BOOST_PP_TUPLE_EAT_2)(417, s) BOOST_PP_IF(p(417, s), BOOST_PP_FOR_417, BOOST_PP_TUPLE_EAT_4)(o(417, s), p, o, m)
-# define BOOST_PP_FOR_417_I(s, p, o, m) BOOST_PP_IF(p(418, s), m, BOOST_PP_TUPLE_EAT_2)(418, s) BOOST_PP_IF(p(418, s), BOOST_PP_FOR_418, BOOST_PP_TUPLE_EAT_4)(o(418, s), p, o, m)
-# define BOOST_PP_FOR_418_I(s, p, o, m) BOOST_PP_IF(p(419, s), m, BOOST_PP_TUPLE_EAT_2)(419, s) BOOST_PP_IF(p(419, s), BOOST_PP_FOR_419, BOOST_PP_TUPLE_EAT_4)(o(419, s), p, o, m)
-# define BOOST_PP_FOR_419_I(s, p, o, m) BOOST_PP_IF(p(420, s), m, BOOST_PP_TUPLE_EAT_2)(420, s) BOOST_PP_IF(p(420, s), BOOST_PP_FOR_420, BOOST_PP_TUPLE_EAT_4)(o(420, s), p, o, m)
-# define BOOST_PP_FOR_420_I(s, p, o, m) BOOST_PP_IF(p(421, s), m, BOOST_PP_TUPLE_EAT_2)(421, s) BOOST_PP_IF(p(421, s), BOOST_PP_FOR_421, BOOST_PP_TUPLE_EAT_4)(o(421, s), p, o, m)
-# define BOOST_PP_FOR_421_I(s, p, o, m) BOOST_PP_IF(p(422, s), m, BOOST_PP_TUPLE_EAT_2)(422, s) BOOST_PP_IF(p(422, s), BOOST_PP_FOR_422, BOOST_PP_TUPLE_EAT_4)(o(422, s), p, o, m)
-# define BOOST_PP_FOR_422_I(s, p, o, m) BOOST_PP_IF(p(423, s), m, BOOST_PP_TUPLE_EAT_2)(423, s) BOOST_PP_IF(p(423, s), BOOST_PP_FOR_423, BOOST_PP_TUPLE_EAT_4)(o(423, s), p, o, m)
-# define BOOST_PP_FOR_423_I(s, p, o, m) BOOST_PP_IF(p(424, s), m, BOOST_PP_TUPLE_EAT_2)(424, s) BOOST_PP_IF(p(424, s), BOOST_PP_FOR_424, BOOST_PP_TUPLE_EAT_4)(o(424, s), p, o, m)
-# define BOOST_PP_FOR_424_I(s, p, o, m) BOOST_PP_IF(p(425, s), m, BOOST_PP_TUPLE_EAT_2)(425, s) BOOST_PP_IF(p(425, s), BOOST_PP_FOR_425, BOOST_PP_TUPLE_EAT_4)(o(425, s), p, o, m)
-# define BOOST_PP_FOR_425_I(s, p, o, m) BOOST_PP_IF(p(426, s), m, BOOST_PP_TUPLE_EAT_2)(426, s) BOOST_PP_IF(p(426, s), BOOST_PP_FOR_426, BOOST_PP_TUPLE_EAT_4)(o(426, s), p, o, m)
-# define BOOST_PP_FOR_426_I(s, p, o, m) BOOST_PP_IF(p(427, s), m, BOOST_PP_TUPLE_EAT_2)(427, s) BOOST_PP_IF(p(427, s), BOOST_PP_FOR_427, BOOST_PP_TUPLE_EAT_4)(o(427, s), p, o, m)
-# define BOOST_PP_FOR_427_I(s, p, o, m) BOOST_PP_IF(p(428, s), m, BOOST_PP_TUPLE_EAT_2)(428, s) BOOST_PP_IF(p(428, s), BOOST_PP_FOR_428, BOOST_PP_TUPLE_EAT_4)(o(428, s), p, o, m)
-# define BOOST_PP_FOR_428_I(s, p, o, m) BOOST_PP_IF(p(429, s), m, BOOST_PP_TUPLE_EAT_2)(429, s) BOOST_PP_IF(p(429, s), BOOST_PP_FOR_429, BOOST_PP_TUPLE_EAT_4)(o(429, s), p, o, m)
-# define BOOST_PP_FOR_429_I(s, p, o, m) BOOST_PP_IF(p(430, s), m, BOOST_PP_TUPLE_EAT_2)(430, s) BOOST_PP_IF(p(430, s), BOOST_PP_FOR_430, BOOST_PP_TUPLE_EAT_4)(o(430, s), p, o, m)
-# define BOOST_PP_FOR_430_I(s, p, o, m) BOOST_PP_IF(p(431, s), m, BOOST_PP_TUPLE_EAT_2)(431, s) BOOST_PP_IF(p(431, s), BOOST_PP_FOR_431, BOOST_PP_TUPLE_EAT_4)(o(431, s), p, o, m)
-# define BOOST_PP_FOR_431_I(s, p, o, m) BOOST_PP_IF(p(432, s), m, BOOST_PP_TUPLE_EAT_2)(432, s) BOOST_PP_IF(p(432, s), BOOST_PP_FOR_432, BOOST_PP_TUPLE_EAT_4)(o(432, s), p, o, m)
-# define BOOST_PP_FOR_432_I(s, p, o, m) BOOST_PP_IF(p(433, s), m, BOOST_PP_TUPLE_EAT_2)(433, s) BOOST_PP_IF(p(433, s), BOOST_PP_FOR_433, BOOST_PP_TUPLE_EAT_4)(o(433, s), p, o, m)
-# define BOOST_PP_FOR_433_I(s, p, o, m) BOOST_PP_IF(p(434, s), m, BOOST_PP_TUPLE_EAT_2)(434, s) BOOST_PP_IF(p(434, s), BOOST_PP_FOR_434, BOOST_PP_TUPLE_EAT_4)(o(434, s), p, o, m)
-# define BOOST_PP_FOR_434_I(s, p, o, m) BOOST_PP_IF(p(435, s), m, BOOST_PP_TUPLE_EAT_2)(435, s) BOOST_PP_IF(p(435, s), BOOST_PP_FOR_435, BOOST_PP_TUPLE_EAT_4)(o(435, s), p, o, m)
-# define BOOST_PP_FOR_435_I(s, p, o, m) BOOST_PP_IF(p(436, s), m, BOOST_PP_TUPLE_EAT_2)(436, s) BOOST_PP_IF(p(436, s), BOOST_PP_FOR_436, BOOST_PP_TUPLE_EAT_4)(o(436, s), p, o, m)
-# define BOOST_PP_FOR_436_I(s, p, o, m) BOOST_PP_IF(p(437, s), m, BOOST_PP_TUPLE_EAT_2)(437, s) BOOST_PP_IF(p(437, s), BOOST_PP_FOR_437, BOOST_PP_TUPLE_EAT_4)(o(437, s), p, o, m)
-# define BOOST_PP_FOR_437_I(s, p, o, m) BOOST_PP_IF(p(438, s), m, BOOST_PP_TUPLE_EAT_2)(438, s) BOOST_PP_IF(p(438, s), BOOST_PP_FOR_438, BOOST_PP_TUPLE_EAT_4)(o(438, s), p, o, m)
-# define BOOST_PP_FOR_438_I(s, p, o, m) BOOST_PP_IF(p(439, s), m, BOOST_PP_TUPLE_EAT_2)(439, s) BOOST_PP_IF(p(439, s), BOOST_PP_FOR_439, BOOST_PP_TUPLE_EAT_4)(o(439, s), p, o, m)
-# define BOOST_PP_FOR_439_I(s, p, o, m) BOOST_PP_IF(p(440, s), m, BOOST_PP_TUPLE_EAT_2)(440, s) BOOST_PP_IF(p(440, s), BOOST_PP_FOR_440, BOOST_PP_TUPLE_EAT_4)(o(440, s), p, o, m)
-# define BOOST_PP_FOR_440_I(s, p, o, m) BOOST_PP_IF(p(441, s), m, BOOST_PP_TUPLE_EAT_2)(441, s) BOOST_PP_IF(p(441, s), BOOST_PP_FOR_441, BOOST_PP_TUPLE_EAT_4)(o(441, s), p, o, m)
-# define BOOST_PP_FOR_441_I(s, p, o, m) BOOST_PP_IF(p(442, s), m, BOOST_PP_TUPLE_EAT_2)(442, s) BOOST_PP_IF(p(442, s), BOOST_PP_FOR_442, BOOST_PP_TUPLE_EAT_4)(o(442, s), p, o, m)
-# define BOOST_PP_FOR_442_I(s, p, o, m) BOOST_PP_IF(p(443, s), m, BOOST_PP_TUPLE_EAT_2)(443, s) BOOST_PP_IF(p(443, s), BOOST_PP_FOR_443, BOOST_PP_TUPLE_EAT_4)(o(443, s), p, o, m)
-# define BOOST_PP_FOR_443_I(s, p, o, m) BOOST_PP_IF(p(444, s), m, BOOST_PP_TUPLE_EAT_2)(444, s) BOOST_PP_IF(p(444, s), BOOST_PP_FOR_444, BOOST_PP_TUPLE_EAT_4)(o(444, s), p, o, m)
-# define BOOST_PP_FOR_444_I(s, p, o, m) BOOST_PP_IF(p(445, s), m, BOOST_PP_TUPLE_EAT_2)(445, s) BOOST_PP_IF(p(445, s), BOOST_PP_FOR_445, BOOST_PP_TUPLE_EAT_4)(o(445, s), p, o, m)
-# define BOOST_PP_FOR_445_I(s, p, o, m) BOOST_PP_IF(p(446, s), m, BOOST_PP_TUPLE_EAT_2)(446, s) BOOST_PP_IF(p(446, s), BOOST_PP_FOR_446, BOOST_PP_TUPLE_EAT_4)(o(446, s), p, o, m)
-# define BOOST_PP_FOR_446_I(s, p, o, m) BOOST_PP_IF(p(447, s), m, BOOST_PP_TUPLE_EAT_2)(447, s) BOOST_PP_IF(p(447, s), BOOST_PP_FOR_447, BOOST_PP_TUPLE_EAT_4)(o(447, s), p, o, m)
-# define BOOST_PP_FOR_447_I(s, p, o, m) BOOST_PP_IF(p(448, s), m, BOOST_PP_TUPLE_EAT_2)(448, s) BOOST_PP_IF(p(448, s), BOOST_PP_FOR_448, BOOST_PP_TUPLE_EAT_4)(o(448, s), p, o, m)
-# define BOOST_PP_FOR_448_I(s, p, o, m) BOOST_PP_IF(p(449, s), m, BOOST_PP_TUPLE_EAT_2)(449, s) BOOST_PP_IF(p(449, s), BOOST_PP_FOR_449, BOOST_PP_TUPLE_EAT_4)(o(449, s), p, o, m)
-# define BOOST_PP_FOR_449_I(s, p, o, m) BOOST_PP_IF(p(450, s), m, BOOST_PP_TUPLE_EAT_2)(450, s) BOOST_PP_IF(p(450, s), BOOST_PP_FOR_450, BOOST_PP_TUPLE_EAT_4)(o(450, s), p, o, m)
-# define BOOST_PP_FOR_450_I(s, p, o, m) BOOST_PP_IF(p(451, s), m, BOOST_PP_TUPLE_EAT_2)(451, s) BOOST_PP_IF(p(451, s), BOOST_PP_FOR_451, BOOST_PP_TUPLE_EAT_4)(o(451, s), p, o, m)
-# define BOOST_PP_FOR_451_I(s, p, o, m) BOOST_PP_IF(p(452, s), m, BOOST_PP_TUPLE_EAT_2)(452, s) BOOST_PP_IF(p(452, s), BOOST_PP_FOR_452, BOOST_PP_TUPLE_EAT_4)(o(452, s), p, o, m)
-# define BOOST_PP_FOR_452_I(s, p, o, m) BOOST_PP_IF(p(453, s), m, BOOST_PP_TUPLE_EAT_2)(453, s) BOOST_PP_IF(p(453, s), BOOST_PP_FOR_453, BOOST_PP_TUPLE_EAT_4)(o(453, s), p, o, m)
-# define BOOST_PP_FOR_453_I(s, p, o, m) BOOST_PP_IF(p(454, s), m, BOOST_PP_TUPLE_EAT_2)(454, s) BOOST_PP_IF(p(454, s), BOOST_PP_FOR_454, BOOST_PP_TUPLE_EAT_4)(o(454, s), p, o, m)
-# define BOOST_PP_FOR_454_I(s, p, o, m) BOOST_PP_IF(p(455, s), m, BOOST_PP_TUPLE_EAT_2)(455, s) BOOST_PP_IF(p(455, s), BOOST_PP_FOR_455, BOOST_PP_TUPLE_EAT_4)(o(455, s), p, o, m)
-# define BOOST_PP_FOR_455_I(s, p, o, m) BOOST_PP_IF(p(456, s), m, BOOST_PP_TUPLE_EAT_2)(456, s) BOOST_PP_IF(p(456, s), BOOST_PP_FOR_456, BOOST_PP_TUPLE_EAT_4)(o(456, s), p, o, m)
-# define BOOST_PP_FOR_456_I(s, p, o, m) BOOST_PP_IF(p(457, s), m, BOOST_PP_TUPLE_EAT_2)(457, s) BOOST_PP_IF(p(457, s), BOOST_PP_FOR_457, BOOST_PP_TUPLE_EAT_4)(o(457, s), p, o, m)
-# define BOOST_PP_FOR_457_I(s, p, o, m) BOOST_PP_IF(p(458, s), m, BOOST_PP_TUPLE_EAT_2)(458, s) BOOST_PP_IF(p(458, s), BOOST_PP_FOR_458, BOOST_PP_TUPLE_EAT_4)(o(458, s), p, o, m)
-# define BOOST_PP_FOR_458_I(s, p, o, m) BOOST_PP_IF(p(459, s), m, BOOST_PP_TUPLE_EAT_2)(459, s) BOOST_PP_IF(p(459, s), BOOST_PP_FOR_459, BOOST_PP_TUPLE_EAT_4)(o(459, s), p, o, m)
-# define BOOST_PP_FOR_459_I(s, p, o, m) BOOST_PP_IF(p(460, s), m, BOOST_PP_TUPLE_EAT_2)(460, s) BOOST_PP_IF(p(460, s), BOOST_PP_FOR_460, BOOST_PP_TUPLE_EAT_4)(o(460, s), p, o, m)
-# define BOOST_PP_FOR_460_I(s, p, o, m) BOOST_PP_IF(p(461, s), m, BOOST_PP_TUPLE_EAT_2)(461, s) BOOST_PP_IF(p(461, s), BOOST_PP_FOR_461, BOOST_PP_TUPLE_EAT_4)(o(461, s), p, o, m)
-# define BOOST_PP_FOR_461_I(s, p, o, m) BOOST_PP_IF(p(462, s), m, BOOST_PP_TUPLE_EAT_2)(462, s) BOOST_PP_IF(p(462, s), BOOST_PP_FOR_462, BOOST_PP_TUPLE_EAT_4)(o(462, s), p, o, m)
-# define BOOST_PP_FOR_462_I(s, p, o, m) BOOST_PP_IF(p(463, s), m, BOOST_PP_TUPLE_EAT_2)(463, s) BOOST_PP_IF(p(463, s), BOOST_PP_FOR_463, BOOST_PP_TUPLE_EAT_4)(o(463, s), p, o, m)
-# define BOOST_PP_FOR_463_I(s, p, o, m) BOOST_PP_IF(p(464, s), m, BOOST_PP_TUPLE_EAT_2)(464, s) BOOST_PP_IF(p(464, s), BOOST_PP_FOR_464, BOOST_PP_TUPLE_EAT_4)(o(464, s), p, o, m)
-# define BOOST_PP_FOR_464_I(s, p, o, m) BOOST_PP_IF(p(465, s), m, BOOST_PP_TUPLE_EAT_2)(465, s) BOOST_PP_IF(p(465, s), BOOST_PP_FOR_465, BOOST_PP_TUPLE_EAT_4)(o(465, s), p, o, m)
-# define BOOST_PP_FOR_465_I(s, p, o, m) BOOST_PP_IF(p(466, s), m, BOOST_PP_TUPLE_EAT_2)(466, s) BOOST_PP_IF(p(466, s), BOOST_PP_FOR_466, BOOST_PP_TUPLE_EAT_4)(o(466, s), p, o, m)
-# define BOOST_PP_FOR_466_I(s, p, o, m) BOOST_PP_IF(p(467, s), m, BOOST_PP_TUPLE_EAT_2)(467, s) BOOST_PP_IF(p(467, s), BOOST_PP_FOR_467, BOOST_PP_TUPLE_EAT_4)(o(467, s), p, o, m)
-# define BOOST_PP_FOR_467_I(s, p, o, m) BOOST_PP_IF(p(468, s), m, BOOST_PP_TUPLE_EAT_2)(468, s) BOOST_PP_IF(p(468, s), BOOST_PP_FOR_468, BOOST_PP_TUPLE_EAT_4)(o(468, s), p, o, m)
-# define BOOST_PP_FOR_468_I(s, p, o, m) BOOST_PP_IF(p(469, s), m, BOOST_PP_TUPLE_EAT_2)(469, s) BOOST_PP_IF(p(469, s), BOOST_PP_FOR_469, BOOST_PP_TUPLE_EAT_4)(o(469, s), p, o, m)
-# define BOOST_PP_FOR_469_I(s, p, o, m) BOOST_PP_IF(p(470, s), m, BOOST_PP_TUPLE_EAT_2)(470, s) BOOST_PP_IF(p(470, s), BOOST_PP_FOR_470, BOOST_PP_TUPLE_EAT_4)(o(470, s), p, o, m)
-# define BOOST_PP_FOR_470_I(s, p, o, m) BOOST_PP_IF(p(471, s), m, BOOST_PP_TUPLE_EAT_2)(471, s) BOOST_PP_IF(p(471, s), BOOST_PP_FOR_471, BOOST_PP_TUPLE_EAT_4)(o(471, s), p, o, m)
-# define BOOST_PP_FOR_471_I(s, p, o, m) BOOST_PP_IF(p(472, s), m, BOOST_PP_TUPLE_EAT_2)(472, s) BOOST_PP_IF(p(472, s), BOOST_PP_FOR_472, BOOST_PP_TUPLE_EAT_4)(o(472, s), p, o, m)
-# define BOOST_PP_FOR_472_I(s, p, o, m) BOOST_PP_IF(p(473, s), m, BOOST_PP_TUPLE_EAT_2)(473, s) BOOST_PP_IF(p(473, s), BOOST_PP_FOR_473, BOOST_PP_TUPLE_EAT_4)(o(473, s), p, o, m)
-# define BOOST_PP_FOR_473_I(s, p, o, m) BOOST_PP_IF(p(474, s), m, BOOST_PP_TUPLE_EAT_2)(474, s) BOOST_PP_IF(p(474, s), BOOST_PP_FOR_474, BOOST_PP_TUPLE_EAT_4)(o(474, s), p, o, m)
-# define BOOST_PP_FOR_474_I(s, p, o, m) BOOST_PP_IF(p(475, s), m, BOOST_PP_TUPLE_EAT_2)(475, s) BOOST_PP_IF(p(475, s), BOOST_PP_FOR_475, BOOST_PP_TUPLE_EAT_4)(o(475, s), p, o, m)
-# define BOOST_PP_FOR_475_I(s, p, o, m) BOOST_PP_IF(p(476, s), m, BOOST_PP_TUPLE_EAT_2)(476, s) BOOST_PP_IF(p(476, s), BOOST_PP_FOR_476, BOOST_PP_TUPLE_EAT_4)(o(476, s), p, o, m)
-# define BOOST_PP_FOR_476_I(s, p, o, m) BOOST_PP_IF(p(477, s), m, BOOST_PP_TUPLE_EAT_2)(477, s) BOOST_PP_IF(p(477, s), BOOST_PP_FOR_477, BOOST_PP_TUPLE_EAT_4)(o(477, s), p, o, m)
-# define BOOST_PP_FOR_477_I(s, p, o, m) BOOST_PP_IF(p(478, s), m, BOOST_PP_TUPLE_EAT_2)(478, s) BOOST_PP_IF(p(478, s), BOOST_PP_FOR_478, BOOST_PP_TUPLE_EAT_4)(o(478, s), p, o, m)
-# define BOOST_PP_FOR_478_I(s, p, o, m) BOOST_PP_IF(p(479, s), m, BOOST_PP_TUPLE_EAT_2)(479, s) BOOST_PP_IF(p(479, s), BOOST_PP_FOR_479, BOOST_PP_TUPLE_EAT_4)(o(479, s), p, o, m)
-# define BOOST_PP_FOR_479_I(s, p, o, m) BOOST_PP_IF(p(480, s), m, BOOST_PP_TUPLE_EAT_2)(480, s) BOOST_PP_IF(p(480, s), BOOST_PP_FOR_480, BOOST_PP_TUPLE_EAT_4)(o(480, s), p, o, m)
-# define BOOST_PP_FOR_480_I(s, p, o, m) BOOST_PP_IF(p(481, s), m, BOOST_PP_TUPLE_EAT_2)(481, s) BOOST_PP_IF(p(481, s), BOOST_PP_FOR_481, BOOST_PP_TUPLE_EAT_4)(o(481, s), p, o, m)
-# define BOOST_PP_FOR_481_I(s, p, o, m) BOOST_PP_IF(p(482, s), m, BOOST_PP_TUPLE_EAT_2)(482, s) BOOST_PP_IF(p(482, s), BOOST_PP_FOR_482, BOOST_PP_TUPLE_EAT_4)(o(482, s), p, o, m)
-# define BOOST_PP_FOR_482_I(s, p, o, m) BOOST_PP_IF(p(483, s), m, BOOST_PP_TUPLE_EAT_2)(483, s) BOOST_PP_IF(p(483, s), BOOST_PP_FOR_483, BOOST_PP_TUPLE_EAT_4)(o(483, s), p, o, m)
-# define BOOST_PP_FOR_483_I(s, p, o, m) BOOST_PP_IF(p(484, s), m, BOOST_PP_TUPLE_EAT_2)(484, s) BOOST_PP_IF(p(484, s), BOOST_PP_FOR_484, BOOST_PP_TUPLE_EAT_4)(o(484, s), p, o, m)
-# define BOOST_PP_FOR_484_I(s, p, o, m) BOOST_PP_IF(p(485, s), m, BOOST_PP_TUPLE_EAT_2)(485, s) BOOST_PP_IF(p(485, s), BOOST_PP_FOR_485, BOOST_PP_TUPLE_EAT_4)(o(485, s), p, o, m)
-# define BOOST_PP_FOR_485_I(s, p, o, m) BOOST_PP_IF(p(486, s), m, BOOST_PP_TUPLE_EAT_2)(486, s) BOOST_PP_IF(p(486, s), BOOST_PP_FOR_486, BOOST_PP_TUPLE_EAT_4)(o(486, s), p, o, m)
-# define BOOST_PP_FOR_486_I(s, p, o, m) BOOST_PP_IF(p(487, s), m, BOOST_PP_TUPLE_EAT_2)(487, s) BOOST_PP_IF(p(487, s), BOOST_PP_FOR_487, BOOST_PP_TUPLE_EAT_4)(o(487, s), p, o, m)
-# define BOOST_PP_FOR_487_I(s, p, o, m) BOOST_PP_IF(p(488, s), m, BOOST_PP_TUPLE_EAT_2)(488, s) BOOST_PP_IF(p(488, s), BOOST_PP_FOR_488, BOOST_PP_TUPLE_EAT_4)(o(488, s), p, o, m)
-# define BOOST_PP_FOR_488_I(s, p, o, m) BOOST_PP_IF(p(489, s), m, BOOST_PP_TUPLE_EAT_2)(489, s) BOOST_PP_IF(p(489, s), BOOST_PP_FOR_489, BOOST_PP_TUPLE_EAT_4)(o(489, s), p, o, m)
-# define BOOST_PP_FOR_489_I(s, p, o, m) BOOST_PP_IF(p(490, s), m, BOOST_PP_TUPLE_EAT_2)(490, s) BOOST_PP_IF(p(490, s), BOOST_PP_FOR_490, BOOST_PP_TUPLE_EAT_4)(o(490, s), p, o, m)
-# define BOOST_PP_FOR_490_I(s, p, o, m) BOOST_PP_IF(p(491, s), m, BOOST_PP_TUPLE_EAT_2)(491, s) BOOST_PP_IF(p(491, s), BOOST_PP_FOR_491, BOOST_PP_TUPLE_EAT_4)(o(491, s), p, o, m)
-# define BOOST_PP_FOR_491_I(s, p, o, m) BOOST_PP_IF(p(492, s), m, BOOST_PP_TUPLE_EAT_2)(492, s) BOOST_PP_IF(p(492, s), BOOST_PP_FOR_492, BOOST_PP_TUPLE_EAT_4)(o(492, s), p, o, m)
-# define BOOST_PP_FOR_492_I(s, p, o, m) BOOST_PP_IF(p(493, s), m, BOOST_PP_TUPLE_EAT_2)(493, s) BOOST_PP_IF(p(493, s), BOOST_PP_FOR_493, BOOST_PP_TUPLE_EAT_4)(o(493, s), p, o, m)
-# define BOOST_PP_FOR_493_I(s, p, o, m) BOOST_PP_IF(p(494, s), m, BOOST_PP_TUPLE_EAT_2)(494, s) BOOST_PP_IF(p(494, s), BOOST_PP_FOR_494, BOOST_PP_TUPLE_EAT_4)(o(494, s), p, o, m)
-# define BOOST_PP_FOR_494_I(s, p, o, m) BOOST_PP_IF(p(495, s), m, BOOST_PP_TUPLE_EAT_2)(495, s) BOOST_PP_IF(p(495, s), BOOST_PP_FOR_495, BOOST_PP_TUPLE_EAT_4)(o(495, s), p, o, m)
-# define BOOST_PP_FOR_495_I(s, p, o, m) BOOST_PP_IF(p(496, s), m, BOOST_PP_TUPLE_EAT_2)(496, s) BOOST_PP_IF(p(496, s), BOOST_PP_FOR_496, BOOST_PP_TUPLE_EAT_4)(o(496, s), p, o, m)
-# define BOOST_PP_FOR_496_I(s, p, o, m) BOOST_PP_IF(p(497, s), m, BOOST_PP_TUPLE_EAT_2)(497, s) BOOST_PP_IF(p(497, s), BOOST_PP_FOR_497, BOOST_PP_TUPLE_EAT_4)(o(497, s), p, o, m)
-# define BOOST_PP_FOR_497_I(s, p, o, m) BOOST_PP_IF(p(498, s), m, BOOST_PP_TUPLE_EAT_2)(498, s) BOOST_PP_IF(p(498, s), BOOST_PP_FOR_498, BOOST_PP_TUPLE_EAT_4)(o(498, s), p, o, m)
-# define BOOST_PP_FOR_498_I(s, p, o, m) BOOST_PP_IF(p(499, s), m, BOOST_PP_TUPLE_EAT_2)(499, s) BOOST_PP_IF(p(499, s), BOOST_PP_FOR_499, BOOST_PP_TUPLE_EAT_4)(o(499, s), p, o, m)
-# define BOOST_PP_FOR_499_I(s, p, o, m) BOOST_PP_IF(p(500, s), m, BOOST_PP_TUPLE_EAT_2)(500, s) BOOST_PP_IF(p(500, s), BOOST_PP_FOR_500, BOOST_PP_TUPLE_EAT_4)(o(500, s), p, o, m)
-# define BOOST_PP_FOR_500_I(s, p, o, m) BOOST_PP_IF(p(501, s), m, BOOST_PP_TUPLE_EAT_2)(501, s) BOOST_PP_IF(p(501, s), BOOST_PP_FOR_501, BOOST_PP_TUPLE_EAT_4)(o(501, s), p, o, m)
-# define BOOST_PP_FOR_501_I(s, p, o, m) BOOST_PP_IF(p(502, s), m, BOOST_PP_TUPLE_EAT_2)(502, s) BOOST_PP_IF(p(502, s), BOOST_PP_FOR_502, BOOST_PP_TUPLE_EAT_4)(o(502, s), p, o, m)
-# define BOOST_PP_FOR_502_I(s, p, o, m) BOOST_PP_IF(p(503, s), m, BOOST_PP_TUPLE_EAT_2)(503, s) BOOST_PP_IF(p(503, s), BOOST_PP_FOR_503, BOOST_PP_TUPLE_EAT_4)(o(503, s), p, o, m)
-# define BOOST_PP_FOR_503_I(s, p, o, m) BOOST_PP_IF(p(504, s), m, BOOST_PP_TUPLE_EAT_2)(504, s) BOOST_PP_IF(p(504, s), BOOST_PP_FOR_504, BOOST_PP_TUPLE_EAT_4)(o(504, s), p, o, m)
-# define BOOST_PP_FOR_504_I(s, p, o, m) BOOST_PP_IF(p(505, s), m, BOOST_PP_TUPLE_EAT_2)(505, s) BOOST_PP_IF(p(505, s), BOOST_PP_FOR_505, BOOST_PP_TUPLE_EAT_4)(o(505, s), p, o, m)
-# define BOOST_PP_FOR_505_I(s, p, o, m) BOOST_PP_IF(p(506, s), m, BOOST_PP_TUPLE_EAT_2)(506, s) BOOST_PP_IF(p(506, s), BOOST_PP_FOR_506, BOOST_PP_TUPLE_EAT_4)(o(506, s), p, o, m)
-# define BOOST_PP_FOR_506_I(s, p, o, m) BOOST_PP_IF(p(507, s), m, BOOST_PP_TUPLE_EAT_2)(507, s) BOOST_PP_IF(p(507, s), BOOST_PP_FOR_507, BOOST_PP_TUPLE_EAT_4)(o(507, s), p, o, m)
-# define BOOST_PP_FOR_507_I(s, p, o, m) BOOST_PP_IF(p(508, s), m, BOOST_PP_TUPLE_EAT_2)(508, s) BOOST_PP_IF(p(508, s), BOOST_PP_FOR_508, BOOST_PP_TUPLE_EAT_4)(o(508, s), p, o, m)
-# define BOOST_PP_FOR_508_I(s, p, o, m) BOOST_PP_IF(p(509, s), m, BOOST_PP_TUPLE_EAT_2)(509, s) BOOST_PP_IF(p(509, s), BOOST_PP_FOR_509, BOOST_PP_TUPLE_EAT_4)(o(509, s), p, o, m)
-# define BOOST_PP_FOR_509_I(s, p, o, m) BOOST_PP_IF(p(510, s), m, BOOST_PP_TUPLE_EAT_2)(510, s) BOOST_PP_IF(p(510, s), BOOST_PP_FOR_510, BOOST_PP_TUPLE_EAT_4)(o(510, s), p, o, m)
-# define BOOST_PP_FOR_510_I(s, p, o, m) BOOST_PP_IF(p(511, s), m, BOOST_PP_TUPLE_EAT_2)(511, s) BOOST_PP_IF(p(511, s), BOOST_PP_FOR_511, BOOST_PP_TUPLE_EAT_4)(o(511, s), p, o, m)
-# define BOOST_PP_FOR_511_I(s, p, o, m) BOOST_PP_IF(p(512, s), m, BOOST_PP_TUPLE_EAT_2)(512, s) BOOST_PP_IF(p(512, s), BOOST_PP_FOR_512, BOOST_PP_TUPLE_EAT_4)(o(512, s), p, o, m)
-# define BOOST_PP_FOR_512_I(s, p, o, m) BOOST_PP_IF(p(513, s), m, BOOST_PP_TUPLE_EAT_2)(513, s) BOOST_PP_IF(p(513, s), BOOST_PP_FOR_513, BOOST_PP_TUPLE_EAT_4)(o(513, s), p, o, m)
-#
-# endif
@@ -1,1557 +0,0 @@
-# /* Copyright (C) 2001
-#  * Housemarque Oy
-#  * http://www.housemarque.com
-#  *
-#  * Distributed under the Boost Software License, Version 1.0. (See
-#  * accompanying file LICENSE_1_0.txt or copy at
-#  * http://www.boost.org/LICENSE_1_0.txt)
-#  */
-#
-# /* Revised by Paul Mensonides (2002) */
-# /* Revised by Edward Diener (2020) */
-#
-# /* See http://www.boost.org for most recent version. */
-#
-# ifndef BOOST_PREPROCESSOR_REPETITION_REPEAT_1024_HPP
-# define BOOST_PREPROCESSOR_REPETITION_REPEAT_1024_HPP
-#
-# define BOOST_PP_REPEAT_1_513(m, d) BOOST_PP_REPEAT_1_512(m, d) m(2, 512, d)
-# define BOOST_PP_REPEAT_1_514(m, d) BOOST_PP_REPEAT_1_513(m, d) m(2, 513, d)
-# define BOOST_PP_REPEAT_1_515(m, d) BOOST_PP_REPEAT_1_514(m, d) m(2, 514, d)
-# define BOOST_PP_REPEAT_1_516(m, d) BOOST_PP_REPEAT_1_515(m, d) m(2, 515, d)
-# define BOOST_PP_REPEAT_1_517(m, d) BOOST_PP_REPEAT_1_516(m, d) m(2, 516, d)
-# define BOOST_PP_REPEAT_1_518(m, d) BOOST_PP_REPEAT_1_517(m, d) m(2, 517, d)
-# define BOOST_PP_REPEAT_1_519(m, d) BOOST_PP_REPEAT_1_518(m, d) m(2, 518, d)
-# define BOOST_PP_REPEAT_1_520(m, d) BOOST_PP_REPEAT_1_519(m, d) m(2, 519, d)
-# define BOOST_PP_REPEAT_1_521(m, d) BOOST_PP_REPEAT_1_520(m, d) m(2, 520, d)
-# define BOOST_PP_REPEAT_1_522(m, d) BOOST_PP_REPEAT_1_521(m, d) m(2, 521, d)
-# define BOOST_PP_REPEAT_1_523(m, d) BOOST_PP_REPEAT_1_522(m, d) m(2, 522, d)
-# define BOOST_PP_REPEAT_1_524(m, d) BOOST_PP_REPEAT_1_523(m, d) m(2, 523, d)
-# define BOOST_PP_REPEAT_1_525(m, d) BOOST_PP_REPEAT_1_524(m, d) m(2, 524, d)
-# define BOOST_PP_REPEAT_1_526(m, d) BOOST_PP_REPEAT_1_525(m, d) m(2, 525, d)
-# define BOOST_PP_REPEAT_1_527(m, d) BOOST_PP_REPEAT_1_526(m, d) m(2, 526, d)
-# define BOOST_PP_REPEAT_1_528(m, d) BOOST_PP_REPEAT_1_527(m, d) m(2, 527, d)
-# define BOOST_PP_REPEAT_1_529(m, d) BOOST_PP_REPEAT_1_528(m, d) m(2, 528, d)
-# define BOOST_PP_REPEAT_1_530(m, d) BOOST_PP_REPEAT_1_529(m, d) m(2, 529, d)
-# define BOOST_PP_REPEAT_1_531(m, d) BOOST_PP_REPEAT_1_530(m, d) m(2, 530, d)
-# define BOOST_PP_REPEAT_1_532(m, d) BOOST_PP_REPEAT_1_531(m, d) m(2, 531, d)
-# define BOOST_PP_REPEAT_1_533(m, d) BOOST_PP_REPEAT_1_532(m, d) m(2, 532, d)
-# define BOOST_PP_REPEAT_1_534(m, d) BOOST_PP_REPEAT_1_533(m, d) m(2, 533, d)
-# define BOOST_PP_REPEAT_1_535(m, d) BOOST_PP_REPEAT_1_534(m, d) m(2, 534, d)
-# define BOOST_PP_REPEAT_1_536(m, d) BOOST_PP_REPEAT_1_535(m, d) m(2, 535, d)
-# define BOOST_PP_REPEAT_1_537(m, d) BOOST_PP_REPEAT_1_536(m, d) m(2, 536, d)
-# define BOOST_PP_REPEAT_1_538(m, d) BOOST_PP_REPEAT_1_537(m, d) m(2, 537, d)
-# define BOOST_PP_REPEAT_1_539(m, d) BOOST_PP_REPEAT_1_538(m, d) m(2, 538, d)
-# define BOOST_PP_REPEAT_1_540(m, d) BOOST_PP_REPEAT_1_539(m, d) m(2, 539, d)
-# define BOOST_PP_REPEAT_1_541(m, d) BOOST_PP_REPEAT_1_540(m, d) m(2, 540, d)
-# define BOOST_PP_REPEAT_1_542(m, d) BOOST_PP_REPEAT_1_541(m, d) m(2, 541, d)
-# define BOOST_PP_REPEAT_1_543(m, d) BOOST_PP_REPEAT_1_542(m, d) m(2, 542, d)
-# define BOOST_PP_REPEAT_1_544(m, d) BOOST_PP_REPEAT_1_543(m, d) m(2, 543, d)
-# define BOOST_PP_REPEAT_1_545(m, d) BOOST_PP_REPEAT_1_544(m, d) m(2, 544, d)
-# define BOOST_PP_REPEAT_1_546(m, d) BOOST_PP_REPEAT_1_545(m, d) m(2, 545, d)
-# define BOOST_PP_REPEAT_1_547(m, d) BOOST_PP_REPEAT_1_546(m, d) m(2, 546, d)
-# define BOOST_PP_REPEAT_1_548(m, d) BOOST_PP_REPEAT_1_547(m, d) m(2, 547, d)
-# define BOOST_PP_REPEAT_1_549(m, d) BOOST_PP_REPEAT_1_548(m, d) m(2, 548, d)
-# define BOOST_PP_REPEAT_1_550(m, d) BOOST_PP_REPEAT_1_549(m, d) m(2, 549, d)
-# define BOOST_PP_REPEAT_1_551(m, d) BOOST_PP_REPEAT_1_550(m, d) m(2, 550, d)
-# define BOOST_PP_REPEAT_1_552(m, d) BOOST_PP_REPEAT_1_551(m, d) m(2, 551, d)
-# define BOOST_PP_REPEAT_1_553(m, d) BOOST_PP_REPEAT_1_552(m, d) m(2, 552, d)
-# define BOOST_PP_REPEAT_1_554(m, d) BOOST_PP_REPEAT_1_553(m, d) m(2, 553, d)
-# define BOOST_PP_REPEAT_1_555(m, d) BOOST_PP_REPEAT_1_554(m, d) m(2, 554, d)
-# define BOOST_PP_REPEAT_1_556(m, d) BOOST_PP_REPEAT_1_555(m, d) m(2, 555, d)
-# define BOOST_PP_REPEAT_1_557(m, d) BOOST_PP_REPEAT_1_556(m, d) m(2, 556, d)
-# define BOOST_PP_REPEAT_1_558(m, d) BOOST_PP_REPEAT_1_557(m, d) m(2, 557, d)
-# define BOOST_PP_REPEAT_1_559(m, d) BOOST_PP_REPEAT_1_558(m, d) m(2, 558, d)
-# define BOOST_PP_REPEAT_1_560(m, d) BOOST_PP_REPEAT_1_559(m, d) m(2, 559, d)
-# define BOOST_PP_REPEAT_1_561(m, d) BOOST_PP_REPEAT_1_560(m, d) m(2, 560, d)
-# define BOOST_PP_REPEAT_1_562(m, d) BOOST_PP_REPEAT_1_561(m, d) m(2, 561, d)
-# define BOOST_PP_REPEAT_1_563(m, d) BOOST_PP_REPEAT_1_562(m, d) m(2, 562, d)
-# define BOOST_PP_REPEAT_1_564(m, d) BOOST_PP_REPEAT_1_563(m, d) m(2, 563, d)
-# define BOOST_PP_REPEAT_1_565(m, d) BOOST_PP_REPEAT_1_564(m, d) m(2, 564, d)
-# define BOOST_PP_REPEAT_1_566(m, d) BOOST_PP_REPEAT_1_565(m, d) m(2, 565, d)
-# define BOOST_PP_REPEAT_1_567(m, d) BOOST_PP_REPEAT_1_566(m, d) m(2, 566, d)
-# define BOOST_PP_REPEAT_1_568(m, d) BOOST_PP_REPEAT_1_567(m, d) m(2, 567, d)
-# define BOOST_PP_REPEAT_1_569(m, d) BOOST_PP_REPEAT_1_568(m, d) m(2, 568, d)
-# define BOOST_PP_REPEAT_1_570(m, d) BOOST_PP_REPEAT_1_569(m, d) m(2, 569, d)
-# define BOOST_PP_REPEAT_1_571(m, d) BOOST_PP_REPEAT_1_570(m, d) m(2, 570, d)
-# define BOOST_PP_REPEAT_1_572(m, d) BOOST_PP_REPEAT_1_571(m, d) m(2, 571, d)
-# define BOOST_PP_REPEAT_1_573(m, d) BOOST_PP_REPEAT_1_572(m, d) m(2, 572, d)
-# define BOOST_PP_REPEAT_1_574(m, d) BOOST_PP_REPEAT_1_573(m, d) m(2, 573, d)
-# define BOOST_PP_REPEAT_1_575(m, d) BOOST_PP_REPEAT_1_574(m, d) m(2, 574, d)
-# define BOOST_PP_REPEAT_1_576(m, d) BOOST_PP_REPEAT_1_575(m, d) m(2, 575, d)
-# define BOOST_PP_REPEAT_1_577(m, d) BOOST_PP_REPEAT_1_576(m, d) m(2, 576, d)
-# define BOOST_PP_REPEAT_1_578(m, d) BOOST_PP_REPEAT_1_577(m, d) m(2, 577, d)
-# define BOOST_PP_REPEAT_1_579(m, d) BOOST_PP_REPEAT_1_578(m, d) m(2, 578, d)
-# define BOOST_PP_REPEAT_1_580(m, d) BOOST_PP_REPEAT_1_579(m, d) m(2, 579, d)
-# define BOOST_PP_REPEAT_1_581(m, d) BOOST_PP_REPEAT_1_580(m, d) m(2, 580, d)
-# define BOOST_PP_REPEAT_1_582(m, d) BOOST_PP_REPEAT_1_581(m, d) m(2, 581, d)
-# define BOOST_PP_REPEAT_1_583(m, d) BOOST_PP_REPEAT_1_582(m, d) m(2, 582, d)
-# define BOOST_PP_REPEAT_1_584(m, d) BOOST_PP_REPEAT_1_583(m, d) m(2, 583, d)
-# define BOOST_PP_REPEAT_1_585(m, d) BOOST_PP_REPEAT_1_584(m, d) m(2, 584, d)
-# define BOOST_PP_REPEAT_1_586(m, d) BOOST_PP_REPEAT_1_585(m, d) m(2, 585, d)
-# define BOOST_PP_REPEAT_1_587(m, d) BOOST_PP_REPEAT_1_586(m, d) m(2, 586, d)
-# define BOOST_PP_REPEAT_1_588(m, d) BOOST_PP_REPEAT_1_587(m, d) m(2, 587, d)
-# define BOOST_PP_REPEAT_1_589(m, d) BOOST_PP_REPEAT_1_588(m, d) m(2, 588, d)
-# define BOOST_PP_REPEAT_1_590(m, d) BOOST_PP_REPEAT_1_589(m, d) m(2, 589, d)
-# define BOOST_PP_REPEAT_1_591(m, d) BOOST_PP_REPEAT_1_590(m, d) m(2, 590, d)
-# define BOOST_PP_REPEAT_1_592(m, d) BOOST_PP_REPEAT_1_591(m, d) m(2, 591, d)
-# define BOOST_PP_REPEAT_1_593(m, d) BOOST_PP_REPEAT_1_592(m, d) m(2, 592, d)
-# define BOOST_PP_REPEAT_1_594(m, d) BOOST_PP_REPEAT_1_593(m, d) m(2, 593, d)
-# define BOOST_PP_REPEAT_1_595(m, d) BOOST_PP_REPEAT_1_594(m, d) m(2, 594, d)
-# define BOOST_PP_REPEAT_1_596(m, d) BOOST_PP_REPEAT_1_595(m, d) m(2, 595, d)
-# define BOOST_PP_REPEAT_1_597(m, d) BOOST_PP_REPEAT_1_596(m, d) m(2, 596, d)
-# define BOOST_PP_REPEAT_1_598(m, d) BOOST_PP_REPEAT_1_597(m, d) m(2, 597, d)
-# define BOOST_PP_REPEAT_1_599(m, d) BOOST_PP_REPEAT_1_598(m, d) m(2, 598, d)
-# define BOOST_PP_REPEAT_1_600(m, d) BOOST_PP_REPEAT_1_599(m, d) m(2, 599, d)
-# define BOOST_PP_REPEAT_1_601(m, d) BOOST_PP_REPEAT_1_600(m, d) m(2, 600, d)
-# define BOOST_PP_REPEAT_1_602(m, d) BOOST_PP_REPEAT_1_601(m, d) m(2, 601, d)
-# define BOOST_PP_REPEAT_1_603(m, d) BOOST_PP_REPEAT_1_602(m, d) m(2, 602, d)
-# define BOOST_PP_REPEAT_1_604(m, d) BOOST_PP_REPEAT_1_603(m, d) m(2, 603, d)
-# define BOOST_PP_REPEAT_1_605(m, d) BOOST_PP_REPEAT_1_604(m, d) m(2, 604, d)
-# define BOOST_PP_REPEAT_1_606(m, d) BOOST_PP_REPEAT_1_605(m, d) m(2, 605, d)
-# define BOOST_PP_REPEAT_1_607(m, d) BOOST_PP_REPEAT_1_606(m, d) m(2, 606, d)
-# define BOOST_PP_REPEAT_1_608(m, d) BOOST_PP_REPEAT_1_607(m, d) m(2, 607, d)
-# define BOOST_PP_REPEAT_1_609(m, d) BOOST_PP_REPEAT_1_608(m, d) m(2, 608, d)
-# define BOOST_PP_REPEAT_1_610(m, d) BOOST_PP_REPEAT_1_609(m, d) m(2, 609, d)
-# define BOOST_PP_REPEAT_1_611(m, d) BOOST_PP_REPEAT_1_610(m, d) m(2, 610, d)
-# define BOOST_PP_REPEAT_1_612(m, d) BOOST_PP_REPEAT_1_611(m, d) m(2, 611, d)
-# define BOOST_PP_REPEAT_1_613(m, d) BOOST_PP_REPEAT_1_612(m, d) m(2, 612, d)
-# define BOOST_PP_REPEAT_1_614(m, d) BOOST_PP_REPEAT_1_613(m, d) m(2, 613, d)
-# define BOOST_PP_REPEAT_1_615(m, d) BOOST_PP_REPEAT_1_614(m, d) m(2, 614, d)
-# define BOOST_PP_REPEAT_1_616(m, d) BOOST_PP_REPEAT_1_615(m, d) m(2, 615, d)
-# define BOOST_PP_REPEAT_1_617(m, d) BOOST_PP_REPEAT_1_616(m, d) m(2, 616, d)
-# define BOOST_PP_REPEAT_1_618(m, d) BOOST_PP_REPEAT_1_617(m, d) m(2, 617, d)
-# define BOOST_PP_REPEAT_1_619(m, d) BOOST_PP_REPEAT_1_618(m, d) m(2, 618, d)
-# define BOOST_PP_REPEAT_1_620(m, d) BOOST_PP_REPEAT_1_619(m, d) m(2, 619, d)
-# define BOOST_PP_REPEAT_1_621(m, d) BOOST_PP_REPEAT_1_620(m, d) m(2, 620, d)
-# define BOOST_PP_REPEAT_1_622(m, d) BOOST_PP_REPEAT_1_621(m, d) m(2, 621, d)
-# define BOOST_PP_REPEAT_1_623(m, d) BOOST_PP_REPEAT_1_622(m, d) m(2, 622, d)
-# define BOOST_PP_REPEAT_1_624(m, d) BOOST_PP_REPEAT_1_623(m, d) m(2, 623, d)
-# define BOOST_PP_REPEAT_1_625(m, d) BOOST_PP_REPEAT_1_624(m, d) m(2, 624, d)
-# define BOOST_PP_REPEAT_1_626(m, d) BOOST_PP_REPEAT_1_625(m, d) m(2, 625, d)
-# define BOOST_PP_REPEAT_1_627(m, d) BOOST_PP_REPEAT_1_626(m, d) m(2, 626, d)
-# define BOOST_PP_REPEAT_1_628(m, d) BOOST_PP_REPEAT_1_627(m, d) m(2, 627, d)
-# define BOOST_PP_REPEAT_1_629(m, d) BOOST_PP_REPEAT_1_628(m, d) m(2, 628, d)
-# define BOOST_PP_REPEAT_1_630(m, d) BOOST_PP_REPEAT_1_629(m, d) m(2, 629, d)
-# define BOOST_PP_REPEAT_1_631(m, d) BOOST_PP_REPEAT_1_630(m, d) m(2, 630, d)
-# define BOOST_PP_REPEAT_1_632(m, d) BOOST_PP_REPEAT_1_631(m, d) m(2, 631, d)
-# define BOOST_PP_REPEAT_1_633(m, d) BOOST_PP_REPEAT_1_632(m, d) m(2, 632, d)
-# define BOOST_PP_REPEAT_1_634(m, d) BOOST_PP_REPEAT_1_633(m, d) m(2, 633, d)
-# define BOOST_PP_REPEAT_1_635(m, d) BOOST_PP_REPEAT_1_634(m, d) m(2, 634, d)
-# define BOOST_PP_REPEAT_1_636(m, d) BOOST_PP_REPEAT_1_635(m, d) m(2, 635, d)
-# define BOOST_PP_REPEAT_1_637(m, d) BOOST_PP_REPEAT_1_636(m, d) m(2, 636, d)
-# define BOOST_PP_REPEAT_1_638(m, d) BOOST_PP_REPEAT_1_637(m, d) m(2, 637, d)
-# define BOOST_PP_REPEAT_1_639(m, d) BOOST_PP_REPEAT_1_638(m, d) m(2, 638, d)
-# define BOOST_PP_REPEAT_1_640(m, d) BOOST_PP_REPEAT_1_639(m, d) m(2, 639, d)
-# define BOOST_PP_REPEAT_1_641(m, d) BOOST_PP_REPEAT_1_640(m, d) m(2, 640, d)
-# define BOOST_PP_REPEAT_1_642(m, d) BOOST_PP_REPEAT_1_641(m, d) m(2, 641, d)
-# define BOOST_PP_REPEAT_1_643(m, d) BOOST_PP_REPEAT_1_642(m, d) m(2, 642, d)
-# define BOOST_PP_REPEAT_1_644(m, d) BOOST_PP_REPEAT_1_643(m, d) m(2, 643, d)
-# define BOOST_PP_REPEAT_1_645(m, d) BOOST_PP_REPEAT_1_644(m, d) m(2, 644, d)
-# define BOOST_PP_REPEAT_1_646(m, d) BOOST_PP_REPEAT_1_645(m, d) m(2, 645, d)
-# define BOOST_PP_REPEAT_1_647(m, d) BOOST_PP_REPEAT_1_646(m, d) m(2, 646, d)
-# define BOOST_PP_REPEAT_1_648(m, d) BOOST_PP_REPEAT_1_647(m, d) m(2, 647, d)
-# define BOOST_PP_REPEAT_1_649(m, d) BOOST_PP_REPEAT_1_648(m, d) m(2, 648, d)
-# define BOOST_PP_REPEAT_1_650(m, d) BOOST_PP_REPEAT_1_649(m, d) m(2, 649, d)
-# define BOOST_PP_REPEAT_1_651(m, d) BOOST_PP_REPEAT_1_650(m, d) m(2, 650, d)
-# define BOOST_PP_REPEAT_1_652(m, d) BOOST_PP_REPEAT_1_651(m, d) m(2, 651, d)
-# define BOOST_PP_REPEAT_1_653(m, d) BOOST_PP_REPEAT_1_652(m, d) m(2, 652, d)
-# define BOOST_PP_REPEAT_1_654(m, d) BOOST_PP_REPEAT_1_653(m, d) m(2, 653, d)
-# define BOOST_PP_REPEAT_1_655(m, d) BOOST_PP_REPEAT_1_654(m, d) m(2, 654, d)
-# define BOOST_PP_REPEAT_1_656(m, d) BOOST_PP_REPEAT_1_655(m, d) m(2, 655, d)
-# define BOOST_PP_REPEAT_1_657(m, d) BOOST_PP_REPEAT_1_656(m, d) m(2, 656, d)
-# define BOOST_PP_REPEAT_1_658(m, d) BOOST_PP_REPEAT_1_657(m, d) m(2, 657, d)
-# define BOOST_PP_REPEAT_1_659(m, d) BOOST_PP_REPEAT_1_658(m, d) m(2, 658, d)
-# define BOOST_PP_REPEAT_1_660(m, d) BOOST_PP_REPEAT_1_659(m, d) m(2, 659, d)
-# define BOOST_PP_REPEAT_1_661(m, d) BOOST_PP_REPEAT_1_660(m, d) m(2, 660, d)
-# define BOOST_PP_REPEAT_1_662(m, d) BOOST_PP_REPEAT_1_661(m, d) m(2, 661, d)
-# define BOOST_PP_REPEAT_1_663(m, d) BOOST_PP_REPEAT_1_662(m, d) m(2, 662, d)
-# define BOOST_PP_REPEAT_1_664(m, d) BOOST_PP_REPEAT_1_663(m, d) m(2, 663, d)
-# define BOOST_PP_REPEAT_1_665(m, d) BOOST_PP_REPEAT_1_664(m, d) m(2, 664, d)
-# define BOOST_PP_REPEAT_1_666(m, d) BOOST_PP_REPEAT_1_665(m, d) m(2, 665, d)
-# define BOOST_PP_REPEAT_1_667(m, d) BOOST_PP_REPEAT_1_666(m, d) m(2, 666, d)
-# define BOOST_PP_REPEAT_1_668(m, d) BOOST_PP_REPEAT_1_667(m, d) m(2, 667, d)
-# define BOOST_PP_REPEAT_1_669(m, d) BOOST_PP_REPEAT_1_668(m, d) m(2, 668, d)
-# define BOOST_PP_REPEAT_1_670(m, d) BOOST_PP_REPEAT_1_669(m, d) m(2, 669, d)
-# define BOOST_PP_REPEAT_1_671(m, d) BOOST_PP_REPEAT_1_670(m, d) m(2, 670, d)
-# define BOOST_PP_REPEAT_1_672(m, d) BOOST_PP_REPEAT_1_671(m, d) m(2, 671, d)
-# define BOOST_PP_REPEAT_1_673(m, d) BOOST_PP_REPEAT_1_672(m, d) m(2, 672, d)
-# define BOOST_PP_REPEAT_1_674(m, d) BOOST_PP_REPEAT_1_673(m, d) m(2, 673, d)
-# define BOOST_PP_REPEAT_1_675(m, d) BOOST_PP_REPEAT_1_674(m, d) m(2, 674, d)
-# define BOOST_PP_REPEAT_1_676(m, d) BOOST_PP_REPEAT_1_675(m, d) m(2, 675, d)
-# define BOOST_PP_REPEAT_1_677(m, d) BOOST_PP_REPEAT_1_676(m, d) m(2, 676, d)
-# define BOOST_PP_REPEAT_1_678(m, d) BOOST_PP_REPEAT_1_677(m, d) m(2, 677, d)
-# define BOOST_PP_REPEAT_1_679(m, d) BOOST_PP_REPEAT_1_678(m, d) m(2, 678, d)
-# define BOOST_PP_REPEAT_1_680(m, d) BOOST_PP_REPEAT_1_679(m, d) m(2, 679, d)
-# define BOOST_PP_REPEAT_1_681(m, d) BOOST_PP_REPEAT_1_680(m, d) m(2, 680, d)
-# define BOOST_PP_REPEAT_1_682(m, d) BOOST_PP_REPEAT_1_681(m, d) m(2, 681, d)
-# define BOOST_PP_REPEAT_1_683(m, d) BOOST_PP_REPEAT_1_682(m, d) m(2, 682, d)
-# define BOOST_PP_REPEAT_1_684(m, d) BOOST_PP_REPEAT_1_683(m, d) m(2, 683, d)
-# define BOOST_PP_REPEAT_1_685(m, d) BOOST_PP_REPEAT_1_684(m, d) m(2, 684, d)
-# define BOOST_PP_REPEAT_1_686(m, d) BOOST_PP_REPEAT_1_685(m, d) m(2, 685, d)
-# define BOOST_PP_REPEAT_1_687(m, d) BOOST_PP_REPEAT_1_686(m, d) m(2, 686, d)
-# define BOOST_PP_REPEAT_1_688(m, d) BOOST_PP_REPEAT_1_687(m, d) m(2, 687, d)
-# define BOOST_PP_REPEAT_1_689(m, d) BOOST_PP_REPEAT_1_688(m, d) m(2, 688, d)
-# define BOOST_PP_REPEAT_1_690(m, d) BOOST_PP_REPEAT_1_689(m, d) m(2, 689, d)
-# define BOOST_PP_REPEAT_1_691(m, d) BOOST_PP_REPEAT_1_690(m, d) m(2, 690, d)
-# define BOOST_PP_REPEAT_1_692(m, d) BOOST_PP_REPEAT_1_691(m, d) m(2, 691, d)
-# define BOOST_PP_REPEAT_1_693(m, d) BOOST_PP_REPEAT_1_692(m, d) m(2, 692, d)
-# define BOOST_PP_REPEAT_1_694(m, d) BOOST_PP_REPEAT_1_693(m, d) m(2, 693, d)
-# define BOOST_PP_REPEAT_1_695(m, d) BOOST_PP_REPEAT_1_694(m, d) m(2, 694, d)
-# define BOOST_PP_REPEAT_1_696(m, d) BOOST_PP_REPEAT_1_695(m, d) m(2, 695, d)
-# define BOOST_PP_REPEAT_1_697(m, d) BOOST_PP_REPEAT_1_696(m, d) m(2, 696, d)
-# define BOOST_PP_REPEAT_1_698(m, d) BOOST_PP_REPEAT_1_697(m, d) m(2, 697, d)
-# define BOOST_PP_REPEAT_1_699(m, d) BOOST_PP_REPEAT_1_698(m, d) m(2, 698, d)
-# define BOOST_PP_REPEAT_1_700(m, d) BOOST_PP_REPEAT_1_699(m, d) m(2, 699, d)
-# define BOOST_PP_REPEAT_1_701(m, d) BOOST_PP_REPEAT_1_700(m, d) m(2, 700, d)
-# define BOOST_PP_REPEAT_1_702(m, d) BOOST_PP_REPEAT_1_701(m, d) m(2, 701, d)
-# define BOOST_PP_REPEAT_1_703(m, d) BOOST_PP_REPEAT_1_702(m, d) m(2, 702, d)
-# define BOOST_PP_REPEAT_1_704(m, d) BOOST_PP_REPEAT_1_703(m, d) m(2, 703, d)
-# define BOOST_PP_REPEAT_1_705(m, d) BOOST_PP_REPEAT_1_704(m, d) m(2, 704, d)
-# define BOOST_PP_REPEAT_1_706(m, d) BOOST_PP_REPEAT_1_705(m, d) m(2, 705, d)
-# define BOOST_PP_REPEAT_1_707(m, d) BOOST_PP_REPEAT_1_706(m, d) m(2, 706, d)
-# define BOOST_PP_REPEAT_1_708(m, d) BOOST_PP_REPEAT_1_707(m, d) m(2, 707, d)
-# define BOOST_PP_REPEAT_1_709(m, d) BOOST_PP_REPEAT_1_708(m, d) m(2, 708, d)
-# define BOOST_PP_REPEAT_1_710(m, d) BOOST_PP_REPEAT_1_709(m, d) m(2, 709, d)
-# define BOOST_PP_REPEAT_1_711(m, d) BOOST_PP_REPEAT_1_710(m, d) m(2, 710, d)
-# define BOOST_PP_REPEAT_1_712(m, d) BOOST_PP_REPEAT_1_711(m, d) m(2, 711, d)
-# define BOOST_PP_REPEAT_1_713(m, d) BOOST_PP_REPEAT_1_712(m, d) m(2, 712, d)
-# define BOOST_PP_REPEAT_1_714(m, d) BOOST_PP_REPEAT_1_713(m, d) m(2, 713, d)
-# define BOOST_PP_REPEAT_1_715(m, d) BOOST_PP_REPEAT_1_714(m, d) m(2, 714, d)
-# define BOOST_PP_REPEAT_1_716(m, d) BOOST_PP_REPEAT_1_715(m, d) m(2, 715, d)
-# define BOOST_PP_REPEAT_1_717(m, d) BOOST_PP_REPEAT_1_716(m, d) m(2, 716, d)
-# define BOOST_PP_REPEAT_1_718(m, d) BOOST_PP_REPEAT_1_717(m, d) m(2, 717, d)
-# define BOOST_PP_REPEAT_1_719(m, d) BOOST_PP_REPEAT_1_718(m, d) m(2, 718, d)
-# define BOOST_PP_REPEAT_1_720(m, d) BOOST_PP_REPEAT_1_719(m, d) m(2, 719, d)
-# define BOOST_PP_REPEAT_1_721(m, d) BOOST_PP_REPEAT_1_720(m, d) m(2, 720, d)
-# define BOOST_PP_REPEAT_1_722(m, d) BOOST_PP_REPEAT_1_721(m, d) m(2, 721, d)
-# define BOOST_PP_REPEAT_1_723(m, d) BOOST_PP_REPEAT_1_722(m, d) m(2, 722, d)
-# define BOOST_PP_REPEAT_1_724(m, d) BOOST_PP_REPEAT_1_723(m, d) m(2, 723, d)
-# define BOOST_PP_REPEAT_1_725(m, d) BOOST_PP_REPEAT_1_724(m, d) m(2, 724, d)
-# define BOOST_PP_REPEAT_1_726(m, d) BOOST_PP_REPEAT_1_725(m, d) m(2, 725, d)
-# define BOOST_PP_REPEAT_1_727(m, d) BOOST_PP_REPEAT_1_726(m, d) m(2, 726, d)
-# define BOOST_PP_REPEAT_1_728(m, d) BOOST_PP_REPEAT_1_727(m, d) m(2, 727, d)
-# define BOOST_PP_REPEAT_1_729(m, d) BOOST_PP_REPEAT_1_728(m, d) m(2, 728, d)
-# define BOOST_PP_REPEAT_1_730(m, d) BOOST_PP_REPEAT_1_729(m, d) m(2, 729, d)
-# define BOOST_PP_REPEAT_1_731(m, d) BOOST_PP_REPEAT_1_730(m, d) m(2, 730, d)
-# define BOOST_PP_REPEAT_1_732(m, d) BOOST_PP_REPEAT_1_731(m, d) m(2, 731, d)
-# define BOOST_PP_REPEAT_1_733(m, d) BOOST_PP_REPEAT_1_732(m, d) m(2, 732, d)
-# define BOOST_PP_REPEAT_1_734(m, d) BOOST_PP_REPEAT_1_733(m, d) m(2, 733, d)
-# define BOOST_PP_REPEAT_1_735(m, d) BOOST_PP_REPEAT_1_734(m, d) m(2, 734, d)
-# define BOOST_PP_REPEAT_1_736(m, d) BOOST_PP_REPEAT_1_735(m, d) m(2, 735, d)
-# define BOOST_PP_REPEAT_1_737(m, d) BOOST_PP_REPEAT_1_736(m, d) m(2, 736, d)
-# define BOOST_PP_REPEAT_1_738(m, d) BOOST_PP_REPEAT_1_737(m, d) m(2, 737, d)
-# define BOOST_PP_REPEAT_1_739(m, d) BOOST_PP_REPEAT_1_738(m, d) m(2, 738, d)
-# define BOOST_PP_REPEAT_1_740(m, d) BOOST_PP_REPEAT_1_739(m, d) m(2, 739, d)
-# define BOOST_PP_REPEAT_1_741(m, d) BOOST_PP_REPEAT_1_740(m, d) m(2, 740, d)
-# define BOOST_PP_REPEAT_1_742(m, d) BOOST_PP_REPEAT_1_741(m, d) m(2, 741, d)
-# define BOOST_PP_REPEAT_1_743(m, d) BOOST_PP_REPEAT_1_742(m, d) m(2, 742, d)
-# define BOOST_PP_REPEAT_1_744(m, d) BOOST_PP_REPEAT_1_743(m, d) m(2, 743, d)
-# define BOOST_PP_REPEAT_1_745(m, d) BOOST_PP_REPEAT_1_744(m, d) m(2, 744, d)
-# define BOOST_PP_REPEAT_1_746(m, d) BOOST_PP_REPEAT_1_745(m, d) m(2, 745, d)
-# define BOOST_PP_REPEAT_1_747(m, d) BOOST_PP_REPEAT_1_746(m, d) m(2, 746, d)
-# define BOOST_PP_REPEAT_1_748(m, d) BOOST_PP_REPEAT_1_747(m, d) m(2, 747, d)
-# define BOOST_PP_REPEAT_1_749(m, d) BOOST_PP_REPEAT_1_748(m, d) m(2, 748, d)
-# define BOOST_PP_REPEAT_1_750(m, d) BOOST_PP_REPEAT_1_749(m, d) m(2, 749, d)
-# define BOOST_PP_REPEAT_1_751(m, d) BOOST_PP_REPEAT_1_750(m, d) m(2, 750, d)
-# define BOOST_PP_REPEAT_1_752(m, d) BOOST_PP_REPEAT_1_751(m, d) m(2, 751, d)
-# define BOOST_PP_REPEAT_1_753(m, d) BOOST_PP_REPEAT_1_752(m, d) m(2, 752, d)
-# define BOOST_PP_REPEAT_1_754(m, d) BOOST_PP_REPEAT_1_753(m, d) m(2, 753, d)
-# define BOOST_PP_REPEAT_1_755(m, d) BOOST_PP_REPEAT_1_754(m, d) m(2, 754, d)
-# define BOOST_PP_REPEAT_1_756(m, d) BOOST_PP_REPEAT_1_755(m, d) m(2, 755, d)
-# define BOOST_PP_REPEAT_1_757(m, d) BOOST_PP_REPEAT_1_756(m, d) m(2, 756, d)
-# define BOOST_PP_REPEAT_1_758(m, d) BOOST_PP_REPEAT_1_757(m, d) m(2, 757, d)
-# define BOOST_PP_REPEAT_1_759(m, d) BOOST_PP_REPEAT_1_758(m, d) m(2, 758, d)
-# define BOOST_PP_REPEAT_1_760(m, d) BOOST_PP_REPEAT_1_759(m, d) m(2, 759, d)
-# define BOOST_PP_REPEAT_1_761(m, d) BOOST_PP_REPEAT_1_760(m, d) m(2, 760, d)
-# define BOOST_PP_REPEAT_1_762(m, d) BOOST_PP_REPEAT_1_761(m, d) m(2, 761, d)
-# define BOOST_PP_REPEAT_1_763(m, d) BOOST_PP_REPEAT_1_762(m, d) m(2, 762, d)
-# define BOOST_PP_REPEAT_1_764(m, d) BOOST_PP_REPEAT_1_763(m, d) m(2, 763, d)
-# define BOOST_PP_REPEAT_1_765(m, d) BOOST_PP_REPEAT_1_764(m, d) m(2, 764, d)
-# define BOOST_PP_REPEAT_1_766(m, d) BOOST_PP_REPEAT_1_765(m, d) m(2, 765, d)
-# define BOOST_PP_REPEAT_1_767(m, d) BOOST_PP_REPEAT_1_766(m, d) m(2, 766, d)
-# define BOOST_PP_REPEAT_1_768(m, d) BOOST_PP_REPEAT_1_767(m, d) m(2, 767, d)
-# define BOOST_PP_REPEAT_1_769(m, d) BOOST_PP_REPEAT_1_768(m, d) m(2, 768, d)
-# define BOOST_PP_REPEAT_1_770(m, d) BOOST_PP_REPEAT_1_769(m, d) m(2, 769, d)
-# define BOOST_PP_REPEAT_1_771(m, d) BOOST_PP_REPEAT_1_770(m, d) m(2, 770, d)
-# define BOOST_PP_REPEAT_1_772(m, d) BOOST_PP_REPEAT_1_771(m, d) m(2, 771, d)
-# define BOOST_PP_REPEAT_1_773(m, d) BOOST_PP_REPEAT_1_772(m, d) m(2, 772, d)
-# define BOOST_PP_REPEAT_1_774(m, d) BOOST_PP_REPEAT_1_773(m, d) m(2, 773, d)
-# define BOOST_PP_REPEAT_1_775(m, d) BOOST_PP_REPEAT_1_774(m, d) m(2, 774, d)
-# define BOOST_PP_REPEAT_1_776(m, d) BOOST_PP_REPEAT_1_775(m, d) m(2, 775, d)
-# define BOOST_PP_REPEAT_1_777(m, d) BOOST_PP_REPEAT_1_776(m, d) m(2, 776, d)
-# define BOOST_PP_REPEAT_1_778(m, d) BOOST_PP_REPEAT_1_777(m, d) m(2, 777, d)
-# define BOOST_PP_REPEAT_1_779(m, d) BOOST_PP_REPEAT_1_778(m, d) m(2, 778, d)
-# define BOOST_PP_REPEAT_1_780(m, d) BOOST_PP_REPEAT_1_779(m, d) m(2, 779, d)
-# define BOOST_PP_REPEAT_1_781(m, d) BOOST_PP_REPEAT_1_780(m, d) m(2, 780, d)
-# define BOOST_PP_REPEAT_1_782(m, d) BOOST_PP_REPEAT_1_781(m, d) m(2, 781, d)
-# define BOOST_PP_REPEAT_1_783(m, d) BOOST_PP_REPEAT_1_782(m, d) m(2, 782, d)
-# define BOOST_PP_REPEAT_1_784(m, d) BOOST_PP_REPEAT_1_783(m, d) m(2, 783, d)
-# define BOOST_PP_REPEAT_1_785(m, d) BOOST_PP_REPEAT_1_784(m, d) m(2, 784, d)
-# define BOOST_PP_REPEAT_1_786(m, d) BOOST_PP_REPEAT_1_785(m, d) m(2, 785, d)
-# define BOOST_PP_REPEAT_1_787(m, d) BOOST_PP_REPEAT_1_786(m, d) m(2, 786, d)
-# define BOOST_PP_REPEAT_1_788(m, d) BOOST_PP_REPEAT_1_787(m, d) m(2, 787, d)
-# define BOOST_PP_REPEAT_1_789(m, d) BOOST_PP_REPEAT_1_788(m, d) m(2, 788, d)
-# define BOOST_PP_REPEAT_1_790(m, d) BOOST_PP_REPEAT_1_789(m, d) m(2, 789, d)
-# define BOOST_PP_REPEAT_1_791(m, d) BOOST_PP_REPEAT_1_790(m, d) m(2, 790, d)
-# define BOOST_PP_REPEAT_1_792(m, d) BOOST_PP_REPEAT_1_791(m, d) m(2, 791, d)
-# define BOOST_PP_REPEAT_1_793(m, d) BOOST_PP_REPEAT_1_792(m, d) m(2, 792, d)
-# define BOOST_PP_REPEAT_1_794(m, d) BOOST_PP_REPEAT_1_793(m, d) m(2, 793, d)
-# define BOOST_PP_REPEAT_1_795(m, d) BOOST_PP_REPEAT_1_794(m, d) m(2, 794, d)
-# define BOOST_PP_REPEAT_1_796(m, d) BOOST_PP_REPEAT_1_795(m, d) m(2, 795, d)
-# define BOOST_PP_REPEAT_1_797(m, d) BOOST_PP_REPEAT_1_796(m, d) m(2, 796, d)
-# define BOOST_PP_REPEAT_1_798(m, d) BOOST_PP_REPEAT_1_797(m, d) m(2, 797, d)
-# define BOOST_PP_REPEAT_1_799(m, d) BOOST_PP_REPEAT_1_798(m, d) m(2, 798, d)
-# define BOOST_PP_REPEAT_1_800(m, d) BOOST_PP_REPEAT_1_799(m, d) m(2, 799, d)
-# define BOOST_PP_REPEAT_1_801(m, d) BOOST_PP_REPEAT_1_800(m, d) m(2, 800, d)
-# define BOOST_PP_REPEAT_1_802(m, d) BOOST_PP_REPEAT_1_801(m, d) m(2, 801, d)
-# define BOOST_PP_REPEAT_1_803(m, d) BOOST_PP_REPEAT_1_802(m, d) m(2, 802, d)
-# define BOOST_PP_REPEAT_1_804(m, d) BOOST_PP_REPEAT_1_803(m, d) m(2, 803, d)
-# define BOOST_PP_REPEAT_1_805(m, d) BOOST_PP_REPEAT_1_804(m, d) m(2, 804, d)
-# define BOOST_PP_REPEAT_1_806(m, d) BOOST_PP_REPEAT_1_805(m, d) m(2, 805, d)
-# define BOOST_PP_REPEAT_1_807(m, d) BOOST_PP_REPEAT_1_806(m, d) m(2, 806, d)
-# define BOOST_PP_REPEAT_1_808(m, d) BOOST_PP_REPEAT_1_807(m, d) m(2, 807, d)
-# define BOOST_PP_REPEAT_1_809(m, d) BOOST_PP_REPEAT_1_808(m, d) m(2, 808, d)
-# define BOOST_PP_REPEAT_1_810(m, d) BOOST_PP_REPEAT_1_809(m, d) m(2, 809, d)
-# define BOOST_PP_REPEAT_1_811(m, d) BOOST_PP_REPEAT_1_810(m, d) m(2, 810, d)
-# define BOOST_PP_REPEAT_1_812(m, d) BOOST_PP_REPEAT_1_811(m, d) m(2, 811, d)
-# define BOOST_PP_REPEAT_1_813(m, d) BOOST_PP_REPEAT_1_812(m, d) m(2, 812, d)
-# define BOOST_PP_REPEAT_1_814(m, d) BOOST_PP_REPEAT_1_813(m, d) m(2, 813, d)
-# define BOOST_PP_REPEAT_1_815(m, d) BOOST_PP_REPEAT_1_814(m, d) m(2, 814, d)
-# define BOOST_PP_REPEAT_1_816(m, d) BOOST_PP_REPEAT_1_815(m, d) m(2, 815, d)
-# define BOOST_PP_REPEAT_1_817(m, d) BOOST_PP_REPEAT_1_816(m, d) m(2, 816, d)
-# define BOOST_PP_REPEAT_1_818(m, d) BOOST_PP_REPEAT_1_817(m, d) m(2, 817, d)
-# define BOOST_PP_REPEAT_1_819(m, d) BOOST_PP_REPEAT_1_818(m, d) m(2, 818, d)
-# define BOOST_PP_REPEAT_1_820(m, d) BOOST_PP_REPEAT_1_819(m, d) m(2, 819, d)
-# define BOOST_PP_REPEAT_1_821(m, d) BOOST_PP_REPEAT_1_820(m, d) m(2, 820, d)
-# define BOOST_PP_REPEAT_1_822(m, d) BOOST_PP_REPEAT_1_821(m, d) m(2, 821, d)
-# define BOOST_PP_REPEAT_1_823(m, d) BOOST_PP_REPEAT_1_822(m, d) m(2, 822, d)
-# define BOOST_PP_REPEAT_1_824(m, d) BOOST_PP_REPEAT_1_823(m, d) m(2, 823, d)
-# define BOOST_PP_REPEAT_1_825(m, d) BOOST_PP_REPEAT_1_824(m, d) m(2, 824, d)
-# define BOOST_PP_REPEAT_1_826(m, d) BOOST_PP_REPEAT_1_825(m, d) m(2, 825, d)
-# define BOOST_PP_REPEAT_1_827(m, d) BOOST_PP_REPEAT_1_826(m, d) m(2, 826, d)
-# define BOOST_PP_REPEAT_1_828(m, d) BOOST_PP_REPEAT_1_827(m, d) m(2, 827, d)
-# define BOOST_PP_REPEAT_1_829(m, d) BOOST_PP_REPEAT_1_828(m, d) m(2, 828, d)
-# define BOOST_PP_REPEAT_1_830(m, d) BOOST_PP_REPEAT_1_829(m, d) m(2, 829, d)
-# define BOOST_PP_REPEAT_1_831(m, d) BOOST_PP_REPEAT_1_830(m, d) m(2, 830, d)
-# define BOOST_PP_REPEAT_1_832(m, d) BOOST_PP_REPEAT_1_831(m, d) m(2, 831, d)
-# define BOOST_PP_REPEAT_1_833(m, d) BOOST_PP_REPEAT_1_832(m, d) m(2, 832, d)
-# define BOOST_PP_REPEAT_1_834(m, d) BOOST_PP_REPEAT_1_833(m, d) m(2, 833, d)
-# define BOOST_PP_REPEAT_1_835(m, d) BOOST_PP_REPEAT_1_834(m, d) m(2, 834, d)
-# define BOOST_PP_REPEAT_1_836(m, d) BOOST_PP_REPEAT_1_835(m, d) m(2, 835, d)
-# define BOOST_PP_REPEAT_1_837(m, d) BOOST_PP_REPEAT_1_836(m, d) m(2, 836, d)
-# define BOOST_PP_REPEAT_1_838(m, d) BOOST_PP_REPEAT_1_837(m, d) m(2, 837, d)
-# define BOOST_PP_REPEAT_1_839(m, d) BOOST_PP_REPEAT_1_838(m, d) m(2, 838, d)
-# define BOOST_PP_REPEAT_1_840(m, d) BOOST_PP_REPEAT_1_839(m, d) m(2, 839, d)
-# define BOOST_PP_REPEAT_1_841(m, d) BOOST_PP_REPEAT_1_840(m, d) m(2, 840, d)
-# define BOOST_PP_REPEAT_1_842(m, d) BOOST_PP_REPEAT_1_841(m, d) m(2, 841, d)
-# define BOOST_PP_REPEAT_1_843(m, d) BOOST_PP_REPEAT_1_842(m, d) m(2, 842, d)
-# define BOOST_PP_REPEAT_1_844(m, d) BOOST_PP_REPEAT_1_843(m, d) m(2, 843, d)
-# define BOOST_PP_REPEAT_1_845(m, d) BOOST_PP_REPEAT_1_844(m, d) m(2, 844, d)
-# define BOOST_PP_REPEAT_1_846(m, d) BOOST_PP_REPEAT_1_845(m, d) m(2, 845, d)
-# define BOOST_PP_REPEAT_1_847(m, d) BOOST_PP_REPEAT_1_846(m, d) m(2, 846, d)
-# define BOOST_PP_REPEAT_1_848(m, d) BOOST_PP_REPEAT_1_847(m, d) m(2, 847, d)
-# define BOOST_PP_REPEAT_1_849(m, d) BOOST_PP_REPEAT_1_848(m, d) m(2, 848, d)
-# define BOOST_PP_REPEAT_1_850(m, d) BOOST_PP_REPEAT_1_849(m, d) m(2, 849, d)
-# define BOOST_PP_REPEAT_1_851(m, d) BOOST_PP_REPEAT_1_850(m, d) m(2, 850, d)
-# define BOOST_PP_REPEAT_1_852(m, d) BOOST_PP_REPEAT_1_851(m, d) m(2, 851, d)
-# define BOOST_PP_REPEAT_1_853(m, d) BOOST_PP_REPEAT_1_852(m, d) m(2, 852, d)
-# define BOOST_PP_REPEAT_1_854(m, d) BOOST_PP_REPEAT_1_853(m, d) m(2, 853, d)
-# define BOOST_PP_REPEAT_1_855(m, d) BOOST_PP_REPEAT_1_854(m, d) m(2, 854, d)
-# define BOOST_PP_REPEAT_1_856(m, d) BOOST_PP_REPEAT_1_855(m, d) m(2, 855, d)
-# define BOOST_PP_REPEAT_1_857(m, d) BOOST_PP_REPEAT_1_856(m, d) m(2, 856, d)
-# define BOOST_PP_REPEAT_1_858(m, d) BOOST_PP_REPEAT_1_857(m, d) m(2, 857, d)
-# define BOOST_PP_REPEAT_1_859(m, d) BOOST_PP_REPEAT_1_858(m, d) m(2, 858, d)
-# define BOOST_PP_REPEAT_1_860(m, d) BOOST_PP_REPEAT_1_859(m, d) m(2, 859, d)
-# define BOOST_PP_REPEAT_1_861(m, d) BOOST_PP_REPEAT_1_860(m, d) m(2, 860, d)
-# define BOOST_PP_REPEAT_1_862(m, d) BOOST_PP_REPEAT_1_861(m, d) m(2, 861, d)
-# define BOOST_PP_REPEAT_1_863(m, d) BOOST_PP_REPEAT_1_862(m, d) m(2, 862, d)
-# define BOOST_PP_REPEAT_1_864(m, d) BOOST_PP_REPEAT_1_863(m, d) m(2, 863, d)
-# define BOOST_PP_REPEAT_1_865(m, d) BOOST_PP_REPEAT_1_864(m, d) m(2, 864, d)
-# define BOOST_PP_REPEAT_1_866(m, d) BOOST_PP_REPEAT_1_865(m, d) m(2, 865, d)
-# define BOOST_PP_REPEAT_1_867(m, d) BOOST_PP_REPEAT_1_866(m, d) m(2, 866, d)
-# define BOOST_PP_REPEAT_1_868(m, d) BOOST_PP_REPEAT_1_867(m, d) m(2, 867, d)
-# define BOOST_PP_REPEAT_1_869(m, d) BOOST_PP_REPEAT_1_868(m, d) m(2, 868, d)
-# define BOOST_PP_REPEAT_1_870(m, d) BOOST_PP_REPEAT_1_869(m, d) m(2, 869, d)
-# define BOOST_PP_REPEAT_1_871(m, d) BOOST_PP_REPEAT_1_870(m, d) m(2, 870, d)
-# define BOOST_PP_REPEAT_1_872(m, d) BOOST_PP_REPEAT_1_871(m, d) m(2, 871, d)
-# define BOOST_PP_REPEAT_1_873(m, d) BOOST_PP_REPEAT_1_872(m, d) m(2, 872, d)
-# define BOOST_PP_REPEAT_1_874(m, d) BOOST_PP_REPEAT_1_873(m, d) m(2, 873, d)
-# define BOOST_PP_REPEAT_1_875(m, d) BOOST_PP_REPEAT_1_874(m, d) m(2, 874, d)
-# define BOOST_PP_REPEAT_1_876(m, d) BOOST_PP_REPEAT_1_875(m, d) m(2, 875, d)
-# define BOOST_PP_REPEAT_1_877(m, d) BOOST_PP_REPEAT_1_876(m, d) m(2, 876, d)
-# define BOOST_PP_REPEAT_1_878(m, d) BOOST_PP_REPEAT_1_877(m, d) m(2, 877, d)
-# define BOOST_PP_REPEAT_1_879(m, d) BOOST_PP_REPEAT_1_878(m, d) m(2, 878, d)
-# define BOOST_PP_REPEAT_1_880(m, d) BOOST_PP_REPEAT_1_879(m, d) m(2, 879, d)
-# define BOOST_PP_REPEAT_1_881(m, d) BOOST_PP_REPEAT_1_880(m, d) m(2, 880, d)
-# define BOOST_PP_REPEAT_1_882(m, d) BOOST_PP_REPEAT_1_881(m, d) m(2, 881, d)
-# define BOOST_PP_REPEAT_1_883(m, d) BOOST_PP_REPEAT_1_882(m, d) m(2, 882, d)
-# define BOOST_PP_REPEAT_1_884(m, d) BOOST_PP_REPEAT_1_883(m, d) m(2, 883, d)
-# define BOOST_PP_REPEAT_1_885(m, d) BOOST_PP_REPEAT_1_884(m, d) m(2, 884, d)
-# define BOOST_PP_REPEAT_1_886(m, d) BOOST_PP_REPEAT_1_885(m, d) m(2, 885, d)
-# define BOOST_PP_REPEAT_1_887(m, d) BOOST_PP_REPEAT_1_886(m, d) m(2, 886, d)
-# define BOOST_PP_REPEAT_1_888(m, d) BOOST_PP_REPEAT_1_887(m, d) m(2, 887, d)
-# define BOOST_PP_REPEAT_1_889(m, d) BOOST_PP_REPEAT_1_888(m, d) m(2, 888, d)
-# define BOOST_PP_REPEAT_1_890(m, d) BOOST_PP_REPEAT_1_889(m, d) m(2, 889, d)
-# define BOOST_PP_REPEAT_1_891(m, d) BOOST_PP_REPEAT_1_890(m, d) m(2, 890, d)
-# define BOOST_PP_REPEAT_1_892(m, d) BOOST_PP_REPEAT_1_891(m, d) m(2, 891, d)
-# define BOOST_PP_REPEAT_1_893(m, d) BOOST_PP_REPEAT_1_892(m, d) m(2, 892, d)
-# define BOOST_PP_REPEAT_1_894(m, d) BOOST_PP_REPEAT_1_893(m, d) m(2, 893, d)
-# define BOOST_PP_REPEAT_1_895(m, d) BOOST_PP_REPEAT_1_894(m, d) m(2, 894, d)
-# define BOOST_PP_REPEAT_1_896(m, d) BOOST_PP_REPEAT_1_895(m, d) m(2, 895, d)
-# define BOOST_PP_REPEAT_1_897(m, d) BOOST_PP_REPEAT_1_896(m, d) m(2, 896, d)
-# define BOOST_PP_REPEAT_1_898(m, d) BOOST_PP_REPEAT_1_897(m, d) m(2, 897, d)
-# define BOOST_PP_REPEAT_1_899(m, d) BOOST_PP_REPEAT_1_898(m, d) m(2, 898, d)
-# define BOOST_PP_REPEAT_1_900(m, d) BOOST_PP_REPEAT_1_899(m, d) m(2, 899, d)
-# define BOOST_PP_REPEAT_1_901(m, d) BOOST_PP_REPEAT_1_900(m, d) m(2, 900, d)
-# define BOOST_PP_REPEAT_1_902(m, d) BOOST_PP_REPEAT_1_901(m, d) m(2, 901, d)
-# define BOOST_PP_REPEAT_1_903(m, d) BOOST_PP_REPEAT_1_902(m, d) m(2, 902, d)
-# define BOOST_PP_REPEAT_1_904(m, d) BOOST_PP_REPEAT_1_903(m, d) m(2, 903, d)
-# define BOOST_PP_REPEAT_1_905(m, d) BOOST_PP_REPEAT_1_904(m, d) m(2, 904, d)
-# define BOOST_PP_REPEAT_1_906(m, d) BOOST_PP_REPEAT_1_905(m, d) m(2, 905, d)
-# define BOOST_PP_REPEAT_1_907(m, d) BOOST_PP_REPEAT_1_906(m, d) m(2, 906, d)
-# define BOOST_PP_REPEAT_1_908(m, d) BOOST_PP_REPEAT_1_907(m, d) m(2, 907, d)
-# define BOOST_PP_REPEAT_1_909(m, d) BOOST_PP_REPEAT_1_908(m, d) m(2, 908, d)
-# define BOOST_PP_REPEAT_1_910(m, d) BOOST_PP_REPEAT_1_909(m, d) m(2, 909, d)
-# define BOOST_PP_REPEAT_1_911(m, d) BOOST_PP_REPEAT_1_910(m, d) m(2, 910, d)
-# define BOOST_PP_REPEAT_1_912(m, d) BOOST_PP_REPEAT_1_911(m, d) m(2, 911, d)
-# define BOOST_PP_REPEAT_1_913(m, d) BOOST_PP_REPEAT_1_912(m, d) m(2, 912, d)
-# define BOOST_PP_REPEAT_1_914(m, d) BOOST_PP_REPEAT_1_913(m, d) m(2, 913, d)
-# define BOOST_PP_REPEAT_1_915(m, d) BOOST_PP_REPEAT_1_914(m, d) m(2, 914, d)
-# define BOOST_PP_REPEAT_1_916(m, d) BOOST_PP_REPEAT_1_915(m, d) m(2, 915, d)
-# define BOOST_PP_REPEAT_1_917(m, d) BOOST_PP_REPEAT_1_916(m, d) m(2, 916, d)
-# define BOOST_PP_REPEAT_1_918(m, d) BOOST_PP_REPEAT_1_917(m, d) m(2, 917, d)
-# define BOOST_PP_REPEAT_1_919(m, d) BOOST_PP_REPEAT_1_918(m, d) m(2, 918, d)
-# define BOOST_PP_REPEAT_1_920(m, d) BOOST_PP_REPEAT_1_919(m, d) m(2, 919, d)
-# define BOOST_PP_REPEAT_1_921(m, d) BOOST_PP_REPEAT_1_920(m, d) m(2, 920, d)
-# define BOOST_PP_REPEAT_1_922(m, d) BOOST_PP_REPEAT_1_921(m, d) m(2, 921, d)
-# define BOOST_PP_REPEAT_1_923(m, d) BOOST_PP_REPEAT_1_922(m, d) m(2, 922, d)
-# define BOOST_PP_REPEAT_1_924(m, d) BOOST_PP_REPEAT_1_923(m, d) m(2, 923, d)
-# define BOOST_PP_REPEAT_1_925(m, d) BOOST_PP_REPEAT_1_924(m, d) m(2, 924, d)
-# define BOOST_PP_REPEAT_1_926(m, d) BOOST_PP_REPEAT_1_925(m, d) m(2, 925, d)
-# define BOOST_PP_REPEAT_1_927(m, d) BOOST_PP_REPEAT_1_926(m, d) m(2, 926, d)
-# define BOOST_PP_REPEAT_1_928(m, d) BOOST_PP_REPEAT_1_927(m, d) m(2, 927, d)
-# define BOOST_PP_REPEAT_1_929(m, d) BOOST_PP_REPEAT_1_928(m, d) m(2, 928, d)
-# define BOOST_PP_REPEAT_1_930(m, d) BOOST_PP_REPEAT_1_929(m, d) m(2, 929, d)
-# define BOOST_PP_REPEAT_1_931(m, d) BOOST_PP_REPEAT_1_930(m, d) m(2, 930, d)
-# define BOOST_PP_REPEAT_1_932(m, d) BOOST_PP_REPEAT_1_931(m, d) m(2, 931, d)
-# define BOOST_PP_REPEAT_1_933(m, d) BOOST_PP_REPEAT_1_932(m, d) m(2, 932, d)
-# define BOOST_PP_REPEAT_1_934(m, d) BOOST_PP_REPEAT_1_933(m, d) m(2, 933, d)
-# define BOOST_PP_REPEAT_1_935(m, d) BOOST_PP_REPEAT_1_934(m, d) m(2, 934, d)
-# define BOOST_PP_REPEAT_1_936(m, d) BOOST_PP_REPEAT_1_935(m, d) m(2, 935, d)
-# define BOOST_PP_REPEAT_1_937(m, d) BOOST_PP_REPEAT_1_936(m, d) m(2, 936, d)
-# define BOOST_PP_REPEAT_1_938(m, d) BOOST_PP_REPEAT_1_937(m, d) m(2, 937, d)
-# define BOOST_PP_REPEAT_1_939(m, d) BOOST_PP_REPEAT_1_938(m, d) m(2, 938, d)
-# define BOOST_PP_REPEAT_1_940(m, d) BOOST_PP_REPEAT_1_939(m, d) m(2, 939, d)
-# define BOOST_PP_REPEAT_1_941(m, d) BOOST_PP_REPEAT_1_940(m, d) m(2, 940, d)
-# define BOOST_PP_REPEAT_1_942(m, d) BOOST_PP_REPEAT_1_941(m, d) m(2, 941, d)
-# define BOOST_PP_REPEAT_1_943(m, d) BOOST_PP_REPEAT_1_942(m, d) m(2, 942, d)
-# define BOOST_PP_REPEAT_1_944(m, d) BOOST_PP_REPEAT_1_943(m, d) m(2, 943, d)
-# define BOOST_PP_REPEAT_1_945(m, d) BOOST_PP_REPEAT_1_944(m, d) m(2, 944, d)
-# define BOOST_PP_REPEAT_1_946(m, d) BOOST_PP_REPEAT_1_945(m, d) m(2, 945, d)
-# define BOOST_PP_REPEAT_1_947(m, d) BOOST_PP_REPEAT_1_946(m, d) m(2, 946, d)
-# define BOOST_PP_REPEAT_1_948(m, d) BOOST_PP_REPEAT_1_947(m, d) m(2, 947, d)
-# define BOOST_PP_REPEAT_1_949(m, d) BOOST_PP_REPEAT_1_948(m, d) m(2, 948, d)
-# define BOOST_PP_REPEAT_1_950(m, d) BOOST_PP_REPEAT_1_949(m, d) m(2, 949, d)
-# define BOOST_PP_REPEAT_1_951(m, d) BOOST_PP_REPEAT_1_950(m, d) m(2, 950, d)
-# define BOOST_PP_REPEAT_1_952(m, d) BOOST_PP_REPEAT_1_951(m, d) m(2, 951, d)
-# define BOOST_PP_REPEAT_1_953(m, d) BOOST_PP_REPEAT_1_952(m, d) m(2, 952, d)
-# define BOOST_PP_REPEAT_1_954(m, d) BOOST_PP_REPEAT_1_953(m, d) m(2, 953, d)
-# define BOOST_PP_REPEAT_1_955(m, d) BOOST_PP_REPEAT_1_954(m, d) m(2, 954, d)
-# define BOOST_PP_REPEAT_1_956(m, d) BOOST_PP_REPEAT_1_955(m, d) m(2, 955, d)
-# define BOOST_PP_REPEAT_1_957(m, d) BOOST_PP_REPEAT_1_956(m, d) m(2, 956, d)
-# define BOOST_PP_REPEAT_1_958(m, d) BOOST_PP_REPEAT_1_957(m, d) m(2, 957, d)
-# define BOOST_PP_REPEAT_1_959(m, d) BOOST_PP_REPEAT_1_958(m, d) m(2, 958, d)
-# define BOOST_PP_REPEAT_1_960(m, d) BOOST_PP_REPEAT_1_959(m, d) m(2, 959, d)
-# define BOOST_PP_REPEAT_1_961(m, d) BOOST_PP_REPEAT_1_960(m, d) m(2, 960, d)
-# define BOOST_PP_REPEAT_1_962(m, d) BOOST_PP_REPEAT_1_961(m, d) m(2, 961, d)
-# define BOOST_PP_REPEAT_1_963(m, d) BOOST_PP_REPEAT_1_962(m, d) m(2, 962, d)
-# define BOOST_PP_REPEAT_1_964(m, d) BOOST_PP_REPEAT_1_963(m, d) m(2, 963, d)
-# define BOOST_PP_REPEAT_1_965(m, d) BOOST_PP_REPEAT_1_964(m, d) m(2, 964, d)
-# define BOOST_PP_REPEAT_1_966(m, d) BOOST_PP_REPEAT_1_965(m, d) m(2, 965, d)
-# define BOOST_PP_REPEAT_1_967(m, d) BOOST_PP_REPEAT_1_966(m, d) m(2, 966, d)
-# define BOOST_PP_REPEAT_1_968(m, d) BOOST_PP_REPEAT_1_967(m, d) m(2, 967, d)
-# define BOOST_PP_REPEAT_1_969(m, d) BOOST_PP_REPEAT_1_968(m, d) m(2, 968, d)
-# define BOOST_PP_REPEAT_1_970(m, d) BOOST_PP_REPEAT_1_969(m, d) m(2, 969, d)
-# define BOOST_PP_REPEAT_1_971(m, d) BOOST_PP_REPEAT_1_970(m, d) m(2, 970, d)
-# define BOOST_PP_REPEAT_1_972(m, d) BOOST_PP_REPEAT_1_971(m, d) m(2, 971, d)
-# define BOOST_PP_REPEAT_1_973(m, d) BOOST_PP_REPEAT_1_972(m, d) m(2, 972, d)
-# define BOOST_PP_REPEAT_1_974(m, d) BOOST_PP_REPEAT_1_973(m, d) m(2, 973, d)
-# define BOOST_PP_REPEAT_1_975(m, d) BOOST_PP_REPEAT_1_974(m, d) m(2, 974, d)
-# define BOOST_PP_REPEAT_1_976(m, d) BOOST_PP_REPEAT_1_975(m, d) m(2, 975, d)
-# define BOOST_PP_REPEAT_1_977(m, d) BOOST_PP_REPEAT_1_976(m, d) m(2, 976, d)
-# define BOOST_PP_REPEAT_1_978(m, d) BOOST_PP_REPEAT_1_977(m, d) m(2, 977, d)
-# define BOOST_PP_REPEAT_1_979(m, d) BOOST_PP_REPEAT_1_978(m, d) m(2, 978, d)
-# define BOOST_PP_REPEAT_1_980(m, d) BOOST_PP_REPEAT_1_979(m, d) m(2, 979, d)
-# define BOOST_PP_REPEAT_1_981(m, d) BOOST_PP_REPEAT_1_980(m, d) m(2, 980, d)
-# define BOOST_PP_REPEAT_1_982(m, d) BOOST_PP_REPEAT_1_981(m, d) m(2, 981, d)
-# define BOOST_PP_REPEAT_1_983(m, d) BOOST_PP_REPEAT_1_982(m, d) m(2, 982, d)
-# define BOOST_PP_REPEAT_1_984(m, d) BOOST_PP_REPEAT_1_983(m, d) m(2, 983, d)
-# define BOOST_PP_REPEAT_1_985(m, d) BOOST_PP_REPEAT_1_984(m, d) m(2, 984, d)
-# define BOOST_PP_REPEAT_1_986(m, d) BOOST_PP_REPEAT_1_985(m, d) m(2, 985, d)
-# define BOOST_PP_REPEAT_1_987(m, d) BOOST_PP_REPEAT_1_986(m, d) m(2, 986, d)
-# define BOOST_PP_REPEAT_1_988(m, d) BOOST_PP_REPEAT_1_987(m, d) m(2, 987, d)
-# define BOOST_PP_REPEAT_1_989(m, d) BOOST_PP_REPEAT_1_988(m, d) m(2, 988, d)
-# define BOOST_PP_REPEAT_1_990(m, d) BOOST_PP_REPEAT_1_989(m, d) m(2, 989, d)
-# define BOOST_PP_REPEAT_1_991(m, d) BOOST_PP_REPEAT_1_990(m, d) m(2, 990, d)
-# define BOOST_PP_REPEAT_1_992(m, d) BOOST_PP_REPEAT_1_991(m, d) m(2, 991, d)
-# define BOOST_PP_REPEAT_1_993(m, d) BOOST_PP_REPEAT_1_992(m, d) m(2, 992, d)
-# define BOOST_PP_REPEAT_1_994(m, d) BOOST_PP_REPEAT_1_993(m, d) m(2, 993, d)
-# define BOOST_PP_REPEAT_1_995(m, d) BOOST_PP_REPEAT_1_994(m, d) m(2, 994, d)
-# define BOOST_PP_REPEAT_1_996(m, d) BOOST_PP_REPEAT_1_995(m, d) m(2, 995, d)
-# define BOOST_PP_REPEAT_1_997(m, d) BOOST_PP_REPEAT_1_996(m, d) m(2, 996, d)
-# define BOOST_PP_REPEAT_1_998(m, d) BOOST_PP_REPEAT_1_997(m, d) m(2, 997, d)
-# define BOOST_PP_REPEAT_1_999(m, d) BOOST_PP_REPEAT_1_998(m, d) m(2, 998, d)
-# define BOOST_PP_REPEAT_1_1000(m, d) BOOST_PP_REPEAT_1_999(m, d) m(2, 999, d)
-# define BOOST_PP_REPEAT_1_1001(m, d) BOOST_PP_REPEAT_1_1000(m, d) m(2, 1000, d)
-# define BOOST_PP_REPEAT_1_1002(m, d) BOOST_PP_REPEAT_1_1001(m, d) m(2, 1001, d)
-# define BOOST_PP_REPEAT_1_1003(m, d) BOOST_PP_REPEAT_1_1002(m, d) m(2, 1002, d)
-# define BOOST_PP_REPEAT_1_1004(m, d) BOOST_PP_REPEAT_1_1003(m, d) m(2, 1003, d)
-# define BOOST_PP_REPEAT_1_1005(m, d) BOOST_PP_REPEAT_1_1004(m, d) m(2, 1004, d)
-# define BOOST_PP_REPEAT_1_1006(m, d) BOOST_PP_REPEAT_1_1005(m, d) m(2, 1005, d)
-# define BOOST_PP_REPEAT_1_1007(m, d) BOOST_PP_REPEAT_1_1006(m, d) m(2, 1006, d)
-# define BOOST_PP_REPEAT_1_1008(m, d) BOOST_PP_REPEAT_1_1007(m, d) m(2, 1007, d)
-# define BOOST_PP_REPEAT_1_1009(m, d) BOOST_PP_REPEAT_1_1008(m, d) m(2, 1008, d)
-# define BOOST_PP_REPEAT_1_1010(m, d) BOOST_PP_REPEAT_1_1009(m, d) m(2, 1009, d)
-# define BOOST_PP_REPEAT_1_1011(m, d) BOOST_PP_REPEAT_1_1010(m, d) m(2, 1010, d)
-# define BOOST_PP_REPEAT_1_1012(m, d) BOOST_PP_REPEAT_1_1011(m, d) m(2, 1011, d)
-# define BOOST_PP_REPEAT_1_1013(m, d) BOOST_PP_REPEAT_1_1012(m, d) m(2, 1012, d)
-# define BOOST_PP_REPEAT_1_1014(m, d) BOOST_PP_REPEAT_1_1013(m, d) m(2, 1013, d)
-# define BOOST_PP_REPEAT_1_1015(m, d) BOOST_PP_REPEAT_1_1014(m, d) m(2, 1014, d)
-# define BOOST_PP_REPEAT_1_1016(m, d) BOOST_PP_REPEAT_1_1015(m, d) m(2, 1015, d)
-# define BOOST_PP_REPEAT_1_1017(m, d) BOOST_PP_REPEAT_1_1016(m, d) m(2, 1016, d)
-# define BOOST_PP_REPEAT_1_1018(m, d) BOOST_PP_REPEAT_1_1017(m, d) m(2, 1017, d)
-# define BOOST_PP_REPEAT_1_1019(m, d) BOOST_PP_REPEAT_1_1018(m, d) m(2, 1018, d)
-# define BOOST_PP_REPEAT_1_1020(m, d) BOOST_PP_REPEAT_1_1019(m, d) m(2, 1019, d)
-# define BOOST_PP_REPEAT_1_1021(m, d) BOOST_PP_REPEAT_1_1020(m, d) m(2, 1020, d)
-# define BOOST_PP_REPEAT_1_1022(m, d) BOOST_PP_REPEAT_1_1021(m, d) m(2, 1021, d)
-# define BOOST_PP_REPEAT_1_1023(m, d) BOOST_PP_REPEAT_1_1022(m, d) m(2, 1022, d)
-# define BOOST_PP_REPEAT_1_1024(m, d) BOOST_PP_REPEAT_1_1023(m, d) m(2, 1023, d)
-#
-# define BOOST_PP_REPEAT_2_513(m, d) BOOST_PP_REPEAT_2_512(m, d) m(3, 512, d)
-# define BOOST_PP_REPEAT_2_514(m, d) BOOST_PP_REPEAT_2_513(m, d) m(3, 513, d)
-# define BOOST_PP_REPEAT_2_515(m, d) BOOST_PP_REPEAT_2_514(m, d) m(3, 514, d)
-# define BOOST_PP_REPEAT_2_516(m, d) BOOST_PP_REPEAT_2_515(m, d) m(3, 515, d)
-# define BOOST_PP_REPEAT_2_517(m, d) BOOST_PP_REPEAT_2_516(m, d) m(3, 516, d)
-# define BOOST_PP_REPEAT_2_518(m, d) BOOST_PP_REPEAT_2_517(m, d) m(3, 517, d)
-# define BOOST_PP_REPEAT_2_519(m, d) BOOST_PP_REPEAT_2_518(m, d) m(3, 518, d)
-# define BOOST_PP_REPEAT_2_520(m, d) BOOST_PP_REPEAT_2_519(m, d) m(3, 519, d)
-# define BOOST_PP_REPEAT_2_521(m, d) BOOST_PP_REPEAT_2_520(m, d) m(3, 520, d)
-# define BOOST_PP_REPEAT_2_522(m, d) BOOST_PP_REPEAT_2_521(m, d) m(3, 521, d)
-# define BOOST_PP_REPEAT_2_523(m, d) BOOST_PP_REPEAT_2_522(m, d) m(3, 522, d)
-# define BOOST_PP_REPEAT_2_524(m, d) BOOST_PP_REPEAT_2_523(m, d) m(3, 523, d)
-# define BOOST_PP_REPEAT_2_525(m, d) BOOST_PP_REPEAT_2_524(m, d) m(3, 524, d)
-# define BOOST_PP_REPEAT_2_526(m, d) BOOST_PP_REPEAT_2_525(m, d) m(3, 525, d)
-# define BOOST_PP_REPEAT_2_527(m, d) BOOST_PP_REPEAT_2_526(m, d) m(3, 526, d)
-# define BOOST_PP_REPEAT_2_528(m, d) BOOST_PP_REPEAT_2_527(m, d) m(3, 527, d)
-# define BOOST_PP_REPEAT_2_529(m, d) BOOST_PP_REPEAT_2_528(m, d) m(3, 528, d)
-# define BOOST_PP_REPEAT_2_530(m, d) BOOST_PP_REPEAT_2_529(m, d) m(3, 529, d)
-# define BOOST_PP_REPEAT_2_531(m, d) BOOST_PP_REPEAT_2_530(m, d) m(3, 530, d)
-# define BOOST_PP_REPEAT_2_532(m, d) BOOST_PP_REPEAT_2_531(m, d) m(3, 531, d)
-# define BOOST_PP_REPEAT_2_533(m, d) BOOST_PP_REPEAT_2_532(m, d) m(3, 532, d)
-# define BOOST_PP_REPEAT_2_534(m, d) BOOST_PP_REPEAT_2_533(m, d) m(3, 533, d)
-# define BOOST_PP_REPEAT_2_535(m, d) BOOST_PP_REPEAT_2_534(m, d) m(3, 534, d)
-# define BOOST_PP_REPEAT_2_536(m, d) BOOST_PP_REPEAT_2_535(m, d) m(3, 535, d)
-# define BOOST_PP_REPEAT_2_537(m, d) BOOST_PP_REPEAT_2_536(m, d) m(3, 536, d)
-# define BOOST_PP_REPEAT_2_538(m, d) BOOST_PP_REPEAT_2_537(m, d) m(3, 537, d)
-# define BOOST_PP_REPEAT_2_539(m, d) BOOST_PP_REPEAT_2_538(m, d) m(3, 538, d)
-# define BOOST_PP_REPEAT_2_540(m, d) BOOST_PP_REPEAT_2_539(m, d) m(3, 539, d)
-# define BOOST_PP_REPEAT_2_541(m, d) BOOST_PP_REPEAT_2_540(m, d) m(3, 540, d)
-# define BOOST_PP_REPEAT_2_542(m, d) BOOST_PP_REPEAT_2_541(m, d) m(3, 541, d)
-# define BOOST_PP_REPEAT_2_543(m, d) BOOST_PP_REPEAT_2_542(m, d) m(3, 542, d)
-# define BOOST_PP_REPEAT_2_544(m, d) BOOST_PP_REPEAT_2_543(m, d) m(3, 543, d)
-# define BOOST_PP_REPEAT_2_545(m, d) BOOST_PP_REPEAT_2_544(m, d) m(3, 544, d)
-# define BOOST_PP_REPEAT_2_546(m, d) BOOST_PP_REPEAT_2_545(m, d) m(3, 545, d)
-# define BOOST_PP_REPEAT_2_547(m, d) BOOST_PP_REPEAT_2_546(m, d) m(3, 546, d)
-# define BOOST_PP_REPEAT_2_548(m, d) BOOST_PP_REPEAT_2_547(m, d) m(3, 547, d)
-# define BOOST_PP_REPEAT_2_549(m, d) BOOST_PP_REPEAT_2_548(m, d) m(3, 548, d)
-# define BOOST_PP_REPEAT_2_550(m, d) BOOST_PP_REPEAT_2_549(m, d) m(3, 549, d)
-# define BOOST_PP_REPEAT_2_551(m, d) BOOST_PP_REPEAT_2_550(m, d) m(3, 550, d)
-# define BOOST_PP_REPEAT_2_552(m, d) BOOST_PP_REPEAT_2_551(m, d) m(3, 551, d)
-# define BOOST_PP_REPEAT_2_553(m, d) BOOST_PP_REPEAT_2_552(m, d) m(3, 552, d)
-# define BOOST_PP_REPEAT_2_554(m, d) BOOST_PP_REPEAT_2_553(m, d) m(3, 553, d)
-# define BOOST_PP_REPEAT_2_555(m, d) BOOST_PP_REPEAT_2_554(m, d) m(3, 554, d)
-# define BOOST_PP_REPEAT_2_556(m, d) BOOST_PP_REPEAT_2_555(m, d) m(3, 555, d)
-# define BOOST_PP_REPEAT_2_557(m, d) BOOST_PP_REPEAT_2_556(m, d) m(3, 556, d)
-# define BOOST_PP_REPEAT_2_558(m, d) BOOST_PP_REPEAT_2_557(m, d) m(3, 557, d)
-# define BOOST_PP_REPEAT_2_559(m, d) BOOST_PP_REPEAT_2_558(m, d) m(3, 558, d)
-# define BOOST_PP_REPEAT_2_560(m, d) BOOST_PP_REPEAT_2_559(m, d) m(3, 559, d)
-# define BOOST_PP_REPEAT_2_561(m, d) BOOST_PP_REPEAT_2_560(m, d) m(3, 560, d)
-# define BOOST_PP_REPEAT_2_562(m, d) BOOST_PP_REPEAT_2_561(m, d) m(3, 561, d)
-# define BOOST_PP_REPEAT_2_563(m, d) BOOST_PP_REPEAT_2_562(m, d) m(3, 562, d)
-# define BOOST_PP_REPEAT_2_564(m, d) BOOST_PP_REPEAT_2_563(m, d) m(3, 563, d)
-# define BOOST_PP_REPEAT_2_565(m, d) BOOST_PP_REPEAT_2_564(m, d) m(3, 564, d)
-# define BOOST_PP_REPEAT_2_566(m, d) BOOST_PP_REPEAT_2_565(m, d) m(3, 565, d)
-# define BOOST_PP_REPEAT_2_567(m, d) BOOST_PP_REPEAT_2_566(m, d) m(3, 566, d)
-# define BOOST_PP_REPEAT_2_568(m, d) BOOST_PP_REPEAT_2_567(m, d) m(3, 567, d)
-# define BOOST_PP_REPEAT_2_569(m, d) BOOST_PP_REPEAT_2_568(m, d) m(3, 568, d)
-# define BOOST_PP_REPEAT_2_570(m, d) BOOST_PP_REPEAT_2_569(m, d) m(3, 569, d)
-# define BOOST_PP_REPEAT_2_571(m, d) BOOST_PP_REPEAT_2_570(m, d) m(3, 570, d)
-# define BOOST_PP_REPEAT_2_572(m, d) BOOST_PP_REPEAT_2_571(m, d) m(3, 571, d)
-# define BOOST_PP_REPEAT_2_573(m, d) BOOST_PP_REPEAT_2_572(m, d) m(3, 572, d)
-# define BOOST_PP_REPEAT_2_574(m, d) BOOST_PP_REPEAT_2_573(m, d) m(3, 573, d)
-# define BOOST_PP_REPEAT_2_575(m, d) BOOST_PP_REPEAT_2_574(m, d) m(3, 574, d)
-# define BOOST_PP_REPEAT_2_576(m, d) BOOST_PP_REPEAT_2_575(m, d) m(3, 575, d)
-# define BOOST_PP_REPEAT_2_577(m, d) BOOST_PP_REPEAT_2_576(m, d) m(3, 576, d)
-# define BOOST_PP_REPEAT_2_578(m, d) BOOST_PP_REPEAT_2_577(m, d) m(3, 577, d)
-# define BOOST_PP_REPEAT_2_579(m, d) BOOST_PP_REPEAT_2_578(m, d) m(3, 578, d)
-# define BOOST_PP_REPEAT_2_580(m, d) BOOST_PP_REPEAT_2_579(m, d) m(3, 579, d)
-# define BOOST_PP_REPEAT_2_581(m, d) BOOST_PP_REPEAT_2_580(m, d) m(3, 580, d)
-# define BOOST_PP_REPEAT_2_582(m, d) BOOST_PP_REPEAT_2_581(m, d) m(3, 581, d)
-# define BOOST_PP_REPEAT_2_583(m, d) BOOST_PP_REPEAT_2_582(m, d) m(3, 582, d)
-# define BOOST_PP_REPEAT_2_584(m, d) BOOST_PP_REPEAT_2_583(m, d) m(3, 583, d)
-# define BOOST_PP_REPEAT_2_585(m, d) BOOST_PP_REPEAT_2_584(m, d) m(3, 584, d)
-# define BOOST_PP_REPEAT_2_586(m, d) BOOST_PP_REPEAT_2_585(m, d) m(3, 585, d)
-# define BOOST_PP_REPEAT_2_587(m, d) BOOST_PP_REPEAT_2_586(m, d) m(3, 586, d)
-# define BOOST_PP_REPEAT_2_588(m, d) BOOST_PP_REPEAT_2_587(m, d) m(3, 587, d)
-# define BOOST_PP_REPEAT_2_589(m, d) BOOST_PP_REPEAT_2_588(m, d) m(3, 588, d)
-# define BOOST_PP_REPEAT_2_590(m, d) BOOST_PP_REPEAT_2_589(m, d) m(3, 589, d)
-# define BOOST_PP_REPEAT_2_591(m, d) BOOST_PP_REPEAT_2_590(m, d) m(3, 590, d)
-# define BOOST_PP_REPEAT_2_592(m, d) BOOST_PP_REPEAT_2_591(m, d) m(3, 591, d)
-# define BOOST_PP_REPEAT_2_593(m, d) BOOST_PP_REPEAT_2_592(m, d) m(3, 592, d)
-# define BOOST_PP_REPEAT_2_594(m, d) BOOST_PP_REPEAT_2_593(m, d) m(3, 593, d)
-# define BOOST_PP_REPEAT_2_595(m, d) BOOST_PP_REPEAT_2_594(m, d) m(3, 594, d)
-# define BOOST_PP_REPEAT_2_596(m, d) BOOST_PP_REPEAT_2_595(m, d) m(3, 595, d)
-# define BOOST_PP_REPEAT_2_597(m, d) BOOST_PP_REPEAT_2_596(m, d) m(3, 596, d)
-# define BOOST_PP_REPEAT_2_598(m, d) BOOST_PP_REPEAT_2_597(m, d) m(3, 597, d)
-# define BOOST_PP_REPEAT_2_599(m, d) BOOST_PP_REPEAT_2_598(m, d) m(3, 598, d)
-# define BOOST_PP_REPEAT_2_600(m, d) BOOST_PP_REPEAT_2_599(m, d) m(3, 599, d)
-# define BOOST_PP_REPEAT_2_601(m, d) BOOST_PP_REPEAT_2_600(m, d) m(3, 600, d)
-# define BOOST_PP_REPEAT_2_602(m, d) BOOST_PP_REPEAT_2_601(m, d) m(3, 601, d)
-# define BOOST_PP_REPEAT_2_603(m, d) BOOST_PP_REPEAT_2_602(m, d) m(3, 602, d)
-# define BOOST_PP_REPEAT_2_604(m, d) BOOST_PP_REPEAT_2_603(m, d) m(3, 603, d)
-# define BOOST_PP_REPEAT_2_605(m, d) BOOST_PP_REPEAT_2_604(m, d) m(3, 604, d)
-# define BOOST_PP_REPEAT_2_606(m, d) BOOST_PP_REPEAT_2_605(m, d) m(3, 605, d)
-# define BOOST_PP_REPEAT_2_607(m, d) BOOST_PP_REPEAT_2_606(m, d) m(3, 606, d)
-# define BOOST_PP_REPEAT_2_608(m, d) BOOST_PP_REPEAT_2_607(m, d) m(3, 607, d)
-# define BOOST_PP_REPEAT_2_609(m, d) BOOST_PP_REPEAT_2_608(m, d) m(3, 608, d)
-# define BOOST_PP_REPEAT_2_610(m, d) BOOST_PP_REPEAT_2_609(m, d) m(3, 609, d)
-# define BOOST_PP_REPEAT_2_611(m, d) BOOST_PP_REPEAT_2_610(m, d) m(3, 610, d)
-# define BOOST_PP_REPEAT_2_612(m, d) BOOST_PP_REPEAT_2_611(m, d) m(3, 611, d)
-# define BOOST_PP_REPEAT_2_613(m, d) BOOST_PP_REPEAT_2_612(m, d) m(3, 612, d)
-# define BOOST_PP_REPEAT_2_614(m, d) BOOST_PP_REPEAT_2_613(m, d) m(3, 613, d)
-# define BOOST_PP_REPEAT_2_615(m, d) BOOST_PP_REPEAT_2_614(m, d) m(3, 614, d)
-# define BOOST_PP_REPEAT_2_616(m, d) BOOST_PP_REPEAT_2_615(m, d) m(3, 615, d)
-# define BOOST_PP_REPEAT_2_617(m, d) BOOST_PP_REPEAT_2_616(m, d) m(3, 616, d)
-# define BOOST_PP_REPEAT_2_618(m, d) BOOST_PP_REPEAT_2_617(m, d) m(3, 617, d)
-# define BOOST_PP_REPEAT_2_619(m, d) BOOST_PP_REPEAT_2_618(m, d) m(3, 618, d)
-# define BOOST_PP_REPEAT_2_620(m, d) BOOST_PP_REPEAT_2_619(m, d) m(3, 619, d)
-# define BOOST_PP_REPEAT_2_621(m, d) BOOST_PP_REPEAT_2_620(m, d) m(3, 620, d)
-# define BOOST_PP_REPEAT_2_622(m, d) BOOST_PP_REPEAT_2_621(m, d) m(3, 621, d)
-# define BOOST_PP_REPEAT_2_623(m, d) BOOST_PP_REPEAT_2_622(m, d) m(3, 622, d)
-# define BOOST_PP_REPEAT_2_624(m, d) BOOST_PP_REPEAT_2_623(m, d) m(3, 623, d)
-# define BOOST_PP_REPEAT_2_625(m, d) BOOST_PP_REPEAT_2_624(m, d) m(3, 624, d)
-# define BOOST_PP_REPEAT_2_626(m, d) BOOST_PP_REPEAT_2_625(m, d) m(3, 625, d)
-# define BOOST_PP_REPEAT_2_627(m, d) BOOST_PP_REPEAT_2_626(m, d) m(3, 626, d)
-# define BOOST_PP_REPEAT_2_628(m, d) BOOST_PP_REPEAT_2_627(m, d) m(3, 627, d)
-# define BOOST_PP_REPEAT_2_629(m, d) BOOST_PP_REPEAT_2_628(m, d) m(3, 628, d)
-# define BOOST_PP_REPEAT_2_630(m, d) BOOST_PP_REPEAT_2_629(m, d) m(3, 629, d)
-# define BOOST_PP_REPEAT_2_631(m, d) BOOST_PP_REPEAT_2_630(m, d) m(3, 630, d)
-# define BOOST_PP_REPEAT_2_632(m, d) BOOST_PP_REPEAT_2_631(m, d) m(3, 631, d)
-# define BOOST_PP_REPEAT_2_633(m, d) BOOST_PP_REPEAT_2_632(m, d) m(3, 632, d)
-# define BOOST_PP_REPEAT_2_634(m, d) BOOST_PP_REPEAT_2_633(m, d) m(3, 633, d)
-# define BOOST_PP_REPEAT_2_635(m, d) BOOST_PP_REPEAT_2_634(m, d) m(3, 634, d)
-# define BOOST_PP_REPEAT_2_636(m, d) BOOST_PP_REPEAT_2_635(m, d) m(3, 635, d)
-# define BOOST_PP_REPEAT_2_637(m, d) BOOST_PP_REPEAT_2_636(m, d) m(3, 636, d)
-# define BOOST_PP_REPEAT_2_638(m, d) BOOST_PP_REPEAT_2_637(m, d) m(3, 637, d)
-# define BOOST_PP_REPEAT_2_639(m, d) BOOST_PP_REPEAT_2_638(m, d) m(3, 638, d)
-# define BOOST_PP_REPEAT_2_640(m, d) BOOST_PP_REPEAT_2_639(m, d) m(3, 639, d)
-# define BOOST_PP_REPEAT_2_641(m, d) BOOST_PP_REPEAT_2_640(m, d) m(3, 640, d)
-# define BOOST_PP_REPEAT_2_642(m, d) BOOST_PP_REPEAT_2_641(m, d) m(3, 641, d)
-# define BOOST_PP_REPEAT_2_643(m, d) BOOST_PP_REPEAT_2_642(m, d) m(3, 642, d)
-# define BOOST_PP_REPEAT_2_644(m, d) BOOST_PP_REPEAT_2_643(m, d) m(3, 643, d)
-# define BOOST_PP_REPEAT_2_645(m, d) BOOST_PP_REPEAT_2_644(m, d) m(3, 644, d)
-# define BOOST_PP_REPEAT_2_646(m, d) BOOST_PP_REPEAT_2_645(m, d) m(3, 645, d)
-# define BOOST_PP_REPEAT_2_647(m, d) BOOST_PP_REPEAT_2_646(m, d) m(3, 646, d)
-# define BOOST_PP_REPEAT_2_648(m, d) BOOST_PP_REPEAT_2_647(m, d) m(3, 647, d)
-# define BOOST_PP_REPEAT_2_649(m, d) BOOST_PP_REPEAT_2_648(m, d) m(3, 648, d)
-# define BOOST_PP_REPEAT_2_650(m, d) BOOST_PP_REPEAT_2_649(m, d) m(3, 649, d)
-# define BOOST_PP_REPEAT_2_651(m, d) BOOST_PP_REPEAT_2_650(m, d) m(3, 650, d)
-# define BOOST_PP_REPEAT_2_652(m, d) BOOST_PP_REPEAT_2_651(m, d) m(3, 651, d)
-# define BOOST_PP_REPEAT_2_653(m, d) BOOST_PP_REPEAT_2_652(m, d) m(3, 652, d)
-# define BOOST_PP_REPEAT_2_654(m, d) BOOST_PP_REPEAT_2_653(m, d) m(3, 653, d)
-# define BOOST_PP_REPEAT_2_655(m, d) BOOST_PP_REPEAT_2_654(m, d) m(3, 654, d)
-# define BOOST_PP_REPEAT_2_656(m, d) BOOST_PP_REPEAT_2_655(m, d) m(3, 655, d)
-# define BOOST_PP_REPEAT_2_657(m, d) BOOST_PP_REPEAT_2_656(m, d) m(3, 656, d)
-# define BOOST_PP_REPEAT_2_658(m, d) BOOST_PP_REPEAT_2_657(m, d) m(3, 657, d)
-# define BOOST_PP_REPEAT_2_659(m, d) BOOST_PP_REPEAT_2_658(m, d) m(3, 658, d)
-# define BOOST_PP_REPEAT_2_660(m, d) BOOST_PP_REPEAT_2_659(m, d) m(3, 659, d)
-# define BOOST_PP_REPEAT_2_661(m, d) BOOST_PP_REPEAT_2_660(m, d) m(3, 660, d)
-# define BOOST_PP_REPEAT_2_662(m, d) BOOST_PP_REPEAT_2_661(m, d) m(3, 661, d)
-# define BOOST_PP_REPEAT_2_663(m, d) BOOST_PP_REPEAT_2_662(m, d) m(3, 662, d)
-# define BOOST_PP_REPEAT_2_664(m, d) BOOST_PP_REPEAT_2_663(m, d) m(3, 663, d)
-# define BOOST_PP_REPEAT_2_665(m, d) BOOST_PP_REPEAT_2_664(m, d) m(3, 664, d)
-# define BOOST_PP_REPEAT_2_666(m, d) BOOST_PP_REPEAT_2_665(m, d) m(3, 665, d)
-# define BOOST_PP_REPEAT_2_667(m, d) BOOST_PP_REPEAT_2_666(m, d) m(3, 666, d)
-# define BOOST_PP_REPEAT_2_668(m, d) BOOST_PP_REPEAT_2_667(m, d) m(3, 667, d)
-# define BOOST_PP_REPEAT_2_669(m, d) BOOST_PP_REPEAT_2_668(m, d) m(3, 668, d)
-# define BOOST_PP_REPEAT_2_670(m, d) BOOST_PP_REPEAT_2_669(m, d) m(3, 669, d)
-# define BOOST_PP_REPEAT_2_671(m, d) BOOST_PP_REPEAT_2_670(m, d) m(3, 670, d)
-# define BOOST_PP_REPEAT_2_672(m, d) BOOST_PP_REPEAT_2_671(m, d) m(3, 671, d)
-# define BOOST_PP_REPEAT_2_673(m, d) BOOST_PP_REPEAT_2_672(m, d) m(3, 672, d)
-# define BOOST_PP_REPEAT_2_674(m, d) BOOST_PP_REPEAT_2_673(m, d) m(3, 673, d)
-# define BOOST_PP_REPEAT_2_675(m, d) BOOST_PP_REPEAT_2_674(m, d) m(3, 674, d)
-# define BOOST_PP_REPEAT_2_676(m, d) BOOST_PP_REPEAT_2_675(m, d) m(3, 675, d)
-# define BOOST_PP_REPEAT_2_677(m, d) BOOST_PP_REPEAT_2_676(m, d) m(3, 676, d)
-# define BOOST_PP_REPEAT_2_678(m, d) BOOST_PP_REPEAT_2_677(m, d) m(3, 677, d)
-# define BOOST_PP_REPEAT_2_679(m, d) BOOST_PP_REPEAT_2_678(m, d) m(3, 678, d)
-# define BOOST_PP_REPEAT_2_680(m, d) BOOST_PP_REPEAT_2_679(m, d) m(3, 679, d)
-# define BOOST_PP_REPEAT_2_681(m, d) BOOST_PP_REPEAT_2_680(m, d) m(3, 680, d)
-# define BOOST_PP_REPEAT_2_682(m, d) BOOST_PP_REPEAT_2_681(m, d) m(3, 681, d)
-# define BOOST_PP_REPEAT_2_683(m, d) BOOST_PP_REPEAT_2_682(m, d) m(3, 682, d)
-# define BOOST_PP_REPEAT_2_684(m, d) BOOST_PP_REPEAT_2_683(m, d) m(3, 683, d)
-# define BOOST_PP_REPEAT_2_685(m, d) BOOST_PP_REPEAT_2_684(m, d) m(3, 684, d)
-# define BOOST_PP_REPEAT_2_686(m, d) BOOST_PP_REPEAT_2_685(m, d) m(3, 685, d)
-# define BOOST_PP_REPEAT_2_687(m, d) BOOST_PP_REPEAT_2_686(m, d) m(3, 686, d)
-# define BOOST_PP_REPEAT_2_688(m, d) BOOST_PP_REPEAT_2_687(m, d) m(3, 687, d)
-# define BOOST_PP_REPEAT_2_689(m, d) BOOST_PP_REPEAT_2_688(m, d) m(3, 688, d)
-# define BOOST_PP_REPEAT_2_690(m, d) BOOST_PP_REPEAT_2_689(m, d) m(3, 689, d)
-# define BOOST_PP_REPEAT_2_691(m, d) BOOST_PP_REPEAT_2_690(m, d) m(3, 690, d)
-# define BOOST_PP_REPEAT_2_692(m, d) BOOST_PP_REPEAT_2_691(m, d) m(3, 691, d)
-# define BOOST_PP_REPEAT_2_693(m, d) BOOST_PP_REPEAT_2_692(m, d) m(3, 692, d)
-# define BOOST_PP_REPEAT_2_694(m, d) BOOST_PP_REPEAT_2_693(m, d) m(3, 693, d)
-# define BOOST_PP_REPEAT_2_695(m, d) BOOST_PP_REPEAT_2_694(m, d) m(3, 694, d)
-# define BOOST_PP_REPEAT_2_696(m, d) BOOST_PP_REPEAT_2_695(m, d) m(3, 695, d)
-# define BOOST_PP_REPEAT_2_697(m, d) BOOST_PP_REPEAT_2_696(m, d) m(3, 696, d)
-# define BOOST_PP_REPEAT_2_698(m, d) BOOST_PP_REPEAT_2_697(m, d) m(3, 697, d)
-# define BOOST_PP_REPEAT_2_699(m, d) BOOST_PP_REPEAT_2_698(m, d) m(3, 698, d)
-# define BOOST_PP_REPEAT_2_700(m, d) BOOST_PP_REPEAT_2_699(m, d) m(3, 699, d)
-# define BOOST_PP_REPEAT_2_701(m, d) BOOST_PP_REPEAT_2_700(m, d) m(3, 700, d)
-# define BOOST_PP_REPEAT_2_702(m, d) BOOST_PP_REPEAT_2_701(m, d) m(3, 701, d)
-# define BOOST_PP_REPEAT_2_703(m, d) BOOST_PP_REPEAT_2_702(m, d) m(3, 702, d)
-# define BOOST_PP_REPEAT_2_704(m, d) BOOST_PP_REPEAT_2_703(m, d) m(3, 703, d)
-# define BOOST_PP_REPEAT_2_705(m, d) BOOST_PP_REPEAT_2_704(m, d) m(3, 704, d)
-# define BOOST_PP_REPEAT_2_706(m, d) BOOST_PP_REPEAT_2_705(m, d) m(3, 705, d)
-# define BOOST_PP_REPEAT_2_707(m, d) BOOST_PP_REPEAT_2_706(m, d) m(3, 706, d)
-# define BOOST_PP_REPEAT_2_708(m, d) BOOST_PP_REPEAT_2_707(m, d) m(3, 707, d)
-# define BOOST_PP_REPEAT_2_709(m, d) BOOST_PP_REPEAT_2_708(m, d) m(3, 708, d)
-# define BOOST_PP_REPEAT_2_710(m, d) BOOST_PP_REPEAT_2_709(m, d) m(3, 709, d)
-# define BOOST_PP_REPEAT_2_711(m, d) BOOST_PP_REPEAT_2_710(m, d) m(3, 710, d)
-# define BOOST_PP_REPEAT_2_712(m, d) BOOST_PP_REPEAT_2_711(m, d) m(3, 711, d)
-# define BOOST_PP_REPEAT_2_713(m, d) BOOST_PP_REPEAT_2_712(m, d) m(3, 712, d)
-# define BOOST_PP_REPEAT_2_714(m, d) BOOST_PP_REPEAT_2_713(m, d) m(3, 713, d)
-# define BOOST_PP_REPEAT_2_715(m, d) BOOST_PP_REPEAT_2_714(m, d) m(3, 714, d)
-# define BOOST_PP_REPEAT_2_716(m, d) BOOST_PP_REPEAT_2_715(m, d) m(3, 715, d)
-# define BOOST_PP_REPEAT_2_717(m, d) BOOST_PP_REPEAT_2_716(m, d) m(3, 716, d)
-# define BOOST_PP_REPEAT_2_718(m, d) BOOST_PP_REPEAT_2_717(m, d) m(3, 717, d)
-# define BOOST_PP_REPEAT_2_719(m, d) BOOST_PP_REPEAT_2_718(m, d) m(3, 718, d)
-# define BOOST_PP_REPEAT_2_720(m, d) BOOST_PP_REPEAT_2_719(m, d) m(3, 719, d)
-# define BOOST_PP_REPEAT_2_721(m, d) BOOST_PP_REPEAT_2_720(m, d) m(3, 720, d)
-# define BOOST_PP_REPEAT_2_722(m, d) BOOST_PP_REPEAT_2_721(m, d) m(3, 721, d)
-# define BOOST_PP_REPEAT_2_723(m, d) BOOST_PP_REPEAT_2_722(m, d) m(3, 722, d)
-# define BOOST_PP_REPEAT_2_724(m, d) BOOST_PP_REPEAT_2_723(m, d) m(3, 723, d)
-# define BOOST_PP_REPEAT_2_725(m, d) BOOST_PP_REPEAT_2_724(m, d) m(3, 724, d)
-# define BOOST_PP_REPEAT_2_726(m, d) BOOST_PP_REPEAT_2_725(m, d) m(3, 725, d)
-# define BOOST_PP_REPEAT_2_727(m, d) BOOST_PP_REPEAT_2_726(m, d) m(3, 726, d)
-# define BOOST_PP_REPEAT_2_728(m, d) BOOST_PP_REPEAT_2_727(m, d) m(3, 727, d)
-# define BOOST_PP_REPEAT_2_729(m, d) BOOST_PP_REPEAT_2_728(m, d) m(3, 728, d)
-# define BOOST_PP_REPEAT_2_730(m, d) BOOST_PP_REPEAT_2_729(m, d) m(3, 729, d)
-# define BOOST_PP_REPEAT_2_731(m, d) BOOST_PP_REPEAT_2_730(m, d) m(3, 730, d)
-# define BOOST_PP_REPEAT_2_732(m, d) BOOST_PP_REPEAT_2_731(m, d) m(3, 731, d)
-# define BOOST_PP_REPEAT_2_733(m, d) BOOST_PP_REPEAT_2_732(m, d) m(3, 732, d)
-# define BOOST_PP_REPEAT_2_734(m, d) BOOST_PP_REPEAT_2_733(m, d) m(3, 733, d)
-# define BOOST_PP_REPEAT_2_735(m, d) BOOST_PP_REPEAT_2_734(m, d) m(3, 734, d)
-# define BOOST_PP_REPEAT_2_736(m, d) BOOST_PP_REPEAT_2_735(m, d) m(3, 735, d)
-# define BOOST_PP_REPEAT_2_737(m, d) BOOST_PP_REPEAT_2_736(m, d) m(3, 736, d)
-# define BOOST_PP_REPEAT_2_738(m, d) BOOST_PP_REPEAT_2_737(m, d) m(3, 737, d)
-# define BOOST_PP_REPEAT_2_739(m, d) BOOST_PP_REPEAT_2_738(m, d) m(3, 738, d)
-# define BOOST_PP_REPEAT_2_740(m, d) BOOST_PP_REPEAT_2_739(m, d) m(3, 739, d)
-# define BOOST_PP_REPEAT_2_741(m, d) BOOST_PP_REPEAT_2_740(m, d) m(3, 740, d)
-# define BOOST_PP_REPEAT_2_742(m, d) BOOST_PP_REPEAT_2_741(m, d) m(3, 741, d)
-# define BOOST_PP_REPEAT_2_743(m, d) BOOST_PP_REPEAT_2_742(m, d) m(3, 742, d)
-# define BOOST_PP_REPEAT_2_744(m, d) BOOST_PP_REPEAT_2_743(m, d) m(3, 743, d)
-# define BOOST_PP_REPEAT_2_745(m, d) BOOST_PP_REPEAT_2_744(m, d) m(3, 744, d)
-# define BOOST_PP_REPEAT_2_746(m, d) BOOST_PP_REPEAT_2_745(m, d) m(3, 745, d)
-# define BOOST_PP_REPEAT_2_747(m, d) BOOST_PP_REPEAT_2_746(m, d) m(3, 746, d)
-# define BOOST_PP_REPEAT_2_748(m, d) BOOST_PP_REPEAT_2_747(m, d) m(3, 747, d)
-# define BOOST_PP_REPEAT_2_749(m, d) BOOST_PP_REPEAT_2_748(m, d) m(3, 748, d)
-# define BOOST_PP_REPEAT_2_750(m, d) BOOST_PP_REPEAT_2_749(m, d) m(3, 749, d)
-# define BOOST_PP_REPEAT_2_751(m, d) BOOST_PP_REPEAT_2_750(m, d) m(3, 750, d)
-# define BOOST_PP_REPEAT_2_752(m, d) BOOST_PP_REPEAT_2_751(m, d) m(3, 751, d)
-# define BOOST_PP_REPEAT_2_753(m, d) BOOST_PP_REPEAT_2_752(m, d) m(3, 752, d)
-# define BOOST_PP_REPEAT_2_754(m, d) BOOST_PP_REPEAT_2_753(m, d) m(3, 753, d)
-# define BOOST_PP_REPEAT_2_755(m, d) BOOST_PP_REPEAT_2_754(m, d) m(3, 754, d)
-# define BOOST_PP_REPEAT_2_756(m, d) BOOST_PP_REPEAT_2_755(m, d) m(3, 755, d)
-# define BOOST_PP_REPEAT_2_757(m, d) BOOST_PP_REPEAT_2_756(m, d) m(3, 756, d)
-# define BOOST_PP_REPEAT_2_758(m, d) BOOST_PP_REPEAT_2_757(m, d) m(3, 757, d)
-# define BOOST_PP_REPEAT_2_759(m, d) BOOST_PP_REPEAT_2_758(m, d) m(3, 758, d)
-# define BOOST_PP_REPEAT_2_760(m, d) BOOST_PP_REPEAT_2_759(m, d) m(3, 759, d)
-# define BOOST_PP_REPEAT_2_761(m, d) BOOST_PP_REPEAT_2_760(m, d) m(3, 760, d)
-# define BOOST_PP_REPEAT_2_762(m, d) BOOST_PP_REPEAT_2_761(m, d) m(3, 761, d)
-# define BOOST_PP_REPEAT_2_763(m, d) BOOST_PP_REPEAT_2_762(m, d) m(3, 762, d)
-# define BOOST_PP_REPEAT_2_764(m, d) BOOST_PP_REPEAT_2_763(m, d) m(3, 763, d)
-# define BOOST_PP_REPEAT_2_765(m, d) BOOST_PP_REPEAT_2_764(m, d) m(3, 764, d)
-# define BOOST_PP_REPEAT_2_766(m, d) BOOST_PP_REPEAT_2_765(m, d) m(3, 765, d)
-# define BOOST_PP_REPEAT_2_767(m, d) BOOST_PP_REPEAT_2_766(m, d) m(3, 766, d)
-# define BOOST_PP_REPEAT_2_768(m, d) BOOST_PP_REPEAT_2_767(m, d) m(3, 767, d)
-# define BOOST_PP_REPEAT_2_769(m, d) BOOST_PP_REPEAT_2_768(m, d) m(3, 768, d)
-# define BOOST_PP_REPEAT_2_770(m, d) BOOST_PP_REPEAT_2_769(m, d) m(3, 769, d)
-# define BOOST_PP_REPEAT_2_771(m, d) BOOST_PP_REPEAT_2_770(m, d) m(3, 770, d)
-# define BOOST_PP_REPEAT_2_772(m, d) BOOST_PP_REPEAT_2_771(m, d) m(3, 771, d)
-# define BOOST_PP_REPEAT_2_773(m, d) BOOST_PP_REPEAT_2_772(m, d) m(3, 772, d)
-# define BOOST_PP_REPEAT_2_774(m, d) BOOST_PP_REPEAT_2_773(m, d) m(3, 773, d)
-# define BOOST_PP_REPEAT_2_775(m, d) BOOST_PP_REPEAT_2_774(m, d) m(3, 774, d)
-# define BOOST_PP_REPEAT_2_776(m, d) BOOST_PP_REPEAT_2_775(m, d) m(3, 775, d)
-# define BOOST_PP_REPEAT_2_777(m, d) BOOST_PP_REPEAT_2_776(m, d) m(3, 776, d)
-# define BOOST_PP_REPEAT_2_778(m, d) BOOST_PP_REPEAT_2_777(m, d) m(3, 777, d)
-# define BOOST_PP_REPEAT_2_779(m, d) BOOST_PP_REPEAT_2_778(m, d) m(3, 778, d)
-# define BOOST_PP_REPEAT_2_780(m, d) BOOST_PP_REPEAT_2_779(m, d) m(3, 779, d)
-# define BOOST_PP_REPEAT_2_781(m, d) BOOST_PP_REPEAT_2_780(m, d) m(3, 780, d)
-# define BOOST_PP_REPEAT_2_782(m, d) BOOST_PP_REPEAT_2_781(m, d) m(3, 781, d)
-# define BOOST_PP_REPEAT_2_783(m, d) BOOST_PP_REPEAT_2_782(m, d) m(3, 782, d)
-# define BOOST_PP_REPEAT_2_784(m, d) BOOST_PP_REPEAT_2_783(m, d) m(3, 783, d)
-# define BOOST_PP_REPEAT_2_785(m, d) BOOST_PP_REPEAT_2_784(m, d) m(3, 784, d)
-# define BOOST_PP_REPEAT_2_786(m, d) BOOST_PP_REPEAT_2_785(m, d) m(3, 785, d)
-# define BOOST_PP_REPEAT_2_787(m, d) BOOST_PP_REPEAT_2_786(m, d) m(3, 786, d)
-# define BOOST_PP_REPEAT_2_788(m, d) BOOST_PP_REPEAT_2_787(m, d) m(3, 787, d)
-# define BOOST_PP_REPEAT_2_789(m, d) BOOST_PP_REPEAT_2_788(m, d) m(3, 788, d)
-# define BOOST_PP_REPEAT_2_790(m, d) BOOST_PP_REPEAT_2_789(m, d) m(3, 789, d)
-# define BOOST_PP_REPEAT_2_791(m, d) BOOST_PP_REPEAT_2_790(m, d) m(3, 790, d)
-# define BOOST_PP_REPEAT_2_792(m, d) BOOST_PP_REPEAT_2_791(m, d) m(3, 791, d)
-# define BOOST_PP_REPEAT_2_793(m, d) BOOST_PP_REPEAT_2_792(m, d) m(3, 792, d)
-# define BOOST_PP_REPEAT_2_794(m, d) BOOST_PP_REPEAT_2_793(m, d) m(3, 793, d)
-# define BOOST_PP_REPEAT_2_795(m, d) BOOST_PP_REPEAT_2_794(m, d) m(3, 794, d)
-# define BOOST_PP_REPEAT_2_796(m, d) BOOST_PP_REPEAT_2_795(m, d) m(3, 795, d)
-# define BOOST_PP_REPEAT_2_797(m, d) BOOST_PP_REPEAT_2_796(m, d) m(3, 796, d)
-# define BOOST_PP_REPEAT_2_798(m, d) BOOST_PP_REPEAT_2_797(m, d) m(3, 797, d)
-# define BOOST_PP_REPEAT_2_799(m, d) BOOST_PP_REPEAT_2_798(m, d) m(3, 798, d)
-# define BOOST_PP_REPEAT_2_800(m, d) BOOST_PP_REPEAT_2_799(m, d) m(3, 799, d)
-# define BOOST_PP_REPEAT_2_801(m, d) BOOST_PP_REPEAT_2_800(m, d) m(3, 800, d)
-# define BOOST_PP_REPEAT_2_802(m, d) BOOST_PP_REPEAT_2_801(m, d) m(3, 801, d)
-# define BOOST_PP_REPEAT_2_803(m, d) BOOST_PP_REPEAT_2_802(m, d) m(3, 802, d)
-# define BOOST_PP_REPEAT_2_804(m, d) BOOST_PP_REPEAT_2_803(m, d) m(3, 803, d)
-# define BOOST_PP_REPEAT_2_805(m, d) BOOST_PP_REPEAT_2_804(m, d) m(3, 804, d)
-# define BOOST_PP_REPEAT_2_806(m, d) BOOST_PP_REPEAT_2_805(m, d) m(3, 805, d)
-# define BOOST_PP_REPEAT_2_807(m, d) BOOST_PP_REPEAT_2_806(m, d) m(3, 806, d)
-# define BOOST_PP_REPEAT_2_808(m, d) BOOST_PP_REPEAT_2_807(m, d) m(3, 807, d)
-# define BOOST_PP_REPEAT_2_809(m, d) BOOST_PP_REPEAT_2_808(m, d) m(3, 808, d)
-# define BOOST_PP_REPEAT_2_810(m, d) BOOST_PP_REPEAT_2_809(m, d) m(3, 809, d)
-# define BOOST_PP_REPEAT_2_811(m, d) BOOST_PP_REPEAT_2_810(m, d) m(3, 810, d)
-# define BOOST_PP_REPEAT_2_812(m, d) BOOST_PP_REPEAT_2_811(m, d) m(3, 811, d)
-# define BOOST_PP_REPEAT_2_813(m, d) BOOST_PP_REPEAT_2_812(m, d) m(3, 812, d)
-# define BOOST_PP_REPEAT_2_814(m, d) BOOST_PP_REPEAT_2_813(m, d) m(3, 813, d)
-# define BOOST_PP_REPEAT_2_815(m, d) BOOST_PP_REPEAT_2_814(m, d) m(3, 814, d)
-# define BOOST_PP_REPEAT_2_816(m, d) BOOST_PP_REPEAT_2_815(m, d) m(3, 815, d)
-# define BOOST_PP_REPEAT_2_817(m, d) BOOST_PP_REPEAT_2_816(m, d) m(3, 816, d)
-# define BOOST_PP_REPEAT_2_818(m, d) BOOST_PP_REPEAT_2_817(m, d) m(3, 817, d)
-# define BOOST_PP_REPEAT_2_819(m, d) BOOST_PP_REPEAT_2_818(m, d) m(3, 818, d)
-# define BOOST_PP_REPEAT_2_820(m, d) BOOST_PP_REPEAT_2_819(m, d) m(3, 819, d)
-# define BOOST_PP_REPEAT_2_821(m, d) BOOST_PP_REPEAT_2_820(m, d) m(3, 820, d)
-# define BOOST_PP_REPEAT_2_822(m, d) BOOST_PP_REPEAT_2_821(m, d) m(3, 821, d)
-# define BOOST_PP_REPEAT_2_823(m, d) BOOST_PP_REPEAT_2_822(m, d) m(3, 822, d)
-# define BOOST_PP_REPEAT_2_824(m, d) BOOST_PP_REPEAT_2_823(m, d) m(3, 823, d)
-# define BOOST_PP_REPEAT_2_825(m, d) BOOST_PP_REPEAT_2_824(m, d) m(3, 824, d)
-# define BOOST_PP_REPEAT_2_826(m, d) BOOST_PP_REPEAT_2_825(m, d) m(3, 825, d)
-# define BOOST_PP_REPEAT_2_827(m, d) BOOST_PP_REPEAT_2_826(m, d) m(3, 826, d)
-# define BOOST_PP_REPEAT_2_828(m, d) BOOST_PP_REPEAT_2_827(m, d) m(3, 827, d)
-# define BOOST_PP_REPEAT_2_829(m, d) BOOST_PP_REPEAT_2_828(m, d) m(3, 828, d)
-# define BOOST_PP_REPEAT_2_830(m, d) BOOST_PP_REPEAT_2_829(m, d) m(3, 829, d)
-# define BOOST_PP_REPEAT_2_831(m, d) BOOST_PP_REPEAT_2_830(m, d) m(3, 830, d)
-# define BOOST_PP_REPEAT_2_832(m, d) BOOST_PP_REPEAT_2_831(m, d) m(3, 831, d)
-# define BOOST_PP_REPEAT_2_833(m, d) BOOST_PP_REPEAT_2_832(m, d) m(3, 832, d)
-# define BOOST_PP_REPEAT_2_834(m, d) BOOST_PP_REPEAT_2_833(m, d) m(3, 833, d)
-# define BOOST_PP_REPEAT_2_835(m, d) BOOST_PP_REPEAT_2_834(m, d) m(3, 834, d)
-# define BOOST_PP_REPEAT_2_836(m, d) BOOST_PP_REPEAT_2_835(m, d) m(3, 835, d)
-# define BOOST_PP_REPEAT_2_837(m, d) BOOST_PP_REPEAT_2_836(m, d) m(3, 836, d)
-# define BOOST_PP_REPEAT_2_838(m, d) BOOST_PP_REPEAT_2_837(m, d) m(3, 837, d)
-# define BOOST_PP_REPEAT_2_839(m, d) BOOST_PP_REPEAT_2_838(m, d) m(3, 838, d)
-# define BOOST_PP_REPEAT_2_840(m, d) BOOST_PP_REPEAT_2_839(m, d) m(3, 839, d)
-# define BOOST_PP_REPEAT_2_841(m, d) BOOST_PP_REPEAT_2_840(m, d) m(3, 840, d)
-# define BOOST_PP_REPEAT_2_842(m, d) BOOST_PP_REPEAT_2_841(m, d) m(3, 841, d)
-# define BOOST_PP_REPEAT_2_843(m, d) BOOST_PP_REPEAT_2_842(m, d) m(3, 842, d)
-# define BOOST_PP_REPEAT_2_844(m, d) BOOST_PP_REPEAT_2_843(m, d) m(3, 843, d)
-# define BOOST_PP_REPEAT_2_845(m, d) BOOST_PP_REPEAT_2_844(m, d) m(3, 844, d)
-# define BOOST_PP_REPEAT_2_846(m, d) BOOST_PP_REPEAT_2_845(m, d) m(3, 845, d)
-# define BOOST_PP_REPEAT_2_847(m, d) BOOST_PP_REPEAT_2_846(m, d) m(3, 846, d)
-# define BOOST_PP_REPEAT_2_848(m, d) BOOST_PP_REPEAT_2_847(m, d) m(3, 847, d)
-# define BOOST_PP_REPEAT_2_849(m, d) BOOST_PP_REPEAT_2_848(m, d) m(3, 848, d)
-# define BOOST_PP_REPEAT_2_850(m, d) BOOST_PP_REPEAT_2_849(m, d) m(3, 849, d)
-# define BOOST_PP_REPEAT_2_851(m, d) BOOST_PP_REPEAT_2_850(m, d) m(3, 850, d)
-# define BOOST_PP_REPEAT_2_852(m, d) BOOST_PP_REPEAT_2_851(m, d) m(3, 851, d)
-# define BOOST_PP_REPEAT_2_853(m, d) BOOST_PP_REPEAT_2_852(m, d) m(3, 852, d)
-# define BOOST_PP_REPEAT_2_854(m, d) BOOST_PP_REPEAT_2_853(m, d) m(3, 853, d)
-# define BOOST_PP_REPEAT_2_855(m, d) BOOST_PP_REPEAT_2_854(m, d) m(3, 854, d)
-# define BOOST_PP_REPEAT_2_856(m, d) BOOST_PP_REPEAT_2_855(m, d) m(3, 855, d)
-# define BOOST_PP_REPEAT_2_857(m, d) BOOST_PP_REPEAT_2_856(m, d) m(3, 856, d)
-# define BOOST_PP_REPEAT_2_858(m, d) BOOST_PP_REPEAT_2_857(m, d) m(3, 857, d)
-# define BOOST_PP_REPEAT_2_859(m, d) BOOST_PP_REPEAT_2_858(m, d) m(3, 858, d)
-# define BOOST_PP_REPEAT_2_860(m, d) BOOST_PP_REPEAT_2_859(m, d) m(3, 859, d)
-# define BOOST_PP_REPEAT_2_861(m, d) BOOST_PP_REPEAT_2_860(m, d) m(3, 860, d)
-# define BOOST_PP_REPEAT_2_862(m, d) BOOST_PP_REPEAT_2_861(m, d) m(3, 861, d)
-# define BOOST_PP_REPEAT_2_863(m, d) BOOST_PP_REPEAT_2_862(m, d) m(3, 862, d)
-# define BOOST_PP_REPEAT_2_864(m, d) BOOST_PP_REPEAT_2_863(m, d) m(3, 863, d)
-# define BOOST_PP_REPEAT_2_865(m, d) BOOST_PP_REPEAT_2_864(m, d) m(3, 864, d)
-# define BOOST_PP_REPEAT_2_866(m, d) BOOST_PP_REPEAT_2_865(m, d) m(3, 865, d)
-# define BOOST_PP_REPEAT_2_867(m, d) BOOST_PP_REPEAT_2_866(m, d) m(3, 866, d)
-# define BOOST_PP_REPEAT_2_868(m, d) BOOST_PP_REPEAT_2_867(m, d) m(3, 867, d)
-# define BOOST_PP_REPEAT_2_869(m, d) BOOST_PP_REPEAT_2_868(m, d) m(3, 868, d)
-# define BOOST_PP_REPEAT_2_870(m, d) BOOST_PP_REPEAT_2_869(m, d) m(3, 869, d)
-# define BOOST_PP_REPEAT_2_871(m, d) BOOST_PP_REPEAT_2_870(m, d) m(3, 870, d)
-# define BOOST_PP_REPEAT_2_872(m, d) BOOST_PP_REPEAT_2_871(m, d) m(3, 871, d)
-# define BOOST_PP_REPEAT_2_873(m, d) BOOST_PP_REPEAT_2_872(m, d) m(3, 872, d)
-# define BOOST_PP_REPEAT_2_874(m, d) BOOST_PP_REPEAT_2_873(m, d) m(3, 873, d)
-# define BOOST_PP_REPEAT_2_875(m, d) BOOST_PP_REPEAT_2_874(m, d) m(3, 874, d)
-# define BOOST_PP_REPEAT_2_876(m, d) BOOST_PP_REPEAT_2_875(m, d) m(3, 875, d)
-# define BOOST_PP_REPEAT_2_877(m, d) BOOST_PP_REPEAT_2_876(m, d) m(3, 876, d)
-# define BOOST_PP_REPEAT_2_878(m, d) BOOST_PP_REPEAT_2_877(m, d) m(3, 877, d)
-# define BOOST_PP_REPEAT_2_879(m, d) BOOST_PP_REPEAT_2_878(m, d) m(3, 878, d)
-# define BOOST_PP_REPEAT_2_880(m, d) BOOST_PP_REPEAT_2_879(m, d) m(3, 879, d)
-# define BOOST_PP_REPEAT_2_881(m, d) BOOST_PP_REPEAT_2_880(m, d) m(3, 880, d)
-# define BOOST_PP_REPEAT_2_882(m, d) BOOST_PP_REPEAT_2_881(m, d) m(3, 881, d)
-# define BOOST_PP_REPEAT_2_883(m, d) BOOST_PP_REPEAT_2_882(m, d) m(3, 882, d)
-# define BOOST_PP_REPEAT_2_884(m, d) BOOST_PP_REPEAT_2_883(m, d) m(3, 883, d)
-# define BOOST_PP_REPEAT_2_885(m, d) BOOST_PP_REPEAT_2_884(m, d) m(3, 884, d)
-# define BOOST_PP_REPEAT_2_886(m, d) BOOST_PP_REPEAT_2_885(m, d) m(3, 885, d)
-# define BOOST_PP_REPEAT_2_887(m, d) BOOST_PP_REPEAT_2_886(m, d) m(3, 886, d)
-# define BOOST_PP_REPEAT_2_888(m, d) BOOST_PP_REPEAT_2_887(m, d) m(3, 887, d)
-# define BOOST_PP_REPEAT_2_889(m, d) BOOST_PP_REPEAT_2_888(m, d) m(3, 888, d)
-# define BOOST_PP_REPEAT_2_890(m, d) BOOST_PP_REPEAT_2_889(m, d) m(3, 889, d)
-# define BOOST_PP_REPEAT_2_891(m, d) BOOST_PP_REPEAT_2_890(m, d) m(3, 890, d)
-# define BOOST_PP_REPEAT_2_892(m, d) BOOST_PP_REPEAT_2_891(m, d) m(3, 891, d)
-# define BOOST_PP_REPEAT_2_893(m, d) BOOST_PP_REPEAT_2_892(m, d) m(3, 892, d)
-# define BOOST_PP_REPEAT_2_894(m, d) BOOST_PP_REPEAT_2_893(m, d) m(3, 893, d)
-# define BOOST_PP_REPEAT_2_895(m, d) BOOST_PP_REPEAT_2_894(m, d) m(3, 894, d)
-# define BOOST_PP_REPEAT_2_896(m, d) BOOST_PP_REPEAT_2_895(m, d) m(3, 895, d)
-# define BOOST_PP_REPEAT_2_897(m, d) BOOST_PP_REPEAT_2_896(m, d) m(3, 896, d)
-# define BOOST_PP_REPEAT_2_898(m, d) BOOST_PP_REPEAT_2_897(m, d) m(3, 897, d)
-# define BOOST_PP_REPEAT_2_899(m, d) BOOST_PP_REPEAT_2_898(m, d) m(3, 898, d)
-# define BOOST_PP_REPEAT_2_900(m, d) BOOST_PP_REPEAT_2_899(m, d) m(3, 899, d)
-# define BOOST_PP_REPEAT_2_901(m, d) BOOST_PP_REPEAT_2_900(m, d) m(3, 900, d)
-# define BOOST_PP_REPEAT_2_902(m, d) BOOST_PP_REPEAT_2_901(m, d) m(3, 901, d)
-# define BOOST_PP_REPEAT_2_903(m, d) BOOST_PP_REPEAT_2_902(m, d) m(3, 902, d)
-# define BOOST_PP_REPEAT_2_904(m, d) BOOST_PP_REPEAT_2_903(m, d) m(3, 903, d)
-# define BOOST_PP_REPEAT_2_905(m, d) BOOST_PP_REPEAT_2_904(m, d) m(3, 904, d)
-# define BOOST_PP_REPEAT_2_906(m, d) BOOST_PP_REPEAT_2_905(m, d) m(3, 905, d)
-# define BOOST_PP_REPEAT_2_907(m, d) BOOST_PP_REPEAT_2_906(m, d) m(3, 906, d)
-# define BOOST_PP_REPEAT_2_908(m, d) BOOST_PP_REPEAT_2_907(m, d) m(3, 907, d)
-# define BOOST_PP_REPEAT_2_909(m, d) BOOST_PP_REPEAT_2_908(m, d) m(3, 908, d)
-# define BOOST_PP_REPEAT_2_910(m, d) BOOST_PP_REPEAT_2_909(m, d) m(3, 909, d)
-# define BOOST_PP_REPEAT_2_911(m, d) BOOST_PP_REPEAT_2_910(m, d) m(3, 910, d)
-# define BOOST_PP_REPEAT_2_912(m, d) BOOST_PP_REPEAT_2_911(m, d) m(3, 911, d)
-# define BOOST_PP_REPEAT_2_913(m, d) BOOST_PP_REPEAT_2_912(m, d) m(3, 912, d)
-# define BOOST_PP_REPEAT_2_914(m, d) BOOST_PP_REPEAT_2_913(m, d) m(3, 913, d)
-# define BOOST_PP_REPEAT_2_915(m, d) BOOST_PP_REPEAT_2_914(m, d) m(3, 914, d)
-# define BOOST_PP_REPEAT_2_916(m, d) BOOST_PP_REPEAT_2_915(m, d) m(3, 915, d)
-# define BOOST_PP_REPEAT_2_917(m, d) BOOST_PP_REPEAT_2_916(m, d) m(3, 916, d)
-# define BOOST_PP_REPEAT_2_918(m, d) BOOST_PP_REPEAT_2_917(m, d) m(3, 917, d)
-# define BOOST_PP_REPEAT_2_919(m, d) BOOST_PP_REPEAT_2_918(m, d) m(3, 918, d)
-# define BOOST_PP_REPEAT_2_920(m, d) BOOST_PP_REPEAT_2_919(m, d) m(3, 919, d)
-# define BOOST_PP_REPEAT_2_921(m, d) BOOST_PP_REPEAT_2_920(m, d) m(3, 920, d)
-# define BOOST_PP_REPEAT_2_922(m, d) BOOST_PP_REPEAT_2_921(m, d) m(3, 921, d)
-# define BOOST_PP_REPEAT_2_923(m, d) BOOST_PP_REPEAT_2_922(m, d) m(3, 922, d)
-# define BOOST_PP_REPEAT_2_924(m, d) BOOST_PP_REPEAT_2_923(m, d) m(3, 923, d)
-# define BOOST_PP_REPEAT_2_925(m, d) BOOST_PP_REPEAT_2_924(m, d) m(3, 924, d)
-# define BOOST_PP_REPEAT_2_926(m, d) BOOST_PP_REPEAT_2_925(m, d) m(3, 925, d)
-# define BOOST_PP_REPEAT_2_927(m, d) BOOST_PP_REPEAT_2_926(m, d) m(3, 926, d)
-# define BOOST_PP_REPEAT_2_928(m, d) BOOST_PP_REPEAT_2_927(m, d) m(3, 927, d)
-# define BOOST_PP_REPEAT_2_929(m, d) BOOST_PP_REPEAT_2_928(m, d) m(3, 928, d)
-# define BOOST_PP_REPEAT_2_930(m, d) BOOST_PP_REPEAT_2_929(m, d) m(3, 929, d)
-# define BOOST_PP_REPEAT_2_931(m, d) BOOST_PP_REPEAT_2_930(m, d) m(3, 930, d)
-# define BOOST_PP_REPEAT_2_932(m, d) BOOST_PP_REPEAT_2_931(m, d) m(3, 931, d)
-# define BOOST_PP_REPEAT_2_933(m, d) BOOST_PP_REPEAT_2_932(m, d) m(3, 932, d)
-# define BOOST_PP_REPEAT_2_934(m, d) BOOST_PP_REPEAT_2_933(m, d) m(3, 933, d)
-# define BOOST_PP_REPEAT_2_935(m, d) BOOST_PP_REPEAT_2_934(m, d) m(3, 934, d)
-# define BOOST_PP_REPEAT_2_936(m, d) BOOST_PP_REPEAT_2_935(m, d) m(3, 935, d)
-# define BOOST_PP_REPEAT_2_937(m, d) BOOST_PP_REPEAT_2_936(m, d) m(3, 936, d)
-# define BOOST_PP_REPEAT_2_938(m, d) BOOST_PP_REPEAT_2_937(m, d) m(3, 937, d)
-# define BOOST_PP_REPEAT_2_939(m, d) BOOST_PP_REPEAT_2_938(m, d) m(3, 938, d)
-# define BOOST_PP_REPEAT_2_940(m, d) BOOST_PP_REPEAT_2_939(m, d) m(3, 939, d)
-# define BOOST_PP_REPEAT_2_941(m, d) BOOST_PP_REPEAT_2_940(m, d) m(3, 940, d)
-# define BOOST_PP_REPEAT_2_942(m, d) BOOST_PP_REPEAT_2_941(m, d) m(3, 941, d)
-# define BOOST_PP_REPEAT_2_943(m, d) BOOST_PP_REPEAT_2_942(m, d) m(3, 942, d)
-# define BOOST_PP_REPEAT_2_944(m, d) BOOST_PP_REPEAT_2_943(m, d) m(3, 943, d)
-# define BOOST_PP_REPEAT_2_945(m, d) BOOST_PP_REPEAT_2_944(m, d) m(3, 944, d)
-# define BOOST_PP_REPEAT_2_946(m, d) BOOST_PP_REPEAT_2_945(m, d) m(3, 945, d)
-# define BOOST_PP_REPEAT_2_947(m, d) BOOST_PP_REPEAT_2_946(m, d) m(3, 946, d)
-# define BOOST_PP_REPEAT_2_948(m, d) BOOST_PP_REPEAT_2_947(m, d) m(3, 947, d)
-# define BOOST_PP_REPEAT_2_949(m, d) BOOST_PP_REPEAT_2_948(m, d) m(3, 948, d)
-# define BOOST_PP_REPEAT_2_950(m, d) BOOST_PP_REPEAT_2_949(m, d) m(3, 949, d)
-# define BOOST_PP_REPEAT_2_951(m, d) BOOST_PP_REPEAT_2_950(m, d) m(3, 950, d)
-# define BOOST_PP_REPEAT_2_952(m, d) BOOST_PP_REPEAT_2_951(m, d) m(3, 951, d)
-# define BOOST_PP_REPEAT_2_953(m, d) BOOST_PP_REPEAT_2_952(m, d) m(3, 952, d)
-# define BOOST_PP_REPEAT_2_954(m, d) BOOST_PP_REPEAT_2_953(m, d) m(3, 953, d)
-# define BOOST_PP_REPEAT_2_955(m, d) BOOST_PP_REPEAT_2_954(m, d) m(3, 954, d)
-# define BOOST_PP_REPEAT_2_956(m, d) BOOST_PP_REPEAT_2_955(m, d) m(3, 955, d)
-# define BOOST_PP_REPEAT_2_957(m, d) BOOST_PP_REPEAT_2_956(m, d) m(3, 956, d)
-# define BOOST_PP_REPEAT_2_958(m, d) BOOST_PP_REPEAT_2_957(m, d) m(3, 957, d)
-# define BOOST_PP_REPEAT_2_959(m, d) BOOST_PP_REPEAT_2_958(m, d) m(3, 958, d)
-# define BOOST_PP_REPEAT_2_960(m, d) BOOST_PP_REPEAT_2_959(m, d) m(3, 959, d)
-# define BOOST_PP_REPEAT_2_961(m, d) BOOST_PP_REPEAT_2_960(m, d) m(3, 960, d)
-# define BOOST_PP_REPEAT_2_962(m, d) BOOST_PP_REPEAT_2_961(m, d) m(3, 961, d)
-# define BOOST_PP_REPEAT_2_963(m, d) BOOST_PP_REPEAT_2_962(m, d) m(3, 962, d)
-# define BOOST_PP_REPEAT_2_964(m, d) BOOST_PP_REPEAT_2_963(m, d) m(3, 963, d)
-# define BOOST_PP_REPEAT_2_965(m, d) BOOST_PP_REPEAT_2_964(m, d) m(3, 964, d)
-# define BOOST_PP_REPEAT_2_966(m, d) BOOST_PP_REPEAT_2_965(m, d) m(3, 965, d)
-# define BOOST_PP_REPEAT_2_967(m, d) BOOST_PP_REPEAT_2_966(m, d) m(3, 966, d)
-# define BOOST_PP_REPEAT_2_968(m, d) BOOST_PP_REPEAT_2_967(m, d) m(3, 967, d)
-# define BOOST_PP_REPEAT_2_969(m, d) BOOST_PP_REPEAT_2_968(m, d) m(3, 968, d)
-# define BOOST_PP_REPEAT_2_970(m, d) BOOST_PP_REPEAT_2_969(m, d) m(3, 969, d)
-# define BOOST_PP_REPEAT_2_971(m, d) BOOST_PP_REPEAT_2_970(m, d) m(3, 970, d)
-# define BOOST_PP_REPEAT_2_972(m, d) BOOST_PP_REPEAT_2_971(m, d) m(3, 971, d)
-# define BOOST_PP_REPEAT_2_973(m, d) BOOST_PP_REPEAT_2_972(m, d) m(3, 972, d)
-# define BOOST_PP_REPEAT_2_974(m, d) BOOST_PP_REPEAT_2_973(m, d) m(3, 973, d)
-# define BOOST_PP_REPEAT_2_975(m, d) BOOST_PP_REPEAT_2_974(m, d) m(3, 974, d)
-# define BOOST_PP_REPEAT_2_976(m, d) BOOST_PP_REPEAT_2_975(m, d) m(3, 975, d)
-# define BOOST_PP_REPEAT_2_977(m, d) BOOST_PP_REPEAT_2_976(m, d) m(3, 976, d)
-# define BOOST_PP_REPEAT_2_978(m, d) BOOST_PP_REPEAT_2_977(m, d) m(3, 977, d)
-# define BOOST_PP_REPEAT_2_979(m, d) BOOST_PP_REPEAT_2_978(m, d) m(3, 978, d)
-# define BOOST_PP_REPEAT_2_980(m, d) BOOST_PP_REPEAT_2_979(m, d) m(3, 979, d)
-# define BOOST_PP_REPEAT_2_981(m, d) BOOST_PP_REPEAT_2_980(m, d) m(3, 980, d)
-# define BOOST_PP_REPEAT_2_982(m, d) BOOST_PP_REPEAT_2_981(m, d) m(3, 981, d)
-# define BOOST_PP_REPEAT_2_983(m, d) BOOST_PP_REPEAT_2_982(m, d) m(3, 982, d)
-# define BOOST_PP_REPEAT_2_984(m, d) BOOST_PP_REPEAT_2_983(m, d) m(3, 983, d)
-# define BOOST_PP_REPEAT_2_985(m, d) BOOST_PP_REPEAT_2_984(m, d) m(3, 984, d)
-# define BOOST_PP_REPEAT_2_986(m, d) BOOST_PP_REPEAT_2_985(m, d) m(3, 985, d)
-# define BOOST_PP_REPEAT_2_987(m, d) BOOST_PP_REPEAT_2_986(m, d) m(3, 986, d)
-# define BOOST_PP_REPEAT_2_988(m, d) BOOST_PP_REPEAT_2_987(m, d) m(3, 987, d)
-# define BOOST_PP_REPEAT_2_989(m, d) BOOST_PP_REPEAT_2_988(m, d) m(3, 988, d)
-# define BOOST_PP_REPEAT_2_990(m, d) BOOST_PP_REPEAT_2_989(m, d) m(3, 989, d)
-# define BOOST_PP_REPEAT_2_991(m, d) BOOST_PP_REPEAT_2_990(m, d) m(3, 990, d)
-# define BOOST_PP_REPEAT_2_992(m, d) BOOST_PP_REPEAT_2_991(m, d) m(3, 991, d)
-# define BOOST_PP_REPEAT_2_993(m, d) BOOST_PP_REPEAT_2_992(m, d) m(3, 992, d)
-# define BOOST_PP_REPEAT_2_994(m, d) BOOST_PP_REPEAT_2_993(m, d) m(3, 993, d)
-# define BOOST_PP_REPEAT_2_995(m, d) BOOST_PP_REPEAT_2_994(m, d) m(3, 994, d)
-# define BOOST_PP_REPEAT_2_996(m, d) BOOST_PP_REPEAT_2_995(m, d) m(3, 995, d)
-# define BOOST_PP_REPEAT_2_997(m, d) BOOST_PP_REPEAT_2_996(m, d) m(3, 996, d)
-# define BOOST_PP_REPEAT_2_998(m, d) BOOST_PP_REPEAT_2_997(m, d) m(3, 997, d)
-# define BOOST_PP_REPEAT_2_999(m, d) BOOST_PP_REPEAT_2_998(m, d) m(3, 998, d)
-# define BOOST_PP_REPEAT_2_1000(m, d) BOOST_PP_REPEAT_2_999(m, d) m(3, 999, d)
-# define BOOST_PP_REPEAT_2_1001(m, d) BOOST_PP_REPEAT_2_1000(m, d) m(3, 1000, d)
-# define BOOST_PP_REPEAT_2_1002(m, d) BOOST_PP_REPEAT_2_1001(m, d) m(3, 1001, d)
-# define BOOST_PP_REPEAT_2_1003(m, d) BOOST_PP_REPEAT_2_1002(m, d) m(3, 1002, d)
-# define BOOST_PP_REPEAT_2_1004(m, d) BOOST_PP_REPEAT_2_1003(m, d) m(3, 1003, d)
-# define BOOST_PP_REPEAT_2_1005(m, d) BOOST_PP_REPEAT_2_1004(m, d) m(3, 1004, d)
-# define BOOST_PP_REPEAT_2_1006(m, d) BOOST_PP_REPEAT_2_1005(m, d) m(3, 1005, d)
-# define BOOST_PP_REPEAT_2_1007(m, d) BOOST_PP_REPEAT_2_1006(m, d) m(3, 1006, d)
-# define BOOST_PP_REPEAT_2_1008(m, d) BOOST_PP_REPEAT_2_1007(m, d) m(3, 1007, d)
-# define BOOST_PP_REPEAT_2_1009(m, d) BOOST_PP_REPEAT_2_1008(m, d) m(3, 1008, d)
-# define BOOST_PP_REPEAT_2_1010(m, d) BOOST_PP_REPEAT_2_1009(m, d) m(3, 1009, d)
-# define BOOST_PP_REPEAT_2_1011(m, d) BOOST_PP_REPEAT_2_1010(m, d) m(3, 1010, d)
-# define BOOST_PP_REPEAT_2_1012(m, d) BOOST_PP_REPEAT_2_1011(m, d) m(3, 1011, d)
-# define BOOST_PP_REPEAT_2_1013(m, d) BOOST_PP_REPEAT_2_1012(m, d) m(3, 1012, d)
-# define BOOST_PP_REPEAT_2_1014(m, d) BOOST_PP_REPEAT_2_1013(m, d) m(3, 1013, d)
-# define BOOST_PP_REPEAT_2_1015(m, d) BOOST_PP_REPEAT_2_1014(m, d) m(3, 1014, d)
-# define BOOST_PP_REPEAT_2_1016(m, d) BOOST_PP_REPEAT_2_1015(m, d) m(3, 1015, d)
-# define BOOST_PP_REPEAT_2_1017(m, d) BOOST_PP_REPEAT_2_1016(m, d) m(3, 1016, d)
-# define BOOST_PP_REPEAT_2_1018(m, d) BOOST_PP_REPEAT_2_1017(m, d) m(3, 1017, d)
-# define BOOST_PP_REPEAT_2_1019(m, d) BOOST_PP_REPEAT_2_1018(m, d) m(3, 1018, d)
-# define BOOST_PP_REPEAT_2_1020(m, d) BOOST_PP_REPEAT_2_1019(m, d) m(3, 1019, d)
-# define BOOST_PP_REPEAT_2_1021(m, d) BOOST_PP_REPEAT_2_1020(m, d) m(3, 1020, d)
-# define BOOST_PP_REPEAT_2_1022(m, d) BOOST_PP_REPEAT_2_1021(m, d) m(3, 1021, d)
-# define BOOST_PP_REPEAT_2_1023(m, d) BOOST_PP_REPEAT_2_1022(m, d) m(3, 1022, d)
-# define BOOST_PP_REPEAT_2_1024(m, d) BOOST_PP_REPEAT_2_1023(m, d) m(3, 1023, d)
-#
-# define BOOST_PP_REPEAT_3_513(m, d) BOOST_PP_REPEAT_3_512(m, d) m(4, 512, d)
-# define BOOST_PP_REPEAT_3_514(m, d) BOOST_PP_REPEAT_3_513(m, d) m(4, 513, d)
-# define BOOST_PP_REPEAT_3_515(m, d) BOOST_PP_REPEAT_3_514(m, d) m(4, 514, d)
-# define BOOST_PP_REPEAT_3_516(m, d) BOOST_PP_REPEAT_3_515(m, d) m(4, 515, d)
-# define BOOST_PP_REPEAT_3_517(m, d) BOOST_PP_REPEAT_3_516(m, d) m(4, 516, d)
-# define BOOST_PP_REPEAT_3_518(m, d) BOOST_PP_REPEAT_3_517(m, d) m(4, 517, d)
-# define BOOST_PP_REPEAT_3_519(m, d) BOOST_PP_REPEAT_3_518(m, d) m(4, 518, d)
-# define BOOST_PP_REPEAT_3_520(m, d) BOOST_PP_REPEAT_3_519(m, d) m(4, 519, d)
-# define BOOST_PP_REPEAT_3_521(m, d) BOOST_PP_REPEAT_3_520(m, d) m(4, 520, d)
-# define BOOST_PP_REPEAT_3_522(m, d) BOOST_PP_REPEAT_3_521(m, d) m(4, 521, d)
-# define BOOST_PP_REPEAT_3_523(m, d) BOOST_PP_REPEAT_3_522(m, d) m(4, 522, d)
-# define BOOST_PP_REPEAT_3_524(m, d) BOOST_PP_REPEAT_3_523(m, d) m(4, 523, d)
-# define BOOST_PP_REPEAT_3_525(m, d) BOOST_PP_REPEAT_3_524(m, d) m(4, 524, d)
-# define BOOST_PP_REPEAT_3_526(m, d) BOOST_PP_REPEAT_3_525(m, d) m(4, 525, d)
-# define BOOST_PP_REPEAT_3_527(m, d) BOOST_PP_REPEAT_3_526(m, d) m(4, 526, d)
-# define BOOST_PP_REPEAT_3_528(m, d) BOOST_PP_REPEAT_3_527(m, d) m(4, 527, d)
-# define BOOST_PP_REPEAT_3_529(m, d) BOOST_PP_REPEAT_3_528(m, d) m(4, 528, d)
-# define BOOST_PP_REPEAT_3_530(m, d) BOOST_PP_REPEAT_3_529(m, d) m(4, 529, d)
-# define BOOST_PP_REPEAT_3_531(m, d) BOOST_PP_REPEAT_3_530(m, d) m(4, 530, d)
-# define BOOST_PP_REPEAT_3_532(m, d) BOOST_PP_REPEAT_3_531(m, d) m(4, 531, d)
-# define BOOST_PP_REPEAT_3_533(m, d) BOOST_PP_REPEAT_3_532(m, d) m(4, 532, d)
-# define BOOST_PP_REPEAT_3_534(m, d) BOOST_PP_REPEAT_3_533(m, d) m(4, 533, d)
-# define BOOST_PP_REPEAT_3_535(m, d) BOOST_PP_REPEAT_3_534(m, d) m(4, 534, d)
-# define BOOST_PP_REPEAT_3_536(m, d) BOOST_PP_REPEAT_3_535(m, d) m(4, 535, d)
-# define BOOST_PP_REPEAT_3_537(m, d) BOOST_PP_REPEAT_3_536(m, d) m(4, 536, d)
-# define BOOST_PP_REPEAT_3_538(m, d) BOOST_PP_REPEAT_3_537(m, d) m(4, 537, d)
-# define BOOST_PP_REPEAT_3_539(m, d) BOOST_PP_REPEAT_3_538(m, d) m(4, 538, d)
-# define BOOST_PP_REPEAT_3_540(m, d) BOOST_PP_REPEAT_3_539(m, d) m(4, 539, d)
-# define BOOST_PP_REPEAT_3_541(m, d) BOOST_PP_REPEAT_3_540(m, d) m(4, 540, d)
-# define BOOST_PP_REPEAT_3_542(m, d) BOOST_PP_REPEAT_3_541(m, d) m(4, 541, d)
-# define BOOST_PP_REPEAT_3_543(m, d) BOOST_PP_REPEAT_3_542(m, d) m(4, 542, d)
-# define BOOST_PP_REPEAT_3_544(m, d) BOOST_PP_REPEAT_3_543(m, d) m(4, 543, d)
-# define BOOST_PP_REPEAT_3_545(m, d) BOOST_PP_REPEAT_3_544(m, d) m(4, 544, d)
-# define BOOST_PP_REPEAT_3_546(m, d) BOOST_PP_REPEAT_3_545(m, d) m(4, 545, d)
-# define BOOST_PP_REPEAT_3_547(m, d) BOOST_PP_REPEAT_3_546(m, d) m(4, 546, d)
-# define BOOST_PP_REPEAT_3_548(m, d) BOOST_PP_REPEAT_3_547(m, d) m(4, 547, d)
-# define BOOST_PP_REPEAT_3_549(m, d) BOOST_PP_REPEAT_3_548(m, d) m(4, 548, d)
-# define BOOST_PP_REPEAT_3_550(m, d) BOOST_PP_REPEAT_3_549(m, d) m(4, 549, d)
-# define BOOST_PP_REPEAT_3_551(m, d) BOOST_PP_REPEAT_3_550(m, d) m(4, 550, d)
-# define BOOST_PP_REPEAT_3_552(m, d) BOOST_PP_REPEAT_3_551(m, d) m(4, 551, d)
-# define BOOST_PP_REPEAT_3_553(m, d) BOOST_PP_REPEAT_3_552(m, d) m(4, 552, d)
-# define BOOST_PP_REPEAT_3_554(m, d) BOOST_PP_REPEAT_3_553(m, d) m(4, 553, d)
-# define BOOST_PP_REPEAT_3_555(m, d) BOOST_PP_REPEAT_3_554(m, d) m(4, 554, d)
-# define BOOST_PP_REPEAT_3_556(m, d) BOOST_PP_REPEAT_3_555(m, d) m(4, 555, d)
-# define BOOST_PP_REPEAT_3_557(m, d) BOOST_PP_REPEAT_3_556(m, d) m(4, 556, d)
-# define BOOST_PP_REPEAT_3_558(m, d) BOOST_PP_REPEAT_3_557(m, d) m(4, 557, d)
-# define BOOST_PP_REPEAT_3_559(m, d) BOOST_PP_REPEAT_3_558(m, d) m(4, 558, d)
-# define BOOST_PP_REPEAT_3_560(m, d) BOOST_PP_REPEAT_3_559(m, d) m(4, 559, d)
-# define BOOST_PP_REPEAT_3_561(m, d) BOOST_PP_REPEAT_3_560(m, d) m(4, 560, d)
-# define BOOST_PP_REPEAT_3_562(m, d) BOOST_PP_REPEAT_3_561(m, d) m(4, 561, d)
-# define BOOST_PP_REPEAT_3_563(m, d) BOOST_PP_REPEAT_3_562(m, d) m(4, 562, d)
-# define BOOST_PP_REPEAT_3_564(m, d) BOOST_PP_REPEAT_3_563(m, d) m(4, 563, d)
-# define BOOST_PP_REPEAT_3_565(m, d) BOOST_PP_REPEAT_3_564(m, d) m(4, 564, d)
-# define BOOST_PP_REPEAT_3_566(m, d) BOOST_PP_REPEAT_3_565(m, d) m(4, 565, d)
-# define BOOST_PP_REPEAT_3_567(m, d) BOOST_PP_REPEAT_3_566(m, d) m(4, 566, d)
-# define BOOST_PP_REPEAT_3_568(m, d) BOOST_PP_REPEAT_3_567(m, d) m(4, 567, d)
-# define BOOST_PP_REPEAT_3_569(m, d) BOOST_PP_REPEAT_3_568(m, d) m(4, 568, d)
-# define BOOST_PP_REPEAT_3_570(m, d) BOOST_PP_REPEAT_3_569(m, d) m(4, 569, d)
-# define BOOST_PP_REPEAT_3_571(m, d) BOOST_PP_REPEAT_3_570(m, d) m(4, 570, d)
-# define BOOST_PP_REPEAT_3_572(m, d) BOOST_PP_REPEAT_3_571(m, d) m(4, 571, d)
-# define BOOST_PP_REPEAT_3_573(m, d) BOOST_PP_REPEAT_3_572(m, d) m(4, 572, d)
-# define BOOST_PP_REPEAT_3_574(m, d) BOOST_PP_REPEAT_3_573(m, d) m(4, 573, d)
-# define BOOST_PP_REPEAT_3_575(m, d) BOOST_PP_REPEAT_3_574(m, d) m(4, 574, d)
-# define BOOST_PP_REPEAT_3_576(m, d) BOOST_PP_REPEAT_3_575(m, d) m(4, 575, d)
-# define BOOST_PP_REPEAT_3_577(m, d) BOOST_PP_REPEAT_3_576(m, d) m(4, 576, d)
-# define BOOST_PP_REPEAT_3_578(m, d) BOOST_PP_REPEAT_3_577(m, d) m(4, 577, d)
-# define BOOST_PP_REPEAT_3_579(m, d) BOOST_PP_REPEAT_3_578(m, d) m(4, 578, d)
-# define BOOST_PP_REPEAT_3_580(m, d) BOOST_PP_REPEAT_3_579(m, d) m(4, 579, d)
-# define BOOST_PP_REPEAT_3_581(m, d) BOOST_PP_REPEAT_3_580(m, d) m(4, 580, d)
-# define BOOST_PP_REPEAT_3_582(m, d) BOOST_PP_REPEAT_3_581(m, d) m(4, 581, d)
-# define BOOST_PP_REPEAT_3_583(m, d) BOOST_PP_REPEAT_3_582(m, d) m(4, 582, d)
-# define BOOST_PP_REPEAT_3_584(m, d) BOOST_PP_REPEAT_3_583(m, d) m(4, 583, d)
-# define BOOST_PP_REPEAT_3_585(m, d) BOOST_PP_REPEAT_3_584(m, d) m(4, 584, d)
-# define BOOST_PP_REPEAT_3_586(m, d) BOOST_PP_REPEAT_3_585(m, d) m(4, 585, d)
-# define BOOST_PP_REPEAT_3_587(m, d) BOOST_PP_REPEAT_3_586(m, d) m(4, 586, d)
-# define BOOST_PP_REPEAT_3_588(m, d) BOOST_PP_REPEAT_3_587(m, d) m(4, 587, d)
-# define BOOST_PP_REPEAT_3_589(m, d) BOOST_PP_REPEAT_3_588(m, d) m(4, 588, d)
-# define BOOST_PP_REPEAT_3_590(m, d) BOOST_PP_REPEAT_3_589(m, d) m(4, 589, d)
-# define BOOST_PP_REPEAT_3_591(m, d) BOOST_PP_REPEAT_3_590(m, d) m(4, 590, d)
-# define BOOST_PP_REPEAT_3_592(m, d) BOOST_PP_REPEAT_3_591(m, d) m(4, 591, d)
-# define BOOST_PP_REPEAT_3_593(m, d) BOOST_PP_REPEAT_3_592(m, d) m(4, 592, d)
-# define BOOST_PP_REPEAT_3_594(m, d) BOOST_PP_REPEAT_3_593(m, d) m(4, 593, d)
-# define BOOST_PP_REPEAT_3_595(m, d) BOOST_PP_REPEAT_3_594(m, d) m(4, 594, d)
-# define BOOST_PP_REPEAT_3_596(m, d) BOOST_PP_REPEAT_3_595(m, d) m(4, 595, d)
-# define BOOST_PP_REPEAT_3_597(m, d) BOOST_PP_REPEAT_3_596(m, d) m(4, 596, d)
-# define BOOST_PP_REPEAT_3_598(m, d) BOOST_PP_REPEAT_3_597(m, d) m(4, 597, d)
-# define BOOST_PP_REPEAT_3_599(m, d) BOOST_PP_REPEAT_3_598(m, d) m(4, 598, d)
-# define BOOST_PP_REPEAT_3_600(m, d) BOOST_PP_REPEAT_3_599(m, d) m(4, 599, d)
-# define BOOST_PP_REPEAT_3_601(m, d) BOOST_PP_REPEAT_3_600(m, d) m(4, 600, d)
-# define BOOST_PP_REPEAT_3_602(m, d) BOOST_PP_REPEAT_3_601(m, d) m(4, 601, d)
-# define BOOST_PP_REPEAT_3_603(m, d) BOOST_PP_REPEAT_3_602(m, d) m(4, 602, d)
-# define BOOST_PP_REPEAT_3_604(m, d) BOOST_PP_REPEAT_3_603(m, d) m(4, 603, d)
-# define BOOST_PP_REPEAT_3_605(m, d) BOOST_PP_REPEAT_3_604(m, d) m(4, 604, d)
-# define BOOST_PP_REPEAT_3_606(m, d) BOOST_PP_REPEAT_3_605(m, d) m(4, 605, d)
-# define BOOST_PP_REPEAT_3_607(m, d) BOOST_PP_REPEAT_3_606(m, d) m(4, 606, d)
-# define BOOST_PP_REPEAT_3_608(m, d) BOOST_PP_REPEAT_3_607(m, d) m(4, 607, d)
-# define BOOST_PP_REPEAT_3_609(m, d) BOOST_PP_REPEAT_3_608(m, d) m(4, 608, d)
-# define BOOST_PP_REPEAT_3_610(m, d) BOOST_PP_REPEAT_3_609(m, d) m(4, 609, d)
-# define BOOST_PP_REPEAT_3_611(m, d) BOOST_PP_REPEAT_3_610(m, d) m(4, 610, d)
-# define BOOST_PP_REPEAT_3_612(m, d) BOOST_PP_REPEAT_3_611(m, d) m(4, 611, d)
-# define BOOST_PP_REPEAT_3_613(m, d) BOOST_PP_REPEAT_3_612(m, d) m(4, 612, d)
-# define BOOST_PP_REPEAT_3_614(m, d) BOOST_PP_REPEAT_3_613(m, d) m(4, 613, d)
-# define BOOST_PP_REPEAT_3_615(m, d) BOOST_PP_REPEAT_3_614(m, d) m(4, 614, d)
-# define BOOST_PP_REPEAT_3_616(m, d) BOOST_PP_REPEAT_3_615(m, d) m(4, 615, d)
-# define BOOST_PP_REPEAT_3_617(m, d) BOOST_PP_REPEAT_3_616(m, d) m(4, 616, d)
-# define BOOST_PP_REPEAT_3_618(m, d) BOOST_PP_REPEAT_3_617(m, d) m(4, 617, d)
-# define BOOST_PP_REPEAT_3_619(m, d) BOOST_PP_REPEAT_3_618(m, d) m(4, 618, d)
-# define BOOST_PP_REPEAT_3_620(m, d) BOOST_PP_REPEAT_3_619(m, d) m(4, 619, d)
-# define BOOST_PP_REPEAT_3_621(m, d) BOOST_PP_REPEAT_3_620(m, d) m(4, 620, d)
-# define BOOST_PP_REPEAT_3_622(m, d) BOOST_PP_REPEAT_3_621(m, d) m(4, 621, d)
-# define BOOST_PP_REPEAT_3_623(m, d) BOOST_PP_REPEAT_3_622(m, d) m(4, 622, d)
-# define BOOST_PP_REPEAT_3_624(m, d) BOOST_PP_REPEAT_3_623(m, d) m(4, 623, d)
-# define BOOST_PP_REPEAT_3_625(m, d) BOOST_PP_REPEAT_3_624(m, d) m(4, 624, d)
-# define BOOST_PP_REPEAT_3_626(m, d) BOOST_PP_REPEAT_3_625(m, d) m(4, 625, d)
-# define BOOST_PP_REPEAT_3_627(m, d) BOOST_PP_REPEAT_3_626(m, d) m(4, 626, d)
-# define BOOST_PP_REPEAT_3_628(m, d) BOOST_PP_REPEAT_3_627(m, d) m(4, 627, d)
-# define BOOST_PP_REPEAT_3_629(m, d) BOOST_PP_REPEAT_3_628(m, d) m(4, 628, d)
-# define BOOST_PP_REPEAT_3_630(m, d) BOOST_PP_REPEAT_3_629(m, d) m(4, 629, d)
-# define BOOST_PP_REPEAT_3_631(m, d) BOOST_PP_REPEAT_3_630(m, d) m(4, 630, d)
-# define BOOST_PP_REPEAT_3_632(m, d) BOOST_PP_REPEAT_3_631(m, d) m(4, 631, d)
-# define BOOST_PP_REPEAT_3_633(m, d) BOOST_PP_REPEAT_3_632(m, d) m(4, 632, d)
-# define BOOST_PP_REPEAT_3_634(m, d) BOOST_PP_REPEAT_3_633(m, d) m(4, 633, d)
-# define BOOST_PP_REPEAT_3_635(m, d) BOOST_PP_REPEAT_3_634(m, d) m(4, 634, d)
-# define BOOST_PP_REPEAT_3_636(m, d) BOOST_PP_REPEAT_3_635(m, d) m(4, 635, d)
-# define BOOST_PP_REPEAT_3_637(m, d) BOOST_PP_REPEAT_3_636(m, d) m(4, 636, d)
-# define BOOST_PP_REPEAT_3_638(m, d) BOOST_PP_REPEAT_3_637(m, d) m(4, 637, d)
-# define BOOST_PP_REPEAT_3_639(m, d) BOOST_PP_REPEAT_3_638(m, d) m(4, 638, d)
-# define BOOST_PP_REPEAT_3_640(m, d) BOOST_PP_REPEAT_3_639(m, d) m(4, 639, d)
-# define BOOST_PP_REPEAT_3_641(m, d) BOOST_PP_REPEAT_3_640(m, d) m(4, 640, d)
-# define BOOST_PP_REPEAT_3_642(m, d) BOOST_PP_REPEAT_3_641(m, d) m(4, 641, d)
-# define BOOST_PP_REPEAT_3_643(m, d) BOOST_PP_REPEAT_3_642(m, d) m(4, 642, d)
-# define BOOST_PP_REPEAT_3_644(m, d) BOOST_PP_REPEAT_3_643(m, d) m(4, 643, d)
-# define BOOST_PP_REPEAT_3_645(m, d) BOOST_PP_REPEAT_3_644(m, d) m(4, 644, d)
-# define BOOST_PP_REPEAT_3_646(m, d) BOOST_PP_REPEAT_3_645(m, d) m(4, 645, d)
-# define BOOST_PP_REPEAT_3_647(m, d) BOOST_PP_REPEAT_3_646(m, d) m(4, 646, d)
-# define BOOST_PP_REPEAT_3_648(m, d) BOOST_PP_REPEAT_3_647(m, d) m(4, 647, d)
-# define BOOST_PP_REPEAT_3_649(m, d) BOOST_PP_REPEAT_3_648(m, d) m(4, 648, d)
-# define BOOST_PP_REPEAT_3_650(m, d) BOOST_PP_REPEAT_3_649(m, d) m(4, 649, d)
-# define BOOST_PP_REPEAT_3_651(m, d) BOOST_PP_REPEAT_3_650(m, d) m(4, 650, d)
-# define BOOST_PP_REPEAT_3_652(m, d) BOOST_PP_REPEAT_3_651(m, d) m(4, 651, d)
-# define BOOST_PP_REPEAT_3_653(m, d) BOOST_PP_REPEAT_3_652(m, d) m(4, 652, d)
-# define BOOST_PP_REPEAT_3_654(m, d) BOOST_PP_REPEAT_3_653(m, d) m(4, 653, d)
-# define BOOST_PP_REPEAT_3_655(m, d) BOOST_PP_REPEAT_3_654(m, d) m(4, 654, d)
-# define BOOST_PP_REPEAT_3_656(m, d) BOOST_PP_REPEAT_3_655(m, d) m(4, 655, d)
-# define BOOST_PP_REPEAT_3_657(m, d) BOOST_PP_REPEAT_3_656(m, d) m(4, 656, d)
-# define BOOST_PP_REPEAT_3_658(m, d) BOOST_PP_REPEAT_3_657(m, d) m(4, 657, d)
-# define BOOST_PP_REPEAT_3_659(m, d) BOOST_PP_REPEAT_3_658(m, d) m(4, 658, d)
-# define BOOST_PP_REPEAT_3_660(m, d) BOOST_PP_REPEAT_3_659(m, d) m(4, 659, d)
-# define BOOST_PP_REPEAT_3_661(m, d) BOOST_PP_REPEAT_3_660(m, d) m(4, 660, d)
-# define BOOST_PP_REPEAT_3_662(m, d) BOOST_PP_REPEAT_3_661(m, d) m(4, 661, d)
-# define BOOST_PP_REPEAT_3_663(m, d) BOOST_PP_REPEAT_3_662(m, d) m(4, 662, d)
-# define BOOST_PP_REPEAT_3_664(m, d) BOOST_PP_REPEAT_3_663(m, d) m(4, 663, d)
-# define BOOST_PP_REPEAT_3_665(m, d) BOOST_PP_REPEAT_3_664(m, d) m(4, 664, d)
-# define BOOST_PP_REPEAT_3_666(m, d) BOOST_PP_REPEAT_3_665(m, d) m(4, 665, d)
-# define BOOST_PP_REPEAT_3_667(m, d) BOOST_PP_REPEAT_3_666(m, d) m(4, 666, d)
-# define BOOST_PP_REPEAT_3_668(m, d) BOOST_PP_REPEAT_3_667(m, d) m(4, 667, d)
-# define BOOST_PP_REPEAT_3_669(m, d) BOOST_PP_REPEAT_3_668(m, d) m(4, 668, d)
-# define BOOST_PP_REPEAT_3_670(m, d) BOOST_PP_REPEAT_3_669(m, d) m(4, 669, d)
-# define BOOST_PP_REPEAT_3_671(m, d) BOOST_PP_REPEAT_3_670(m, d) m(4, 670, d)
-# define BOOST_PP_REPEAT_3_672(m, d) BOOST_PP_REPEAT_3_671(m, d) m(4, 671, d)
-# define BOOST_PP_REPEAT_3_673(m, d) BOOST_PP_REPEAT_3_672(m, d) m(4, 672, d)
-# define BOOST_PP_REPEAT_3_674(m, d) BOOST_PP_REPEAT_3_673(m, d) m(4, 673, d)
-# define BOOST_PP_REPEAT_3_675(m, d) BOOST_PP_REPEAT_3_674(m, d) m(4, 674, d)
-# define BOOST_PP_REPEAT_3_676(m, d) BOOST_PP_REPEAT_3_675(m, d) m(4, 675, d)
-# define BOOST_PP_REPEAT_3_677(m, d) BOOST_PP_REPEAT_3_676(m, d) m(4, 676, d)
-# define BOOST_PP_REPEAT_3_678(m, d) BOOST_PP_REPEAT_3_677(m, d) m(4, 677, d)
-# define BOOST_PP_REPEAT_3_679(m, d) BOOST_PP_REPEAT_3_678(m, d) m(4, 678, d)
-# define BOOST_PP_REPEAT_3_680(m, d) BOOST_PP_REPEAT_3_679(m, d) m(4, 679, d)
-# define BOOST_PP_REPEAT_3_681(m, d) BOOST_PP_REPEAT_3_680(m, d) m(4, 680, d)
-# define BOOST_PP_REPEAT_3_682(m, d) BOOST_PP_REPEAT_3_681(m, d) m(4, 681, d)
-# define BOOST_PP_REPEAT_3_683(m, d) BOOST_PP_REPEAT_3_682(m, d) m(4, 682, d)
-# define BOOST_PP_REPEAT_3_684(m, d) BOOST_PP_REPEAT_3_683(m, d) m(4, 683, d)
-# define BOOST_PP_REPEAT_3_685(m, d) BOOST_PP_REPEAT_3_684(m, d) m(4, 684, d)
-# define BOOST_PP_REPEAT_3_686(m, d) BOOST_PP_REPEAT_3_685(m, d) m(4, 685, d)
-# define BOOST_PP_REPEAT_3_687(m, d) BOOST_PP_REPEAT_3_686(m, d) m(4, 686, d)
-# define BOOST_PP_REPEAT_3_688(m, d) BOOST_PP_REPEAT_3_687(m, d) m(4, 687, d)
-# define BOOST_PP_REPEAT_3_689(m, d) BOOST_PP_REPEAT_3_688(m, d) m(4, 688, d)
-# define BOOST_PP_REPEAT_3_690(m, d) BOOST_PP_REPEAT_3_689(m, d) m(4, 689, d)
-# define BOOST_PP_REPEAT_3_691(m, d) BOOST_PP_REPEAT_3_690(m, d) m(4, 690, d)
-# define BOOST_PP_REPEAT_3_692(m, d) BOOST_PP_REPEAT_3_691(m, d) m(4, 691, d)
-# define BOOST_PP_REPEAT_3_693(m, d) BOOST_PP_REPEAT_3_692(m, d) m(4, 692, d)
-# define BOOST_PP_REPEAT_3_694(m, d) BOOST_PP_REPEAT_3_693(m, d) m(4, 693, d)
-# define BOOST_PP_REPEAT_3_695(m, d) BOOST_PP_REPEAT_3_694(m, d) m(4, 694, d)
-# define BOOST_PP_REPEAT_3_696(m, d) BOOST_PP_REPEAT_3_695(m, d) m(4, 695, d)
-# define BOOST_PP_REPEAT_3_697(m, d) BOOST_PP_REPEAT_3_696(m, d) m(4, 696, d)
-# define BOOST_PP_REPEAT_3_698(m, d) BOOST_PP_REPEAT_3_697(m, d) m(4, 697, d)
-# define BOOST_PP_REPEAT_3_699(m, d) BOOST_PP_REPEAT_3_698(m, d) m(4, 698, d)
-# define BOOST_PP_REPEAT_3_700(m, d) BOOST_PP_REPEAT_3_699(m, d) m(4, 699, d)
-# define BOOST_PP_REPEAT_3_701(m, d) BOOST_PP_REPEAT_3_700(m, d) m(4, 700, d)
-# define BOOST_PP_REPEAT_3_702(m, d) BOOST_PP_REPEAT_3_701(m, d) m(4, 701, d)
-# define BOOST_PP_REPEAT_3_703(m, d) BOOST_PP_REPEAT_3_702(m, d) m(4, 702, d)
-# define BOOST_PP_REPEAT_3_704(m, d) BOOST_PP_REPEAT_3_703(m, d) m(4, 703, d)
-# define BOOST_PP_REPEAT_3_705(m, d) BOOST_PP_REPEAT_3_704(m, d) m(4, 704, d)
-# define BOOST_PP_REPEAT_3_706(m, d) BOOST_PP_REPEAT_3_705(m, d) m(4, 705, d)
-# define BOOST_PP_REPEAT_3_707(m, d) BOOST_PP_REPEAT_3_706(m, d) m(4, 706, d)
-# define BOOST_PP_REPEAT_3_708(m, d) BOOST_PP_REPEAT_3_707(m, d) m(4, 707, d)
-# define BOOST_PP_REPEAT_3_709(m, d) BOOST_PP_REPEAT_3_708(m, d) m(4, 708, d)
-# define BOOST_PP_REPEAT_3_710(m, d) BOOST_PP_REPEAT_3_709(m, d) m(4, 709, d)
-# define BOOST_PP_REPEAT_3_711(m, d) BOOST_PP_REPEAT_3_710(m, d) m(4, 710, d)
-# define BOOST_PP_REPEAT_3_712(m, d) BOOST_PP_REPEAT_3_711(m, d) m(4, 711, d)
-# define BOOST_PP_REPEAT_3_713(m, d) BOOST_PP_REPEAT_3_712(m, d) m(4, 712, d)
-# define BOOST_PP_REPEAT_3_714(m, d) BOOST_PP_REPEAT_3_713(m, d) m(4, 713, d)
-# define BOOST_PP_REPEAT_3_715(m, d) BOOST_PP_REPEAT_3_714(m, d) m(4, 714, d)
-# define BOOST_PP_REPEAT_3_716(m, d) BOOST_PP_REPEAT_3_715(m, d) m(4, 715, d)
-# define BOOST_PP_REPEAT_3_717(m, d) BOOST_PP_REPEAT_3_716(m, d) m(4, 716, d)
-# define BOOST_PP_REPEAT_3_718(m, d) BOOST_PP_REPEAT_3_717(m, d) m(4, 717, d)
-# define BOOST_PP_REPEAT_3_719(m, d) BOOST_PP_REPEAT_3_718(m, d) m(4, 718, d)
-# define BOOST_PP_REPEAT_3_720(m, d) BOOST_PP_REPEAT_3_719(m, d) m(4, 719, d)
-# define BOOST_PP_REPEAT_3_721(m, d) BOOST_PP_REPEAT_3_720(m, d) m(4, 720, d)
-# define BOOST_PP_REPEAT_3_722(m, d) BOOST_PP_REPEAT_3_721(m, d) m(4, 721, d)
-# define BOOST_PP_REPEAT_3_723(m, d) BOOST_PP_REPEAT_3_722(m, d) m(4, 722, d)
-# define BOOST_PP_REPEAT_3_724(m, d) BOOST_PP_REPEAT_3_723(m, d) m(4, 723, d)
-# define BOOST_PP_REPEAT_3_725(m, d) BOOST_PP_REPEAT_3_724(m, d) m(4, 724, d)
-# define BOOST_PP_REPEAT_3_726(m, d) BOOST_PP_REPEAT_3_725(m, d) m(4, 725, d)
-# define BOOST_PP_REPEAT_3_727(m, d) BOOST_PP_REPEAT_3_726(m, d) m(4, 726, d)
-# define BOOST_PP_REPEAT_3_728(m, d) BOOST_PP_REPEAT_3_727(m, d) m(4, 727, d)
-# define BOOST_PP_REPEAT_3_729(m, d) BOOST_PP_REPEAT_3_728(m, d) m(4, 728, d)
-# define BOOST_PP_REPEAT_3_730(m, d) BOOST_PP_REPEAT_3_729(m, d) m(4, 729, d)
-# define BOOST_PP_REPEAT_3_731(m, d) BOOST_PP_REPEAT_3_730(m, d) m(4, 730, d)
-# define BOOST_PP_REPEAT_3_732(m, d) BOOST_PP_REPEAT_3_731(m, d) m(4, 731, d)
-# define BOOST_PP_REPEAT_3_733(m, d) BOOST_PP_REPEAT_3_732(m, d) m(4, 732, d)
-# define BOOST_PP_REPEAT_3_734(m, d) BOOST_PP_REPEAT_3_733(m, d) m(4, 733, d)
-# define BOOST_PP_REPEAT_3_735(m, d) BOOST_PP_REPEAT_3_734(m, d) m(4, 734, d)
-# define BOOST_PP_REPEAT_3_736(m, d) BOOST_PP_REPEAT_3_735(m, d) m(4, 735, d)
-# define BOOST_PP_REPEAT_3_737(m, d) BOOST_PP_REPEAT_3_736(m, d) m(4, 736, d)
-# define BOOST_PP_REPEAT_3_738(m, d) BOOST_PP_REPEAT_3_737(m, d) m(4, 737, d)
-# define BOOST_PP_REPEAT_3_739(m, d) BOOST_PP_REPEAT_3_738(m, d) m(4, 738, d)
-# define BOOST_PP_REPEAT_3_740(m, d) BOOST_PP_REPEAT_3_739(m, d) m(4, 739, d)
-# define BOOST_PP_REPEAT_3_741(m, d) BOOST_PP_REPEAT_3_740(m, d) m(4, 740, d)
-# define BOOST_PP_REPEAT_3_742(m, d) BOOST_PP_REPEAT_3_741(m, d) m(4, 741, d)
-# define BOOST_PP_REPEAT_3_743(m, d) BOOST_PP_REPEAT_3_742(m, d) m(4, 742, d)
-# define BOOST_PP_REPEAT_3_744(m, d) BOOST_PP_REPEAT_3_743(m, d) m(4, 743, d)
-# define BOOST_PP_REPEAT_3_745(m, d) BOOST_PP_REPEAT_3_744(m, d) m(4, 744, d)
-# define BOOST_PP_REPEAT_3_746(m, d) BOOST_PP_REPEAT_3_745(m, d) m(4, 745, d)
-# define BOOST_PP_REPEAT_3_747(m, d) BOOST_PP_REPEAT_3_746(m, d) m(4, 746, d)
-# define BOOST_PP_REPEAT_3_748(m, d) BOOST_PP_REPEAT_3_747(m, d) m(4, 747, d)
-# define BOOST_PP_REPEAT_3_749(m, d) BOOST_PP_REPEAT_3_748(m, d) m(4, 748, d)
-# define BOOST_PP_REPEAT_3_750(m, d) BOOST_PP_REPEAT_3_749(m, d) m(4, 749, d)
-# define BOOST_PP_REPEAT_3_751(m, d) BOOST_PP_REPEAT_3_750(m, d) m(4, 750, d)
-# define BOOST_PP_REPEAT_3_752(m, d) BOOST_PP_REPEAT_3_751(m, d) m(4, 751, d)
-# define BOOST_PP_REPEAT_3_753(m, d) BOOST_PP_REPEAT_3_752(m, d) m(4, 752, d)
-# define BOOST_PP_REPEAT_3_754(m, d) BOOST_PP_REPEAT_3_753(m, d) m(4, 753, d)
-# define BOOST_PP_REPEAT_3_755(m, d) BOOST_PP_REPEAT_3_754(m, d) m(4, 754, d)
-# define BOOST_PP_REPEAT_3_756(m, d) BOOST_PP_REPEAT_3_755(m, d) m(4, 755, d)
-# define BOOST_PP_REPEAT_3_757(m, d) BOOST_PP_REPEAT_3_756(m, d) m(4, 756, d)
-# define BOOST_PP_REPEAT_3_758(m, d) BOOST_PP_REPEAT_3_757(m, d) m(4, 757, d)
-# define BOOST_PP_REPEAT_3_759(m, d) BOOST_PP_REPEAT_3_758(m, d) m(4, 758, d)
-# define BOOST_PP_REPEAT_3_760(m, d) BOOST_PP_REPEAT_3_759(m, d) m(4, 759, d)
-# define BOOST_PP_REPEAT_3_761(m, d) BOOST_PP_REPEAT_3_760(m, d) m(4, 760, d)
-# define BOOST_PP_REPEAT_3_762(m, d) BOOST_PP_REPEAT_3_761(m, d) m(4, 761, d)
-# define BOOST_PP_REPEAT_3_763(m, d) BOOST_PP_REPEAT_3_762(m, d) m(4, 762, d)
-# define BOOST_PP_REPEAT_3_764(m, d) BOOST_PP_REPEAT_3_763(m, d) m(4, 763, d)
-# define BOOST_PP_REPEAT_3_765(m, d) BOOST_PP_REPEAT_3_764(m, d) m(4, 764, d)
-# define BOOST_PP_REPEAT_3_766(m, d) BOOST_PP_REPEAT_3_765(m, d) m(4, 765, d)
-# define BOOST_PP_REPEAT_3_767(m, d) BOOST_PP_REPEAT_3_766(m, d) m(4, 766, d)
-# define BOOST_PP_REPEAT_3_768(m, d) BOOST_PP_REPEAT_3_767(m, d) m(4, 767, d)
-# define BOOST_PP_REPEAT_3_769(m, d) BOOST_PP_REPEAT_3_768(m, d) m(4, 768, d)
-# define BOOST_PP_REPEAT_3_770(m, d) BOOST_PP_REPEAT_3_769(m, d) m(4, 769, d)
-# define BOOST_PP_REPEAT_3_771(m, d) BOOST_PP_REPEAT_3_770(m, d) m(4, 770, d)
-# define BOOST_PP_REPEAT_3_772(m, d) BOOST_PP_REPEAT_3_771(m, d) m(4, 771, d)
-# define BOOST_PP_REPEAT_3_773(m, d) BOOST_PP_REPEAT_3_772(m, d) m(4, 772, d)
-# define BOOST_PP_REPEAT_3_774(m, d) BOOST_PP_REPEAT_3_773(m, d) m(4, 773, d)
-# define BOOST_PP_REPEAT_3_775(m, d) BOOST_PP_REPEAT_3_774(m, d) m(4, 774, d)
-# define BOOST_PP_REPEAT_3_776(m, d) BOOST_PP_REPEAT_3_775(m, d) m(4, 775, d)
-# define BOOST_PP_REPEAT_3_777(m, d) BOOST_PP_REPEAT_3_776(m, d) m(4, 776, d)
-# define BOOST_PP_REPEAT_3_778(m, d) BOOST_PP_REPEAT_3_777(m, d) m(4, 777, d)
-# define BOOST_PP_REPEAT_3_779(m, d) BOOST_PP_REPEAT_3_778(m, d) m(4, 778, d)
-# define BOOST_PP_REPEAT_3_780(m, d) BOOST_PP_REPEAT_3_779(m, d) m(4, 779, d)
-# define BOOST_PP_REPEAT_3_781(m, d) BOOST_PP_REPEAT_3_780(m, d) m(4, 780, d)
-# define BOOST_PP_REPEAT_3_782(m, d) BOOST_PP_REPEAT_3_781(m, d) m(4, 781, d)
-# define BOOST_PP_REPEAT_3_783(m, d) BOOST_PP_REPEAT_3_782(m, d) m(4, 782, d)
-# define BOOST_PP_REPEAT_3_784(m, d) BOOST_PP_REPEAT_3_783(m, d) m(4, 783, d)
-# define BOOST_PP_REPEAT_3_785(m, d) BOOST_PP_REPEAT_3_784(m, d) m(4, 784, d)
-# define BOOST_PP_REPEAT_3_786(m, d) BOOST_PP_REPEAT_3_785(m, d) m(4, 785, d)
-# define BOOST_PP_REPEAT_3_787(m, d) BOOST_PP_REPEAT_3_786(m, d) m(4, 786, d)
-# define BOOST_PP_REPEAT_3_788(m, d) BOOST_PP_REPEAT_3_787(m, d) m(4, 787, d)
-# define BOOST_PP_REPEAT_3_789(m, d) BOOST_PP_REPEAT_3_788(m, d) m(4, 788, d)
-# define BOOST_PP_REPEAT_3_790(m, d) BOOST_PP_REPEAT_3_789(m, d) m(4, 789, d)
-# define BOOST_PP_REPEAT_3_791(m, d) BOOST_PP_REPEAT_3_790(m, d) m(4, 790, d)
-# define BOOST_PP_REPEAT_3_792(m, d) BOOST_PP_REPEAT_3_791(m, d) m(4, 791, d)
-# define BOOST_PP_REPEAT_3_793(m, d) BOOST_PP_REPEAT_3_792(m, d) m(4, 792, d)
-# define BOOST_PP_REPEAT_3_794(m, d) BOOST_PP_REPEAT_3_793(m, d) m(4, 793, d)
-# define BOOST_PP_REPEAT_3_795(m, d) BOOST_PP_REPEAT_3_794(m, d) m(4, 794, d)
-# define BOOST_PP_REPEAT_3_796(m, d) BOOST_PP_REPEAT_3_795(m, d) m(4, 795, d)
-# define BOOST_PP_REPEAT_3_797(m, d) BOOST_PP_REPEAT_3_796(m, d) m(4, 796, d)
-# define BOOST_PP_REPEAT_3_798(m, d) BOOST_PP_REPEAT_3_797(m, d) m(4, 797, d)
-# define BOOST_PP_REPEAT_3_799(m, d) BOOST_PP_REPEAT_3_798(m, d) m(4, 798, d)
-# define BOOST_PP_REPEAT_3_800(m, d) BOOST_PP_REPEAT_3_799(m, d) m(4, 799, d)
-# define BOOST_PP_REPEAT_3_801(m, d) BOOST_PP_REPEAT_3_800(m, d) m(4, 800, d)
-# define BOOST_PP_REPEAT_3_802(m, d) BOOST_PP_REPEAT_3_801(m, d) m(4, 801, d)
-# define BOOST_PP_REPEAT_3_803(m, d) BOOST_PP_REPEAT_3_802(m, d) m(4, 802, d)
-# define BOOST_PP_REPEAT_3_804(m, d) BOOST_PP_REPEAT_3_803(m, d) m(4, 803, d)
-# define BOOST_PP_REPEAT_3_805(m, d) BOOST_PP_REPEAT_3_804(m, d) m(4, 804, d)
-# define BOOST_PP_REPEAT_3_806(m, d) BOOST_PP_REPEAT_3_805(m, d) m(4, 805, d)
-# define BOOST_PP_REPEAT_3_807(m, d) BOOST_PP_REPEAT_3_806(m, d) m(4, 806, d)
-# define BOOST_PP_REPEAT_3_808(m, d) BOOST_PP_REPEAT_3_807(m, d) m(4, 807, d)
-# define BOOST_PP_REPEAT_3_809(m, d) BOOST_PP_REPEAT_3_808(m, d) m(4, 808, d)
-# define BOOST_PP_REPEAT_3_810(m, d) BOOST_PP_REPEAT_3_809(m, d) m(4, 809, d)
-# define BOOST_PP_REPEAT_3_811(m, d) BOOST_PP_REPEAT_3_810(m, d) m(4, 810, d)
-# define BOOST_PP_REPEAT_3_812(m, d) BOOST_PP_REPEAT_3_811(m, d) m(4, 811, d)
-# define BOOST_PP_REPEAT_3_813(m, d) BOOST_PP_REPEAT_3_812(m, d) m(4, 812, d)
-# define BOOST_PP_REPEAT_3_814(m, d) BOOST_PP_REPEAT_3_813(m, d) m(4, 813, d)
-# define BOOST_PP_REPEAT_3_815(m, d) BOOST_PP_REPEAT_3_814(m, d) m(4, 814, d)
-# define BOOST_PP_REPEAT_3_816(m, d) BOOST_PP_REPEAT_3_815(m, d) m(4, 815, d)
-# define BOOST_PP_REPEAT_3_817(m, d) BOOST_PP_REPEAT_3_816(m, d) m(4, 816, d)
-# define BOOST_PP_REPEAT_3_818(m, d) BOOST_PP_REPEAT_3_817(m, d) m(4, 817, d)
-# define BOOST_PP_REPEAT_3_819(m, d) BOOST_PP_REPEAT_3_818(m, d) m(4, 818, d)
-# define BOOST_PP_REPEAT_3_820(m, d) BOOST_PP_REPEAT_3_819(m, d) m(4, 819, d)
-# define BOOST_PP_REPEAT_3_821(m, d) BOOST_PP_REPEAT_3_820(m, d) m(4, 820, d)
-# define BOOST_PP_REPEAT_3_822(m, d) BOOST_PP_REPEAT_3_821(m, d) m(4, 821, d)
-# define BOOST_PP_REPEAT_3_823(m, d) BOOST_PP_REPEAT_3_822(m, d) m(4, 822, d)
-# define BOOST_PP_REPEAT_3_824(m, d) BOOST_PP_REPEAT_3_823(m, d) m(4, 823, d)
-# define BOOST_PP_REPEAT_3_825(m, d) BOOST_PP_REPEAT_3_824(m, d) m(4, 824, d)
-# define BOOST_PP_REPEAT_3_826(m, d) BOOST_PP_REPEAT_3_825(m, d) m(4, 825, d)
-# define BOOST_PP_REPEAT_3_827(m, d) BOOST_PP_REPEAT_3_826(m, d) m(4, 826, d)
-# define BOOST_PP_REPEAT_3_828(m, d) BOOST_PP_REPEAT_3_827(m, d) m(4, 827, d)
-# define BOOST_PP_REPEAT_3_829(m, d) BOOST_PP_REPEAT_3_828(m, d) m(4, 828, d)
-# define BOOST_PP_REPEAT_3_830(m, d) BOOST_PP_REPEAT_3_829(m, d) m(4, 829, d)
-# define BOOST_PP_REPEAT_3_831(m, d) BOOST_PP_REPEAT_3_830(m, d) m(4, 830, d)
-# define BOOST_PP_REPEAT_3_832(m, d) BOOST_PP_REPEAT_3_831(m, d) m(4, 831, d)
-# define BOOST_PP_REPEAT_3_833(m, d) BOOST_PP_REPEAT_3_832(m, d) m(4, 832, d)
-# define BOOST_PP_REPEAT_3_834(m, d) BOOST_PP_REPEAT_3_833(m, d) m(4, 833, d)
-# define BOOST_PP_REPEAT_3_835(m, d) BOOST_PP_REPEAT_3_834(m, d) m(4, 834, d)
-# define BOOST_PP_REPEAT_3_836(m, d) BOOST_PP_REPEAT_3_835(m, d) m(4, 835, d)
-# define BOOST_PP_REPEAT_3_837(m, d) BOOST_PP_REPEAT_3_836(m, d) m(4, 836, d)
-# define BOOST_PP_REPEAT_3_838(m, d) BOOST_PP_REPEAT_3_837(m, d) m(4, 837, d)
-# define BOOST_PP_REPEAT_3_839(m, d) BOOST_PP_REPEAT_3_838(m, d) m(4, 838, d)
-# define BOOST_PP_REPEAT_3_840(m, d) BOOST_PP_REPEAT_3_839(m, d) m(4, 839, d)
-# define BOOST_PP_REPEAT_3_841(m, d) BOOST_PP_REPEAT_3_840(m, d) m(4, 840, d)
-# define BOOST_PP_REPEAT_3_842(m, d) BOOST_PP_REPEAT_3_841(m, d) m(4, 841, d)
-# define BOOST_PP_REPEAT_3_843(m, d) BOOST_PP_REPEAT_3_842(m, d) m(4, 842, d)
-# define BOOST_PP_REPEAT_3_844(m, d) BOOST_PP_REPEAT_3_843(m, d) m(4, 843, d)
-# define BOOST_PP_REPEAT_3_845(m, d) BOOST_PP_REPEAT_3_844(m, d) m(4, 844, d)
-# define BOOST_PP_REPEAT_3_846(m, d) BOOST_PP_REPEAT_3_845(m, d) m(4, 845, d)
-# define BOOST_PP_REPEAT_3_847(m, d) BOOST_PP_REPEAT_3_846(m, d) m(4, 846, d)
-# define BOOST_PP_REPEAT_3_848(m, d) BOOST_PP_REPEAT_3_847(m, d) m(4, 847, d)
-# define BOOST_PP_REPEAT_3_849(m, d) BOOST_PP_REPEAT_3_848(m, d) m(4, 848, d)
-# define BOOST_PP_REPEAT_3_850(m, d) BOOST_PP_REPEAT_3_849(m, d) m(4, 849, d)
-# define BOOST_PP_REPEAT_3_851(m, d) BOOST_PP_REPEAT_3_850(m, d) m(4, 850, d)
-# define BOOST_PP_REPEAT_3_852(m, d) BOOST_PP_REPEAT_3_851(m, d) m(4, 851, d)
-# define BOOST_PP_REPEAT_3_853(m, d) BOOST_PP_REPEAT_3_852(m, d) m(4, 852, d)
-# define BOOST_PP_REPEAT_3_854(m, d) BOOST_PP_REPEAT_3_853(m, d) m(4, 853, d)
-# define BOOST_PP_REPEAT_3_855(m, d) BOOST_PP_REPEAT_3_854(m, d) m(4, 854, d)
-# define BOOST_PP_REPEAT_3_856(m, d) BOOST_PP_REPEAT_3_855(m, d) m(4, 855, d)
-# define BOOST_PP_REPEAT_3_857(m, d) BOOST_PP_REPEAT_3_856(m, d) m(4, 856, d)
-# define BOOST_PP_REPEAT_3_858(m, d) BOOST_PP_REPEAT_3_857(m, d) m(4, 857, d)
-# define BOOST_PP_REPEAT_3_859(m, d) BOOST_PP_REPEAT_3_858(m, d) m(4, 858, d)
-# define BOOST_PP_REPEAT_3_860(m, d) BOOST_PP_REPEAT_3_859(m, d) m(4, 859, d)
-# define BOOST_PP_REPEAT_3_861(m, d) BOOST_PP_REPEAT_3_860(m, d) m(4, 860, d)
-# define BOOST_PP_REPEAT_3_862(m, d) BOOST_PP_REPEAT_3_861(m, d) m(4, 861, d)
-# define BOOST_PP_REPEAT_3_863(m, d) BOOST_PP_REPEAT_3_862(m, d) m(4, 862, d)
-# define BOOST_PP_REPEAT_3_864(m, d) BOOST_PP_REPEAT_3_863(m, d) m(4, 863, d)
-# define BOOST_PP_REPEAT_3_865(m, d) BOOST_PP_REPEAT_3_864(m, d) m(4, 864, d)
-# define BOOST_PP_REPEAT_3_866(m, d) BOOST_PP_REPEAT_3_865(m, d) m(4, 865, d)
-# define BOOST_PP_REPEAT_3_867(m, d) BOOST_PP_REPEAT_3_866(m, d) m(4, 866, d)
-# define BOOST_PP_REPEAT_3_868(m, d) BOOST_PP_REPEAT_3_867(m, d) m(4, 867, d)
-# define BOOST_PP_REPEAT_3_869(m, d) BOOST_PP_REPEAT_3_868(m, d) m(4, 868, d)
-# define BOOST_PP_REPEAT_3_870(m, d) BOOST_PP_REPEAT_3_869(m, d) m(4, 869, d)
-# define BOOST_PP_REPEAT_3_871(m, d) BOOST_PP_REPEAT_3_870(m, d) m(4, 870, d)
-# define BOOST_PP_REPEAT_3_872(m, d) BOOST_PP_REPEAT_3_871(m, d) m(4, 871, d)
-# define BOOST_PP_REPEAT_3_873(m, d) BOOST_PP_REPEAT_3_872(m, d) m(4, 872, d)
-# define BOOST_PP_REPEAT_3_874(m, d) BOOST_PP_REPEAT_3_873(m, d) m(4, 873, d)
-# define BOOST_PP_REPEAT_3_875(m, d) BOOST_PP_REPEAT_3_874(m, d) m(4, 874, d)
-# define BOOST_PP_REPEAT_3_876(m, d) BOOST_PP_REPEAT_3_875(m, d) m(4, 875, d)
-# define BOOST_PP_REPEAT_3_877(m, d) BOOST_PP_REPEAT_3_876(m, d) m(4, 876, d)
-# define BOOST_PP_REPEAT_3_878(m, d) BOOST_PP_REPEAT_3_877(m, d) m(4, 877, d)
-# define BOOST_PP_REPEAT_3_879(m, d) BOOST_PP_REPEAT_3_878(m, d) m(4, 878, d)
-# define BOOST_PP_REPEAT_3_880(m, d) BOOST_PP_REPEAT_3_879(m, d) m(4, 879, d)
-# define BOOST_PP_REPEAT_3_881(m, d) BOOST_PP_REPEAT_3_880(m, d) m(4, 880, d)
-# define BOOST_PP_REPEAT_3_882(m, d) BOOST_PP_REPEAT_3_881(m, d) m(4, 881, d)
-# define BOOST_PP_REPEAT_3_883(m, d) BOOST_PP_REPEAT_3_882(m, d) m(4, 882, d)
-# define BOOST_PP_REPEAT_3_884(m, d) BOOST_PP_REPEAT_3_883(m, d) m(4, 883, d)
-# define BOOST_PP_REPEAT_3_885(m, d) BOOST_PP_REPEAT_3_884(m, d) m(4, 884, d)
-# define BOOST_PP_REPEAT_3_886(m, d) BOOST_PP_REPEAT_3_885(m, d) m(4, 885, d)
-# define BOOST_PP_REPEAT_3_887(m, d) BOOST_PP_REPEAT_3_886(m, d) m(4, 886, d)
-# define BOOST_PP_REPEAT_3_888(m, d) BOOST_PP_REPEAT_3_887(m, d) m(4, 887, d)
-# define BOOST_PP_REPEAT_3_889(m, d) BOOST_PP_REPEAT_3_888(m, d) m(4, 888, d)
-# define BOOST_PP_REPEAT_3_890(m, d) BOOST_PP_REPEAT_3_889(m, d) m(4, 889, d)
-# define BOOST_PP_REPEAT_3_891(m, d) BOOST_PP_REPEAT_3_890(m, d) m(4, 890, d)
-# define BOOST_PP_REPEAT_3_892(m, d) BOOST_PP_REPEAT_3_891(m, d) m(4, 891, d)
-# define BOOST_PP_REPEAT_3_893(m, d) BOOST_PP_REPEAT_3_892(m, d) m(4, 892, d)
-# define BOOST_PP_REPEAT_3_894(m, d) BOOST_PP_REPEAT_3_893(m, d) m(4, 893, d)
-# define BOOST_PP_REPEAT_3_895(m, d) BOOST_PP_REPEAT_3_894(m, d) m(4, 894, d)
-# define BOOST_PP_REPEAT_3_896(m, d) BOOST_PP_REPEAT_3_895(m, d) m(4, 895, d)
-# define BOOST_PP_REPEAT_3_897(m, d) BOOST_PP_REPEAT_3_896(m, d) m(4, 896, d)
-# define BOOST_PP_REPEAT_3_898(m, d) BOOST_PP_REPEAT_3_897(m, d) m(4, 897, d)
-# define BOOST_PP_REPEAT_3_899(m, d) BOOST_PP_REPEAT_3_898(m, d) m(4, 898, d)
-# define BOOST_PP_REPEAT_3_900(m, d) BOOST_PP_REPEAT_3_899(m, d) m(4, 899, d)
-# define BOOST_PP_REPEAT_3_901(m, d) BOOST_PP_REPEAT_3_900(m, d) m(4, 900, d)
-# define BOOST_PP_REPEAT_3_902(m, d) BOOST_PP_REPEAT_3_901(m, d) m(4, 901, d)
-# define BOOST_PP_REPEAT_3_903(m, d) BOOST_PP_REPEAT_3_902(m, d) m(4, 902, d)
-# define BOOST_PP_REPEAT_3_904(m, d) BOOST_PP_REPEAT_3_903(m, d) m(4, 903, d)
-# define BOOST_PP_REPEAT_3_905(m, d) BOOST_PP_REPEAT_3_904(m, d) m(4, 904, d)
-# define BOOST_PP_REPEAT_3_906(m, d) BOOST_PP_REPEAT_3_905(m, d) m(4, 905, d)
-# define BOOST_PP_REPEAT_3_907(m, d) BOOST_PP_REPEAT_3_906(m, d) m(4, 906, d)
-# define BOOST_PP_REPEAT_3_908(m, d) BOOST_PP_REPEAT_3_907(m, d) m(4, 907, d)
-# define BOOST_PP_REPEAT_3_909(m, d) BOOST_PP_REPEAT_3_908(m, d) m(4, 908, d)
-# define BOOST_PP_REPEAT_3_910(m, d) BOOST_PP_REPEAT_3_909(m, d) m(4, 909, d)
-# define BOOST_PP_REPEAT_3_911(m, d) BOOST_PP_REPEAT_3_910(m, d) m(4, 910, d)
-# define BOOST_PP_REPEAT_3_912(m, d) BOOST_PP_REPEAT_3_911(m, d) m(4, 911, d)
-# define BOOST_PP_REPEAT_3_913(m, d) BOOST_PP_REPEAT_3_912(m, d) m(4, 912, d)
-# define BOOST_PP_REPEAT_3_914(m, d) BOOST_PP_REPEAT_3_913(m, d) m(4, 913, d)
-# define BOOST_PP_REPEAT_3_915(m, d) BOOST_PP_REPEAT_3_914(m, d) m(4, 914, d)
-# define BOOST_PP_REPEAT_3_916(m, d) BOOST_PP_REPEAT_3_915(m, d) m(4, 915, d)
-# define BOOST_PP_REPEAT_3_917(m, d) BOOST_PP_REPEAT_3_916(m, d) m(4, 916, d)
-# define BOOST_PP_REPEAT_3_918(m, d) BOOST_PP_REPEAT_3_917(m, d) m(4, 917, d)
-# define BOOST_PP_REPEAT_3_919(m, d) BOOST_PP_REPEAT_3_918(m, d) m(4, 918, d)
-# define BOOST_PP_REPEAT_3_920(m, d) BOOST_PP_REPEAT_3_919(m, d) m(4, 919, d)
-# define BOOST_PP_REPEAT_3_921(m, d) BOOST_PP_REPEAT_3_920(m, d) m(4, 920, d)
-# define BOOST_PP_REPEAT_3_922(m, d) BOOST_PP_REPEAT_3_921(m, d) m(4, 921, d)
-# define BOOST_PP_REPEAT_3_923(m, d) BOOST_PP_REPEAT_3_922(m, d) m(4, 922, d)
-# define BOOST_PP_REPEAT_3_924(m, d) BOOST_PP_REPEAT_3_923(m, d) m(4, 923, d)
-# define BOOST_PP_REPEAT_3_925(m, d) BOOST_PP_REPEAT_3_924(m, d) m(4, 924, d)
-# define BOOST_PP_REPEAT_3_926(m, d) BOOST_PP_REPEAT_3_925(m, d) m(4, 925, d)
-# define BOOST_PP_REPEAT_3_927(m, d) BOOST_PP_REPEAT_3_926(m, d) m(4, 926, d)
-# define BOOST_PP_REPEAT_3_928(m, d) BOOST_PP_REPEAT_3_927(m, d) m(4, 927, d)
-# define BOOST_PP_REPEAT_3_929(m, d) BOOST_PP_REPEAT_3_928(m, d) m(4, 928, d)
-# define BOOST_PP_REPEAT_3_930(m, d) BOOST_PP_REPEAT_3_929(m, d) m(4, 929, d)
-# define BOOST_PP_REPEAT_3_931(m, d) BOOST_PP_REPEAT_3_930(m, d) m(4, 930, d)
-# define BOOST_PP_REPEAT_3_932(m, d) BOOST_PP_REPEAT_3_931(m, d) m(4, 931, d)
-# define BOOST_PP_REPEAT_3_933(m, d) BOOST_PP_REPEAT_3_932(m, d) m(4, 932, d)
-# define BOOST_PP_REPEAT_3_934(m, d) BOOST_PP_REPEAT_3_933(m, d) m(4, 933, d)
-# define BOOST_PP_REPEAT_3_935(m, d) BOOST_PP_REPEAT_3_934(m, d) m(4, 934, d)
-# define BOOST_PP_REPEAT_3_936(m, d) BOOST_PP_REPEAT_3_935(m, d) m(4, 935, d)
-# define BOOST_PP_REPEAT_3_937(m, d) BOOST_PP_REPEAT_3_936(m, d) m(4, 936, d)
-# define BOOST_PP_REPEAT_3_938(m, d) BOOST_PP_REPEAT_3_937(m, d) m(4, 937, d)
-# define BOOST_PP_REPEAT_3_939(m, d) BOOST_PP_REPEAT_3_938(m, d) m(4, 938, d)
-# define BOOST_PP_REPEAT_3_940(m, d) BOOST_PP_REPEAT_3_939(m, d) m(4, 939, d)
-# define BOOST_PP_REPEAT_3_941(m, d) BOOST_PP_REPEAT_3_940(m, d) m(4, 940, d)
-# define BOOST_PP_REPEAT_3_942(m, d) BOOST_PP_REPEAT_3_941(m, d) m(4, 941, d)
-# define BOOST_PP_REPEAT_3_943(m, d) BOOST_PP_REPEAT_3_942(m, d) m(4, 942, d)
-# define BOOST_PP_REPEAT_3_944(m, d) BOOST_PP_REPEAT_3_943(m, d) m(4, 943, d)
-# define BOOST_PP_REPEAT_3_945(m, d) BOOST_PP_REPEAT_3_944(m, d) m(4, 944, d)
-# define BOOST_PP_REPEAT_3_946(m, d) BOOST_PP_REPEAT_3_945(m, d) m(4, 945, d)
-# define BOOST_PP_REPEAT_3_947(m, d) BOOST_PP_REPEAT_3_946(m, d) m(4, 946, d)
-# define BOOST_PP_REPEAT_3_948(m, d) BOOST_PP_REPEAT_3_947(m, d) m(4, 947, d)
-# define BOOST_PP_REPEAT_3_949(m, d) BOOST_PP_REPEAT_3_948(m, d) m(4, 948, d)
-# define BOOST_PP_REPEAT_3_950(m, d) BOOST_PP_REPEAT_3_949(m, d) m(4, 949, d)
-# define BOOST_PP_REPEAT_3_951(m, d) BOOST_PP_REPEAT_3_950(m, d) m(4, 950, d)
-# define BOOST_PP_REPEAT_3_952(m, d) BOOST_PP_REPEAT_3_951(m, d) m(4, 951, d)
-# define BOOST_PP_REPEAT_3_953(m, d) BOOST_PP_REPEAT_3_952(m, d) m(4, 952, d)
-# define BOOST_PP_REPEAT_3_954(m, d) BOOST_PP_REPEAT_3_953(m, d) m(4, 953, d)
-# define BOOST_PP_REPEAT_3_955(m, d) BOOST_PP_REPEAT_3_954(m, d) m(4, 954, d)
-# define BOOST_PP_REPEAT_3_956(m, d) BOOST_PP_REPEAT_3_955(m, d) m(4, 955, d)
-# define BOOST_PP_REPEAT_3_957(m, d) BOOST_PP_REPEAT_3_956(m, d) m(4, 956, d)
-# define BOOST_PP_REPEAT_3_958(m, d) BOOST_PP_REPEAT_3_957(m, d) m(4, 957, d)
-# define BOOST_PP_REPEAT_3_959(m, d) BOOST_PP_REPEAT_3_958(m, d) m(4, 958, d)
-# define BOOST_PP_REPEAT_3_960(m, d) BOOST_PP_REPEAT_3_959(m, d) m(4, 959, d)
-# define BOOST_PP_REPEAT_3_961(m, d) BOOST_PP_REPEAT_3_960(m, d) m(4, 960, d)
-# define BOOST_PP_REPEAT_3_962(m, d) BOOST_PP_REPEAT_3_961(m, d) m(4, 961, d)
-# define BOOST_PP_REPEAT_3_963(m, d) BOOST_PP_REPEAT_3_962(m, d) m(4, 962, d)
-# define BOOST_PP_REPEAT_3_964(m, d) BOOST_PP_REPEAT_3_963(m, d) m(4, 963, d)
-# define BOOST_PP_REPEAT_3_965(m, d) BOOST_PP_REPEAT_3_964(m, d) m(4, 964, d)
-# define BOOST_PP_REPEAT_3_966(m, d) BOOST_PP_REPEAT_3_965(m, d) m(4, 965, d)
-# define BOOST_PP_REPEAT_3_967(m, d) BOOST_PP_REPEAT_3_966(m, d) m(4, 966, d)
-# define BOOST_PP_REPEAT_3_968(m, d) BOOST_PP_REPEAT_3_967(m, d) m(4, 967, d)
-# define BOOST_PP_REPEAT_3_969(m, d) BOOST_PP_REPEAT_3_968(m, d) m(4, 968, d)
-# define BOOST_PP_REPEAT_3_970(m, d) BOOST_PP_REPEAT_3_969(m, d) m(4, 969, d)
-# define BOOST_PP_REPEAT_3_971(m, d) BOOST_PP_REPEAT_3_970(m, d) m(4, 970, d)
-# define BOOST_PP_REPEAT_3_972(m, d) BOOST_PP_REPEAT_3_971(m, d) m(4, 971, d)
-# define BOOST_PP_REPEAT_3_973(m, d) BOOST_PP_REPEAT_3_972(m, d) m(4, 972, d)
-# define BOOST_PP_REPEAT_3_974(m, d) BOOST_PP_REPEAT_3_973(m, d) m(4, 973, d)
-# define BOOST_PP_REPEAT_3_975(m, d) BOOST_PP_REPEAT_3_974(m, d) m(4, 974, d)
-# define BOOST_PP_REPEAT_3_976(m, d) BOOST_PP_REPEAT_3_975(m, d) m(4, 975, d)
-# define BOOST_PP_REPEAT_3_977(m, d) BOOST_PP_REPEAT_3_976(m, d) m(4, 976, d)
-# define BOOST_PP_REPEAT_3_978(m, d) BOOST_PP_REPEAT_3_977(m, d) m(4, 977, d)
-# define BOOST_PP_REPEAT_3_979(m, d) BOOST_PP_REPEAT_3_978(m, d) m(4, 978, d)
-# define BOOST_PP_REPEAT_3_980(m, d) BOOST_PP_REPEAT_3_979(m, d) m(4, 979, d)
-# define BOOST_PP_REPEAT_3_981(m, d) BOOST_PP_REPEAT_3_980(m, d) m(4, 980, d)
-# define BOOST_PP_REPEAT_3_982(m, d) BOOST_PP_REPEAT_3_981(m, d) m(4, 981, d)
-# define BOOST_PP_REPEAT_3_983(m, d) BOOST_PP_REPEAT_3_982(m, d) m(4, 982, d)
-# define BOOST_PP_REPEAT_3_984(m, d) BOOST_PP_REPEAT_3_983(m, d) m(4, 983, d)
-# define BOOST_PP_REPEAT_3_985(m, d) BOOST_PP_REPEAT_3_984(m, d) m(4, 984, d)
-# define BOOST_PP_REPEAT_3_986(m, d) BOOST_PP_REPEAT_3_985(m, d) m(4, 985, d)
-# define BOOST_PP_REPEAT_3_987(m, d) BOOST_PP_REPEAT_3_986(m, d) m(4, 986, d)
-# define BOOST_PP_REPEAT_3_988(m, d) BOOST_PP_REPEAT_3_987(m, d) m(4, 987, d)
-# define BOOST_PP_REPEAT_3_989(m, d) BOOST_PP_REPEAT_3_988(m, d) m(4, 988, d)
-# define BOOST_PP_REPEAT_3_990(m, d) BOOST_PP_REPEAT_3_989(m, d) m(4, 989, d)
-# define BOOST_PP_REPEAT_3_991(m, d) BOOST_PP_REPEAT_3_990(m, d) m(4, 990, d)
-# define BOOST_PP_REPEAT_3_992(m, d) BOOST_PP_REPEAT_3_991(m, d) m(4, 991, d)
-# define BOOST_PP_REPEAT_3_993(m, d) BOOST_PP_REPEAT_3_992(m, d) m(4, 992, d)
-# define BOOST_PP_REPEAT_3_994(m, d) BOOST_PP_REPEAT_3_993(m, d) m(4, 993, d)
-# define BOOST_PP_REPEAT_3_995(m, d) BOOST_PP_REPEAT_3_994(m, d) m(4, 994, d)
-# define BOOST_PP_REPEAT_3_996(m, d) BOOST_PP_REPEAT_3_995(m, d) m(4, 995, d)
-# define BOOST_PP_REPEAT_3_997(m, d) BOOST_PP_REPEAT_3_996(m, d) m(4, 996, d)
-# define BOOST_PP_REPEAT_3_998(m, d) BOOST_PP_REPEAT_3_997(m, d) m(4, 997, d)
-# define BOOST_PP_REPEAT_3_999(m, d) BOOST_PP_REPEAT_3_998(m, d) m(4, 998, d)
-# define BOOST_PP_REPEAT_3_1000(m, d) BOOST_PP_REPEAT_3_999(m, d) m(4, 999, d)
-# define BOOST_PP_REPEAT_3_1001(m, d) BOOST_PP_REPEAT_3_1000(m, d) m(4, 1000, d)
-# define BOOST_PP_REPEAT_3_1002(m, d) BOOST_PP_REPEAT_3_1001(m, d) m(4, 1001, d)
-# define BOOST_PP_REPEAT_3_1003(m, d) BOOST_PP_REPEAT_3_1002(m, d) m(4, 1002, d)
-# define BOOST_PP_REPEAT_3_1004(m, d) BOOST_PP_REPEAT_3_1003(m, d) m(4, 1003, d)
-# define BOOST_PP_REPEAT_3_1005(m, d) BOOST_PP_REPEAT_3_1004(m, d) m(4, 1004, d)
-# define BOOST_PP_REPEAT_3_1006(m, d) BOOST_PP_REPEAT_3_1005(m, d) m(4, 1005, d)
-# define BOOST_PP_REPEAT_3_1007(m, d) BOOST_PP_REPEAT_3_1006(m, d) m(4, 1006, d)
-# define BOOST_PP_REPEAT_3_1008(m, d) BOOST_PP_REPEAT_3_1007(m, d) m(4, 1007, d)
-# define BOOST_PP_REPEAT_3_1009(m, d) BOOST_PP_REPEAT_3_1008(m, d) m(4, 1008, d)
-# define BOOST_PP_REPEAT_3_1010(m, d) BOOST_PP_REPEAT_3_1009(m, d) m(4, 1009, d)
-# define BOOST_PP_REPEAT_3_1011(m, d) BOOST_PP_REPEAT_3_1010(m, d) m(4, 1010, d)
-# define BOOST_PP_REPEAT_3_1012(m, d) BOOST_PP_REPEAT_3_1011(m, d) m(4, 1011, d)
-# define BOOST_PP_REPEAT_3_1013(m, d) BOOST_PP_REPEAT_3_1012(m, d) m(4, 1012, d)
-# define BOOST_PP_REPEAT_3_1014(m, d) BOOST_PP_REPEAT_3_1013(m, d) m(4, 1013, d)
-# define BOOST_PP_REPEAT_3_1015(m, d) BOOST_PP_REPEAT_3_1014(m, d) m(4, 1014, d)
-# define BOOST_PP_REPEAT_3_1016(m, d) BOOST_PP_REPEAT_3_1015(m, d) m(4, 1015, d)
-# define BOOST_PP_REPEAT_3_1017(m, d) BOOST_PP_REPEAT_3_1016(m, d) m(4, 1016, d)
-# define BOOST_PP_REPEAT_3_1018(m, d) BOOST_PP_REPEAT_3_1017(m, d) m(4, 1017, d)
-# define BOOST_PP_REPEAT_3_1019(m, d) BOOST_PP_REPEAT_3_1018(m, d) m(4, 1018, d)
-# define BOOST_PP_REPEAT_3_1020(m, d) BOOST_PP_REPEAT_3_1019(m, d) m(4, 1019, d)
-# define BOOST_PP_REPEAT_3_1021(m, d) BOOST_PP_REPEAT_3_1020(m, d) m(4, 1020, d)
-# define BOOST_PP_REPEAT_3_1022(m, d) BOOST_PP_REPEAT_3_1021(m, d) m(4, 1021, d)
-# define BOOST_PP_REPEAT_3_1023(m, d) BOOST_PP_REPEAT_3_1022(m, d) m(4, 1022, d)
-# define BOOST_PP_REPEAT_3_1024(m, d) BOOST_PP_REPEAT_3_1023(m, d) m(4, 1023, d)
-#
-# endif
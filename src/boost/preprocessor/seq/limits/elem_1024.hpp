@@ -1,530 +0,0 @@
-# /* **************************************************************************
-#  *                                                                          *
-#  *     (C) Copyright Paul Mensonides 2002.
-#  *     Distributed under the Boost Software License, Version 1.0. (See
-#  *     accompanying file LICENSE_1_0.txt or copy at
-#  *     http://www.boost.org/LICENSE_1_0.txt)
-#  *                                                                          *
-#  ************************************************************************** */
-#
-# /* Revised by Edward Diener (2020) */
-#
-# /* See http://www.boost.org for most recent version. */
-#
-# ifndef BOOST_PREPROCESSOR_SEQ_ELEM_1024_HPP
-# define BOOST_PREPROCESSOR_SEQ_ELEM_1024_HPP
-#
-# define BOOST_PP_SEQ_ELEM_512(_) BOOST_PP_SEQ_ELEM_511
-# define BOOST_PP_SEQ_ELEM_513(_) BOOST_PP_SEQ_ELEM_512
-# define BOOST_PP_SEQ_ELEM_514(_) BOOST_PP_SEQ_ELEM_513
-# define BOOST_PP_SEQ_ELEM_515(_) BOOST_PP_SEQ_ELEM_514
-# define BOOST_PP_SEQ_ELEM_516(_) BOOST_PP_SEQ_ELEM_515
-# define BOOST_PP_SEQ_ELEM_517(_) BOOST_PP_SEQ_ELEM_516
-# define BOOST_PP_SEQ_ELEM_518(_) BOOST_PP_SEQ_ELEM_517
-# define BOOST_PP_SEQ_ELEM_519(_) BOOST_PP_SEQ_ELEM_518
-# define BOOST_PP_SEQ_ELEM_520(_) BOOST_PP_SEQ_ELEM_519
-# define BOOST_PP_SEQ_ELEM_521(_) BOOST_PP_SEQ_ELEM_520
-# define BOOST_PP_SEQ_ELEM_522(_) BOOST_PP_SEQ_ELEM_521
-# define BOOST_PP_SEQ_ELEM_523(_) BOOST_PP_SEQ_ELEM_522
-# define BOOST_PP_SEQ_ELEM_524(_) BOOST_PP_SEQ_ELEM_523
-# define BOOST_PP_SEQ_ELEM_525(_) BOOST_PP_SEQ_ELEM_524
-# define BOOST_PP_SEQ_ELEM_526(_) BOOST_PP_SEQ_ELEM_525
-# define BOOST_PP_SEQ_ELEM_527(_) BOOST_PP_SEQ_ELEM_526
-# define BOOST_PP_SEQ_ELEM_528(_) BOOST_PP_SEQ_ELEM_527
-# define BOOST_PP_SEQ_ELEM_529(_) BOOST_PP_SEQ_ELEM_528
-# define BOOST_PP_SEQ_ELEM_530(_) BOOST_PP_SEQ_ELEM_529
-# define BOOST_PP_SEQ_ELEM_531(_) BOOST_PP_SEQ_ELEM_530
-# define BOOST_PP_SEQ_ELEM_532(_) BOOST_PP_SEQ_ELEM_531
-# define BOOST_PP_SEQ_ELEM_533(_) BOOST_PP_SEQ_ELEM_532
-# define BOOST_PP_SEQ_ELEM_534(_) BOOST_PP_SEQ_ELEM_533
-# define BOOST_PP_SEQ_ELEM_535(_) BOOST_PP_SEQ_ELEM_534
-# define BOOST_PP_SEQ_ELEM_536(_) BOOST_PP_SEQ_ELEM_535
-# define BOOST_PP_SEQ_ELEM_537(_) BOOST_PP_SEQ_ELEM_536
-# define BOOST_PP_SEQ_ELEM_538(_) BOOST_PP_SEQ_ELEM_537
-# define BOOST_PP_SEQ_ELEM_539(_) BOOST_PP_SEQ_ELEM_538
-# define BOOST_PP_SEQ_ELEM_540(_) BOOST_PP_SEQ_ELEM_539
-# define BOOST_PP_SEQ_ELEM_541(_) BOOST_PP_SEQ_ELEM_540
-# define BOOST_PP_SEQ_ELEM_542(_) BOOST_PP_SEQ_ELEM_541
-# define BOOST_PP_SEQ_ELEM_543(_) BOOST_PP_SEQ_ELEM_542
-# define BOOST_PP_SEQ_ELEM_544(_) BOOST_PP_SEQ_ELEM_543
-# define BOOST_PP_SEQ_ELEM_545(_) BOOST_PP_SEQ_ELEM_544
-# define BOOST_PP_SEQ_ELEM_546(_) BOOST_PP_SEQ_ELEM_545
-# define BOOST_PP_SEQ_ELEM_547(_) BOOST_PP_SEQ_ELEM_546
-# define BOOST_PP_SEQ_ELEM_548(_) BOOST_PP_SEQ_ELEM_547
-# define BOOST_PP_SEQ_ELEM_549(_) BOOST_PP_SEQ_ELEM_548
-# define BOOST_PP_SEQ_ELEM_550(_) BOOST_PP_SEQ_ELEM_549
-# define BOOST_PP_SEQ_ELEM_551(_) BOOST_PP_SEQ_ELEM_550
-# define BOOST_PP_SEQ_ELEM_552(_) BOOST_PP_SEQ_ELEM_551
-# define BOOST_PP_SEQ_ELEM_553(_) BOOST_PP_SEQ_ELEM_552
-# define BOOST_PP_SEQ_ELEM_554(_) BOOST_PP_SEQ_ELEM_553
-# define BOOST_PP_SEQ_ELEM_555(_) BOOST_PP_SEQ_ELEM_554
-# define BOOST_PP_SEQ_ELEM_556(_) BOOST_PP_SEQ_ELEM_555
-# define BOOST_PP_SEQ_ELEM_557(_) BOOST_PP_SEQ_ELEM_556
-# define BOOST_PP_SEQ_ELEM_558(_) BOOST_PP_SEQ_ELEM_557
-# define BOOST_PP_SEQ_ELEM_559(_) BOOST_PP_SEQ_ELEM_558
-# define BOOST_PP_SEQ_ELEM_560(_) BOOST_PP_SEQ_ELEM_559
-# define BOOST_PP_SEQ_ELEM_561(_) BOOST_PP_SEQ_ELEM_560
-# define BOOST_PP_SEQ_ELEM_562(_) BOOST_PP_SEQ_ELEM_561
-# define BOOST_PP_SEQ_ELEM_563(_) BOOST_PP_SEQ_ELEM_562
-# define BOOST_PP_SEQ_ELEM_564(_) BOOST_PP_SEQ_ELEM_563
-# define BOOST_PP_SEQ_ELEM_565(_) BOOST_PP_SEQ_ELEM_564
-# define BOOST_PP_SEQ_ELEM_566(_) BOOST_PP_SEQ_ELEM_565
-# define BOOST_PP_SEQ_ELEM_567(_) BOOST_PP_SEQ_ELEM_566
-# define BOOST_PP_SEQ_ELEM_568(_) BOOST_PP_SEQ_ELEM_567
-# define BOOST_PP_SEQ_ELEM_569(_) BOOST_PP_SEQ_ELEM_568
-# define BOOST_PP_SEQ_ELEM_570(_) BOOST_PP_SEQ_ELEM_569
-# define BOOST_PP_SEQ_ELEM_571(_) BOOST_PP_SEQ_ELEM_570
-# define BOOST_PP_SEQ_ELEM_572(_) BOOST_PP_SEQ_ELEM_571
-# define BOOST_PP_SEQ_ELEM_573(_) BOOST_PP_SEQ_ELEM_572
-# define BOOST_PP_SEQ_ELEM_574(_) BOOST_PP_SEQ_ELEM_573
-# define BOOST_PP_SEQ_ELEM_575(_) BOOST_PP_SEQ_ELEM_574
-# define BOOST_PP_SEQ_ELEM_576(_) BOOST_PP_SEQ_ELEM_575
-# define BOOST_PP_SEQ_ELEM_577(_) BOOST_PP_SEQ_ELEM_576
-# define BOOST_PP_SEQ_ELEM_578(_) BOOST_PP_SEQ_ELEM_577
-# define BOOST_PP_SEQ_ELEM_579(_) BOOST_PP_SEQ_ELEM_578
-# define BOOST_PP_SEQ_ELEM_580(_) BOOST_PP_SEQ_ELEM_579
-# define BOOST_PP_SEQ_ELEM_581(_) BOOST_PP_SEQ_ELEM_580
-# define BOOST_PP_SEQ_ELEM_582(_) BOOST_PP_SEQ_ELEM_581
-# define BOOST_PP_SEQ_ELEM_583(_) BOOST_PP_SEQ_ELEM_582
-# define BOOST_PP_SEQ_ELEM_584(_) BOOST_PP_SEQ_ELEM_583
-# define BOOST_PP_SEQ_ELEM_585(_) BOOST_PP_SEQ_ELEM_584
-# define BOOST_PP_SEQ_ELEM_586(_) BOOST_PP_SEQ_ELEM_585
-# define BOOST_PP_SEQ_ELEM_587(_) BOOST_PP_SEQ_ELEM_586
-# define BOOST_PP_SEQ_ELEM_588(_) BOOST_PP_SEQ_ELEM_587
-# define BOOST_PP_SEQ_ELEM_589(_) BOOST_PP_SEQ_ELEM_588
-# define BOOST_PP_SEQ_ELEM_590(_) BOOST_PP_SEQ_ELEM_589
-# define BOOST_PP_SEQ_ELEM_591(_) BOOST_PP_SEQ_ELEM_590
-# define BOOST_PP_SEQ_ELEM_592(_) BOOST_PP_SEQ_ELEM_591
-# define BOOST_PP_SEQ_ELEM_593(_) BOOST_PP_SEQ_ELEM_592
-# define BOOST_PP_SEQ_ELEM_594(_) BOOST_PP_SEQ_ELEM_593
-# define BOOST_PP_SEQ_ELEM_595(_) BOOST_PP_SEQ_ELEM_594
-# define BOOST_PP_SEQ_ELEM_596(_) BOOST_PP_SEQ_ELEM_595
-# define BOOST_PP_SEQ_ELEM_597(_) BOOST_PP_SEQ_ELEM_596
-# define BOOST_PP_SEQ_ELEM_598(_) BOOST_PP_SEQ_ELEM_597
-# define BOOST_PP_SEQ_ELEM_599(_) BOOST_PP_SEQ_ELEM_598
-# define BOOST_PP_SEQ_ELEM_600(_) BOOST_PP_SEQ_ELEM_599
-# define BOOST_PP_SEQ_ELEM_601(_) BOOST_PP_SEQ_ELEM_600
-# define BOOST_PP_SEQ_ELEM_602(_) BOOST_PP_SEQ_ELEM_601
-# define BOOST_PP_SEQ_ELEM_603(_) BOOST_PP_SEQ_ELEM_602
-# define BOOST_PP_SEQ_ELEM_604(_) BOOST_PP_SEQ_ELEM_603
-# define BOOST_PP_SEQ_ELEM_605(_) BOOST_PP_SEQ_ELEM_604
-# define BOOST_PP_SEQ_ELEM_606(_) BOOST_PP_SEQ_ELEM_605
-# define BOOST_PP_SEQ_ELEM_607(_) BOOST_PP_SEQ_ELEM_606
-# define BOOST_PP_SEQ_ELEM_608(_) BOOST_PP_SEQ_ELEM_607
-# define BOOST_PP_SEQ_ELEM_609(_) BOOST_PP_SEQ_ELEM_608
-# define BOOST_PP_SEQ_ELEM_610(_) BOOST_PP_SEQ_ELEM_609
-# define BOOST_PP_SEQ_ELEM_611(_) BOOST_PP_SEQ_ELEM_610
-# define BOOST_PP_SEQ_ELEM_612(_) BOOST_PP_SEQ_ELEM_611
-# define BOOST_PP_SEQ_ELEM_613(_) BOOST_PP_SEQ_ELEM_612
-# define BOOST_PP_SEQ_ELEM_614(_) BOOST_PP_SEQ_ELEM_613
-# define BOOST_PP_SEQ_ELEM_615(_) BOOST_PP_SEQ_ELEM_614
-# define BOOST_PP_SEQ_ELEM_616(_) BOOST_PP_SEQ_ELEM_615
-# define BOOST_PP_SEQ_ELEM_617(_) BOOST_PP_SEQ_ELEM_616
-# define BOOST_PP_SEQ_ELEM_618(_) BOOST_PP_SEQ_ELEM_617
-# define BOOST_PP_SEQ_ELEM_619(_) BOOST_PP_SEQ_ELEM_618
-# define BOOST_PP_SEQ_ELEM_620(_) BOOST_PP_SEQ_ELEM_619
-# define BOOST_PP_SEQ_ELEM_621(_) BOOST_PP_SEQ_ELEM_620
-# define BOOST_PP_SEQ_ELEM_622(_) BOOST_PP_SEQ_ELEM_621
-# define BOOST_PP_SEQ_ELEM_623(_) BOOST_PP_SEQ_ELEM_622
-# define BOOST_PP_SEQ_ELEM_624(_) BOOST_PP_SEQ_ELEM_623
-# define BOOST_PP_SEQ_ELEM_625(_) BOOST_PP_SEQ_ELEM_624
-# define BOOST_PP_SEQ_ELEM_626(_) BOOST_PP_SEQ_ELEM_625
-# define BOOST_PP_SEQ_ELEM_627(_) BOOST_PP_SEQ_ELEM_626
-# define BOOST_PP_SEQ_ELEM_628(_) BOOST_PP_SEQ_ELEM_627
-# define BOOST_PP_SEQ_ELEM_629(_) BOOST_PP_SEQ_ELEM_628
-# define BOOST_PP_SEQ_ELEM_630(_) BOOST_PP_SEQ_ELEM_629
-# define BOOST_PP_SEQ_ELEM_631(_) BOOST_PP_SEQ_ELEM_630
-# define BOOST_PP_SEQ_ELEM_632(_) BOOST_PP_SEQ_ELEM_631
-# define BOOST_PP_SEQ_ELEM_633(_) BOOST_PP_SEQ_ELEM_632
-# define BOOST_PP_SEQ_ELEM_634(_) BOOST_PP_SEQ_ELEM_633
-# define BOOST_PP_SEQ_ELEM_635(_) BOOST_PP_SEQ_ELEM_634
-# define BOOST_PP_SEQ_ELEM_636(_) BOOST_PP_SEQ_ELEM_635
-# define BOOST_PP_SEQ_ELEM_637(_) BOOST_PP_SEQ_ELEM_636
-# define BOOST_PP_SEQ_ELEM_638(_) BOOST_PP_SEQ_ELEM_637
-# define BOOST_PP_SEQ_ELEM_639(_) BOOST_PP_SEQ_ELEM_638
-# define BOOST_PP_SEQ_ELEM_640(_) BOOST_PP_SEQ_ELEM_639
-# define BOOST_PP_SEQ_ELEM_641(_) BOOST_PP_SEQ_ELEM_640
-# define BOOST_PP_SEQ_ELEM_642(_) BOOST_PP_SEQ_ELEM_641
-# define BOOST_PP_SEQ_ELEM_643(_) BOOST_PP_SEQ_ELEM_642
-# define BOOST_PP_SEQ_ELEM_644(_) BOOST_PP_SEQ_ELEM_643
-# define BOOST_PP_SEQ_ELEM_645(_) BOOST_PP_SEQ_ELEM_644
-# define BOOST_PP_SEQ_ELEM_646(_) BOOST_PP_SEQ_ELEM_645
-# define BOOST_PP_SEQ_ELEM_647(_) BOOST_PP_SEQ_ELEM_646
-# define BOOST_PP_SEQ_ELEM_648(_) BOOST_PP_SEQ_ELEM_647
-# define BOOST_PP_SEQ_ELEM_649(_) BOOST_PP_SEQ_ELEM_648
-# define BOOST_PP_SEQ_ELEM_650(_) BOOST_PP_SEQ_ELEM_649
-# define BOOST_PP_SEQ_ELEM_651(_) BOOST_PP_SEQ_ELEM_650
-# define BOOST_PP_SEQ_ELEM_652(_) BOOST_PP_SEQ_ELEM_651
-# define BOOST_PP_SEQ_ELEM_653(_) BOOST_PP_SEQ_ELEM_652
-# define BOOST_PP_SEQ_ELEM_654(_) BOOST_PP_SEQ_ELEM_653
-# define BOOST_PP_SEQ_ELEM_655(_) BOOST_PP_SEQ_ELEM_654
-# define BOOST_PP_SEQ_ELEM_656(_) BOOST_PP_SEQ_ELEM_655
-# define BOOST_PP_SEQ_ELEM_657(_) BOOST_PP_SEQ_ELEM_656
-# define BOOST_PP_SEQ_ELEM_658(_) BOOST_PP_SEQ_ELEM_657
-# define BOOST_PP_SEQ_ELEM_659(_) BOOST_PP_SEQ_ELEM_658
-# define BOOST_PP_SEQ_ELEM_660(_) BOOST_PP_SEQ_ELEM_659
-# define BOOST_PP_SEQ_ELEM_661(_) BOOST_PP_SEQ_ELEM_660
-# define BOOST_PP_SEQ_ELEM_662(_) BOOST_PP_SEQ_ELEM_661
-# define BOOST_PP_SEQ_ELEM_663(_) BOOST_PP_SEQ_ELEM_662
-# define BOOST_PP_SEQ_ELEM_664(_) BOOST_PP_SEQ_ELEM_663
-# define BOOST_PP_SEQ_ELEM_665(_) BOOST_PP_SEQ_ELEM_664
-# define BOOST_PP_SEQ_ELEM_666(_) BOOST_PP_SEQ_ELEM_665
-# define BOOST_PP_SEQ_ELEM_667(_) BOOST_PP_SEQ_ELEM_666
-# define BOOST_PP_SEQ_ELEM_668(_) BOOST_PP_SEQ_ELEM_667
-# define BOOST_PP_SEQ_ELEM_669(_) BOOST_PP_SEQ_ELEM_668
-# define BOOST_PP_SEQ_ELEM_670(_) BOOST_PP_SEQ_ELEM_669
-# define BOOST_PP_SEQ_ELEM_671(_) BOOST_PP_SEQ_ELEM_670
-# define BOOST_PP_SEQ_ELEM_672(_) BOOST_PP_SEQ_ELEM_671
-# define BOOST_PP_SEQ_ELEM_673(_) BOOST_PP_SEQ_ELEM_672
-# define BOOST_PP_SEQ_ELEM_674(_) BOOST_PP_SEQ_ELEM_673
-# define BOOST_PP_SEQ_ELEM_675(_) BOOST_PP_SEQ_ELEM_674
-# define BOOST_PP_SEQ_ELEM_676(_) BOOST_PP_SEQ_ELEM_675
-# define BOOST_PP_SEQ_ELEM_677(_) BOOST_PP_SEQ_ELEM_676
-# define BOOST_PP_SEQ_ELEM_678(_) BOOST_PP_SEQ_ELEM_677
-# define BOOST_PP_SEQ_ELEM_679(_) BOOST_PP_SEQ_ELEM_678
-# define BOOST_PP_SEQ_ELEM_680(_) BOOST_PP_SEQ_ELEM_679
-# define BOOST_PP_SEQ_ELEM_681(_) BOOST_PP_SEQ_ELEM_680
-# define BOOST_PP_SEQ_ELEM_682(_) BOOST_PP_SEQ_ELEM_681
-# define BOOST_PP_SEQ_ELEM_683(_) BOOST_PP_SEQ_ELEM_682
-# define BOOST_PP_SEQ_ELEM_684(_) BOOST_PP_SEQ_ELEM_683
-# define BOOST_PP_SEQ_ELEM_685(_) BOOST_PP_SEQ_ELEM_684
-# define BOOST_PP_SEQ_ELEM_686(_) BOOST_PP_SEQ_ELEM_685
-# define BOOST_PP_SEQ_ELEM_687(_) BOOST_PP_SEQ_ELEM_686
-# define BOOST_PP_SEQ_ELEM_688(_) BOOST_PP_SEQ_ELEM_687
-# define BOOST_PP_SEQ_ELEM_689(_) BOOST_PP_SEQ_ELEM_688
-# define BOOST_PP_SEQ_ELEM_690(_) BOOST_PP_SEQ_ELEM_689
-# define BOOST_PP_SEQ_ELEM_691(_) BOOST_PP_SEQ_ELEM_690
-# define BOOST_PP_SEQ_ELEM_692(_) BOOST_PP_SEQ_ELEM_691
-# define BOOST_PP_SEQ_ELEM_693(_) BOOST_PP_SEQ_ELEM_692
-# define BOOST_PP_SEQ_ELEM_694(_) BOOST_PP_SEQ_ELEM_693
-# define BOOST_PP_SEQ_ELEM_695(_) BOOST_PP_SEQ_ELEM_694
-# define BOOST_PP_SEQ_ELEM_696(_) BOOST_PP_SEQ_ELEM_695
-# define BOOST_PP_SEQ_ELEM_697(_) BOOST_PP_SEQ_ELEM_696
-# define BOOST_PP_SEQ_ELEM_698(_) BOOST_PP_SEQ_ELEM_697
-# define BOOST_PP_SEQ_ELEM_699(_) BOOST_PP_SEQ_ELEM_698
-# define BOOST_PP_SEQ_ELEM_700(_) BOOST_PP_SEQ_ELEM_699
-# define BOOST_PP_SEQ_ELEM_701(_) BOOST_PP_SEQ_ELEM_700
-# define BOOST_PP_SEQ_ELEM_702(_) BOOST_PP_SEQ_ELEM_701
-# define BOOST_PP_SEQ_ELEM_703(_) BOOST_PP_SEQ_ELEM_702
-# define BOOST_PP_SEQ_ELEM_704(_) BOOST_PP_SEQ_ELEM_703
-# define BOOST_PP_SEQ_ELEM_705(_) BOOST_PP_SEQ_ELEM_704
-# define BOOST_PP_SEQ_ELEM_706(_) BOOST_PP_SEQ_ELEM_705
-# define BOOST_PP_SEQ_ELEM_707(_) BOOST_PP_SEQ_ELEM_706
-# define BOOST_PP_SEQ_ELEM_708(_) BOOST_PP_SEQ_ELEM_707
-# define BOOST_PP_SEQ_ELEM_709(_) BOOST_PP_SEQ_ELEM_708
-# define BOOST_PP_SEQ_ELEM_710(_) BOOST_PP_SEQ_ELEM_709
-# define BOOST_PP_SEQ_ELEM_711(_) BOOST_PP_SEQ_ELEM_710
-# define BOOST_PP_SEQ_ELEM_712(_) BOOST_PP_SEQ_ELEM_711
-# define BOOST_PP_SEQ_ELEM_713(_) BOOST_PP_SEQ_ELEM_712
-# define BOOST_PP_SEQ_ELEM_714(_) BOOST_PP_SEQ_ELEM_713
-# define BOOST_PP_SEQ_ELEM_715(_) BOOST_PP_SEQ_ELEM_714
-# define BOOST_PP_SEQ_ELEM_716(_) BOOST_PP_SEQ_ELEM_715
-# define BOOST_PP_SEQ_ELEM_717(_) BOOST_PP_SEQ_ELEM_716
-# define BOOST_PP_SEQ_ELEM_718(_) BOOST_PP_SEQ_ELEM_717
-# define BOOST_PP_SEQ_ELEM_719(_) BOOST_PP_SEQ_ELEM_718
-# define BOOST_PP_SEQ_ELEM_720(_) BOOST_PP_SEQ_ELEM_719
-# define BOOST_PP_SEQ_ELEM_721(_) BOOST_PP_SEQ_ELEM_720
-# define BOOST_PP_SEQ_ELEM_722(_) BOOST_PP_SEQ_ELEM_721
-# define BOOST_PP_SEQ_ELEM_723(_) BOOST_PP_SEQ_ELEM_722
-# define BOOST_PP_SEQ_ELEM_724(_) BOOST_PP_SEQ_ELEM_723
-# define BOOST_PP_SEQ_ELEM_725(_) BOOST_PP_SEQ_ELEM_724
-# define BOOST_PP_SEQ_ELEM_726(_) BOOST_PP_SEQ_ELEM_725
-# define BOOST_PP_SEQ_ELEM_727(_) BOOST_PP_SEQ_ELEM_726
-# define BOOST_PP_SEQ_ELEM_728(_) BOOST_PP_SEQ_ELEM_727
-# define BOOST_PP_SEQ_ELEM_729(_) BOOST_PP_SEQ_ELEM_728
-# define BOOST_PP_SEQ_ELEM_730(_) BOOST_PP_SEQ_ELEM_729
-# define BOOST_PP_SEQ_ELEM_731(_) BOOST_PP_SEQ_ELEM_730
-# define BOOST_PP_SEQ_ELEM_732(_) BOOST_PP_SEQ_ELEM_731
-# define BOOST_PP_SEQ_ELEM_733(_) BOOST_PP_SEQ_ELEM_732
-# define BOOST_PP_SEQ_ELEM_734(_) BOOST_PP_SEQ_ELEM_733
-# define BOOST_PP_SEQ_ELEM_735(_) BOOST_PP_SEQ_ELEM_734
-# define BOOST_PP_SEQ_ELEM_736(_) BOOST_PP_SEQ_ELEM_735
-# define BOOST_PP_SEQ_ELEM_737(_) BOOST_PP_SEQ_ELEM_736
-# define BOOST_PP_SEQ_ELEM_738(_) BOOST_PP_SEQ_ELEM_737
-# define BOOST_PP_SEQ_ELEM_739(_) BOOST_PP_SEQ_ELEM_738
-# define BOOST_PP_SEQ_ELEM_740(_) BOOST_PP_SEQ_ELEM_739
-# define BOOST_PP_SEQ_ELEM_741(_) BOOST_PP_SEQ_ELEM_740
-# define BOOST_PP_SEQ_ELEM_742(_) BOOST_PP_SEQ_ELEM_741
-# define BOOST_PP_SEQ_ELEM_743(_) BOOST_PP_SEQ_ELEM_742
-# define BOOST_PP_SEQ_ELEM_744(_) BOOST_PP_SEQ_ELEM_743
-# define BOOST_PP_SEQ_ELEM_745(_) BOOST_PP_SEQ_ELEM_744
-# define BOOST_PP_SEQ_ELEM_746(_) BOOST_PP_SEQ_ELEM_745
-# define BOOST_PP_SEQ_ELEM_747(_) BOOST_PP_SEQ_ELEM_746
-# define BOOST_PP_SEQ_ELEM_748(_) BOOST_PP_SEQ_ELEM_747
-# define BOOST_PP_SEQ_ELEM_749(_) BOOST_PP_SEQ_ELEM_748
-# define BOOST_PP_SEQ_ELEM_750(_) BOOST_PP_SEQ_ELEM_749
-# define BOOST_PP_SEQ_ELEM_751(_) BOOST_PP_SEQ_ELEM_750
-# define BOOST_PP_SEQ_ELEM_752(_) BOOST_PP_SEQ_ELEM_751
-# define BOOST_PP_SEQ_ELEM_753(_) BOOST_PP_SEQ_ELEM_752
-# define BOOST_PP_SEQ_ELEM_754(_) BOOST_PP_SEQ_ELEM_753
-# define BOOST_PP_SEQ_ELEM_755(_) BOOST_PP_SEQ_ELEM_754
-# define BOOST_PP_SEQ_ELEM_756(_) BOOST_PP_SEQ_ELEM_755
-# define BOOST_PP_SEQ_ELEM_757(_) BOOST_PP_SEQ_ELEM_756
-# define BOOST_PP_SEQ_ELEM_758(_) BOOST_PP_SEQ_ELEM_757
-# define BOOST_PP_SEQ_ELEM_759(_) BOOST_PP_SEQ_ELEM_758
-# define BOOST_PP_SEQ_ELEM_760(_) BOOST_PP_SEQ_ELEM_759
-# define BOOST_PP_SEQ_ELEM_761(_) BOOST_PP_SEQ_ELEM_760
-# define BOOST_PP_SEQ_ELEM_762(_) BOOST_PP_SEQ_ELEM_761
-# define BOOST_PP_SEQ_ELEM_763(_) BOOST_PP_SEQ_ELEM_762
-# define BOOST_PP_SEQ_ELEM_764(_) BOOST_PP_SEQ_ELEM_763
-# define BOOST_PP_SEQ_ELEM_765(_) BOOST_PP_SEQ_ELEM_764
-# define BOOST_PP_SEQ_ELEM_766(_) BOOST_PP_SEQ_ELEM_765
-# define BOOST_PP_SEQ_ELEM_767(_) BOOST_PP_SEQ_ELEM_766
-# define BOOST_PP_SEQ_ELEM_768(_) BOOST_PP_SEQ_ELEM_767
-# define BOOST_PP_SEQ_ELEM_769(_) BOOST_PP_SEQ_ELEM_768
-# define BOOST_PP_SEQ_ELEM_770(_) BOOST_PP_SEQ_ELEM_769
-# define BOOST_PP_SEQ_ELEM_771(_) BOOST_PP_SEQ_ELEM_770
-# define BOOST_PP_SEQ_ELEM_772(_) BOOST_PP_SEQ_ELEM_771
-# define BOOST_PP_SEQ_ELEM_773(_) BOOST_PP_SEQ_ELEM_772
-# define BOOST_PP_SEQ_ELEM_774(_) BOOST_PP_SEQ_ELEM_773
-# define BOOST_PP_SEQ_ELEM_775(_) BOOST_PP_SEQ_ELEM_774
-# define BOOST_PP_SEQ_ELEM_776(_) BOOST_PP_SEQ_ELEM_775
-# define BOOST_PP_SEQ_ELEM_777(_) BOOST_PP_SEQ_ELEM_776
-# define BOOST_PP_SEQ_ELEM_778(_) BOOST_PP_SEQ_ELEM_777
-# define BOOST_PP_SEQ_ELEM_779(_) BOOST_PP_SEQ_ELEM_778
-# define BOOST_PP_SEQ_ELEM_780(_) BOOST_PP_SEQ_ELEM_779
-# define BOOST_PP_SEQ_ELEM_781(_) BOOST_PP_SEQ_ELEM_780
-# define BOOST_PP_SEQ_ELEM_782(_) BOOST_PP_SEQ_ELEM_781
-# define BOOST_PP_SEQ_ELEM_783(_) BOOST_PP_SEQ_ELEM_782
-# define BOOST_PP_SEQ_ELEM_784(_) BOOST_PP_SEQ_ELEM_783
-# define BOOST_PP_SEQ_ELEM_785(_) BOOST_PP_SEQ_ELEM_784
-# define BOOST_PP_SEQ_ELEM_786(_) BOOST_PP_SEQ_ELEM_785
-# define BOOST_PP_SEQ_ELEM_787(_) BOOST_PP_SEQ_ELEM_786
-# define BOOST_PP_SEQ_ELEM_788(_) BOOST_PP_SEQ_ELEM_787
-# define BOOST_PP_SEQ_ELEM_789(_) BOOST_PP_SEQ_ELEM_788
-# define BOOST_PP_SEQ_ELEM_790(_) BOOST_PP_SEQ_ELEM_789
-# define BOOST_PP_SEQ_ELEM_791(_) BOOST_PP_SEQ_ELEM_790
-# define BOOST_PP_SEQ_ELEM_792(_) BOOST_PP_SEQ_ELEM_791
-# define BOOST_PP_SEQ_ELEM_793(_) BOOST_PP_SEQ_ELEM_792
-# define BOOST_PP_SEQ_ELEM_794(_) BOOST_PP_SEQ_ELEM_793
-# define BOOST_PP_SEQ_ELEM_795(_) BOOST_PP_SEQ_ELEM_794
-# define BOOST_PP_SEQ_ELEM_796(_) BOOST_PP_SEQ_ELEM_795
-# define BOOST_PP_SEQ_ELEM_797(_) BOOST_PP_SEQ_ELEM_796
-# define BOOST_PP_SEQ_ELEM_798(_) BOOST_PP_SEQ_ELEM_797
-# define BOOST_PP_SEQ_ELEM_799(_) BOOST_PP_SEQ_ELEM_798
-# define BOOST_PP_SEQ_ELEM_800(_) BOOST_PP_SEQ_ELEM_799
-# define BOOST_PP_SEQ_ELEM_801(_) BOOST_PP_SEQ_ELEM_800
-# define BOOST_PP_SEQ_ELEM_802(_) BOOST_PP_SEQ_ELEM_801
-# define BOOST_PP_SEQ_ELEM_803(_) BOOST_PP_SEQ_ELEM_802
-# define BOOST_PP_SEQ_ELEM_804(_) BOOST_PP_SEQ_ELEM_803
-# define BOOST_PP_SEQ_ELEM_805(_) BOOST_PP_SEQ_ELEM_804
-# define BOOST_PP_SEQ_ELEM_806(_) BOOST_PP_SEQ_ELEM_805
-# define BOOST_PP_SEQ_ELEM_807(_) BOOST_PP_SEQ_ELEM_806
-# define BOOST_PP_SEQ_ELEM_808(_) BOOST_PP_SEQ_ELEM_807
-# define BOOST_PP_SEQ_ELEM_809(_) BOOST_PP_SEQ_ELEM_808
-# define BOOST_PP_SEQ_ELEM_810(_) BOOST_PP_SEQ_ELEM_809
-# define BOOST_PP_SEQ_ELEM_811(_) BOOST_PP_SEQ_ELEM_810
-# define BOOST_PP_SEQ_ELEM_812(_) BOOST_PP_SEQ_ELEM_811
-# define BOOST_PP_SEQ_ELEM_813(_) BOOST_PP_SEQ_ELEM_812
-# define BOOST_PP_SEQ_ELEM_814(_) BOOST_PP_SEQ_ELEM_813
-# define BOOST_PP_SEQ_ELEM_815(_) BOOST_PP_SEQ_ELEM_814
-# define BOOST_PP_SEQ_ELEM_816(_) BOOST_PP_SEQ_ELEM_815
-# define BOOST_PP_SEQ_ELEM_817(_) BOOST_PP_SEQ_ELEM_816
-# define BOOST_PP_SEQ_ELEM_818(_) BOOST_PP_SEQ_ELEM_817
-# define BOOST_PP_SEQ_ELEM_819(_) BOOST_PP_SEQ_ELEM_818
-# define BOOST_PP_SEQ_ELEM_820(_) BOOST_PP_SEQ_ELEM_819
-# define BOOST_PP_SEQ_ELEM_821(_) BOOST_PP_SEQ_ELEM_820
-# define BOOST_PP_SEQ_ELEM_822(_) BOOST_PP_SEQ_ELEM_821
-# define BOOST_PP_SEQ_ELEM_823(_) BOOST_PP_SEQ_ELEM_822
-# define BOOST_PP_SEQ_ELEM_824(_) BOOST_PP_SEQ_ELEM_823
-# define BOOST_PP_SEQ_ELEM_825(_) BOOST_PP_SEQ_ELEM_824
-# define BOOST_PP_SEQ_ELEM_826(_) BOOST_PP_SEQ_ELEM_825
-# define BOOST_PP_SEQ_ELEM_827(_) BOOST_PP_SEQ_ELEM_826
-# define BOOST_PP_SEQ_ELEM_828(_) BOOST_PP_SEQ_ELEM_827
-# define BOOST_PP_SEQ_ELEM_829(_) BOOST_PP_SEQ_ELEM_828
-# define BOOST_PP_SEQ_ELEM_830(_) BOOST_PP_SEQ_ELEM_829
-# define BOOST_PP_SEQ_ELEM_831(_) BOOST_PP_SEQ_ELEM_830
-# define BOOST_PP_SEQ_ELEM_832(_) BOOST_PP_SEQ_ELEM_831
-# define BOOST_PP_SEQ_ELEM_833(_) BOOST_PP_SEQ_ELEM_832
-# define BOOST_PP_SEQ_ELEM_834(_) BOOST_PP_SEQ_ELEM_833
-# define BOOST_PP_SEQ_ELEM_835(_) BOOST_PP_SEQ_ELEM_834
-# define BOOST_PP_SEQ_ELEM_836(_) BOOST_PP_SEQ_ELEM_835
-# define BOOST_PP_SEQ_ELEM_837(_) BOOST_PP_SEQ_ELEM_836
-# define BOOST_PP_SEQ_ELEM_838(_) BOOST_PP_SEQ_ELEM_837
-# define BOOST_PP_SEQ_ELEM_839(_) BOOST_PP_SEQ_ELEM_838
-# define BOOST_PP_SEQ_ELEM_840(_) BOOST_PP_SEQ_ELEM_839
-# define BOOST_PP_SEQ_ELEM_841(_) BOOST_PP_SEQ_ELEM_840
-# define BOOST_PP_SEQ_ELEM_842(_) BOOST_PP_SEQ_ELEM_841
-# define BOOST_PP_SEQ_ELEM_843(_) BOOST_PP_SEQ_ELEM_842
-# define BOOST_PP_SEQ_ELEM_844(_) BOOST_PP_SEQ_ELEM_843
-# define BOOST_PP_SEQ_ELEM_845(_) BOOST_PP_SEQ_ELEM_844
-# define BOOST_PP_SEQ_ELEM_846(_) BOOST_PP_SEQ_ELEM_845
-# define BOOST_PP_SEQ_ELEM_847(_) BOOST_PP_SEQ_ELEM_846
-# define BOOST_PP_SEQ_ELEM_848(_) BOOST_PP_SEQ_ELEM_847
-# define BOOST_PP_SEQ_ELEM_849(_) BOOST_PP_SEQ_ELEM_848
-# define BOOST_PP_SEQ_ELEM_850(_) BOOST_PP_SEQ_ELEM_849
-# define BOOST_PP_SEQ_ELEM_851(_) BOOST_PP_SEQ_ELEM_850
-# define BOOST_PP_SEQ_ELEM_852(_) BOOST_PP_SEQ_ELEM_851
-# define BOOST_PP_SEQ_ELEM_853(_) BOOST_PP_SEQ_ELEM_852
-# define BOOST_PP_SEQ_ELEM_854(_) BOOST_PP_SEQ_ELEM_853
-# define BOOST_PP_SEQ_ELEM_855(_) BOOST_PP_SEQ_ELEM_854
-# define BOOST_PP_SEQ_ELEM_856(_) BOOST_PP_SEQ_ELEM_855
-# define BOOST_PP_SEQ_ELEM_857(_) BOOST_PP_SEQ_ELEM_856
-# define BOOST_PP_SEQ_ELEM_858(_) BOOST_PP_SEQ_ELEM_857
-# define BOOST_PP_SEQ_ELEM_859(_) BOOST_PP_SEQ_ELEM_858
-# define BOOST_PP_SEQ_ELEM_860(_) BOOST_PP_SEQ_ELEM_859
-# define BOOST_PP_SEQ_ELEM_861(_) BOOST_PP_SEQ_ELEM_860
-# define BOOST_PP_SEQ_ELEM_862(_) BOOST_PP_SEQ_ELEM_861
-# define BOOST_PP_SEQ_ELEM_863(_) BOOST_PP_SEQ_ELEM_862
-# define BOOST_PP_SEQ_ELEM_864(_) BOOST_PP_SEQ_ELEM_863
-# define BOOST_PP_SEQ_ELEM_865(_) BOOST_PP_SEQ_ELEM_864
-# define BOOST_PP_SEQ_ELEM_866(_) BOOST_PP_SEQ_ELEM_865
-# define BOOST_PP_SEQ_ELEM_867(_) BOOST_PP_SEQ_ELEM_866
-# define BOOST_PP_SEQ_ELEM_868(_) BOOST_PP_SEQ_ELEM_867
-# define BOOST_PP_SEQ_ELEM_869(_) BOOST_PP_SEQ_ELEM_868
-# define BOOST_PP_SEQ_ELEM_870(_) BOOST_PP_SEQ_ELEM_869
-# define BOOST_PP_SEQ_ELEM_871(_) BOOST_PP_SEQ_ELEM_870
-# define BOOST_PP_SEQ_ELEM_872(_) BOOST_PP_SEQ_ELEM_871
-# define BOOST_PP_SEQ_ELEM_873(_) BOOST_PP_SEQ_ELEM_872
-# define BOOST_PP_SEQ_ELEM_874(_) BOOST_PP_SEQ_ELEM_873
-# define BOOST_PP_SEQ_ELEM_875(_) BOOST_PP_SEQ_ELEM_874
-# define BOOST_PP_SEQ_ELEM_876(_) BOOST_PP_SEQ_ELEM_875
-# define BOOST_PP_SEQ_ELEM_877(_) BOOST_PP_SEQ_ELEM_876
-# define BOOST_PP_SEQ_ELEM_878(_) BOOST_PP_SEQ_ELEM_877
-# define BOOST_PP_SEQ_ELEM_879(_) BOOST_PP_SEQ_ELEM_878
-# define BOOST_PP_SEQ_ELEM_880(_) BOOST_PP_SEQ_ELEM_879
-# define BOOST_PP_SEQ_ELEM_881(_) BOOST_PP_SEQ_ELEM_880
-# define BOOST_PP_SEQ_ELEM_882(_) BOOST_PP_SEQ_ELEM_881
-# define BOOST_PP_SEQ_ELEM_883(_) BOOST_PP_SEQ_ELEM_882
-# define BOOST_PP_SEQ_ELEM_884(_) BOOST_PP_SEQ_ELEM_883
-# define BOOST_PP_SEQ_ELEM_885(_) BOOST_PP_SEQ_ELEM_884
-# define BOOST_PP_SEQ_ELEM_886(_) BOOST_PP_SEQ_ELEM_885
-# define BOOST_PP_SEQ_ELEM_887(_) BOOST_PP_SEQ_ELEM_886
-# define BOOST_PP_SEQ_ELEM_888(_) BOOST_PP_SEQ_ELEM_887
-# define BOOST_PP_SEQ_ELEM_889(_) BOOST_PP_SEQ_ELEM_888
-# define BOOST_PP_SEQ_ELEM_890(_) BOOST_PP_SEQ_ELEM_889
-# define BOOST_PP_SEQ_ELEM_891(_) BOOST_PP_SEQ_ELEM_890
-# define BOOST_PP_SEQ_ELEM_892(_) BOOST_PP_SEQ_ELEM_891
-# define BOOST_PP_SEQ_ELEM_893(_) BOOST_PP_SEQ_ELEM_892
-# define BOOST_PP_SEQ_ELEM_894(_) BOOST_PP_SEQ_ELEM_893
-# define BOOST_PP_SEQ_ELEM_895(_) BOOST_PP_SEQ_ELEM_894
-# define BOOST_PP_SEQ_ELEM_896(_) BOOST_PP_SEQ_ELEM_895
-# define BOOST_PP_SEQ_ELEM_897(_) BOOST_PP_SEQ_ELEM_896
-# define BOOST_PP_SEQ_ELEM_898(_) BOOST_PP_SEQ_ELEM_897
-# define BOOST_PP_SEQ_ELEM_899(_) BOOST_PP_SEQ_ELEM_898
-# define BOOST_PP_SEQ_ELEM_900(_) BOOST_PP_SEQ_ELEM_899
-# define BOOST_PP_SEQ_ELEM_901(_) BOOST_PP_SEQ_ELEM_900
-# define BOOST_PP_SEQ_ELEM_902(_) BOOST_PP_SEQ_ELEM_901
-# define BOOST_PP_SEQ_ELEM_903(_) BOOST_PP_SEQ_ELEM_902
-# define BOOST_PP_SEQ_ELEM_904(_) BOOST_PP_SEQ_ELEM_903
-# define BOOST_PP_SEQ_ELEM_905(_) BOOST_PP_SEQ_ELEM_904
-# define BOOST_PP_SEQ_ELEM_906(_) BOOST_PP_SEQ_ELEM_905
-# define BOOST_PP_SEQ_ELEM_907(_) BOOST_PP_SEQ_ELEM_906
-# define BOOST_PP_SEQ_ELEM_908(_) BOOST_PP_SEQ_ELEM_907
-# define BOOST_PP_SEQ_ELEM_909(_) BOOST_PP_SEQ_ELEM_908
-# define BOOST_PP_SEQ_ELEM_910(_) BOOST_PP_SEQ_ELEM_909
-# define BOOST_PP_SEQ_ELEM_911(_) BOOST_PP_SEQ_ELEM_910
-# define BOOST_PP_SEQ_ELEM_912(_) BOOST_PP_SEQ_ELEM_911
-# define BOOST_PP_SEQ_ELEM_913(_) BOOST_PP_SEQ_ELEM_912
-# define BOOST_PP_SEQ_ELEM_914(_) BOOST_PP_SEQ_ELEM_913
-# define BOOST_PP_SEQ_ELEM_915(_) BOOST_PP_SEQ_ELEM_914
-# define BOOST_PP_SEQ_ELEM_916(_) BOOST_PP_SEQ_ELEM_915
-# define BOOST_PP_SEQ_ELEM_917(_) BOOST_PP_SEQ_ELEM_916
-# define BOOST_PP_SEQ_ELEM_918(_) BOOST_PP_SEQ_ELEM_917
-# define BOOST_PP_SEQ_ELEM_919(_) BOOST_PP_SEQ_ELEM_918
-# define BOOST_PP_SEQ_ELEM_920(_) BOOST_PP_SEQ_ELEM_919
-# define BOOST_PP_SEQ_ELEM_921(_) BOOST_PP_SEQ_ELEM_920
-# define BOOST_PP_SEQ_ELEM_922(_) BOOST_PP_SEQ_ELEM_921
-# define BOOST_PP_SEQ_ELEM_923(_) BOOST_PP_SEQ_ELEM_922
-# define BOOST_PP_SEQ_ELEM_924(_) BOOST_PP_SEQ_ELEM_923
-# define BOOST_PP_SEQ_ELEM_925(_) BOOST_PP_SEQ_ELEM_924
-# define BOOST_PP_SEQ_ELEM_926(_) BOOST_PP_SEQ_ELEM_925
-# define BOOST_PP_SEQ_ELEM_927(_) BOOST_PP_SEQ_ELEM_926
-# define BOOST_PP_SEQ_ELEM_928(_) BOOST_PP_SEQ_ELEM_927
-# define BOOST_PP_SEQ_ELEM_929(_) BOOST_PP_SEQ_ELEM_928
-# define BOOST_PP_SEQ_ELEM_930(_) BOOST_PP_SEQ_ELEM_929
-# define BOOST_PP_SEQ_ELEM_931(_) BOOST_PP_SEQ_ELEM_930
-# define BOOST_PP_SEQ_ELEM_932(_) BOOST_PP_SEQ_ELEM_931
-# define BOOST_PP_SEQ_ELEM_933(_) BOOST_PP_SEQ_ELEM_932
-# define BOOST_PP_SEQ_ELEM_934(_) BOOST_PP_SEQ_ELEM_933
-# define BOOST_PP_SEQ_ELEM_935(_) BOOST_PP_SEQ_ELEM_934
-# define BOOST_PP_SEQ_ELEM_936(_) BOOST_PP_SEQ_ELEM_935
-# define BOOST_PP_SEQ_ELEM_937(_) BOOST_PP_SEQ_ELEM_936
-# define BOOST_PP_SEQ_ELEM_938(_) BOOST_PP_SEQ_ELEM_937
-# define BOOST_PP_SEQ_ELEM_939(_) BOOST_PP_SEQ_ELEM_938
-# define BOOST_PP_SEQ_ELEM_940(_) BOOST_PP_SEQ_ELEM_939
-# define BOOST_PP_SEQ_ELEM_941(_) BOOST_PP_SEQ_ELEM_940
-# define BOOST_PP_SEQ_ELEM_942(_) BOOST_PP_SEQ_ELEM_941
-# define BOOST_PP_SEQ_ELEM_943(_) BOOST_PP_SEQ_ELEM_942
-# define BOOST_PP_SEQ_ELEM_944(_) BOOST_PP_SEQ_ELEM_943
-# define BOOST_PP_SEQ_ELEM_945(_) BOOST_PP_SEQ_ELEM_944
-# define BOOST_PP_SEQ_ELEM_946(_) BOOST_PP_SEQ_ELEM_945
-# define BOOST_PP_SEQ_ELEM_947(_) BOOST_PP_SEQ_ELEM_946
-# define BOOST_PP_SEQ_ELEM_948(_) BOOST_PP_SEQ_ELEM_947
-# define BOOST_PP_SEQ_ELEM_949(_) BOOST_PP_SEQ_ELEM_948
-# define BOOST_PP_SEQ_ELEM_950(_) BOOST_PP_SEQ_ELEM_949
-# define BOOST_PP_SEQ_ELEM_951(_) BOOST_PP_SEQ_ELEM_950
-# define BOOST_PP_SEQ_ELEM_952(_) BOOST_PP_SEQ_ELEM_951
-# define BOOST_PP_SEQ_ELEM_953(_) BOOST_PP_SEQ_ELEM_952
-# define BOOST_PP_SEQ_ELEM_954(_) BOOST_PP_SEQ_ELEM_953
-# define BOOST_PP_SEQ_ELEM_955(_) BOOST_PP_SEQ_ELEM_954
-# define BOOST_PP_SEQ_ELEM_956(_) BOOST_PP_SEQ_ELEM_955
-# define BOOST_PP_SEQ_ELEM_957(_) BOOST_PP_SEQ_ELEM_956
-# define BOOST_PP_SEQ_ELEM_958(_) BOOST_PP_SEQ_ELEM_957
-# define BOOST_PP_SEQ_ELEM_959(_) BOOST_PP_SEQ_ELEM_958
-# define BOOST_PP_SEQ_ELEM_960(_) BOOST_PP_SEQ_ELEM_959
-# define BOOST_PP_SEQ_ELEM_961(_) BOOST_PP_SEQ_ELEM_960
-# define BOOST_PP_SEQ_ELEM_962(_) BOOST_PP_SEQ_ELEM_961
-# define BOOST_PP_SEQ_ELEM_963(_) BOOST_PP_SEQ_ELEM_962
-# define BOOST_PP_SEQ_ELEM_964(_) BOOST_PP_SEQ_ELEM_963
-# define BOOST_PP_SEQ_ELEM_965(_) BOOST_PP_SEQ_ELEM_964
-# define BOOST_PP_SEQ_ELEM_966(_) BOOST_PP_SEQ_ELEM_965
-# define BOOST_PP_SEQ_ELEM_967(_) BOOST_PP_SEQ_ELEM_966
-# define BOOST_PP_SEQ_ELEM_968(_) BOOST_PP_SEQ_ELEM_967
-# define BOOST_PP_SEQ_ELEM_969(_) BOOST_PP_SEQ_ELEM_968
-# define BOOST_PP_SEQ_ELEM_970(_) BOOST_PP_SEQ_ELEM_969
-# define BOOST_PP_SEQ_ELEM_971(_) BOOST_PP_SEQ_ELEM_970
-# define BOOST_PP_SEQ_ELEM_972(_) BOOST_PP_SEQ_ELEM_971
-# define BOOST_PP_SEQ_ELEM_973(_) BOOST_PP_SEQ_ELEM_972
-# define BOOST_PP_SEQ_ELEM_974(_) BOOST_PP_SEQ_ELEM_973
-# define BOOST_PP_SEQ_ELEM_975(_) BOOST_PP_SEQ_ELEM_974
-# define BOOST_PP_SEQ_ELEM_976(_) BOOST_PP_SEQ_ELEM_975
-# define BOOST_PP_SEQ_ELEM_977(_) BOOST_PP_SEQ_ELEM_976
-# define BOOST_PP_SEQ_ELEM_978(_) BOOST_PP_SEQ_ELEM_977
-# define BOOST_PP_SEQ_ELEM_979(_) BOOST_PP_SEQ_ELEM_978
-# define BOOST_PP_SEQ_ELEM_980(_) BOOST_PP_SEQ_ELEM_979
-# define BOOST_PP_SEQ_ELEM_981(_) BOOST_PP_SEQ_ELEM_980
-# define BOOST_PP_SEQ_ELEM_982(_) BOOST_PP_SEQ_ELEM_981
-# define BOOST_PP_SEQ_ELEM_983(_) BOOST_PP_SEQ_ELEM_982
-# define BOOST_PP_SEQ_ELEM_984(_) BOOST_PP_SEQ_ELEM_983
-# define BOOST_PP_SEQ_ELEM_985(_) BOOST_PP_SEQ_ELEM_984
-# define BOOST_PP_SEQ_ELEM_986(_) BOOST_PP_SEQ_ELEM_985
-# define BOOST_PP_SEQ_ELEM_987(_) BOOST_PP_SEQ_ELEM_986
-# define BOOST_PP_SEQ_ELEM_988(_) BOOST_PP_SEQ_ELEM_987
-# define BOOST_PP_SEQ_ELEM_989(_) BOOST_PP_SEQ_ELEM_988
-# define BOOST_PP_SEQ_ELEM_990(_) BOOST_PP_SEQ_ELEM_989
-# define BOOST_PP_SEQ_ELEM_991(_) BOOST_PP_SEQ_ELEM_990
-# define BOOST_PP_SEQ_ELEM_992(_) BOOST_PP_SEQ_ELEM_991
-# define BOOST_PP_SEQ_ELEM_993(_) BOOST_PP_SEQ_ELEM_992
-# define BOOST_PP_SEQ_ELEM_994(_) BOOST_PP_SEQ_ELEM_993
-# define BOOST_PP_SEQ_ELEM_995(_) BOOST_PP_SEQ_ELEM_994
-# define BOOST_PP_SEQ_ELEM_996(_) BOOST_PP_SEQ_ELEM_995
-# define BOOST_PP_SEQ_ELEM_997(_) BOOST_PP_SEQ_ELEM_996
-# define BOOST_PP_SEQ_ELEM_998(_) BOOST_PP_SEQ_ELEM_997
-# define BOOST_PP_SEQ_ELEM_999(_) BOOST_PP_SEQ_ELEM_998
-# define BOOST_PP_SEQ_ELEM_1000(_) BOOST_PP_SEQ_ELEM_999
-# define BOOST_PP_SEQ_ELEM_1001(_) BOOST_PP_SEQ_ELEM_1000
-# define BOOST_PP_SEQ_ELEM_1002(_) BOOST_PP_SEQ_ELEM_1001
-# define BOOST_PP_SEQ_ELEM_1003(_) BOOST_PP_SEQ_ELEM_1002
-# define BOOST_PP_SEQ_ELEM_1004(_) BOOST_PP_SEQ_ELEM_1003
-# define BOOST_PP_SEQ_ELEM_1005(_) BOOST_PP_SEQ_ELEM_1004
-# define BOOST_PP_SEQ_ELEM_1006(_) BOOST_PP_SEQ_ELEM_1005
-# define BOOST_PP_SEQ_ELEM_1007(_) BOOST_PP_SEQ_ELEM_1006
-# define BOOST_PP_SEQ_ELEM_1008(_) BOOST_PP_SEQ_ELEM_1007
-# define BOOST_PP_SEQ_ELEM_1009(_) BOOST_PP_SEQ_ELEM_1008
-# define BOOST_PP_SEQ_ELEM_1010(_) BOOST_PP_SEQ_ELEM_1009
-# define BOOST_PP_SEQ_ELEM_1011(_) BOOST_PP_SEQ_ELEM_1010
-# define BOOST_PP_SEQ_ELEM_1012(_) BOOST_PP_SEQ_ELEM_1011
-# define BOOST_PP_SEQ_ELEM_1013(_) BOOST_PP_SEQ_ELEM_1012
-# define BOOST_PP_SEQ_ELEM_1014(_) BOOST_PP_SEQ_ELEM_1013
-# define BOOST_PP_SEQ_ELEM_1015(_) BOOST_PP_SEQ_ELEM_1014
-# define BOOST_PP_SEQ_ELEM_1016(_) BOOST_PP_SEQ_ELEM_1015
-# define BOOST_PP_SEQ_ELEM_1017(_) BOOST_PP_SEQ_ELEM_1016
-# define BOOST_PP_SEQ_ELEM_1018(_) BOOST_PP_SEQ_ELEM_1017
-# define BOOST_PP_SEQ_ELEM_1019(_) BOOST_PP_SEQ_ELEM_1018
-# define BOOST_PP_SEQ_ELEM_1020(_) BOOST_PP_SEQ_ELEM_1019
-# define BOOST_PP_SEQ_ELEM_1021(_) BOOST_PP_SEQ_ELEM_1020
-# define BOOST_PP_SEQ_ELEM_1022(_) BOOST_PP_SEQ_ELEM_1021
-# define BOOST_PP_SEQ_ELEM_1023(_) BOOST_PP_SEQ_ELEM_1022
-#
-# endif
@@ -1,1043 +0,0 @@
-# /* **************************************************************************
-#  *                                                                          *
-#  *     (C) Copyright Paul Mensonides 2002.
-#  *     Distributed under the Boost Software License, Version 1.0. (See
-#  *     accompanying file LICENSE_1_0.txt or copy at
-#  *     http://www.boost.org/LICENSE_1_0.txt)
-#  *                                                                          *
-#  ************************************************************************** */
-#
-# /* Revised by Edward Diener (2020) */
-#
-# /* See http://www.boost.org for most recent version. */
-#
-# ifndef BOOST_PREPROCESSOR_SEQ_SIZE_1024_HPP
-# define BOOST_PREPROCESSOR_SEQ_SIZE_1024_HPP
-#
-# define BOOST_PP_SEQ_SIZE_513(_) BOOST_PP_SEQ_SIZE_514
-# define BOOST_PP_SEQ_SIZE_514(_) BOOST_PP_SEQ_SIZE_515
-# define BOOST_PP_SEQ_SIZE_515(_) BOOST_PP_SEQ_SIZE_516
-# define BOOST_PP_SEQ_SIZE_516(_) BOOST_PP_SEQ_SIZE_517
-# define BOOST_PP_SEQ_SIZE_517(_) BOOST_PP_SEQ_SIZE_518
-# define BOOST_PP_SEQ_SIZE_518(_) BOOST_PP_SEQ_SIZE_519
-# define BOOST_PP_SEQ_SIZE_519(_) BOOST_PP_SEQ_SIZE_520
-# define BOOST_PP_SEQ_SIZE_520(_) BOOST_PP_SEQ_SIZE_521
-# define BOOST_PP_SEQ_SIZE_521(_) BOOST_PP_SEQ_SIZE_522
-# define BOOST_PP_SEQ_SIZE_522(_) BOOST_PP_SEQ_SIZE_523
-# define BOOST_PP_SEQ_SIZE_523(_) BOOST_PP_SEQ_SIZE_524
-# define BOOST_PP_SEQ_SIZE_524(_) BOOST_PP_SEQ_SIZE_525
-# define BOOST_PP_SEQ_SIZE_525(_) BOOST_PP_SEQ_SIZE_526
-# define BOOST_PP_SEQ_SIZE_526(_) BOOST_PP_SEQ_SIZE_527
-# define BOOST_PP_SEQ_SIZE_527(_) BOOST_PP_SEQ_SIZE_528
-# define BOOST_PP_SEQ_SIZE_528(_) BOOST_PP_SEQ_SIZE_529
-# define BOOST_PP_SEQ_SIZE_529(_) BOOST_PP_SEQ_SIZE_530
-# define BOOST_PP_SEQ_SIZE_530(_) BOOST_PP_SEQ_SIZE_531
-# define BOOST_PP_SEQ_SIZE_531(_) BOOST_PP_SEQ_SIZE_532
-# define BOOST_PP_SEQ_SIZE_532(_) BOOST_PP_SEQ_SIZE_533
-# define BOOST_PP_SEQ_SIZE_533(_) BOOST_PP_SEQ_SIZE_534
-# define BOOST_PP_SEQ_SIZE_534(_) BOOST_PP_SEQ_SIZE_535
-# define BOOST_PP_SEQ_SIZE_535(_) BOOST_PP_SEQ_SIZE_536
-# define BOOST_PP_SEQ_SIZE_536(_) BOOST_PP_SEQ_SIZE_537
-# define BOOST_PP_SEQ_SIZE_537(_) BOOST_PP_SEQ_SIZE_538
-# define BOOST_PP_SEQ_SIZE_538(_) BOOST_PP_SEQ_SIZE_539
-# define BOOST_PP_SEQ_SIZE_539(_) BOOST_PP_SEQ_SIZE_540
-# define BOOST_PP_SEQ_SIZE_540(_) BOOST_PP_SEQ_SIZE_541
-# define BOOST_PP_SEQ_SIZE_541(_) BOOST_PP_SEQ_SIZE_542
-# define BOOST_PP_SEQ_SIZE_542(_) BOOST_PP_SEQ_SIZE_543
-# define BOOST_PP_SEQ_SIZE_543(_) BOOST_PP_SEQ_SIZE_544
-# define BOOST_PP_SEQ_SIZE_544(_) BOOST_PP_SEQ_SIZE_545
-# define BOOST_PP_SEQ_SIZE_545(_) BOOST_PP_SEQ_SIZE_546
-# define BOOST_PP_SEQ_SIZE_546(_) BOOST_PP_SEQ_SIZE_547
-# define BOOST_PP_SEQ_SIZE_547(_) BOOST_PP_SEQ_SIZE_548
-# define BOOST_PP_SEQ_SIZE_548(_) BOOST_PP_SEQ_SIZE_549
-# define BOOST_PP_SEQ_SIZE_549(_) BOOST_PP_SEQ_SIZE_550
-# define BOOST_PP_SEQ_SIZE_550(_) BOOST_PP_SEQ_SIZE_551
-# define BOOST_PP_SEQ_SIZE_551(_) BOOST_PP_SEQ_SIZE_552
-# define BOOST_PP_SEQ_SIZE_552(_) BOOST_PP_SEQ_SIZE_553
-# define BOOST_PP_SEQ_SIZE_553(_) BOOST_PP_SEQ_SIZE_554
-# define BOOST_PP_SEQ_SIZE_554(_) BOOST_PP_SEQ_SIZE_555
-# define BOOST_PP_SEQ_SIZE_555(_) BOOST_PP_SEQ_SIZE_556
-# define BOOST_PP_SEQ_SIZE_556(_) BOOST_PP_SEQ_SIZE_557
-# define BOOST_PP_SEQ_SIZE_557(_) BOOST_PP_SEQ_SIZE_558
-# define BOOST_PP_SEQ_SIZE_558(_) BOOST_PP_SEQ_SIZE_559
-# define BOOST_PP_SEQ_SIZE_559(_) BOOST_PP_SEQ_SIZE_560
-# define BOOST_PP_SEQ_SIZE_560(_) BOOST_PP_SEQ_SIZE_561
-# define BOOST_PP_SEQ_SIZE_561(_) BOOST_PP_SEQ_SIZE_562
-# define BOOST_PP_SEQ_SIZE_562(_) BOOST_PP_SEQ_SIZE_563
-# define BOOST_PP_SEQ_SIZE_563(_) BOOST_PP_SEQ_SIZE_564
-# define BOOST_PP_SEQ_SIZE_564(_) BOOST_PP_SEQ_SIZE_565
-# define BOOST_PP_SEQ_SIZE_565(_) BOOST_PP_SEQ_SIZE_566
-# define BOOST_PP_SEQ_SIZE_566(_) BOOST_PP_SEQ_SIZE_567
-# define BOOST_PP_SEQ_SIZE_567(_) BOOST_PP_SEQ_SIZE_568
-# define BOOST_PP_SEQ_SIZE_568(_) BOOST_PP_SEQ_SIZE_569
-# define BOOST_PP_SEQ_SIZE_569(_) BOOST_PP_SEQ_SIZE_570
-# define BOOST_PP_SEQ_SIZE_570(_) BOOST_PP_SEQ_SIZE_571
-# define BOOST_PP_SEQ_SIZE_571(_) BOOST_PP_SEQ_SIZE_572
-# define BOOST_PP_SEQ_SIZE_572(_) BOOST_PP_SEQ_SIZE_573
-# define BOOST_PP_SEQ_SIZE_573(_) BOOST_PP_SEQ_SIZE_574
-# define BOOST_PP_SEQ_SIZE_574(_) BOOST_PP_SEQ_SIZE_575
-# define BOOST_PP_SEQ_SIZE_575(_) BOOST_PP_SEQ_SIZE_576
-# define BOOST_PP_SEQ_SIZE_576(_) BOOST_PP_SEQ_SIZE_577
-# define BOOST_PP_SEQ_SIZE_577(_) BOOST_PP_SEQ_SIZE_578
-# define BOOST_PP_SEQ_SIZE_578(_) BOOST_PP_SEQ_SIZE_579
-# define BOOST_PP_SEQ_SIZE_579(_) BOOST_PP_SEQ_SIZE_580
-# define BOOST_PP_SEQ_SIZE_580(_) BOOST_PP_SEQ_SIZE_581
-# define BOOST_PP_SEQ_SIZE_581(_) BOOST_PP_SEQ_SIZE_582
-# define BOOST_PP_SEQ_SIZE_582(_) BOOST_PP_SEQ_SIZE_583
-# define BOOST_PP_SEQ_SIZE_583(_) BOOST_PP_SEQ_SIZE_584
-# define BOOST_PP_SEQ_SIZE_584(_) BOOST_PP_SEQ_SIZE_585
-# define BOOST_PP_SEQ_SIZE_585(_) BOOST_PP_SEQ_SIZE_586
-# define BOOST_PP_SEQ_SIZE_586(_) BOOST_PP_SEQ_SIZE_587
-# define BOOST_PP_SEQ_SIZE_587(_) BOOST_PP_SEQ_SIZE_588
-# define BOOST_PP_SEQ_SIZE_588(_) BOOST_PP_SEQ_SIZE_589
-# define BOOST_PP_SEQ_SIZE_589(_) BOOST_PP_SEQ_SIZE_590
-# define BOOST_PP_SEQ_SIZE_590(_) BOOST_PP_SEQ_SIZE_591
-# define BOOST_PP_SEQ_SIZE_591(_) BOOST_PP_SEQ_SIZE_592
-# define BOOST_PP_SEQ_SIZE_592(_) BOOST_PP_SEQ_SIZE_593
-# define BOOST_PP_SEQ_SIZE_593(_) BOOST_PP_SEQ_SIZE_594
-# define BOOST_PP_SEQ_SIZE_594(_) BOOST_PP_SEQ_SIZE_595
-# define BOOST_PP_SEQ_SIZE_595(_) BOOST_PP_SEQ_SIZE_596
-# define BOOST_PP_SEQ_SIZE_596(_) BOOST_PP_SEQ_SIZE_597
-# define BOOST_PP_SEQ_SIZE_597(_) BOOST_PP_SEQ_SIZE_598
-# define BOOST_PP_SEQ_SIZE_598(_) BOOST_PP_SEQ_SIZE_599
-# define BOOST_PP_SEQ_SIZE_599(_) BOOST_PP_SEQ_SIZE_600
-# define BOOST_PP_SEQ_SIZE_600(_) BOOST_PP_SEQ_SIZE_601
-# define BOOST_PP_SEQ_SIZE_601(_) BOOST_PP_SEQ_SIZE_602
-# define BOOST_PP_SEQ_SIZE_602(_) BOOST_PP_SEQ_SIZE_603
-# define BOOST_PP_SEQ_SIZE_603(_) BOOST_PP_SEQ_SIZE_604
-# define BOOST_PP_SEQ_SIZE_604(_) BOOST_PP_SEQ_SIZE_605
-# define BOOST_PP_SEQ_SIZE_605(_) BOOST_PP_SEQ_SIZE_606
-# define BOOST_PP_SEQ_SIZE_606(_) BOOST_PP_SEQ_SIZE_607
-# define BOOST_PP_SEQ_SIZE_607(_) BOOST_PP_SEQ_SIZE_608
-# define BOOST_PP_SEQ_SIZE_608(_) BOOST_PP_SEQ_SIZE_609
-# define BOOST_PP_SEQ_SIZE_609(_) BOOST_PP_SEQ_SIZE_610
-# define BOOST_PP_SEQ_SIZE_610(_) BOOST_PP_SEQ_SIZE_611
-# define BOOST_PP_SEQ_SIZE_611(_) BOOST_PP_SEQ_SIZE_612
-# define BOOST_PP_SEQ_SIZE_612(_) BOOST_PP_SEQ_SIZE_613
-# define BOOST_PP_SEQ_SIZE_613(_) BOOST_PP_SEQ_SIZE_614
-# define BOOST_PP_SEQ_SIZE_614(_) BOOST_PP_SEQ_SIZE_615
-# define BOOST_PP_SEQ_SIZE_615(_) BOOST_PP_SEQ_SIZE_616
-# define BOOST_PP_SEQ_SIZE_616(_) BOOST_PP_SEQ_SIZE_617
-# define BOOST_PP_SEQ_SIZE_617(_) BOOST_PP_SEQ_SIZE_618
-# define BOOST_PP_SEQ_SIZE_618(_) BOOST_PP_SEQ_SIZE_619
-# define BOOST_PP_SEQ_SIZE_619(_) BOOST_PP_SEQ_SIZE_620
-# define BOOST_PP_SEQ_SIZE_620(_) BOOST_PP_SEQ_SIZE_621
-# define BOOST_PP_SEQ_SIZE_621(_) BOOST_PP_SEQ_SIZE_622
-# define BOOST_PP_SEQ_SIZE_622(_) BOOST_PP_SEQ_SIZE_623
-# define BOOST_PP_SEQ_SIZE_623(_) BOOST_PP_SEQ_SIZE_624
-# define BOOST_PP_SEQ_SIZE_624(_) BOOST_PP_SEQ_SIZE_625
-# define BOOST_PP_SEQ_SIZE_625(_) BOOST_PP_SEQ_SIZE_626
-# define BOOST_PP_SEQ_SIZE_626(_) BOOST_PP_SEQ_SIZE_627
-# define BOOST_PP_SEQ_SIZE_627(_) BOOST_PP_SEQ_SIZE_628
-# define BOOST_PP_SEQ_SIZE_628(_) BOOST_PP_SEQ_SIZE_629
-# define BOOST_PP_SEQ_SIZE_629(_) BOOST_PP_SEQ_SIZE_630
-# define BOOST_PP_SEQ_SIZE_630(_) BOOST_PP_SEQ_SIZE_631
-# define BOOST_PP_SEQ_SIZE_631(_) BOOST_PP_SEQ_SIZE_632
-# define BOOST_PP_SEQ_SIZE_632(_) BOOST_PP_SEQ_SIZE_633
-# define BOOST_PP_SEQ_SIZE_633(_) BOOST_PP_SEQ_SIZE_634
-# define BOOST_PP_SEQ_SIZE_634(_) BOOST_PP_SEQ_SIZE_635
-# define BOOST_PP_SEQ_SIZE_635(_) BOOST_PP_SEQ_SIZE_636
-# define BOOST_PP_SEQ_SIZE_636(_) BOOST_PP_SEQ_SIZE_637
-# define BOOST_PP_SEQ_SIZE_637(_) BOOST_PP_SEQ_SIZE_638
-# define BOOST_PP_SEQ_SIZE_638(_) BOOST_PP_SEQ_SIZE_639
-# define BOOST_PP_SEQ_SIZE_639(_) BOOST_PP_SEQ_SIZE_640
-# define BOOST_PP_SEQ_SIZE_640(_) BOOST_PP_SEQ_SIZE_641
-# define BOOST_PP_SEQ_SIZE_641(_) BOOST_PP_SEQ_SIZE_642
-# define BOOST_PP_SEQ_SIZE_642(_) BOOST_PP_SEQ_SIZE_643
-# define BOOST_PP_SEQ_SIZE_643(_) BOOST_PP_SEQ_SIZE_644
-# define BOOST_PP_SEQ_SIZE_644(_) BOOST_PP_SEQ_SIZE_645
-# define BOOST_PP_SEQ_SIZE_645(_) BOOST_PP_SEQ_SIZE_646
-# define BOOST_PP_SEQ_SIZE_646(_) BOOST_PP_SEQ_SIZE_647
-# define BOOST_PP_SEQ_SIZE_647(_) BOOST_PP_SEQ_SIZE_648
-# define BOOST_PP_SEQ_SIZE_648(_) BOOST_PP_SEQ_SIZE_649
-# define BOOST_PP_SEQ_SIZE_649(_) BOOST_PP_SEQ_SIZE_650
-# define BOOST_PP_SEQ_SIZE_650(_) BOOST_PP_SEQ_SIZE_651
-# define BOOST_PP_SEQ_SIZE_651(_) BOOST_PP_SEQ_SIZE_652
-# define BOOST_PP_SEQ_SIZE_652(_) BOOST_PP_SEQ_SIZE_653
-# define BOOST_PP_SEQ_SIZE_653(_) BOOST_PP_SEQ_SIZE_654
-# define BOOST_PP_SEQ_SIZE_654(_) BOOST_PP_SEQ_SIZE_655
-# define BOOST_PP_SEQ_SIZE_655(_) BOOST_PP_SEQ_SIZE_656
-# define BOOST_PP_SEQ_SIZE_656(_) BOOST_PP_SEQ_SIZE_657
-# define BOOST_PP_SEQ_SIZE_657(_) BOOST_PP_SEQ_SIZE_658
-# define BOOST_PP_SEQ_SIZE_658(_) BOOST_PP_SEQ_SIZE_659
-# define BOOST_PP_SEQ_SIZE_659(_) BOOST_PP_SEQ_SIZE_660
-# define BOOST_PP_SEQ_SIZE_660(_) BOOST_PP_SEQ_SIZE_661
-# define BOOST_PP_SEQ_SIZE_661(_) BOOST_PP_SEQ_SIZE_662
-# define BOOST_PP_SEQ_SIZE_662(_) BOOST_PP_SEQ_SIZE_663
-# define BOOST_PP_SEQ_SIZE_663(_) BOOST_PP_SEQ_SIZE_664
-# define BOOST_PP_SEQ_SIZE_664(_) BOOST_PP_SEQ_SIZE_665
-# define BOOST_PP_SEQ_SIZE_665(_) BOOST_PP_SEQ_SIZE_666
-# define BOOST_PP_SEQ_SIZE_666(_) BOOST_PP_SEQ_SIZE_667
-# define BOOST_PP_SEQ_SIZE_667(_) BOOST_PP_SEQ_SIZE_668
-# define BOOST_PP_SEQ_SIZE_668(_) BOOST_PP_SEQ_SIZE_669
-# define BOOST_PP_SEQ_SIZE_669(_) BOOST_PP_SEQ_SIZE_670
-# define BOOST_PP_SEQ_SIZE_670(_) BOOST_PP_SEQ_SIZE_671
-# define BOOST_PP_SEQ_SIZE_671(_) BOOST_PP_SEQ_SIZE_672
-# define BOOST_PP_SEQ_SIZE_672(_) BOOST_PP_SEQ_SIZE_673
-# define BOOST_PP_SEQ_SIZE_673(_) BOOST_PP_SEQ_SIZE_674
-# define BOOST_PP_SEQ_SIZE_674(_) BOOST_PP_SEQ_SIZE_675
-# define BOOST_PP_SEQ_SIZE_675(_) BOOST_PP_SEQ_SIZE_676
-# define BOOST_PP_SEQ_SIZE_676(_) BOOST_PP_SEQ_SIZE_677
-# define BOOST_PP_SEQ_SIZE_677(_) BOOST_PP_SEQ_SIZE_678
-# define BOOST_PP_SEQ_SIZE_678(_) BOOST_PP_SEQ_SIZE_679
-# define BOOST_PP_SEQ_SIZE_679(_) BOOST_PP_SEQ_SIZE_680
-# define BOOST_PP_SEQ_SIZE_680(_) BOOST_PP_SEQ_SIZE_681
-# define BOOST_PP_SEQ_SIZE_681(_) BOOST_PP_SEQ_SIZE_682
-# define BOOST_PP_SEQ_SIZE_682(_) BOOST_PP_SEQ_SIZE_683
-# define BOOST_PP_SEQ_SIZE_683(_) BOOST_PP_SEQ_SIZE_684
-# define BOOST_PP_SEQ_SIZE_684(_) BOOST_PP_SEQ_SIZE_685
-# define BOOST_PP_SEQ_SIZE_685(_) BOOST_PP_SEQ_SIZE_686
-# define BOOST_PP_SEQ_SIZE_686(_) BOOST_PP_SEQ_SIZE_687
-# define BOOST_PP_SEQ_SIZE_687(_) BOOST_PP_SEQ_SIZE_688
-# define BOOST_PP_SEQ_SIZE_688(_) BOOST_PP_SEQ_SIZE_689
-# define BOOST_PP_SEQ_SIZE_689(_) BOOST_PP_SEQ_SIZE_690
-# define BOOST_PP_SEQ_SIZE_690(_) BOOST_PP_SEQ_SIZE_691
-# define BOOST_PP_SEQ_SIZE_691(_) BOOST_PP_SEQ_SIZE_692
-# define BOOST_PP_SEQ_SIZE_692(_) BOOST_PP_SEQ_SIZE_693
-# define BOOST_PP_SEQ_SIZE_693(_) BOOST_PP_SEQ_SIZE_694
-# define BOOST_PP_SEQ_SIZE_694(_) BOOST_PP_SEQ_SIZE_695
-# define BOOST_PP_SEQ_SIZE_695(_) BOOST_PP_SEQ_SIZE_696
-# define BOOST_PP_SEQ_SIZE_696(_) BOOST_PP_SEQ_SIZE_697
-# define BOOST_PP_SEQ_SIZE_697(_) BOOST_PP_SEQ_SIZE_698
-# define BOOST_PP_SEQ_SIZE_698(_) BOOST_PP_SEQ_SIZE_699
-# define BOOST_PP_SEQ_SIZE_699(_) BOOST_PP_SEQ_SIZE_700
-# define BOOST_PP_SEQ_SIZE_700(_) BOOST_PP_SEQ_SIZE_701
-# define BOOST_PP_SEQ_SIZE_701(_) BOOST_PP_SEQ_SIZE_702
-# define BOOST_PP_SEQ_SIZE_702(_) BOOST_PP_SEQ_SIZE_703
-# define BOOST_PP_SEQ_SIZE_703(_) BOOST_PP_SEQ_SIZE_704
-# define BOOST_PP_SEQ_SIZE_704(_) BOOST_PP_SEQ_SIZE_705
-# define BOOST_PP_SEQ_SIZE_705(_) BOOST_PP_SEQ_SIZE_706
-# define BOOST_PP_SEQ_SIZE_706(_) BOOST_PP_SEQ_SIZE_707
-# define BOOST_PP_SEQ_SIZE_707(_) BOOST_PP_SEQ_SIZE_708
-# define BOOST_PP_SEQ_SIZE_708(_) BOOST_PP_SEQ_SIZE_709
-# define BOOST_PP_SEQ_SIZE_709(_) BOOST_PP_SEQ_SIZE_710
-# define BOOST_PP_SEQ_SIZE_710(_) BOOST_PP_SEQ_SIZE_711
-# define BOOST_PP_SEQ_SIZE_711(_) BOOST_PP_SEQ_SIZE_712
-# define BOOST_PP_SEQ_SIZE_712(_) BOOST_PP_SEQ_SIZE_713
-# define BOOST_PP_SEQ_SIZE_713(_) BOOST_PP_SEQ_SIZE_714
-# define BOOST_PP_SEQ_SIZE_714(_) BOOST_PP_SEQ_SIZE_715
-# define BOOST_PP_SEQ_SIZE_715(_) BOOST_PP_SEQ_SIZE_716
-# define BOOST_PP_SEQ_SIZE_716(_) BOOST_PP_SEQ_SIZE_717
-# define BOOST_PP_SEQ_SIZE_717(_) BOOST_PP_SEQ_SIZE_718
-# define BOOST_PP_SEQ_SIZE_718(_) BOOST_PP_SEQ_SIZE_719
-# define BOOST_PP_SEQ_SIZE_719(_) BOOST_PP_SEQ_SIZE_720
-# define BOOST_PP_SEQ_SIZE_720(_) BOOST_PP_SEQ_SIZE_721
-# define BOOST_PP_SEQ_SIZE_721(_) BOOST_PP_SEQ_SIZE_722
-# define BOOST_PP_SEQ_SIZE_722(_) BOOST_PP_SEQ_SIZE_723
-# define BOOST_PP_SEQ_SIZE_723(_) BOOST_PP_SEQ_SIZE_724
-# define BOOST_PP_SEQ_SIZE_724(_) BOOST_PP_SEQ_SIZE_725
-# define BOOST_PP_SEQ_SIZE_725(_) BOOST_PP_SEQ_SIZE_726
-# define BOOST_PP_SEQ_SIZE_726(_) BOOST_PP_SEQ_SIZE_727
-# define BOOST_PP_SEQ_SIZE_727(_) BOOST_PP_SEQ_SIZE_728
-# define BOOST_PP_SEQ_SIZE_728(_) BOOST_PP_SEQ_SIZE_729
-# define BOOST_PP_SEQ_SIZE_729(_) BOOST_PP_SEQ_SIZE_730
-# define BOOST_PP_SEQ_SIZE_730(_) BOOST_PP_SEQ_SIZE_731
-# define BOOST_PP_SEQ_SIZE_731(_) BOOST_PP_SEQ_SIZE_732
-# define BOOST_PP_SEQ_SIZE_732(_) BOOST_PP_SEQ_SIZE_733
-# define BOOST_PP_SEQ_SIZE_733(_) BOOST_PP_SEQ_SIZE_734
-# define BOOST_PP_SEQ_SIZE_734(_) BOOST_PP_SEQ_SIZE_735
-# define BOOST_PP_SEQ_SIZE_735(_) BOOST_PP_SEQ_SIZE_736
-# define BOOST_PP_SEQ_SIZE_736(_) BOOST_PP_SEQ_SIZE_737
-# define BOOST_PP_SEQ_SIZE_737(_) BOOST_PP_SEQ_SIZE_738
-# define BOOST_PP_SEQ_SIZE_738(_) BOOST_PP_SEQ_SIZE_739
-# define BOOST_PP_SEQ_SIZE_739(_) BOOST_PP_SEQ_SIZE_740
-# define BOOST_PP_SEQ_SIZE_740(_) BOOST_PP_SEQ_SIZE_741
-# define BOOST_PP_SEQ_SIZE_741(_) BOOST_PP_SEQ_SIZE_742
-# define BOOST_PP_SEQ_SIZE_742(_) BOOST_PP_SEQ_SIZE_743
-# define BOOST_PP_SEQ_SIZE_743(_) BOOST_PP_SEQ_SIZE_744
-# define BOOST_PP_SEQ_SIZE_744(_) BOOST_PP_SEQ_SIZE_745
-# define BOOST_PP_SEQ_SIZE_745(_) BOOST_PP_SEQ_SIZE_746
-# define BOOST_PP_SEQ_SIZE_746(_) BOOST_PP_SEQ_SIZE_747
-# define BOOST_PP_SEQ_SIZE_747(_) BOOST_PP_SEQ_SIZE_748
-# define BOOST_PP_SEQ_SIZE_748(_) BOOST_PP_SEQ_SIZE_749
-# define BOOST_PP_SEQ_SIZE_749(_) BOOST_PP_SEQ_SIZE_750
-# define BOOST_PP_SEQ_SIZE_750(_) BOOST_PP_SEQ_SIZE_751
-# define BOOST_PP_SEQ_SIZE_751(_) BOOST_PP_SEQ_SIZE_752
-# define BOOST_PP_SEQ_SIZE_752(_) BOOST_PP_SEQ_SIZE_753
-# define BOOST_PP_SEQ_SIZE_753(_) BOOST_PP_SEQ_SIZE_754
-# define BOOST_PP_SEQ_SIZE_754(_) BOOST_PP_SEQ_SIZE_755
-# define BOOST_PP_SEQ_SIZE_755(_) BOOST_PP_SEQ_SIZE_756
-# define BOOST_PP_SEQ_SIZE_756(_) BOOST_PP_SEQ_SIZE_757
-# define BOOST_PP_SEQ_SIZE_757(_) BOOST_PP_SEQ_SIZE_758
-# define BOOST_PP_SEQ_SIZE_758(_) BOOST_PP_SEQ_SIZE_759
-# define BOOST_PP_SEQ_SIZE_759(_) BOOST_PP_SEQ_SIZE_760
-# define BOOST_PP_SEQ_SIZE_760(_) BOOST_PP_SEQ_SIZE_761
-# define BOOST_PP_SEQ_SIZE_761(_) BOOST_PP_SEQ_SIZE_762
-# define BOOST_PP_SEQ_SIZE_762(_) BOOST_PP_SEQ_SIZE_763
-# define BOOST_PP_SEQ_SIZE_763(_) BOOST_PP_SEQ_SIZE_764
-# define BOOST_PP_SEQ_SIZE_764(_) BOOST_PP_SEQ_SIZE_765
-# define BOOST_PP_SEQ_SIZE_765(_) BOOST_PP_SEQ_SIZE_766
-# define BOOST_PP_SEQ_SIZE_766(_) BOOST_PP_SEQ_SIZE_767
-# define BOOST_PP_SEQ_SIZE_767(_) BOOST_PP_SEQ_SIZE_768
-# define BOOST_PP_SEQ_SIZE_768(_) BOOST_PP_SEQ_SIZE_769
-# define BOOST_PP_SEQ_SIZE_769(_) BOOST_PP_SEQ_SIZE_770
-# define BOOST_PP_SEQ_SIZE_770(_) BOOST_PP_SEQ_SIZE_771
-# define BOOST_PP_SEQ_SIZE_771(_) BOOST_PP_SEQ_SIZE_772
-# define BOOST_PP_SEQ_SIZE_772(_) BOOST_PP_SEQ_SIZE_773
-# define BOOST_PP_SEQ_SIZE_773(_) BOOST_PP_SEQ_SIZE_774
-# define BOOST_PP_SEQ_SIZE_774(_) BOOST_PP_SEQ_SIZE_775
-# define BOOST_PP_SEQ_SIZE_775(_) BOOST_PP_SEQ_SIZE_776
-# define BOOST_PP_SEQ_SIZE_776(_) BOOST_PP_SEQ_SIZE_777
-# define BOOST_PP_SEQ_SIZE_777(_) BOOST_PP_SEQ_SIZE_778
-# define BOOST_PP_SEQ_SIZE_778(_) BOOST_PP_SEQ_SIZE_779
-# define BOOST_PP_SEQ_SIZE_779(_) BOOST_PP_SEQ_SIZE_780
-# define BOOST_PP_SEQ_SIZE_780(_) BOOST_PP_SEQ_SIZE_781
-# define BOOST_PP_SEQ_SIZE_781(_) BOOST_PP_SEQ_SIZE_782
-# define BOOST_PP_SEQ_SIZE_782(_) BOOST_PP_SEQ_SIZE_783
-# define BOOST_PP_SEQ_SIZE_783(_) BOOST_PP_SEQ_SIZE_784
-# define BOOST_PP_SEQ_SIZE_784(_) BOOST_PP_SEQ_SIZE_785
-# define BOOST_PP_SEQ_SIZE_785(_) BOOST_PP_SEQ_SIZE_786
-# define BOOST_PP_SEQ_SIZE_786(_) BOOST_PP_SEQ_SIZE_787
-# define BOOST_PP_SEQ_SIZE_787(_) BOOST_PP_SEQ_SIZE_788
-# define BOOST_PP_SEQ_SIZE_788(_) BOOST_PP_SEQ_SIZE_789
-# define BOOST_PP_SEQ_SIZE_789(_) BOOST_PP_SEQ_SIZE_790
-# define BOOST_PP_SEQ_SIZE_790(_) BOOST_PP_SEQ_SIZE_791
-# define BOOST_PP_SEQ_SIZE_791(_) BOOST_PP_SEQ_SIZE_792
-# define BOOST_PP_SEQ_SIZE_792(_) BOOST_PP_SEQ_SIZE_793
-# define BOOST_PP_SEQ_SIZE_793(_) BOOST_PP_SEQ_SIZE_794
-# define BOOST_PP_SEQ_SIZE_794(_) BOOST_PP_SEQ_SIZE_795
-# define BOOST_PP_SEQ_SIZE_795(_) BOOST_PP_SEQ_SIZE_796
-# define BOOST_PP_SEQ_SIZE_796(_) BOOST_PP_SEQ_SIZE_797
-# define BOOST_PP_SEQ_SIZE_797(_) BOOST_PP_SEQ_SIZE_798
-# define BOOST_PP_SEQ_SIZE_798(_) BOOST_PP_SEQ_SIZE_799
-# define BOOST_PP_SEQ_SIZE_799(_) BOOST_PP_SEQ_SIZE_800
-# define BOOST_PP_SEQ_SIZE_800(_) BOOST_PP_SEQ_SIZE_801
-# define BOOST_PP_SEQ_SIZE_801(_) BOOST_PP_SEQ_SIZE_802
-# define BOOST_PP_SEQ_SIZE_802(_) BOOST_PP_SEQ_SIZE_803
-# define BOOST_PP_SEQ_SIZE_803(_) BOOST_PP_SEQ_SIZE_804
-# define BOOST_PP_SEQ_SIZE_804(_) BOOST_PP_SEQ_SIZE_805
-# define BOOST_PP_SEQ_SIZE_805(_) BOOST_PP_SEQ_SIZE_806
-# define BOOST_PP_SEQ_SIZE_806(_) BOOST_PP_SEQ_SIZE_807
-# define BOOST_PP_SEQ_SIZE_807(_) BOOST_PP_SEQ_SIZE_808
-# define BOOST_PP_SEQ_SIZE_808(_) BOOST_PP_SEQ_SIZE_809
-# define BOOST_PP_SEQ_SIZE_809(_) BOOST_PP_SEQ_SIZE_810
-# define BOOST_PP_SEQ_SIZE_810(_) BOOST_PP_SEQ_SIZE_811
-# define BOOST_PP_SEQ_SIZE_811(_) BOOST_PP_SEQ_SIZE_812
-# define BOOST_PP_SEQ_SIZE_812(_) BOOST_PP_SEQ_SIZE_813
-# define BOOST_PP_SEQ_SIZE_813(_) BOOST_PP_SEQ_SIZE_814
-# define BOOST_PP_SEQ_SIZE_814(_) BOOST_PP_SEQ_SIZE_815
-# define BOOST_PP_SEQ_SIZE_815(_) BOOST_PP_SEQ_SIZE_816
-# define BOOST_PP_SEQ_SIZE_816(_) BOOST_PP_SEQ_SIZE_817
-# define BOOST_PP_SEQ_SIZE_817(_) BOOST_PP_SEQ_SIZE_818
-# define BOOST_PP_SEQ_SIZE_818(_) BOOST_PP_SEQ_SIZE_819
-# define BOOST_PP_SEQ_SIZE_819(_) BOOST_PP_SEQ_SIZE_820
-# define BOOST_PP_SEQ_SIZE_820(_) BOOST_PP_SEQ_SIZE_821
-# define BOOST_PP_SEQ_SIZE_821(_) BOOST_PP_SEQ_SIZE_822
-# define BOOST_PP_SEQ_SIZE_822(_) BOOST_PP_SEQ_SIZE_823
-# define BOOST_PP_SEQ_SIZE_823(_) BOOST_PP_SEQ_SIZE_824
-# define BOOST_PP_SEQ_SIZE_824(_) BOOST_PP_SEQ_SIZE_825
-# define BOOST_PP_SEQ_SIZE_825(_) BOOST_PP_SEQ_SIZE_826
-# define BOOST_PP_SEQ_SIZE_826(_) BOOST_PP_SEQ_SIZE_827
-# define BOOST_PP_SEQ_SIZE_827(_) BOOST_PP_SEQ_SIZE_828
-# define BOOST_PP_SEQ_SIZE_828(_) BOOST_PP_SEQ_SIZE_829
-# define BOOST_PP_SEQ_SIZE_829(_) BOOST_PP_SEQ_SIZE_830
-# define BOOST_PP_SEQ_SIZE_830(_) BOOST_PP_SEQ_SIZE_831
-# define BOOST_PP_SEQ_SIZE_831(_) BOOST_PP_SEQ_SIZE_832
-# define BOOST_PP_SEQ_SIZE_832(_) BOOST_PP_SEQ_SIZE_833
-# define BOOST_PP_SEQ_SIZE_833(_) BOOST_PP_SEQ_SIZE_834
-# define BOOST_PP_SEQ_SIZE_834(_) BOOST_PP_SEQ_SIZE_835
-# define BOOST_PP_SEQ_SIZE_835(_) BOOST_PP_SEQ_SIZE_836
-# define BOOST_PP_SEQ_SIZE_836(_) BOOST_PP_SEQ_SIZE_837
-# define BOOST_PP_SEQ_SIZE_837(_) BOOST_PP_SEQ_SIZE_838
-# define BOOST_PP_SEQ_SIZE_838(_) BOOST_PP_SEQ_SIZE_839
-# define BOOST_PP_SEQ_SIZE_839(_) BOOST_PP_SEQ_SIZE_840
-# define BOOST_PP_SEQ_SIZE_840(_) BOOST_PP_SEQ_SIZE_841
-# define BOOST_PP_SEQ_SIZE_841(_) BOOST_PP_SEQ_SIZE_842
-# define BOOST_PP_SEQ_SIZE_842(_) BOOST_PP_SEQ_SIZE_843
-# define BOOST_PP_SEQ_SIZE_843(_) BOOST_PP_SEQ_SIZE_844
-# define BOOST_PP_SEQ_SIZE_844(_) BOOST_PP_SEQ_SIZE_845
-# define BOOST_PP_SEQ_SIZE_845(_) BOOST_PP_SEQ_SIZE_846
-# define BOOST_PP_SEQ_SIZE_846(_) BOOST_PP_SEQ_SIZE_847
-# define BOOST_PP_SEQ_SIZE_847(_) BOOST_PP_SEQ_SIZE_848
-# define BOOST_PP_SEQ_SIZE_848(_) BOOST_PP_SEQ_SIZE_849
-# define BOOST_PP_SEQ_SIZE_849(_) BOOST_PP_SEQ_SIZE_850
-# define BOOST_PP_SEQ_SIZE_850(_) BOOST_PP_SEQ_SIZE_851
-# define BOOST_PP_SEQ_SIZE_851(_) BOOST_PP_SEQ_SIZE_852
-# define BOOST_PP_SEQ_SIZE_852(_) BOOST_PP_SEQ_SIZE_853
-# define BOOST_PP_SEQ_SIZE_853(_) BOOST_PP_SEQ_SIZE_854
-# define BOOST_PP_SEQ_SIZE_854(_) BOOST_PP_SEQ_SIZE_855
-# define BOOST_PP_SEQ_SIZE_855(_) BOOST_PP_SEQ_SIZE_856
-# define BOOST_PP_SEQ_SIZE_856(_) BOOST_PP_SEQ_SIZE_857
-# define BOOST_PP_SEQ_SIZE_857(_) BOOST_PP_SEQ_SIZE_858
-# define BOOST_PP_SEQ_SIZE_858(_) BOOST_PP_SEQ_SIZE_859
-# define BOOST_PP_SEQ_SIZE_859(_) BOOST_PP_SEQ_SIZE_860
-# define BOOST_PP_SEQ_SIZE_860(_) BOOST_PP_SEQ_SIZE_861
-# define BOOST_PP_SEQ_SIZE_861(_) BOOST_PP_SEQ_SIZE_862
-# define BOOST_PP_SEQ_SIZE_862(_) BOOST_PP_SEQ_SIZE_863
-# define BOOST_PP_SEQ_SIZE_863(_) BOOST_PP_SEQ_SIZE_864
-# define BOOST_PP_SEQ_SIZE_864(_) BOOST_PP_SEQ_SIZE_865
-# define BOOST_PP_SEQ_SIZE_865(_) BOOST_PP_SEQ_SIZE_866
-# define BOOST_PP_SEQ_SIZE_866(_) BOOST_PP_SEQ_SIZE_867
-# define BOOST_PP_SEQ_SIZE_867(_) BOOST_PP_SEQ_SIZE_868
-# define BOOST_PP_SEQ_SIZE_868(_) BOOST_PP_SEQ_SIZE_869
-# define BOOST_PP_SEQ_SIZE_869(_) BOOST_PP_SEQ_SIZE_870
-# define BOOST_PP_SEQ_SIZE_870(_) BOOST_PP_SEQ_SIZE_871
-# define BOOST_PP_SEQ_SIZE_871(_) BOOST_PP_SEQ_SIZE_872
-# define BOOST_PP_SEQ_SIZE_872(_) BOOST_PP_SEQ_SIZE_873
-# define BOOST_PP_SEQ_SIZE_873(_) BOOST_PP_SEQ_SIZE_874
-# define BOOST_PP_SEQ_SIZE_874(_) BOOST_PP_SEQ_SIZE_875
-# define BOOST_PP_SEQ_SIZE_875(_) BOOST_PP_SEQ_SIZE_876
-# define BOOST_PP_SEQ_SIZE_876(_) BOOST_PP_SEQ_SIZE_877
-# define BOOST_PP_SEQ_SIZE_877(_) BOOST_PP_SEQ_SIZE_878
-# define BOOST_PP_SEQ_SIZE_878(_) BOOST_PP_SEQ_SIZE_879
-# define BOOST_PP_SEQ_SIZE_879(_) BOOST_PP_SEQ_SIZE_880
-# define BOOST_PP_SEQ_SIZE_880(_) BOOST_PP_SEQ_SIZE_881
-# define BOOST_PP_SEQ_SIZE_881(_) BOOST_PP_SEQ_SIZE_882
-# define BOOST_PP_SEQ_SIZE_882(_) BOOST_PP_SEQ_SIZE_883
-# define BOOST_PP_SEQ_SIZE_883(_) BOOST_PP_SEQ_SIZE_884
-# define BOOST_PP_SEQ_SIZE_884(_) BOOST_PP_SEQ_SIZE_885
-# define BOOST_PP_SEQ_SIZE_885(_) BOOST_PP_SEQ_SIZE_886
-# define BOOST_PP_SEQ_SIZE_886(_) BOOST_PP_SEQ_SIZE_887
-# define BOOST_PP_SEQ_SIZE_887(_) BOOST_PP_SEQ_SIZE_888
-# define BOOST_PP_SEQ_SIZE_888(_) BOOST_PP_SEQ_SIZE_889
-# define BOOST_PP_SEQ_SIZE_889(_) BOOST_PP_SEQ_SIZE_890
-# define BOOST_PP_SEQ_SIZE_890(_) BOOST_PP_SEQ_SIZE_891
-# define BOOST_PP_SEQ_SIZE_891(_) BOOST_PP_SEQ_SIZE_892
-# define BOOST_PP_SEQ_SIZE_892(_) BOOST_PP_SEQ_SIZE_893
-# define BOOST_PP_SEQ_SIZE_893(_) BOOST_PP_SEQ_SIZE_894
-# define BOOST_PP_SEQ_SIZE_894(_) BOOST_PP_SEQ_SIZE_895
-# define BOOST_PP_SEQ_SIZE_895(_) BOOST_PP_SEQ_SIZE_896
-# define BOOST_PP_SEQ_SIZE_896(_) BOOST_PP_SEQ_SIZE_897
-# define BOOST_PP_SEQ_SIZE_897(_) BOOST_PP_SEQ_SIZE_898
-# define BOOST_PP_SEQ_SIZE_898(_) BOOST_PP_SEQ_SIZE_899
-# define BOOST_PP_SEQ_SIZE_899(_) BOOST_PP_SEQ_SIZE_900
-# define BOOST_PP_SEQ_SIZE_900(_) BOOST_PP_SEQ_SIZE_901
-# define BOOST_PP_SEQ_SIZE_901(_) BOOST_PP_SEQ_SIZE_902
-# define BOOST_PP_SEQ_SIZE_902(_) BOOST_PP_SEQ_SIZE_903
-# define BOOST_PP_SEQ_SIZE_903(_) BOOST_PP_SEQ_SIZE_904
-# define BOOST_PP_SEQ_SIZE_904(_) BOOST_PP_SEQ_SIZE_905
-# define BOOST_PP_SEQ_SIZE_905(_) BOOST_PP_SEQ_SIZE_906
-# define BOOST_PP_SEQ_SIZE_906(_) BOOST_PP_SEQ_SIZE_907
-# define BOOST_PP_SEQ_SIZE_907(_) BOOST_PP_SEQ_SIZE_908
-# define BOOST_PP_SEQ_SIZE_908(_) BOOST_PP_SEQ_SIZE_909
-# define BOOST_PP_SEQ_SIZE_909(_) BOOST_PP_SEQ_SIZE_910
-# define BOOST_PP_SEQ_SIZE_910(_) BOOST_PP_SEQ_SIZE_911
-# define BOOST_PP_SEQ_SIZE_911(_) BOOST_PP_SEQ_SIZE_912
-# define BOOST_PP_SEQ_SIZE_912(_) BOOST_PP_SEQ_SIZE_913
-# define BOOST_PP_SEQ_SIZE_913(_) BOOST_PP_SEQ_SIZE_914
-# define BOOST_PP_SEQ_SIZE_914(_) BOOST_PP_SEQ_SIZE_915
-# define BOOST_PP_SEQ_SIZE_915(_) BOOST_PP_SEQ_SIZE_916
-# define BOOST_PP_SEQ_SIZE_916(_) BOOST_PP_SEQ_SIZE_917
-# define BOOST_PP_SEQ_SIZE_917(_) BOOST_PP_SEQ_SIZE_918
-# define BOOST_PP_SEQ_SIZE_918(_) BOOST_PP_SEQ_SIZE_919
-# define BOOST_PP_SEQ_SIZE_919(_) BOOST_PP_SEQ_SIZE_920
-# define BOOST_PP_SEQ_SIZE_920(_) BOOST_PP_SEQ_SIZE_921
-# define BOOST_PP_SEQ_SIZE_921(_) BOOST_PP_SEQ_SIZE_922
-# define BOOST_PP_SEQ_SIZE_922(_) BOOST_PP_SEQ_SIZE_923
-# define BOOST_PP_SEQ_SIZE_923(_) BOOST_PP_SEQ_SIZE_924
-# define BOOST_PP_SEQ_SIZE_924(_) BOOST_PP_SEQ_SIZE_925
-# define BOOST_PP_SEQ_SIZE_925(_) BOOST_PP_SEQ_SIZE_926
-# define BOOST_PP_SEQ_SIZE_926(_) BOOST_PP_SEQ_SIZE_927
-# define BOOST_PP_SEQ_SIZE_927(_) BOOST_PP_SEQ_SIZE_928
-# define BOOST_PP_SEQ_SIZE_928(_) BOOST_PP_SEQ_SIZE_929
-# define BOOST_PP_SEQ_SIZE_929(_) BOOST_PP_SEQ_SIZE_930
-# define BOOST_PP_SEQ_SIZE_930(_) BOOST_PP_SEQ_SIZE_931
-# define BOOST_PP_SEQ_SIZE_931(_) BOOST_PP_SEQ_SIZE_932
-# define BOOST_PP_SEQ_SIZE_932(_) BOOST_PP_SEQ_SIZE_933
-# define BOOST_PP_SEQ_SIZE_933(_) BOOST_PP_SEQ_SIZE_934
-# define BOOST_PP_SEQ_SIZE_934(_) BOOST_PP_SEQ_SIZE_935
-# define BOOST_PP_SEQ_SIZE_935(_) BOOST_PP_SEQ_SIZE_936
-# define BOOST_PP_SEQ_SIZE_936(_) BOOST_PP_SEQ_SIZE_937
-# define BOOST_PP_SEQ_SIZE_937(_) BOOST_PP_SEQ_SIZE_938
-# define BOOST_PP_SEQ_SIZE_938(_) BOOST_PP_SEQ_SIZE_939
-# define BOOST_PP_SEQ_SIZE_939(_) BOOST_PP_SEQ_SIZE_940
-# define BOOST_PP_SEQ_SIZE_940(_) BOOST_PP_SEQ_SIZE_941
-# define BOOST_PP_SEQ_SIZE_941(_) BOOST_PP_SEQ_SIZE_942
-# define BOOST_PP_SEQ_SIZE_942(_) BOOST_PP_SEQ_SIZE_943
-# define BOOST_PP_SEQ_SIZE_943(_) BOOST_PP_SEQ_SIZE_944
-# define BOOST_PP_SEQ_SIZE_944(_) BOOST_PP_SEQ_SIZE_945
-# define BOOST_PP_SEQ_SIZE_945(_) BOOST_PP_SEQ_SIZE_946
-# define BOOST_PP_SEQ_SIZE_946(_) BOOST_PP_SEQ_SIZE_947
-# define BOOST_PP_SEQ_SIZE_947(_) BOOST_PP_SEQ_SIZE_948
-# define BOOST_PP_SEQ_SIZE_948(_) BOOST_PP_SEQ_SIZE_949
-# define BOOST_PP_SEQ_SIZE_949(_) BOOST_PP_SEQ_SIZE_950
-# define BOOST_PP_SEQ_SIZE_950(_) BOOST_PP_SEQ_SIZE_951
-# define BOOST_PP_SEQ_SIZE_951(_) BOOST_PP_SEQ_SIZE_952
-# define BOOST_PP_SEQ_SIZE_952(_) BOOST_PP_SEQ_SIZE_953
-# define BOOST_PP_SEQ_SIZE_953(_) BOOST_PP_SEQ_SIZE_954
-# define BOOST_PP_SEQ_SIZE_954(_) BOOST_PP_SEQ_SIZE_955
-# define BOOST_PP_SEQ_SIZE_955(_) BOOST_PP_SEQ_SIZE_956
-# define BOOST_PP_SEQ_SIZE_956(_) BOOST_PP_SEQ_SIZE_957
-# define BOOST_PP_SEQ_SIZE_957(_) BOOST_PP_SEQ_SIZE_958
-# define BOOST_PP_SEQ_SIZE_958(_) BOOST_PP_SEQ_SIZE_959
-# define BOOST_PP_SEQ_SIZE_959(_) BOOST_PP_SEQ_SIZE_960
-# define BOOST_PP_SEQ_SIZE_960(_) BOOST_PP_SEQ_SIZE_961
-# define BOOST_PP_SEQ_SIZE_961(_) BOOST_PP_SEQ_SIZE_962
-# define BOOST_PP_SEQ_SIZE_962(_) BOOST_PP_SEQ_SIZE_963
-# define BOOST_PP_SEQ_SIZE_963(_) BOOST_PP_SEQ_SIZE_964
-# define BOOST_PP_SEQ_SIZE_964(_) BOOST_PP_SEQ_SIZE_965
-# define BOOST_PP_SEQ_SIZE_965(_) BOOST_PP_SEQ_SIZE_966
-# define BOOST_PP_SEQ_SIZE_966(_) BOOST_PP_SEQ_SIZE_967
-# define BOOST_PP_SEQ_SIZE_967(_) BOOST_PP_SEQ_SIZE_968
-# define BOOST_PP_SEQ_SIZE_968(_) BOOST_PP_SEQ_SIZE_969
-# define BOOST_PP_SEQ_SIZE_969(_) BOOST_PP_SEQ_SIZE_970
-# define BOOST_PP_SEQ_SIZE_970(_) BOOST_PP_SEQ_SIZE_971
-# define BOOST_PP_SEQ_SIZE_971(_) BOOST_PP_SEQ_SIZE_972
-# define BOOST_PP_SEQ_SIZE_972(_) BOOST_PP_SEQ_SIZE_973
-# define BOOST_PP_SEQ_SIZE_973(_) BOOST_PP_SEQ_SIZE_974
-# define BOOST_PP_SEQ_SIZE_974(_) BOOST_PP_SEQ_SIZE_975
-# define BOOST_PP_SEQ_SIZE_975(_) BOOST_PP_SEQ_SIZE_976
-# define BOOST_PP_SEQ_SIZE_976(_) BOOST_PP_SEQ_SIZE_977
-# define BOOST_PP_SEQ_SIZE_977(_) BOOST_PP_SEQ_SIZE_978
-# define BOOST_PP_SEQ_SIZE_978(_) BOOST_PP_SEQ_SIZE_979
-# define BOOST_PP_SEQ_SIZE_979(_) BOOST_PP_SEQ_SIZE_980
-# define BOOST_PP_SEQ_SIZE_980(_) BOOST_PP_SEQ_SIZE_981
-# define BOOST_PP_SEQ_SIZE_981(_) BOOST_PP_SEQ_SIZE_982
-# define BOOST_PP_SEQ_SIZE_982(_) BOOST_PP_SEQ_SIZE_983
-# define BOOST_PP_SEQ_SIZE_983(_) BOOST_PP_SEQ_SIZE_984
-# define BOOST_PP_SEQ_SIZE_984(_) BOOST_PP_SEQ_SIZE_985
-# define BOOST_PP_SEQ_SIZE_985(_) BOOST_PP_SEQ_SIZE_986
-# define BOOST_PP_SEQ_SIZE_986(_) BOOST_PP_SEQ_SIZE_987
-# define BOOST_PP_SEQ_SIZE_987(_) BOOST_PP_SEQ_SIZE_988
-# define BOOST_PP_SEQ_SIZE_988(_) BOOST_PP_SEQ_SIZE_989
-# define BOOST_PP_SEQ_SIZE_989(_) BOOST_PP_SEQ_SIZE_990
-# define BOOST_PP_SEQ_SIZE_990(_) BOOST_PP_SEQ_SIZE_991
-# define BOOST_PP_SEQ_SIZE_991(_) BOOST_PP_SEQ_SIZE_992
-# define BOOST_PP_SEQ_SIZE_992(_) BOOST_PP_SEQ_SIZE_993
-# define BOOST_PP_SEQ_SIZE_993(_) BOOST_PP_SEQ_SIZE_994
-# define BOOST_PP_SEQ_SIZE_994(_) BOOST_PP_SEQ_SIZE_995
-# define BOOST_PP_SEQ_SIZE_995(_) BOOST_PP_SEQ_SIZE_996
-# define BOOST_PP_SEQ_SIZE_996(_) BOOST_PP_SEQ_SIZE_997
-# define BOOST_PP_SEQ_SIZE_997(_) BOOST_PP_SEQ_SIZE_998
-# define BOOST_PP_SEQ_SIZE_998(_) BOOST_PP_SEQ_SIZE_999
-# define BOOST_PP_SEQ_SIZE_999(_) BOOST_PP_SEQ_SIZE_1000
-# define BOOST_PP_SEQ_SIZE_1000(_) BOOST_PP_SEQ_SIZE_1001
-# define BOOST_PP_SEQ_SIZE_1001(_) BOOST_PP_SEQ_SIZE_1002
-# define BOOST_PP_SEQ_SIZE_1002(_) BOOST_PP_SEQ_SIZE_1003
-# define BOOST_PP_SEQ_SIZE_1003(_) BOOST_PP_SEQ_SIZE_1004
-# define BOOST_PP_SEQ_SIZE_1004(_) BOOST_PP_SEQ_SIZE_1005
-# define BOOST_PP_SEQ_SIZE_1005(_) BOOST_PP_SEQ_SIZE_1006
-# define BOOST_PP_SEQ_SIZE_1006(_) BOOST_PP_SEQ_SIZE_1007
-# define BOOST_PP_SEQ_SIZE_1007(_) BOOST_PP_SEQ_SIZE_1008
-# define BOOST_PP_SEQ_SIZE_1008(_) BOOST_PP_SEQ_SIZE_1009
-# define BOOST_PP_SEQ_SIZE_1009(_) BOOST_PP_SEQ_SIZE_1010
-# define BOOST_PP_SEQ_SIZE_1010(_) BOOST_PP_SEQ_SIZE_1011
-# define BOOST_PP_SEQ_SIZE_1011(_) BOOST_PP_SEQ_SIZE_1012
-# define BOOST_PP_SEQ_SIZE_1012(_) BOOST_PP_SEQ_SIZE_1013
-# define BOOST_PP_SEQ_SIZE_1013(_) BOOST_PP_SEQ_SIZE_1014
-# define BOOST_PP_SEQ_SIZE_1014(_) BOOST_PP_SEQ_SIZE_1015
-# define BOOST_PP_SEQ_SIZE_1015(_) BOOST_PP_SEQ_SIZE_1016
-# define BOOST_PP_SEQ_SIZE_1016(_) BOOST_PP_SEQ_SIZE_1017
-# define BOOST_PP_SEQ_SIZE_1017(_) BOOST_PP_SEQ_SIZE_1018
-# define BOOST_PP_SEQ_SIZE_1018(_) BOOST_PP_SEQ_SIZE_1019
-# define BOOST_PP_SEQ_SIZE_1019(_) BOOST_PP_SEQ_SIZE_1020
-# define BOOST_PP_SEQ_SIZE_1020(_) BOOST_PP_SEQ_SIZE_1021
-# define BOOST_PP_SEQ_SIZE_1021(_) BOOST_PP_SEQ_SIZE_1022
-# define BOOST_PP_SEQ_SIZE_1022(_) BOOST_PP_SEQ_SIZE_1023
-# define BOOST_PP_SEQ_SIZE_1023(_) BOOST_PP_SEQ_SIZE_1024
-# define BOOST_PP_SEQ_SIZE_1024(_) BOOST_PP_SEQ_SIZE_1025
-#
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_514 514
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_515 515
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_516 516
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_517 517
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_518 518
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_519 519
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_520 520
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_521 521
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_522 522
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_523 523
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_524 524
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_525 525
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_526 526
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_527 527
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_528 528
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_529 529
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_530 530
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_531 531
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_532 532
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_533 533
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_534 534
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_535 535
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_536 536
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_537 537
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_538 538
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_539 539
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_540 540
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_541 541
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_542 542
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_543 543
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_544 544
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_545 545
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_546 546
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_547 547
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_548 548
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_549 549
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_550 550
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_551 551
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_552 552
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_553 553
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_554 554
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_555 555
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_556 556
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_557 557
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_558 558
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_559 559
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_560 560
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_561 561
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_562 562
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_563 563
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_564 564
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_565 565
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_566 566
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_567 567
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_568 568
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_569 569
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_570 570
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_571 571
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_572 572
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_573 573
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_574 574
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_575 575
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_576 576
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_577 577
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_578 578
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_579 579
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_580 580
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_581 581
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_582 582
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_583 583
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_584 584
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_585 585
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_586 586
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_587 587
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_588 588
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_589 589
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_590 590
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_591 591
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_592 592
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_593 593
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_594 594
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_595 595
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_596 596
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_597 597
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_598 598
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_599 599
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_600 600
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_601 601
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_602 602
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_603 603
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_604 604
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_605 605
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_606 606
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_607 607
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_608 608
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_609 609
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_610 610
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_611 611
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_612 612
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_613 613
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_614 614
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_615 615
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_616 616
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_617 617
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_618 618
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_619 619
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_620 620
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_621 621
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_622 622
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_623 623
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_624 624
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_625 625
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_626 626
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_627 627
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_628 628
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_629 629
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_630 630
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_631 631
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_632 632
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_633 633
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_634 634
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_635 635
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_636 636
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_637 637
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_638 638
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_639 639
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_640 640
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_641 641
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_642 642
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_643 643
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_644 644
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_645 645
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_646 646
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_647 647
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_648 648
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_649 649
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_650 650
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_651 651
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_652 652
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_653 653
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_654 654
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_655 655
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_656 656
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_657 657
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_658 658
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_659 659
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_660 660
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_661 661
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_662 662
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_663 663
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_664 664
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_665 665
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_666 666
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_667 667
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_668 668
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_669 669
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_670 670
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_671 671
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_672 672
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_673 673
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_674 674
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_675 675
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_676 676
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_677 677
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_678 678
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_679 679
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_680 680
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_681 681
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_682 682
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_683 683
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_684 684
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_685 685
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_686 686
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_687 687
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_688 688
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_689 689
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_690 690
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_691 691
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_692 692
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_693 693
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_694 694
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_695 695
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_696 696
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_697 697
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_698 698
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_699 699
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_700 700
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_701 701
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_702 702
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_703 703
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_704 704
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_705 705
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_706 706
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_707 707
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_708 708
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_709 709
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_710 710
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_711 711
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_712 712
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_713 713
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_714 714
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_715 715
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_716 716
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_717 717
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_718 718
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_719 719
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_720 720
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_721 721
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_722 722
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_723 723
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_724 724
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_725 725
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_726 726
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_727 727
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_728 728
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_729 729
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_730 730
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_731 731
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_732 732
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_733 733
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_734 734
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_735 735
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_736 736
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_737 737
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_738 738
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_739 739
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_740 740
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_741 741
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_742 742
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_743 743
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_744 744
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_745 745
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_746 746
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_747 747
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_748 748
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_749 749
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_750 750
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_751 751
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_752 752
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_753 753
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_754 754
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_755 755
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_756 756
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_757 757
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_758 758
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_759 759
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_760 760
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_761 761
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_762 762
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_763 763
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_764 764
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_765 765
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_766 766
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_767 767
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_768 768
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_769 769
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_770 770
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_771 771
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_772 772
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_773 773
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_774 774
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_775 775
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_776 776
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_777 777
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_778 778
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_779 779
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_780 780
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_781 781
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_782 782
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_783 783
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_784 784
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_785 785
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_786 786
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_787 787
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_788 788
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_789 789
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_790 790
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_791 791
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_792 792
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_793 793
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_794 794
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_795 795
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_796 796
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_797 797
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_798 798
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_799 799
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_800 800
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_801 801
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_802 802
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_803 803
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_804 804
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_805 805
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_806 806
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_807 807
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_808 808
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_809 809
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_810 810
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_811 811
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_812 812
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_813 813
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_814 814
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_815 815
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_816 816
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_817 817
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_818 818
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_819 819
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_820 820
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_821 821
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_822 822
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_823 823
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_824 824
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_825 825
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_826 826
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_827 827
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_828 828
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_829 829
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_830 830
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_831 831
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_832 832
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_833 833
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_834 834
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_835 835
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_836 836
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_837 837
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_838 838
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_839 839
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_840 840
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_841 841
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_842 842
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_843 843
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_844 844
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_845 845
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_846 846
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_847 847
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_848 848
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_849 849
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_850 850
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_851 851
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_852 852
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_853 853
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_854 854
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_855 855
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_856 856
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_857 857
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_858 858
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_859 859
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_860 860
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_861 861
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_862 862
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_863 863
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_864 864
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_865 865
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_866 866
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_867 867
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_868 868
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_869 869
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_870 870
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_871 871
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_872 872
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_873 873
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_874 874
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_875 875
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_876 876
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_877 877
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_878 878
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_879 879
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_880 880
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_881 881
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_882 882
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_883 883
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_884 884
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_885 885
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_886 886
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_887 887
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_888 888
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_889 889
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_890 890
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_891 891
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_892 892
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_893 893
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_894 894
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_895 895
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_896 896
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_897 897
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_898 898
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_899 899
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_900 900
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_901 901
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_902 902
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_903 903
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_904 904
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_905 905
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_906 906
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_907 907
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_908 908
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_909 909
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_910 910
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_911 911
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_912 912
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_913 913
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_914 914
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_915 915
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_916 916
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_917 917
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_918 918
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_919 919
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_920 920
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_921 921
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_922 922
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_923 923
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_924 924
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_925 925
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_926 926
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_927 927
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_928 928
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_929 929
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_930 930
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_931 931
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_932 932
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_933 933
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_934 934
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_935 935
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_936 936
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_937 937
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_938 938
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_939 939
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_940 940
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_941 941
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_942 942
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_943 943
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_944 944
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_945 945
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_946 946
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_947 947
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_948 948
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_949 949
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_950 950
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_951 951
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_952 952
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_953 953
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_954 954
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_955 955
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_956 956
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_957 957
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_958 958
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_959 959
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_960 960
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_961 961
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_962 962
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_963 963
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_964 964
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_965 965
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_966 966
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_967 967
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_968 968
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_969 969
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_970 970
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_971 971
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_972 972
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_973 973
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_974 974
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_975 975
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_976 976
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_977 977
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_978 978
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_979 979
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_980 980
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_981 981
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_982 982
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_983 983
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_984 984
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_985 985
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_986 986
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_987 987
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_988 988
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_989 989
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_990 990
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_991 991
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_992 992
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_993 993
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_994 994
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_995 995
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_996 996
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_997 997
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_998 998
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_999 999
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1000 1000
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1001 1001
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1002 1002
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1003 1003
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1004 1004
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1005 1005
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1006 1006
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1007 1007
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1008 1008
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1009 1009
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1010 1010
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1011 1011
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1012 1012
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1013 1013
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1014 1014
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1015 1015
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1016 1016
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1017 1017
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1018 1018
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1019 1019
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1020 1020
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1021 1021
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1022 1022
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1023 1023
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1024 1024
-# define BOOST_PP_SEQ_SIZE_BOOST_PP_SEQ_SIZE_1025 1025
-#
-# endif
@@ -1,1747 +0,0 @@
-# /* Copyright (C) 2001
-#  * Housemarque Oy
-#  * http://www.housemarque.com
-#  *
-#  * Distributed under the Boost Software License, Version 1.0. (See
-#  * accompanying file LICENSE_1_0.txt or copy at
-#  * http://www.boost.org/LICENSE_1_0.txt)
-#  */
-#
-# /* Revised by Paul Mensonides (2002-2011) */
-# /* Revised by Edward Diener (2011,2020) */
-#
-# /* See http://www.boost.org for most recent version. */
-#
-# ifndef BOOST_PREPROCESSOR_TUPLE_TO_LIST_256_HPP
-# define BOOST_PREPROCESSOR_TUPLE_TO_LIST_256_HPP
-#
-# define BOOST_PP_TUPLE_TO_LIST_129( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )
-# define BOOST_PP_TUPLE_TO_LIST_130( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))
-# define BOOST_PP_TUPLE_TO_LIST_131( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))
-# define BOOST_PP_TUPLE_TO_LIST_132( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))
-# define BOOST_PP_TUPLE_TO_LIST_133( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))
-# define BOOST_PP_TUPLE_TO_LIST_134( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))
-# define BOOST_PP_TUPLE_TO_LIST_135( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))
-# define BOOST_PP_TUPLE_TO_LIST_136( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))
-# define BOOST_PP_TUPLE_TO_LIST_137( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))
-# define BOOST_PP_TUPLE_TO_LIST_138( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_139( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_140( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_141( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_142( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_143( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_144( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_145( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_146( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_147( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_148( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_149( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_150( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_151( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_152( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_153( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_154( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_155( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_156( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_157( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_158( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_159( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_160( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_161( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_162( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_163( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_164( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_165( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_166( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_167( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_168( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_169( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_170( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_171( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_172( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_173( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_174( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_175( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_176( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_177( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_178( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_179( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_180( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_181( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_182( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_183( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_184( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_185( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_186( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_187( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_188( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_189( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_190( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_191( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_192( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_193( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )
-# define BOOST_PP_TUPLE_TO_LIST_194( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))
-# define BOOST_PP_TUPLE_TO_LIST_195( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))
-# define BOOST_PP_TUPLE_TO_LIST_196( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))
-# define BOOST_PP_TUPLE_TO_LIST_197( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))
-# define BOOST_PP_TUPLE_TO_LIST_198( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))
-# define BOOST_PP_TUPLE_TO_LIST_199( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))
-# define BOOST_PP_TUPLE_TO_LIST_200( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))
-# define BOOST_PP_TUPLE_TO_LIST_201( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))
-# define BOOST_PP_TUPLE_TO_LIST_202( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_203( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_204( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_205( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_206( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_207( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_208( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_209( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_210( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_211( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_212( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_213( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_214( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_215( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_216( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_217( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_218( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_219( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_220( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_221( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_222( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_223( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_224( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_225( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_226( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_227( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_228( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_229( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_230( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_231( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_232( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_233( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_234( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_235( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_236( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_237( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_238( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_239( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_240( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_241( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_242( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, ( e241, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_243( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, ( e241, ( e242, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_244( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, ( e241, ( e242, ( e243, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_245( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, ( e241, ( e242, ( e243, ( e244, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_246( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, ( e241, ( e242, ( e243, ( e244, ( e245, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_247( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, ( e241, ( e242, ( e243, ( e244, ( e245, ( e246, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_248( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, ( e241, ( e242, ( e243, ( e244, ( e245, ( e246, ( e247, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_249( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, ( e241, ( e242, ( e243, ( e244, ( e245, ( e246, ( e247, ( e248, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_250( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248, e249 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, ( e241, ( e242, ( e243, ( e244, ( e245, ( e246, ( e247, ( e248, ( e249, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_251( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248, e249, e250 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, ( e241, ( e242, ( e243, ( e244, ( e245, ( e246, ( e247, ( e248, ( e249, ( e250, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_252( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248, e249, e250, e251 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, ( e241, ( e242, ( e243, ( e244, ( e245, ( e246, ( e247, ( e248, ( e249, ( e250, ( e251, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_253( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248, e249, e250, e251, e252 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, ( e241, ( e242, ( e243, ( e244, ( e245, ( e246, ( e247, ( e248, ( e249, ( e250, ( e251, ( e252, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_254( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248, e249, e250, e251, e252, e253 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, ( e241, ( e242, ( e243, ( e244, ( e245, ( e246, ( e247, ( e248, ( e249, ( e250, ( e251, ( e252, ( e253, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_255( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248, e249, e250, e251, e252, e253, e254 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, ( e241, ( e242, ( e243, ( e244, ( e245, ( e246, ( e247, ( e248, ( e249, ( e250, ( e251, ( e252, ( e253, ( e254, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-# define BOOST_PP_TUPLE_TO_LIST_256( \
-                                  e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                  e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                  e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                  e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248, e249, e250, e251, e252, e253, e254, e255 ) \
-                                  ( \
-                                  e0, (e1, (e2, (e3, (e4, (e5, (e6, (e7, (e8, (e9, (e10, (e11, (e12, (e13, (e14, (e15, (e16, (e17, (e18, (e19, (e20, (e21, (e22, (e23, (e24, (e25, (e26, (e27, (e28, (e29, (e30, (e31, (e32, (e33, (e34, (e35, (e36, (e37, (e38, (e39, (e40, (e41, (e42, (e43, (e44, (e45, (e46, (e47, (e48, (e49, (e50, (e51, (e52, (e53, (e54, (e55, (e56, (e57, (e58, (e59, (e60, (e61, (e62, (e63, \
-                                  ( e64, ( e65, ( e66, ( e67, ( e68, ( e69, ( e70, ( e71, ( e72, ( e73, ( e74, ( e75, ( e76, ( e77, ( e78, ( e79, ( e80, ( e81, ( e82, ( e83, ( e84, ( e85, ( e86, ( e87, ( e88, ( e89, ( e90, ( e91, ( e92, ( e93, ( e94, ( e95, ( e96, ( e97, ( e98, ( e99, ( e100, ( e101, ( e102, ( e103, ( e104, ( e105, ( e106, ( e107, ( e108, ( e109, ( e110, ( e111, ( e112, ( e113, ( e114, ( e115, ( e116, ( e117, ( e118, ( e119, ( e120, ( e121, ( e122, ( e123, ( e124, ( e125, ( e126, ( e127, \
-                                  ( e128, ( e129, ( e130, ( e131, ( e132, ( e133, ( e134, ( e135, ( e136, ( e137, ( e138, ( e139, ( e140, ( e141, ( e142, ( e143, ( e144, ( e145, ( e146, ( e147, ( e148, ( e149, ( e150, ( e151, ( e152, ( e153, ( e154, ( e155, ( e156, ( e157, ( e158, ( e159, ( e160, ( e161, ( e162, ( e163, ( e164, ( e165, ( e166, ( e167, ( e168, ( e169, ( e170, ( e171, ( e172, ( e173, ( e174, ( e175, ( e176, ( e177, ( e178, ( e179, ( e180, ( e181, ( e182, ( e183, ( e184, ( e185, ( e186, ( e187, ( e188, ( e189, ( e190, ( e191, \
-                                  ( e192, ( e193, ( e194, ( e195, ( e196, ( e197, ( e198, ( e199, ( e200, ( e201, ( e202, ( e203, ( e204, ( e205, ( e206, ( e207, ( e208, ( e209, ( e210, ( e211, ( e212, ( e213, ( e214, ( e215, ( e216, ( e217, ( e218, ( e219, ( e220, ( e221, ( e222, ( e223, ( e224, ( e225, ( e226, ( e227, ( e228, ( e229, ( e230, ( e231, ( e232, ( e233, ( e234, ( e235, ( e236, ( e237, ( e238, ( e239, ( e240, ( e241, ( e242, ( e243, ( e244, ( e245, ( e246, ( e247, ( e248, ( e249, ( e250, ( e251, ( e252, ( e253, ( e254, ( e255, \
-                                  BOOST_PP_NIL \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  )))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))) \
-                                  ))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
-#
-# endif
@@ -1,1171 +0,0 @@
-# /* **************************************************************************
-#  *                                                                          *
-#  *     (C) Copyright Paul Mensonides 2002-2011.                             *
-#  *     (C) Copyright Edward Diener 2011.                                    *
-#  *     Distributed under the Boost Software License, Version 1.0. (See      *
-#  *     accompanying file LICENSE_1_0.txt or copy at                         *
-#  *     http://www.boost.org/LICENSE_1_0.txt)                                *
-#  *                                                                          *
-#  ************************************************************************** */
-#
-# /* Revised by Edward Diener (2020) */
-#
-# /* See http://www.boost.org for most recent version. */
-#
-# ifndef BOOST_PREPROCESSOR_TUPLE_TO_SEQ_256_HPP
-# define BOOST_PREPROCESSOR_TUPLE_TO_SEQ_256_HPP
-#
-# define BOOST_PP_TUPLE_TO_SEQ_129( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)
-# define BOOST_PP_TUPLE_TO_SEQ_130( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)
-# define BOOST_PP_TUPLE_TO_SEQ_131( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)
-# define BOOST_PP_TUPLE_TO_SEQ_132( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)
-# define BOOST_PP_TUPLE_TO_SEQ_133( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)
-# define BOOST_PP_TUPLE_TO_SEQ_134( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)
-# define BOOST_PP_TUPLE_TO_SEQ_135( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)
-# define BOOST_PP_TUPLE_TO_SEQ_136( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)
-# define BOOST_PP_TUPLE_TO_SEQ_137( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)
-# define BOOST_PP_TUPLE_TO_SEQ_138( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)
-# define BOOST_PP_TUPLE_TO_SEQ_139( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)
-# define BOOST_PP_TUPLE_TO_SEQ_140( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)
-# define BOOST_PP_TUPLE_TO_SEQ_141( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)
-# define BOOST_PP_TUPLE_TO_SEQ_142( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)
-# define BOOST_PP_TUPLE_TO_SEQ_143( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)
-# define BOOST_PP_TUPLE_TO_SEQ_144( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)
-# define BOOST_PP_TUPLE_TO_SEQ_145( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)
-# define BOOST_PP_TUPLE_TO_SEQ_146( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)
-# define BOOST_PP_TUPLE_TO_SEQ_147( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)
-# define BOOST_PP_TUPLE_TO_SEQ_148( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)
-# define BOOST_PP_TUPLE_TO_SEQ_149( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)
-# define BOOST_PP_TUPLE_TO_SEQ_150( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)
-# define BOOST_PP_TUPLE_TO_SEQ_151( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)
-# define BOOST_PP_TUPLE_TO_SEQ_152( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)
-# define BOOST_PP_TUPLE_TO_SEQ_153( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)
-# define BOOST_PP_TUPLE_TO_SEQ_154( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)
-# define BOOST_PP_TUPLE_TO_SEQ_155( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)
-# define BOOST_PP_TUPLE_TO_SEQ_156( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)
-# define BOOST_PP_TUPLE_TO_SEQ_157( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)
-# define BOOST_PP_TUPLE_TO_SEQ_158( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)
-# define BOOST_PP_TUPLE_TO_SEQ_159( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)
-# define BOOST_PP_TUPLE_TO_SEQ_160( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)
-# define BOOST_PP_TUPLE_TO_SEQ_161( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)
-# define BOOST_PP_TUPLE_TO_SEQ_162( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)
-# define BOOST_PP_TUPLE_TO_SEQ_163( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)
-# define BOOST_PP_TUPLE_TO_SEQ_164( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)
-# define BOOST_PP_TUPLE_TO_SEQ_165( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)
-# define BOOST_PP_TUPLE_TO_SEQ_166( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)
-# define BOOST_PP_TUPLE_TO_SEQ_167( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)
-# define BOOST_PP_TUPLE_TO_SEQ_168( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)
-# define BOOST_PP_TUPLE_TO_SEQ_169( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)
-# define BOOST_PP_TUPLE_TO_SEQ_170( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)
-# define BOOST_PP_TUPLE_TO_SEQ_171( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)
-# define BOOST_PP_TUPLE_TO_SEQ_172( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)
-# define BOOST_PP_TUPLE_TO_SEQ_173( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)
-# define BOOST_PP_TUPLE_TO_SEQ_174( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)
-# define BOOST_PP_TUPLE_TO_SEQ_175( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)
-# define BOOST_PP_TUPLE_TO_SEQ_176( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)
-# define BOOST_PP_TUPLE_TO_SEQ_177( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)
-# define BOOST_PP_TUPLE_TO_SEQ_178( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)
-# define BOOST_PP_TUPLE_TO_SEQ_179( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)
-# define BOOST_PP_TUPLE_TO_SEQ_180( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)
-# define BOOST_PP_TUPLE_TO_SEQ_181( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)
-# define BOOST_PP_TUPLE_TO_SEQ_182( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)
-# define BOOST_PP_TUPLE_TO_SEQ_183( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)
-# define BOOST_PP_TUPLE_TO_SEQ_184( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)
-# define BOOST_PP_TUPLE_TO_SEQ_185( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)
-# define BOOST_PP_TUPLE_TO_SEQ_186( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)
-# define BOOST_PP_TUPLE_TO_SEQ_187( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)
-# define BOOST_PP_TUPLE_TO_SEQ_188( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)
-# define BOOST_PP_TUPLE_TO_SEQ_189( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)
-# define BOOST_PP_TUPLE_TO_SEQ_190( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)
-# define BOOST_PP_TUPLE_TO_SEQ_191( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)
-# define BOOST_PP_TUPLE_TO_SEQ_192( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191)
-# define BOOST_PP_TUPLE_TO_SEQ_193( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)
-# define BOOST_PP_TUPLE_TO_SEQ_194( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)
-# define BOOST_PP_TUPLE_TO_SEQ_195( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)
-# define BOOST_PP_TUPLE_TO_SEQ_196( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)
-# define BOOST_PP_TUPLE_TO_SEQ_197( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)
-# define BOOST_PP_TUPLE_TO_SEQ_198( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)
-# define BOOST_PP_TUPLE_TO_SEQ_199( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)
-# define BOOST_PP_TUPLE_TO_SEQ_200( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)
-# define BOOST_PP_TUPLE_TO_SEQ_201( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)
-# define BOOST_PP_TUPLE_TO_SEQ_202( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)
-# define BOOST_PP_TUPLE_TO_SEQ_203( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)
-# define BOOST_PP_TUPLE_TO_SEQ_204( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)
-# define BOOST_PP_TUPLE_TO_SEQ_205( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)
-# define BOOST_PP_TUPLE_TO_SEQ_206( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)
-# define BOOST_PP_TUPLE_TO_SEQ_207( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)
-# define BOOST_PP_TUPLE_TO_SEQ_208( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)
-# define BOOST_PP_TUPLE_TO_SEQ_209( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)
-# define BOOST_PP_TUPLE_TO_SEQ_210( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)
-# define BOOST_PP_TUPLE_TO_SEQ_211( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)
-# define BOOST_PP_TUPLE_TO_SEQ_212( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)
-# define BOOST_PP_TUPLE_TO_SEQ_213( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)
-# define BOOST_PP_TUPLE_TO_SEQ_214( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)
-# define BOOST_PP_TUPLE_TO_SEQ_215( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)
-# define BOOST_PP_TUPLE_TO_SEQ_216( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)
-# define BOOST_PP_TUPLE_TO_SEQ_217( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)
-# define BOOST_PP_TUPLE_TO_SEQ_218( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)
-# define BOOST_PP_TUPLE_TO_SEQ_219( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)
-# define BOOST_PP_TUPLE_TO_SEQ_220( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)
-# define BOOST_PP_TUPLE_TO_SEQ_221( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)
-# define BOOST_PP_TUPLE_TO_SEQ_222( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)
-# define BOOST_PP_TUPLE_TO_SEQ_223( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)
-# define BOOST_PP_TUPLE_TO_SEQ_224( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)
-# define BOOST_PP_TUPLE_TO_SEQ_225( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)
-# define BOOST_PP_TUPLE_TO_SEQ_226( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)
-# define BOOST_PP_TUPLE_TO_SEQ_227( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)
-# define BOOST_PP_TUPLE_TO_SEQ_228( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)
-# define BOOST_PP_TUPLE_TO_SEQ_229( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)
-# define BOOST_PP_TUPLE_TO_SEQ_230( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)
-# define BOOST_PP_TUPLE_TO_SEQ_231( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)
-# define BOOST_PP_TUPLE_TO_SEQ_232( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)
-# define BOOST_PP_TUPLE_TO_SEQ_233( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)
-# define BOOST_PP_TUPLE_TO_SEQ_234( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)
-# define BOOST_PP_TUPLE_TO_SEQ_235( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)
-# define BOOST_PP_TUPLE_TO_SEQ_236( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)
-# define BOOST_PP_TUPLE_TO_SEQ_237( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)
-# define BOOST_PP_TUPLE_TO_SEQ_238( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)
-# define BOOST_PP_TUPLE_TO_SEQ_239( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)
-# define BOOST_PP_TUPLE_TO_SEQ_240( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)
-# define BOOST_PP_TUPLE_TO_SEQ_241( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)
-# define BOOST_PP_TUPLE_TO_SEQ_242( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)(e241)
-# define BOOST_PP_TUPLE_TO_SEQ_243( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)(e241)(e242)
-# define BOOST_PP_TUPLE_TO_SEQ_244( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)(e241)(e242)(e243)
-# define BOOST_PP_TUPLE_TO_SEQ_245( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)(e241)(e242)(e243)(e244)
-# define BOOST_PP_TUPLE_TO_SEQ_246( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)(e241)(e242)(e243)(e244)(e245)
-# define BOOST_PP_TUPLE_TO_SEQ_247( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)(e241)(e242)(e243)(e244)(e245)(e246)
-# define BOOST_PP_TUPLE_TO_SEQ_248( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)(e241)(e242)(e243)(e244)(e245)(e246)(e247)
-# define BOOST_PP_TUPLE_TO_SEQ_249( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)(e241)(e242)(e243)(e244)(e245)(e246)(e247)(e248)
-# define BOOST_PP_TUPLE_TO_SEQ_250( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248, e249 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)(e241)(e242)(e243)(e244)(e245)(e246)(e247)(e248)(e249)
-# define BOOST_PP_TUPLE_TO_SEQ_251( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248, e249, e250 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)(e241)(e242)(e243)(e244)(e245)(e246)(e247)(e248)(e249)(e250)
-# define BOOST_PP_TUPLE_TO_SEQ_252( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248, e249, e250, e251 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)(e241)(e242)(e243)(e244)(e245)(e246)(e247)(e248)(e249)(e250)(e251)
-# define BOOST_PP_TUPLE_TO_SEQ_253( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248, e249, e250, e251, e252 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)(e241)(e242)(e243)(e244)(e245)(e246)(e247)(e248)(e249)(e250)(e251)(e252)
-# define BOOST_PP_TUPLE_TO_SEQ_254( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248, e249, e250, e251, e252, e253 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)(e241)(e242)(e243)(e244)(e245)(e246)(e247)(e248)(e249)(e250)(e251)(e252)(e253)
-# define BOOST_PP_TUPLE_TO_SEQ_255( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248, e249, e250, e251, e252, e253, e254 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)(e241)(e242)(e243)(e244)(e245)(e246)(e247)(e248)(e249)(e250)(e251)(e252)(e253)(e254)
-# define BOOST_PP_TUPLE_TO_SEQ_256( \
-                                 e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19, e20, e21, e22, e23, e24, e25, e26, e27, e28, e29, e30, e31, e32, e33, e34, e35, e36, e37, e38, e39, e40, e41, e42, e43, e44, e45, e46, e47, e48, e49, e50, e51, e52, e53, e54, e55, e56, e57, e58, e59, e60, e61, e62, e63, \
-                                 e64, e65, e66, e67, e68, e69, e70, e71, e72, e73, e74, e75, e76, e77, e78, e79, e80, e81, e82, e83, e84, e85, e86, e87, e88, e89, e90, e91, e92, e93, e94, e95, e96, e97, e98, e99, e100, e101, e102, e103, e104, e105, e106, e107, e108, e109, e110, e111, e112, e113, e114, e115, e116, e117, e118, e119, e120, e121, e122, e123, e124, e125, e126, e127, \
-                                 e128, e129, e130, e131, e132, e133, e134, e135, e136, e137, e138, e139, e140, e141, e142, e143, e144, e145, e146, e147, e148, e149, e150, e151, e152, e153, e154, e155, e156, e157, e158, e159, e160, e161, e162, e163, e164, e165, e166, e167, e168, e169, e170, e171, e172, e173, e174, e175, e176, e177, e178, e179, e180, e181, e182, e183, e184, e185, e186, e187, e188, e189, e190, e191, \
-                                 e192, e193, e194, e195, e196, e197, e198, e199, e200, e201, e202, e203, e204, e205, e206, e207, e208, e209, e210, e211, e212, e213, e214, e215, e216, e217, e218, e219, e220, e221, e222, e223, e224, e225, e226, e227, e228, e229, e230, e231, e232, e233, e234, e235, e236, e237, e238, e239, e240, e241, e242, e243, e244, e245, e246, e247, e248, e249, e250, e251, e252, e253, e254, e255 \
-                                 ) \
-                                 (e0)(e1)(e2)(e3)(e4)(e5)(e6)(e7)(e8)(e9)(e10)(e11)(e12)(e13)(e14)(e15)(e16)(e17)(e18)(e19)(e20)(e21)(e22)(e23)(e24)(e25)(e26)(e27)(e28)(e29)(e30)(e31)(e32)(e33)(e34)(e35)(e36)(e37)(e38)(e39)(e40)(e41)(e42)(e43)(e44)(e45)(e46)(e47)(e48)(e49)(e50)(e51)(e52)(e53)(e54)(e55)(e56)(e57)(e58)(e59)(e60)(e61)(e62)(e63) \
-                                 (e64)(e65)(e66)(e67)(e68)(e69)(e70)(e71)(e72)(e73)(e74)(e75)(e76)(e77)(e78)(e79)(e80)(e81)(e82)(e83)(e84)(e85)(e86)(e87)(e88)(e89)(e90)(e91)(e92)(e93)(e94)(e95)(e96)(e97)(e98)(e99)(e100)(e101)(e102)(e103)(e104)(e105)(e106)(e107)(e108)(e109)(e110)(e111)(e112)(e113)(e114)(e115)(e116)(e117)(e118)(e119)(e120)(e121)(e122)(e123)(e124)(e125)(e126)(e127) \
-                                 (e128)(129)(e130)(e131)(e132)(e133)(e134)(e135)(e136)(e137)(e138)(e139)(e140)(e141)(e142)(e143)(e144)(e145)(e146)(e147)(e148)(e149)(e150)(e151)(e152)(e153)(e154)(e155)(e156)(e157)(e158)(e159)(e160)(e161)(e162)(e163)(e164)(e165)(e166)(e167)(e168)(e169)(e170)(e171)(e172)(e173)(e174)(e175)(e176)(e177)(e178)(e179)(e180)(e181)(e182)(e183)(e184)(e185)(e186)(e187)(e188)(e189)(e190)(e191) \
-                                 (e192)(193)(e194)(e195)(e196)(e197)(e198)(e199)(e200)(e201)(e202)(e203)(e204)(e205)(e206)(e207)(e208)(e209)(e210)(e211)(e212)(e213)(e214)(e215)(e216)(e217)(e218)(e219)(e220)(e221)(e222)(e223)(e224)(e225)(e226)(e227)(e228)(e229)(e230)(e231)(e232)(e233)(e234)(e235)(e236)(e237)(e238)(e239)(e240)(e241)(e242)(e243)(e244)(e245)(e246)(e247)(e248)(e249)(e250)(e251)(e252)(e253)(e254)(e255)
-#
-# endif
@@ -0,0 +1,66 @@
+// MIT License
+//
+// Copyright (c) 2025 Siarhei Homan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+module;
+
+#include <comock/comock.h>
+
+export module comock;
+
+export namespace comock {
+
+using comock::Repo;
+
+using comock::CallBudget;
+using comock::CallObserver;
+using comock::Clock;
+using comock::ConcurrencyLimit;
+using comock::ExpectationScript;
+using comock::Latency;
+using comock::MockArray;
+using comock::Naggy;
+using comock::Nice;
+using comock::RepoSnapshot;
+using comock::ServerModel;
+using comock::SimulatedServer;
+using comock::Strict;
+using comock::SystemClock;
+using comock::VirtualClock;
+
+using comock::BatchingOpportunity;
+using comock::BatchingReport;
+using comock::CostReport;
+using comock::MethodCost;
+using comock::RedundantCallReport;
+using comock::RedundantCalls;
+using comock::ScenarioCost;
+using comock::operator<<;
+
+namespace internal {
+
+// The base of every mock. The mock definition macros reach the rest of the
+// internals through its member aliases.
+using internal::MockBase;
+
+}  // namespace internal
+
+}  // namespace comock
@@ -22,246 +22,1852 @@
 
 #pragma once
 
-#include <any>
-#include <deque>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <functional>
 #include <iostream>
+#include <iterator>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
-
-#include <boost/preprocessor/comparison.hpp>
-#include <boost/preprocessor/control.hpp>
-#include <boost/preprocessor/punctuation.hpp>
-#include <boost/preprocessor/seq.hpp>
+#include <utility>
+#include <vector>
 
 namespace comock {
 
+struct MethodCost {
+  std::string method;
+  std::size_t calls;
+  double cost;
+};
+
+struct ScenarioCost {
+  std::string name;
+  double total;
+  std::vector<MethodCost> methods;
+};
+
+// Synthetic cost accumulated by mocked calls, see Repo::setCallCost.
+struct CostReport {
+  std::vector<ScenarioCost> scenarios;
+
+  double total() const {
+    auto total = 0.0;
+    for (auto const& scenario : scenarios) {
+      total += scenario.total;
+    }
+    return total;
+  }
+
+  ScenarioCost const* scenario(std::string const& name) const {
+    for (auto const& scenario : scenarios) {
+      if (scenario.name == name) {
+        return &scenario;
+      }
+    }
+    return nullptr;
+  }
+};
+
+inline std::ostream& operator<<(std::ostream& stream,
+                                CostReport const& report) {
+  for (auto const& scenario : report.scenarios) {
+    stream << "[comock] Scenario '" << scenario.name
+           << "' cost: " << scenario.total << "\n";
+    for (auto const& method : scenario.methods) {
+      stream << "[comock]   " << method.method << ": " << method.cost << " ("
+             << method.calls << " calls)\n";
+    }
+  }
+  return stream;
+}
+
+struct RedundantCalls {
+  std::string method;
+  std::size_t calls;
+  std::size_t redundant_calls;
+};
+
+// Calls repeated with identical arguments, see Repo::detectRedundantCalls.
+struct RedundantCallReport {
+  std::vector<RedundantCalls> methods;
+
+  RedundantCalls const* method(std::string const& name) const {
+    for (auto const& method : methods) {
+      if (method.method == name) {
+        return &method;
+      }
+    }
+    return nullptr;
+  }
+};
+
+inline std::ostream& operator<<(std::ostream& stream,
+                                RedundantCallReport const& report) {
+  for (auto const& method : report.methods) {
+    stream << "[comock] " << method.method << ": " << method.redundant_calls
+           << " of " << method.calls << " calls repeated\n";
+  }
+  return stream;
+}
+
+struct BatchingOpportunity {
+  std::string method;
+  std::string batch_method;
+  std::size_t calls;
+  // Maximal runs of consecutive calls on the same mock.
+  std::size_t runs;
+  std::size_t longest_run;
+  // Calls in runs of two or more, which a batch call could replace.
+  std::size_t batchable_calls;
+};
+
+// Runs of consecutive calls, see Repo::detectBatchingOpportunities.
+struct BatchingReport {
+  std::vector<BatchingOpportunity> methods;
+
+  BatchingOpportunity const* method(std::string const& name) const {
+    for (auto const& method : methods) {
+      if (method.method == name) {
+        return &method;
+      }
+    }
+    return nullptr;
+  }
+};
+
+inline std::ostream& operator<<(std::ostream& stream,
+                                BatchingReport const& report) {
+  for (auto const& method : report.methods) {
+    stream << "[comock] " << method.method << ": " << method.calls
+           << " calls in " << method.runs << " runs, longest run "
+           << method.longest_run << ", " << method.batchable_calls
+           << " calls could use "
+           << (method.batch_method.empty() ? "a batch call"
+                                           : method.batch_method)
+           << "\n";
+  }
+  return stream;
+}
+
+namespace internal {
+
+// Small deterministic PRNG (SplitMix64). Its output, unlike that of the
+// standard distributions, is the same on every platform for a given seed.
+class Random {
+ public:
+  explicit Random(std::uint64_t const seed) : state_{seed} {}
+
+  std::uint64_t next() {
+    auto value = (state_ += 0x9e3779b97f4a7c15ull);
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    return value ^ (value >> 31);
+  }
+
+  // Uniformly distributed in [0, 1).
+  double uniform() { return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+
+ private:
+  std::uint64_t state_;
+};
+
+}  // namespace internal
+
+// Time source for code under test. Production code uses SystemClock, tests
+// inject the VirtualClock of a Repo.
+class Clock {
+ public:
+  using duration = std::chrono::nanoseconds;
+  using time_point = std::chrono::time_point<Clock, duration>;
+
+  virtual ~Clock() = default;
+
+  virtual time_point now() const = 0;
+};
+
+class SystemClock : public Clock {
+ public:
+  time_point now() const override {
+    return time_point{std::chrono::duration_cast<duration>(
+        std::chrono::steady_clock::now().time_since_epoch())};
+  }
+};
+
+// Clock that only moves when advanced, either explicitly or by the latency
+// of mocked calls.
+class VirtualClock : public Clock {
+ public:
+  time_point now() const override { return now_; }
+
+  void advance(duration const duration) { now_ += duration; }
+
+ private:
+  time_point now_ = {};
+};
+
+// Simulated latency of a mocked method, see Repo::setLatency.
+class Latency {
+ public:
+  static Latency fixed(Clock::duration const latency) {
+    return Latency{[latency]() { return latency; }};
+  }
+
+  // Latencies of consecutive calls. The last one is repeated once the
+  // sequence is exhausted.
+  static Latency sequence(std::vector<Clock::duration> latencies) {
+    if (latencies.empty()) {
+      throw std::invalid_argument{"[comock] Latency sequence is empty."};
+    }
+
+    auto generator = [latencies = std::move(latencies),
+                      index = std::size_t{0}]() mutable {
+      auto const latency = latencies[index];
+      if (index + 1 < latencies.size()) {
+        ++index;
+      }
+      return latency;
+    };
+    return Latency{std::move(generator)};
+  }
+
+  static Latency uniform(Clock::duration const min,
+                         Clock::duration const max,
+                         std::uint64_t const seed) {
+    return Latency{[min, max, random = internal::Random{seed}]() mutable {
+      auto const range = static_cast<double>((max - min).count());
+      return min + Clock::duration{static_cast<Clock::duration::rep>(
+                       range * random.uniform())};
+    }};
+  }
+
+  static Latency exponential(Clock::duration const mean,
+                             std::uint64_t const seed) {
+    return Latency{[mean, random = internal::Random{seed}]() mutable {
+      auto const scale = -std::log(1.0 - random.uniform());
+      return Clock::duration{static_cast<Clock::duration::rep>(
+          static_cast<double>(mean.count()) * scale)};
+    }};
+  }
+
+  explicit Latency(std::function<Clock::duration()> generator)
+      : generator_{std::move(generator)} {}
+
+  Clock::duration operator()() { return generator_(); }
+
+ private:
+  std::function<Clock::duration()> generator_;
+};
+
+struct ServerModel {
+  std::size_t concurrency = 1;
+  std::size_t queue_capacity = 0;
+  Latency service_time = Latency::fixed({});
+  // Blocking callers wait for their request: the call advances the virtual
+  // clock to the end of its service. Otherwise the call returns at once and
+  // the server stays busy in the background.
+  bool blocking = true;
+};
+
+// Queueing model of a dependency with limited concurrency and a bounded queue,
+// driven by a virtual clock. Its serve() callbacks are meant for onCall:
+//
+//   repo.onCall(*mock, &Backend::send, server.serve(on_accept, on_reject));
+//
+// The server must outlive the callbacks it creates.
+class SimulatedServer {
+ public:
+  struct Admission {
+    Clock::time_point arrival;
+    Clock::time_point start;
+    Clock::time_point finish;
+  };
+
+  SimulatedServer(VirtualClock& clock, ServerModel model)
+      : clock_{clock},
+        model_{std::move(model)},
+        busy_until_(model_.concurrency, Clock::time_point{}) {
+    if (model_.concurrency == 0) {
+      throw std::invalid_argument{
+          "[comock] Simulated server needs a concurrency of at least 1."};
+    }
+  }
+
+  // Admits a request arriving now, or rejects it if all servers are busy and
+  // the queue is full.
+  std::optional<Admission> admit() {
+    auto const now = clock_.now();
+
+    jobs_.erase(std::remove_if(jobs_.begin(), jobs_.end(),
+                               [now](Admission const& job) {
+                                 return job.finish <= now;
+                               }),
+                jobs_.end());
+
+    if (jobs_.size() >= model_.concurrency + model_.queue_capacity) {
+      ++rejected_;
+      return std::nullopt;
+    }
+
+    auto const server =
+        std::min_element(busy_until_.begin(), busy_until_.end());
+    auto const start = std::max(now, *server);
+    auto const admission = Admission{now, start, start + model_.service_time()};
+    *server = admission.finish;
+    jobs_.push_back(admission);
+    ++accepted_;
+
+    auto const queued = static_cast<std::size_t>(std::count_if(
+        jobs_.begin(), jobs_.end(),
+        [now](Admission const& job) { return job.start > now; }));
+    max_queue_length_ = std::max(max_queue_length_, queued);
+
+    if (model_.blocking) {
+      clock_.advance(admission.finish - now);
+    }
+
+    return admission;
+  }
+
+  // Returns a callback that calls on_accept for admitted requests and
+  // on_reject for rejected ones. on_accept may take the Admission as its
+  // first argument, followed by the call arguments.
+  template <typename OnAccept, typename OnReject>
+  auto serve(OnAccept on_accept, OnReject on_reject) {
+    return [this, on_accept = std::move(on_accept),
+            on_reject = std::move(on_reject)](auto... args) {
+      if (auto const admission = admit()) {
+        if constexpr (std::is_invocable_v<OnAccept const&, Admission const&,
+                                          decltype(args)...>) {
+          return on_accept(*admission, std::move(args)...);
+        } else {
+          return on_accept(std::move(args)...);
+        }
+      }
+      return on_reject(std::move(args)...);
+    };
+  }
+
+  std::size_t accepted() const { return accepted_; }
+
+  std::size_t rejected() const { return rejected_; }
+
+  std::size_t maxQueueLength() const { return max_queue_length_; }
+
+ private:
+  VirtualClock& clock_;
+  ServerModel model_;
+  std::vector<Clock::time_point> busy_until_;
+  std::vector<Admission> jobs_ = {};
+  std::size_t accepted_ = 0;
+  std::size_t rejected_ = 0;
+  std::size_t max_queue_length_ = 0;
+};
+
+// Notified on the calling thread when a mocked call starts, before it is
+// dispatched, and when its callback finishes, see Repo::addCallObserver. The
+// names are static strings, so observers can record them without allocating.
+class CallObserver {
+ public:
+  virtual ~CallObserver() = default;
+
+  virtual void callStarted(char const* type, char const* method) = 0;
+
+  virtual void callFinished(char const* type, char const* method) = 0;
+};
+
 namespace internal {
 
+// Access of coroutine scripts (comock_script.h) to the repository.
+struct ScriptAccess;
+
+struct MockTypeInfo {
+  char const* name;
+};
+
+// Compile-time identity of a mocked method, emitted by the mock definition
+// macros. A default constructed key does not identify any method.
+struct MethodKey {
+  MockTypeInfo const* type = nullptr;
+  void const* id = nullptr;
+  char const* name = "";
+
+  constexpr bool operator==(MethodKey const& other) const {
+    return type == other.type && id == other.id;
+  }
+
+  constexpr bool operator!=(MethodKey const& other) const {
+    return !(*this == other);
+  }
+
+  constexpr explicit operator bool() const { return type != nullptr; }
+};
+
+// The address of id identifies the mocked member function Method. Unlike a
+// counter, it is the same in every translation unit.
+template <auto Method>
+struct MethodId {
+  static constexpr char id = 0;
+};
+
+// Overload tag of a method slot.
+template <int N>
+struct MethodSlot {};
+
+// Callback stored as std::function<ReturnType(Args...)> behind a
+// signature-agnostic pointer. The MethodKey it is registered with determines
+// the signature, so it is cast back without a type check.
+using ErasedCallback = std::shared_ptr<void const>;
+
+template <typename ReturnType, typename... Args>
+ErasedCallback eraseCallback(std::function<ReturnType(Args...)> callback) {
+  return std::make_shared<std::function<ReturnType(Args...)> const>(
+      std::move(callback));
+}
+
+template <typename ReturnType, typename... Args>
+std::function<ReturnType(Args...)> const& restoreCallback(
+    ErasedCallback const& callback) {
+  return *static_cast<std::function<ReturnType(Args...)> const*>(
+      callback.get());
+}
+
 class ExpectedCallbackQueue {
  public:
-  template <typename ReturnType, typename Mock, typename... Args>
+  // Mock id of expectations that any mock of the method's type satisfies.
+  static constexpr uintptr_t any_mock = 0;
+
+  struct ExpectedCallback {
+    std::string description;
+    uintptr_t mock;
+    MethodKey method;
+    ErasedCallback callback;
+    // Consecutive calls that the expectation covers.
+    std::size_t count = 1;
+  };
+
+  // Expectations shared between queues, consumed through a cursor.
+  using Script = std::vector<ExpectedCallback>;
+
   void push(std::string description,
-            Mock const& mock,
-            ReturnType (Mock::MockedType::*method)(Args...),
-            std::function<ReturnType(Args...)> callback) {
-    callbacks_.push_back(std::make_tuple(std::move(description),
-                                         reinterpret_cast<uintptr_t>(&mock),
-                                         method, std::move(callback)));
+            uintptr_t const mock,
+            MethodKey const method,
+            ErasedCallback callback) {
+    callbacks_.push_back(
+        {std::move(description), mock, method, std::move(callback)});
+    updatePending();
   }
 
-  template <typename ReturnType, typename Mock, typename... Args>
-  void push(std::string description,
-            Mock const& mock,
-            ReturnType (Mock::MockedType::*method)(Args...) const,
-            std::function<ReturnType(Args...)> callback) {
-    callbacks_.push_back(std::make_tuple(std::move(description),
-                                         reinterpret_cast<uintptr_t>(&mock),
-                                         method, std::move(callback)));
+  // Popped expectations are released right away, their slots once they make
+  // up half of the queue. The queue keeps its capacity, so refilling it does
+  // not allocate again.
+  void pop() {
+    if (script_front_ < scriptSize()) {
+      if (++script_calls_ == (*script_)[script_front_].count) {
+        ++script_front_;
+        script_calls_ = 0;
+      }
+      updatePending();
+      return;
+    }
+
+    auto& front = callbacks_[front_];
+    std::string{}.swap(front.description);
+    front.callback.reset();
+
+    if (++front_ * 2 >= callbacks_.size()) {
+      callbacks_.erase(callbacks_.begin(), callbacks_.begin() + front_);
+      front_ = 0;
+    }
+    updatePending();
   }
 
-  void pop() { callbacks_.pop_front(); }
+  void clear() {
+    script_.reset();
+    script_front_ = 0;
+    script_calls_ = 0;
+    callbacks_.clear();
+    front_ = 0;
+    updatePending();
+  }
+
+  // Moves the remaining expectations into a script, which the queue then
+  // shares with the caller.
+  std::shared_ptr<Script const> snapshot() {
+    if (script_front_ == 0 && script_calls_ == 0 &&
+        front_ == callbacks_.size()) {
+      return script_;
+    }
+
+    auto script = std::make_shared<Script>();
+    script->reserve(scriptSize() - script_front_ + callbacks_.size() - front_);
 
-  bool isEmpty() const { return callbacks_.empty(); }
+    if (script_) {
+      script->insert(script->end(), script_->begin() + script_front_,
+                     script_->end());
 
-  template <typename ReturnType, typename Mock, typename... Args>
-  bool peekMatch(Mock const& mock,
-                 ReturnType (Mock::MockedType::*method)(Args...)) const {
-    return matchInternal(reinterpret_cast<uintptr_t>(&mock), method);
+      if (!script->empty()) {
+        script->front().count -= script_calls_;
+      }
+    }
+    std::move(callbacks_.begin() + front_, callbacks_.end(),
+              std::back_inserter(*script));
+
+    clear();
+    script_ = std::move(script);
+    updatePending();
+    return script_;
   }
 
-  template <typename ReturnType, typename Mock, typename... Args>
-  bool peekMatch(Mock const& mock,
-                 ReturnType (Mock::MockedType::*method)(Args...) const) const {
-    return matchInternal(reinterpret_cast<uintptr_t>(&mock), method);
+  // Replaces the expectations with the script. Expectations pushed later
+  // follow the script.
+  void bind(std::shared_ptr<Script const> script) {
+    clear();
+    script_ = std::move(script);
+    updatePending();
   }
 
-  std::string peekDescription() const {
-    return std::get<0>(callbacks_.front());
+  bool isEmpty() const {
+    return script_front_ == scriptSize() && front_ == callbacks_.size();
   }
 
-  template <typename ReturnType, typename... Args>
-  std::function<ReturnType(Args...)> peekCallback() const {
-    return std::any_cast<std::function<ReturnType(Args...)>>(
-        std::get<3>(callbacks_.front()));
+  // Same as !isEmpty(), but may be read without the lock.
+  bool hasPending() const { return pending_.load(std::memory_order_relaxed); }
+
+  bool peekMatch(uintptr_t const mock, MethodKey const& method) const {
+    auto const& front = peek();
+    return (front.mock == mock || front.mock == any_mock) &&
+           front.method == method;
   }
 
+  std::string peekDescription() const { return peek().description; }
+
+  ErasedCallback peekCallback() const { return peek().callback; }
+
  private:
-  template <typename Method>
-  bool matchInternal(uintptr_t const mock, Method method) const {
-    auto const& front = callbacks_.front();
+  std::size_t scriptSize() const { return script_ ? script_->size() : 0; }
+
+  void updatePending() {
+    pending_.store(!isEmpty(), std::memory_order_relaxed);
+  }
+
+  ExpectedCallback const& peek() const {
+    return script_front_ < scriptSize() ? (*script_)[script_front_]
+                                        : callbacks_[front_];
+  }
+
+  std::shared_ptr<Script const> script_;
+  std::size_t script_front_ = 0;
+  // Calls of the script's front expectation that already happened.
+  std::size_t script_calls_ = 0;
+  std::vector<ExpectedCallback> callbacks_;
+  std::size_t front_ = 0;
+  std::atomic<bool> pending_{false};
+};
+
+class FallbackCallbacks {
+ public:
+  void add(uintptr_t const mock,
+           MethodKey const method,
+           ErasedCallback callback) {
+    callbacks_[mock].emplace_back(method, std::move(callback));
+    ++size_;
+  }
+
+  // Shared callbacks apply to every mock of the method's type that has no
+  // callback of its own.
+  void addShared(MethodKey const method, ErasedCallback callback) {
+    shared_callbacks_.emplace_back(method, std::move(callback));
+    ++size_;
+  }
+
+  bool isEmpty() const { return size_ == 0 && !base_; }
+
+  // Releases every callback, but keeps the storage of mocks that received
+  // callbacks since the previous clear, so that the next iteration of a
+  // test reuses it. Storage of other mocks is released.
+  void clear() {
+    for (auto callbacks_it = callbacks_.begin();
+         callbacks_it != callbacks_.end();) {
+      if (callbacks_it->second.empty()) {
+        callbacks_it = callbacks_.erase(callbacks_it);
+      } else {
+        callbacks_it->second.clear();
+        ++callbacks_it;
+      }
+    }
+
+    shared_callbacks_.clear();
+    size_ = 0;
+    base_.reset();
+  }
 
-    auto const expected_mock = std::get<1>(front);
-    if (expected_mock != mock) {
-      return false;
+  // Moves the callbacks into an immutable layer, which the callbacks then
+  // share with the caller. Later registrations take precedence over it.
+  std::shared_ptr<FallbackCallbacks const> snapshot() {
+    if (size_ > 0) {
+      auto layer = std::make_shared<FallbackCallbacks const>(std::move(*this));
+      *this = FallbackCallbacks{};
+      base_ = std::move(layer);
     }
 
-    auto const expected_method = std::any_cast<Method>(&std::get<2>(front));
-    if (!expected_method || *expected_method != method) {
-      return false;
+    return base_;
+  }
+
+  // Replaces the callbacks with the layer.
+  void restore(std::shared_ptr<FallbackCallbacks const> layer) {
+    clear();
+    base_ = std::move(layer);
+  }
+
+  // The callback stays valid until the next registration, so callers copy
+  // it before they invoke it.
+  ErasedCallback const* get(uintptr_t const mock,
+                            MethodKey const& method) const {
+    if (auto const* callback = getOwn(mock, method)) {
+      return callback;
     }
 
-    return true;
+    return getShared(method);
   }
 
  private:
-  using DescriptionMockMethodCallbackTuple =
-      std::tuple<std::string, uintptr_t, std::any, std::any>;
-  std::deque<DescriptionMockMethodCallbackTuple> callbacks_;
+  using Callbacks = std::vector<std::pair<MethodKey, ErasedCallback>>;
+
+  ErasedCallback const* getOwn(uintptr_t const mock,
+                               MethodKey const& method) const {
+    auto const mock_callbacks_it = callbacks_.find(mock);
+
+    if (mock_callbacks_it != callbacks_.end()) {
+      if (auto const* callback = find(mock_callbacks_it->second, method)) {
+        return callback;
+      }
+    }
+
+    return base_ ? base_->getOwn(mock, method) : nullptr;
+  }
+
+  ErasedCallback const* getShared(MethodKey const& method) const {
+    if (auto const* callback = find(shared_callbacks_, method)) {
+      return callback;
+    }
+
+    return base_ ? base_->getShared(method) : nullptr;
+  }
+
+  static ErasedCallback const* find(Callbacks const& callbacks,
+                                    MethodKey const& method) {
+    for (auto callback_it = callbacks.rbegin(); callback_it != callbacks.rend();
+         ++callback_it) {
+      if (callback_it->first == method) {
+        return &callback_it->second;
+      }
+    }
+
+    return nullptr;
+  }
+
+  std::unordered_map<uintptr_t, Callbacks> callbacks_;
+  Callbacks shared_callbacks_;
+  std::size_t size_ = 0;
+  std::shared_ptr<FallbackCallbacks const> base_;
 };
 
-class FallbackCallbacks {
+class CallBudgets {
  public:
-  template <typename ReturnType, typename Mock, typename... Args>
-  void add(Mock const& mock,
-           ReturnType (Mock::MockedType::*method)(Args...),
-           std::function<ReturnType(Args...)> callback) {
-    callbacks_[reinterpret_cast<uintptr_t>(&mock)].emplace_back(method,
-                                                                callback);
+  using Target = std::pair<uintptr_t, MethodKey>;
+
+  std::size_t add(std::string description,
+                  std::size_t const max_calls,
+                  std::vector<Target> targets) {
+    auto const id = next_id_++;
+    budgets_.push_back(
+        {id, std::move(description), max_calls, 0, std::move(targets)});
+    return id;
   }
 
-  template <typename ReturnType, typename Mock, typename... Args>
-  void add(Mock const& mock,
-           ReturnType (Mock::MockedType::*method)(Args...) const,
-           std::function<ReturnType(Args...)> callback) {
-    callbacks_[reinterpret_cast<uintptr_t>(&mock)].emplace_back(method,
-                                                                callback);
+  void remove(std::size_t const id) { budgets_.erase(find(id)); }
+
+  std::size_t calls(std::size_t const id) const { return find(id)->calls; }
+
+  bool isEmpty() const { return budgets_.empty(); }
+
+  // Counts a call against every budget that covers it and reports each
+  // budget that the call exceeds.
+  void count(uintptr_t const mock,
+             MethodKey const& method,
+             std::function<void(std::string const&)> const& handler) {
+    for (auto& budget : budgets_) {
+      for (auto const& target : budget.targets) {
+        if (target.first == mock && target.second == method) {
+          if (++budget.calls > budget.max_calls && handler) {
+            handler(budget.description);
+          }
+          break;
+        }
+      }
+    }
   }
 
-  template <typename ReturnType, typename Mock, typename... Args>
-  std::function<ReturnType(Args...)> get(
-      Mock const& mock,
-      ReturnType (Mock::MockedType::*method)(Args...)) const {
-    return getInternal<std::function<ReturnType(Args...)>>(
-        reinterpret_cast<uintptr_t>(&mock), method);
+ private:
+  struct Budget {
+    std::size_t id;
+    std::string description;
+    std::size_t max_calls;
+    std::size_t calls;
+    std::vector<Target> targets;
+  };
+
+  std::vector<Budget>::iterator find(std::size_t const id) {
+    return std::find_if(budgets_.begin(), budgets_.end(),
+                        [id](Budget const& budget) { return budget.id == id; });
   }
 
-  template <typename ReturnType, typename Mock, typename... Args>
-  std::function<ReturnType(Args...)> get(
-      Mock const& mock,
-      ReturnType (Mock::MockedType::*method)(Args...) const) const {
-    return getInternal<std::function<ReturnType(Args...)>>(
-        reinterpret_cast<uintptr_t>(&mock), method);
+  std::vector<Budget>::const_iterator find(std::size_t const id) const {
+    return std::find_if(budgets_.begin(), budgets_.end(),
+                        [id](Budget const& budget) { return budget.id == id; });
+  }
+
+ private:
+  std::size_t next_id_ = 0;
+  std::vector<Budget> budgets_;
+};
+
+// Limits on the number of calls that run at the same time. The counters are
+// updated without the dispatch lock, when a call is dispatched and when its
+// callback returns.
+class ConcurrencyLimits {
+ public:
+  using Target = std::pair<uintptr_t, MethodKey>;
+
+  // Limits that may cover a single method of a mock at the same time.
+  static constexpr std::size_t max_limits_per_method = 4;
+
+  struct Limit {
+    std::string description;
+    std::size_t max_in_flight;
+    std::vector<Target> targets;
+    std::atomic<std::size_t> in_flight{0};
+    std::atomic<std::size_t> peak{0};
+  };
+
+  // Limits that cover one method of one mock.
+  struct MethodLimits {
+    std::array<Limit*, max_limits_per_method> limits = {};
+    std::size_t size = 0;
+  };
+
+  // The limit stays owned by the caller and has to be removed before it is
+  // destroyed.
+  std::unique_ptr<Limit> add(std::string description,
+                             std::size_t const max_in_flight,
+                             std::vector<Target> targets) {
+    auto limit = std::make_unique<Limit>();
+    limit->description = std::move(description);
+    limit->max_in_flight = max_in_flight;
+    limit->targets = std::move(targets);
+
+    for (auto const& target : limit->targets) {
+      auto const* const method_limits = get(target.first, target.second);
+
+      if (method_limits && method_limits->size == max_limits_per_method) {
+        throw std::invalid_argument{
+            "[comock] Cannot set more concurrency limits for a method of a "
+            "mock object."};
+      }
+    }
+
+    for (auto const& target : limit->targets) {
+      auto& method_limits = methodLimits(target.first, target.second);
+      auto const end = method_limits.limits.begin() + method_limits.size;
+
+      if (std::find(method_limits.limits.begin(), end, limit.get()) == end) {
+        method_limits.limits[method_limits.size++] = limit.get();
+      }
+    }
+
+    ++size_;
+    return limit;
+  }
+
+  void remove(Limit const& limit) {
+    for (auto const& target : limit.targets) {
+      auto& method_limits = methodLimits(target.first, target.second);
+      auto const begin = method_limits.limits.begin();
+      auto const end = std::remove(begin, begin + method_limits.size, &limit);
+      method_limits.size = static_cast<std::size_t>(end - begin);
+    }
+
+    --size_;
+  }
+
+  bool isEmpty() const { return size_ == 0; }
+
+  // Limits that cover the call, entered by the InFlightCalls guard.
+  MethodLimits find(uintptr_t const mock, MethodKey const& method) const {
+    if (isEmpty()) {
+      return {};
+    }
+
+    auto const* const method_limits = get(mock, method);
+    return method_limits ? *method_limits : MethodLimits{};
+  }
+
+ private:
+  MethodLimits const* get(uintptr_t const mock, MethodKey const& method) const {
+    auto const mock_limits_it = targets_.find(mock);
+
+    if (mock_limits_it == targets_.end()) {
+      return nullptr;
+    }
+
+    for (auto const& entry : mock_limits_it->second) {
+      if (entry.first == method) {
+        return &entry.second;
+      }
+    }
+
+    return nullptr;
+  }
+
+  MethodLimits& methodLimits(uintptr_t const mock, MethodKey const& method) {
+    auto& mock_limits = targets_[mock];
+
+    for (auto& entry : mock_limits) {
+      if (entry.first == method) {
+        return entry.second;
+      }
+    }
+
+    return mock_limits.emplace_back(method, MethodLimits{}).second;
+  }
+
+  std::unordered_map<uintptr_t, std::vector<std::pair<MethodKey, MethodLimits>>>
+      targets_ = {};
+  std::size_t size_ = 0;
+};
+
+// Keeps a call counted as in flight for the lifetime of the guard.
+class InFlightCalls {
+ public:
+  InFlightCalls(ConcurrencyLimits::MethodLimits const& limits,
+                std::function<void(std::string const&)> const& handler)
+      : limits_{limits} {
+    for (auto index = std::size_t{0}; index < limits_.size; ++index) {
+      auto* const limit = limits_.limits[index];
+      auto const in_flight = ++limit->in_flight;
+      auto peak = limit->peak.load();
+
+      while (in_flight > peak &&
+             !limit->peak.compare_exchange_weak(peak, in_flight)) {
+      }
+
+      if (in_flight > limit->max_in_flight && handler) {
+        handler(limit->description);
+      }
+    }
+  }
+
+  InFlightCalls(InFlightCalls&& other) noexcept : limits_{other.limits_} {
+    other.limits_.size = 0;
   }
 
- private:
-  template <typename Callback, typename Method>
-  Callback getInternal(uintptr_t const mock, Method method) const {
-    auto const mock_callbacks_it = callbacks_.find(mock);
+  InFlightCalls(InFlightCalls const&) = delete;
+  InFlightCalls& operator=(InFlightCalls const&) = delete;
+  InFlightCalls& operator=(InFlightCalls&&) = delete;
+
+  ~InFlightCalls() {
+    for (auto index = std::size_t{0}; index < limits_.size; ++index) {
+      --limits_.limits[index]->in_flight;
+    }
+  }
+
+ private:
+  ConcurrencyLimits::MethodLimits limits_;
+};
+
+class CallCosts {
+ public:
+  // Cost callbacks are stored as std::function<double(Args const&...)> and
+  // follow the same lookup rules as fallback callbacks.
+  void set(uintptr_t const mock,
+           MethodKey const method,
+           ErasedCallback callback) {
+    functions_.add(mock, method, std::move(callback));
+  }
+
+  ErasedCallback const* get(uintptr_t const mock,
+                            MethodKey const& method) const {
+    return functions_.get(mock, method);
+  }
+
+  bool isEmpty() const { return functions_.isEmpty(); }
+
+  void beginScenario(std::string name) {
+    scenarios_.push_back({std::move(name), {}});
+  }
+
+  void record(MethodKey const& method, double const cost) {
+    if (scenarios_.empty()) {
+      beginScenario("default");
+    }
+
+    auto& methods = scenarios_.back().methods;
+    auto method_it = std::find_if(
+        methods.begin(), methods.end(),
+        [&method](MethodEntry const& entry) { return entry.method == method; });
+
+    if (method_it == methods.end()) {
+      method_it = methods.insert(methods.end(), MethodEntry{method, 0, 0.0});
+    }
+
+    ++method_it->calls;
+    method_it->cost += cost;
+  }
+
+  CostReport report() const {
+    auto report = CostReport{};
+
+    for (auto const& scenario : scenarios_) {
+      auto& scenario_cost = report.scenarios.emplace_back(
+          ScenarioCost{scenario.name, 0.0, {}});
+
+      for (auto const& entry : scenario.methods) {
+        scenario_cost.total += entry.cost;
+        scenario_cost.methods.push_back(
+            {std::string{entry.method.type->name} + "::" + entry.method.name,
+             entry.calls, entry.cost});
+      }
+    }
+
+    return report;
+  }
+
+ private:
+  struct MethodEntry {
+    MethodKey method;
+    std::size_t calls;
+    double cost;
+  };
+
+  struct Scenario {
+    std::string name;
+    std::vector<MethodEntry> methods;
+  };
+
+  FallbackCallbacks functions_ = {};
+  std::vector<Scenario> scenarios_ = {};
+};
+
+inline std::size_t hashCombine(std::size_t const seed,
+                               std::size_t const value) {
+  return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+}
+
+// Default argument hasher, combines std::hash of every argument.
+struct ArgumentHash {
+  template <typename... Args>
+  std::size_t operator()(Args const&... args) const {
+    auto hash = std::size_t{0};
+    ((hash = hashCombine(hash, std::hash<Args>{}(args))), ...);
+    return hash;
+  }
+};
+
+class RedundantCallDetector {
+ public:
+  // Hashers are stored as std::function<std::size_t(Args const&...)> and
+  // follow the same lookup rules as fallback callbacks.
+  void set(uintptr_t const mock,
+           MethodKey const method,
+           ErasedCallback hasher) {
+    hashers_.add(mock, method, std::move(hasher));
+  }
+
+  ErasedCallback const* get(uintptr_t const mock,
+                            MethodKey const& method) const {
+    return hashers_.get(mock, method);
+  }
+
+  bool isEmpty() const { return hashers_.isEmpty(); }
+
+  void record(uintptr_t const mock,
+              MethodKey const& method,
+              std::size_t const argument_hash) {
+    auto hash = hashCombine(std::hash<uintptr_t>{}(mock),
+                            std::hash<void const*>{}(method.type));
+    hash = hashCombine(hash, std::hash<void const*>{}(method.id));
+    hash = hashCombine(hash, argument_hash);
+
+    auto method_it = std::find_if(
+        methods_.begin(), methods_.end(),
+        [&method](MethodEntry const& entry) { return entry.method == method; });
+
+    if (method_it == methods_.end()) {
+      method_it = methods_.insert(methods_.end(), MethodEntry{method, 0, 0});
+    }
+
+    ++method_it->calls;
+
+    if (!seen_.insert(hash).second) {
+      ++method_it->redundant_calls;
+    }
+  }
+
+  RedundantCallReport report() const {
+    auto report = RedundantCallReport{};
+
+    for (auto const& entry : methods_) {
+      report.methods.push_back(
+          {std::string{entry.method.type->name} + "::" + entry.method.name,
+           entry.calls, entry.redundant_calls});
+    }
+
+    return report;
+  }
+
+ private:
+  struct MethodEntry {
+    MethodKey method;
+    std::size_t calls;
+    std::size_t redundant_calls;
+  };
+
+  FallbackCallbacks hashers_ = {};
+  std::unordered_set<std::size_t> seen_ = {};
+  std::vector<MethodEntry> methods_ = {};
+};
+
+// Follows the order of all mocked calls and collects the runs of consecutive
+// calls to the tracked methods.
+class BatchingDetector {
+ public:
+  void add(uintptr_t const mock,
+           MethodKey const method,
+           std::string batch_method) {
+    auto entry_it = std::find_if(
+        methods_.begin(), methods_.end(),
+        [&method](MethodEntry const& entry) { return entry.method == method; });
+
+    if (entry_it == methods_.end()) {
+      entry_it = methods_.insert(methods_.end(), MethodEntry{method, {}});
+    }
+
+    if (!batch_method.empty()) {
+      entry_it->stats.batch_method = std::move(batch_method);
+    }
+
+    targets_.push_back({mock, method});
+  }
+
+  bool isEmpty() const { return targets_.empty(); }
+
+  void record(uintptr_t const mock, MethodKey const& method) {
+    if (run_.length > 0 && run_.mock == mock && run_.method == method) {
+      ++run_.length;
+      return;
+    }
+
+    closeRun(methods_, run_);
+    run_ = {};
+
+    for (auto const& target : targets_) {
+      if (target.first == mock && target.second == method) {
+        run_ = {mock, method, 1};
+        break;
+      }
+    }
+  }
+
+  BatchingReport report() const {
+    auto methods = methods_;
+    closeRun(methods, run_);
+
+    auto report = BatchingReport{};
+
+    for (auto& entry : methods) {
+      entry.stats.method =
+          std::string{entry.method.type->name} + "::" + entry.method.name;
+      report.methods.push_back(std::move(entry.stats));
+    }
+
+    return report;
+  }
+
+ private:
+  struct Run {
+    uintptr_t mock = 0;
+    MethodKey method = {};
+    std::size_t length = 0;
+  };
+
+  struct MethodEntry {
+    MethodKey method;
+    BatchingOpportunity stats;
+  };
+
+  static void closeRun(std::vector<MethodEntry>& methods, Run const& run) {
+    if (run.length == 0) {
+      return;
+    }
+
+    auto& stats = std::find_if(methods.begin(), methods.end(),
+                               [&run](MethodEntry const& entry) {
+                                 return entry.method == run.method;
+                               })
+                      ->stats;
+
+    stats.calls += run.length;
+    ++stats.runs;
+    stats.longest_run = std::max(stats.longest_run, run.length);
+
+    if (run.length > 1) {
+      stats.batchable_calls += run.length;
+    }
+  }
+
+  std::vector<std::pair<uintptr_t, MethodKey>> targets_ = {};
+  std::vector<MethodEntry> methods_ = {};
+  Run run_ = {};
+};
+
+class CallLatencies {
+ public:
+  void set(uintptr_t const mock, MethodKey const method, Latency latency) {
+    latencies_.add(mock, method,
+                   eraseCallback(std::function<Clock::duration()>{
+                       std::move(latency)}));
+  }
+
+  bool isEmpty() const { return latencies_.isEmpty(); }
+
+  // Advances the clock by the latency of the call, if one is configured.
+  void apply(uintptr_t const mock,
+             MethodKey const& method,
+             VirtualClock& clock) const {
+    if (auto const latency = latencies_.get(mock, method)) {
+      clock.advance(restoreCallback<Clock::duration>(*latency)());
+    }
+  }
+
+ private:
+  FallbackCallbacks latencies_ = {};
+};
+
+// Faults injected into calls that are not matched by an expectation. A call
+// draws a single random number, so the faults of a method are mutually
+// exclusive and the whole sequence is reproducible from the seed.
+class FaultInjections {
+ public:
+  void add(uintptr_t const mock,
+           MethodKey const method,
+           double const rate,
+           ErasedCallback callback,
+           Clock::duration const latency) {
+    if (!(rate >= 0.0 && rate <= 1.0)) {
+      throw std::invalid_argument{
+          "[comock] Fault rate must be in the range [0, 1]."};
+    }
+
+    seed();
+    faults_[mock].push_back({method, rate, std::move(callback), latency});
+  }
+
+  bool isEmpty() const { return faults_.empty(); }
+
+  void seed(std::uint64_t const seed) {
+    seed_ = seed;
+    random_ = Random{seed};
+  }
+
+  // Seeded from the steady clock unless set explicitly.
+  std::uint64_t seed() {
+    if (!seed_) {
+      seed(static_cast<std::uint64_t>(
+          std::chrono::steady_clock::now().time_since_epoch().count()));
+    }
+    return *seed_;
+  }
+
+  // Advances the clock by the latency of the injected fault and returns its
+  // callback. Returns null if no fault is injected or the fault only adds
+  // latency.
+  ErasedCallback const* apply(uintptr_t const mock,
+                              MethodKey const& method,
+                              VirtualClock& clock) {
+    auto const mock_faults_it = faults_.find(mock);
+
+    if (mock_faults_it == faults_.end()) {
+      return nullptr;
+    }
+
+    auto const sample = random_.uniform();
+    auto threshold = 0.0;
+
+    for (auto const& fault : mock_faults_it->second) {
+      if (fault.method != method) {
+        continue;
+      }
+
+      threshold += fault.rate;
+
+      if (sample < threshold) {
+        clock.advance(fault.latency);
+        return fault.callback ? &fault.callback : nullptr;
+      }
+    }
+
+    return nullptr;
+  }
+
+  // Prints the seed once, so that a failing run can be replayed.
+  void reportSeed() {
+    if (!isEmpty() && !seed_reported_) {
+      seed_reported_ = true;
+      std::cerr << "[comock] Fault injection seed: " << *seed_ << std::endl;
+    }
+  }
+
+ private:
+  struct Fault {
+    MethodKey method;
+    double rate;
+    ErasedCallback callback;
+    Clock::duration latency;
+  };
+
+  std::unordered_map<uintptr_t, std::vector<Fault>> faults_ = {};
+  std::optional<std::uint64_t> seed_ = {};
+  Random random_{0};
+  bool seed_reported_ = false;
+};
+
+template <typename This, typename ReturnType, typename T, typename... Args>
+using MethodPointer =
+    std::conditional_t<std::is_const_v<std::remove_pointer_t<This>>,
+                       ReturnType (T::*)(Args...) const,
+                       ReturnType (T::*)(Args...)>;
+
+// Call counts kept in one shard per thread and merged when read, so that
+// threads calling the same method do not contend for a cache line.
+class CallCounts {
+ public:
+  CallCounts() = default;
+
+  CallCounts(CallCounts const&) = delete;
+  CallCounts& operator=(CallCounts const&) = delete;
+
+  void enable() { enabled_ = true; }
+
+  bool isEnabled() const { return enabled_; }
+
+  // Only the calling thread writes its shard, so counting takes neither a
+  // lock nor a read-modify-write.
+  void record(uintptr_t const mock, MethodKey const& method) {
+    auto const hash = hashOf(mock, method);
+    auto* table = &localShard().table;
+
+    while (true) {
+      if (auto* const entry = table->find(hash, mock, method)) {
+        auto const count = entry->count.load(std::memory_order_relaxed);
+        entry->count.store(count + 1, std::memory_order_relaxed);
+        return;
+      }
+
+      auto* const next = table->next.load(std::memory_order_relaxed);
+
+      if (!next) {
+        break;
+      }
+
+      table = next;
+    }
+
+    // Entries never move, so readers may scan the tables at any time. A
+    // table that is three quarters full is followed by a larger one.
+    if (table->size * 4 >= table->capacity * 3) {
+      auto* const next = new Table{table->capacity * 2};
+      table->next.store(next, std::memory_order_release);
+      table = next;
+    }
+
+    table->insert(hash, mock, method);
+  }
+
+  std::size_t count(uintptr_t const mock, MethodKey const& method) const {
+    auto const hash = hashOf(mock, method);
+    auto const lock = std::lock_guard<std::mutex>{shards_mutex_};
+    auto count = std::size_t{0};
+
+    for (auto const& thread_shard : shards_) {
+      for (auto const* table = &thread_shard.second->table; table;
+           table = table->next.load(std::memory_order_acquire)) {
+        if (auto const* const entry = table->find(hash, mock, method)) {
+          count += entry->count.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    return count;
+  }
+
+ private:
+  struct Entry {
+    std::atomic<bool> used{false};
+    uintptr_t mock = 0;
+    MethodKey method = {};
+    std::atomic<std::size_t> count{0};
+  };
+
+  // Open addressing table written by one thread and read by any.
+  struct Table {
+    explicit Table(std::size_t const table_capacity)
+        : entries{std::make_unique<Entry[]>(table_capacity)},
+          capacity{table_capacity} {}
+
+    Table(Table const&) = delete;
+    Table& operator=(Table const&) = delete;
+
+    ~Table() { delete next.load(); }
+
+    Entry* find(std::size_t const hash,
+                uintptr_t const mock,
+                MethodKey const& method) const {
+      for (auto index = hash & (capacity - 1);;
+           index = (index + 1) & (capacity - 1)) {
+        auto& entry = entries[index];
+
+        if (!entry.used.load(std::memory_order_acquire)) {
+          return nullptr;
+        }
+
+        if (entry.mock == mock && entry.method == method) {
+          return &entry;
+        }
+      }
+    }
+
+    void insert(std::size_t const hash,
+                uintptr_t const mock,
+                MethodKey const& method) {
+      auto index = hash & (capacity - 1);
+
+      while (entries[index].used.load(std::memory_order_relaxed)) {
+        index = (index + 1) & (capacity - 1);
+      }
+
+      auto& entry = entries[index];
+      entry.mock = mock;
+      entry.method = method;
+      entry.count.store(1, std::memory_order_relaxed);
+      entry.used.store(true, std::memory_order_release);
+      ++size;
+    }
+
+    std::unique_ptr<Entry[]> entries;
+    std::size_t capacity;
+    // Only read by the writing thread.
+    std::size_t size = 0;
+    std::atomic<Table*> next{nullptr};
+  };
+
+  struct alignas(64) Shard {
+    Table table{64};
+  };
+
+  static std::size_t hashOf(uintptr_t const mock, MethodKey const& method) {
+    return hashCombine(
+        hashCombine(std::hash<uintptr_t>{}(mock),
+                    std::hash<void const*>{}(method.type)),
+        std::hash<void const*>{}(method.id));
+  }
+
+  Shard& localShard() {
+    // The address of a thread local identifies the thread. A later thread
+    // may reuse the shard of a finished one, which does not change the sums.
+    thread_local char thread_tag = 0;
+    thread_local struct {
+      std::uint64_t owner = 0;
+      Shard* shard = nullptr;
+    } cache;
+
+    if (cache.owner != id_) {
+      auto const lock = std::lock_guard<std::mutex>{shards_mutex_};
+      auto& shard = shards_[&thread_tag];
+
+      if (!shard) {
+        shard = std::make_unique<Shard>();
+      }
+
+      cache.owner = id_;
+      cache.shard = shard.get();
+    }
+
+    return *cache.shard;
+  }
+
+  inline static std::atomic<std::uint64_t> next_id_{1};
+
+  std::uint64_t const id_ = next_id_++;
+  bool enabled_ = false;
+  mutable std::mutex shards_mutex_ = {};
+  std::unordered_map<void const*, std::unique_ptr<Shard>> shards_ = {};
+};
+
+// Notifies the call observers for the lifetime of the guard.
+class ObservedCall {
+ public:
+  ObservedCall(std::vector<CallObserver*> const& observers,
+               MethodKey const& method)
+      : observers_{observers.empty() ? nullptr : &observers}, method_{method} {
+    if (observers_) {
+      for (auto* const observer : *observers_) {
+        observer->callStarted(method_.type->name, method_.name);
+      }
+    }
+  }
+
+  ObservedCall(ObservedCall&& other) noexcept
+      : observers_{std::exchange(other.observers_, nullptr)},
+        method_{other.method_} {}
+
+  ObservedCall(ObservedCall const&) = delete;
+  ObservedCall& operator=(ObservedCall const&) = delete;
+  ObservedCall& operator=(ObservedCall&&) = delete;
+
+  ~ObservedCall() {
+    if (observers_) {
+      for (auto* const observer : *observers_) {
+        observer->callFinished(method_.type->name, method_.name);
+      }
+    }
+  }
+
+ private:
+  std::vector<CallObserver*> const* observers_;
+  MethodKey method_;
+};
+
+// Handling of calls that no expectation or fallback covers, selected by
+// creating a Nice, Naggy or Strict mock.
+enum class CallPolicy { Default, Nice, Naggy, Strict };
+
+// The call stays in flight until the resolved call is destroyed.
+struct ResolvedCall {
+  // Null if the default callback has to be used. Owned by the call, so that
+  // the callback may reconfigure the repo, which replaces stored callbacks.
+  ErasedCallback callback;
+  InFlightCalls in_flight;
+  ObservedCall observed;
+};
+
+struct RepoState {
+  bool expectations_paused = false;
+  ExpectedCallbackQueue expected_callback_queue = {};
+  FallbackCallbacks fallback_callbacks = {};
+  std::function<void(std::optional<std::string> const&)>
+      unexpected_call_handler = {};
+  std::function<void(std::string const&)> missing_call_handler = {};
+  CallBudgets call_budgets = {};
+  std::function<void(std::string const&)> call_budget_handler = {};
+  ConcurrencyLimits concurrency_limits = {};
+  std::function<void(std::string const&)> concurrency_limit_handler = {};
+  BatchingDetector batching = {};
+  std::function<void(BatchingReport const&)> batching_report_handler = {};
+  CallCosts call_costs = {};
+  RedundantCallDetector redundant_calls = {};
+  VirtualClock clock = {};
+  CallLatencies call_latencies = {};
+  FaultInjections fault_injections = {};
+  std::vector<CallObserver*> call_observers = {};
+  CallCounts call_counts = {};
+  std::mutex mutex = {};
+
+  // Signature-agnostic part of a mocked call. Safe to call from several
+  // threads, the callback itself runs without the lock.
+  ResolvedCall resolveCall(uintptr_t const mock,
+                           MethodKey const& method,
+                           CallPolicy const policy,
+                           std::optional<double> const cost,
+                           std::optional<std::size_t> const argument_hash) {
+    // Observers are notified without the lock, so that they may block.
+    auto observed = ObservedCall{call_observers, method};
+
+    if (call_counts.isEnabled()) {
+      call_counts.record(mock, method);
+    }
+
+    // Calls served by a fallback touch no shared state, so concurrent calls
+    // do not serialize. Pending expectations, and the statistics of costs,
+    // argument hashes, budgets and batching, are kept under the lock.
+    if (!cost && !argument_hash && !serializesCalls()) {
+      if (auto const* callback = fallback_callbacks.get(mock, method)) {
+        return {*callback,
+                InFlightCalls{concurrency_limits.find(mock, method),
+                              concurrency_limit_handler},
+                std::move(observed)};
+      }
+    }
+
+    auto const lock = std::lock_guard<std::mutex>{mutex};
+
+    if (cost) {
+      call_costs.record(method, *cost);
+    }
+
+    if (argument_hash) {
+      redundant_calls.record(mock, method, *argument_hash);
+    }
+
+    if (!batching.isEmpty()) {
+      batching.record(mock, method);
+    }
+
+    auto in_flight = InFlightCalls{concurrency_limits.find(mock, method),
+                                   concurrency_limit_handler};
+
+    return {resolveCallback(mock, method, policy), std::move(in_flight),
+            std::move(observed)};
+  }
+
+ private:
+  // Only configuration and the last expectation change the result, so it
+  // is read without the lock.
+  bool serializesCalls() const {
+    return expected_callback_queue.hasPending() || !call_budgets.isEmpty() ||
+           !call_latencies.isEmpty() || !fault_injections.isEmpty() ||
+           !batching.isEmpty();
+  }
+
+  ErasedCallback resolveCallback(uintptr_t const mock,
+                                 MethodKey const& method,
+                                 CallPolicy const policy) {
+    if (!call_budgets.isEmpty()) {
+      call_budgets.count(mock, method, call_budget_handler);
+    }
+
+    if (!call_latencies.isEmpty()) {
+      call_latencies.apply(mock, method, clock);
+    }
+
+    auto expectation_description = std::optional<std::string>{};
+
+    if (!expectations_paused && !expected_callback_queue.isEmpty()) {
+      if (expected_callback_queue.peekMatch(mock, method)) {
+        auto expected_callback = expected_callback_queue.peekCallback();
+        expected_callback_queue.pop();
+        return expected_callback;
+      }
+
+      expectation_description = expected_callback_queue.peekDescription();
+      expected_callback_queue.pop();
+
+      // Strict mocks report a violated expectation even if a fallback
+      // covers the call.
+      if (policy == CallPolicy::Strict) {
+        reportUnexpectedCall(expectation_description);
+      }
+    }
+
+    if (!fault_injections.isEmpty()) {
+      if (auto const* fault_callback =
+              fault_injections.apply(mock, method, clock)) {
+        return *fault_callback;
+      }
+    }
+
+    if (auto const* fallback_callback = fallback_callbacks.get(mock, method)) {
+      return *fallback_callback;
+    }
+
+    if (expectations_paused) {
+      return nullptr;
+    }
+
+    if (expectation_description) {
+      if (policy != CallPolicy::Strict) {
+        reportUnexpectedCall(expectation_description);
+      }
+    } else if (policy == CallPolicy::Naggy) {
+      std::cerr << "[comock] Uninteresting method call: " << method.type->name
+                << "::" << method.name << std::endl;
+    } else if (policy != CallPolicy::Nice) {
+      reportUnexpectedCall(expectation_description);
+    }
+
+    return nullptr;
+  }
+
+  void reportUnexpectedCall(
+      std::optional<std::string> const& expectation_description) {
+    if (unexpected_call_handler) {
+      fault_injections.reportSeed();
+      unexpected_call_handler(expectation_description);
+    }
+  }
+};
+
+// Instantiated once per method signature, shared by all mocks and methods
+// with that signature.
+template <typename ReturnType, typename... Args>
+ReturnType call(RepoState& repo_state,
+                uintptr_t const mock,
+                MethodKey const& method,
+                CallPolicy const policy,
+                std::function<ReturnType(Args...)> const& default_callback,
+                Args... args) {
+  auto cost = std::optional<double>{};
+
+  if (!repo_state.call_costs.isEmpty()) {
+    if (auto const cost_callback = repo_state.call_costs.get(mock, method)) {
+      cost = restoreCallback<double, Args const&...>(*cost_callback)(args...);
+    }
+  }
+
+  auto argument_hash = std::optional<std::size_t>{};
+
+  if (!repo_state.redundant_calls.isEmpty()) {
+    if (auto const hasher = repo_state.redundant_calls.get(mock, method)) {
+      argument_hash =
+          restoreCallback<std::size_t, Args const&...>(*hasher)(args...);
+    }
+  }
+
+  auto const resolved_call =
+      repo_state.resolveCall(mock, method, policy, cost, argument_hash);
+
+  if (resolved_call.callback) {
+    return restoreCallback<ReturnType, Args...>(resolved_call.callback)(
+        std::move(args)...);
+  }
+
+  return default_callback(std::move(args)...);
+}
+
+template <class T>
+class MockBase : public T {
+ public:
+  friend class Repo;
+
+  using MockedType = T;
+
+  template <typename... Args>
+  MockBase(RepoState& repo_state, Args... args)
+      : T(std::forward<Args>(args)...), repo_state_(repo_state) {}
+
+ protected:
+  // The mock definition macros name internal types through these aliases,
+  // so that the comock module only has to export MockBase.
+  using ComockMethodKey = MethodKey;
+  using ComockMockTypeInfo = MockTypeInfo;
+  using ComockRepoState = RepoState;
+
+  template <int N>
+  using ComockMethodSlot = MethodSlot<N>;
+
+  template <auto Method>
+  using ComockMethodId = MethodId<Method>;
+
+  template <typename This, typename ReturnType, typename U, typename... Args>
+  using ComockMethodPointer = MethodPointer<This, ReturnType, U, Args...>;
+
+  template <typename ReturnType, typename... Args>
+  ReturnType call(MethodKey const& key,
+                  std::function<ReturnType(Args...)> const& default_callback,
+                  Args... args) const {
+    return internal::call(repo_state_, reinterpret_cast<uintptr_t>(this), key,
+                          call_policy_, default_callback, std::move(args)...);
+  }
+
+  CallPolicy call_policy_ = CallPolicy::Default;
+
+ private:
+  RepoState& repo_state_;
+};
+
+template <class Mock, CallPolicy Policy>
+class PolicyMock : public Mock {
+ public:
+  template <typename... Args>
+  PolicyMock(RepoState& repo_state, Args... args)
+      : Mock(repo_state, std::forward<Args>(args)...) {
+    this->call_policy_ = Policy;
+  }
+};
+
+}  // namespace internal
+
+// Mocks created as repo.create<comock::Nice<Mock>>() use the default callback
+// for calls that no expectation or fallback covers, Naggy mocks also print a
+// warning. Strict mocks report every violated expectation, even if a fallback
+// covers the call.
+template <class Mock>
+using Nice = internal::PolicyMock<Mock, internal::CallPolicy::Nice>;
+
+template <class Mock>
+using Naggy = internal::PolicyMock<Mock, internal::CallPolicy::Naggy>;
+
+template <class Mock>
+using Strict = internal::PolicyMock<Mock, internal::CallPolicy::Strict>;
+
+// Limit on the number of calls to a mocked method, active for the lifetime of
+// the object returned by Repo::limitCalls.
+class CallBudget {
+ public:
+  CallBudget(CallBudget&& other) noexcept
+      : budgets_{std::exchange(other.budgets_, nullptr)}, id_{other.id_} {}
+
+  CallBudget(CallBudget const&) = delete;
+  CallBudget& operator=(CallBudget const&) = delete;
+  CallBudget& operator=(CallBudget&&) = delete;
+
+  ~CallBudget() {
+    if (budgets_) {
+      budgets_->remove(id_);
+    }
+  }
+
+  std::size_t calls() const { return budgets_->calls(id_); }
+
+ private:
+  friend class Repo;
+
+  CallBudget(internal::CallBudgets& budgets, std::size_t const id)
+      : budgets_{&budgets}, id_{id} {}
+
+ private:
+  internal::CallBudgets* budgets_;
+  std::size_t id_;
+};
+
+// Limit on the number of concurrent calls to a mocked method, active for the
+// lifetime of the object returned by Repo::limitConcurrency.
+class ConcurrencyLimit {
+ public:
+  ConcurrencyLimit(ConcurrencyLimit&& other) noexcept
+      : limits_{std::exchange(other.limits_, nullptr)},
+        limit_{std::move(other.limit_)} {}
+
+  ConcurrencyLimit(ConcurrencyLimit const&) = delete;
+  ConcurrencyLimit& operator=(ConcurrencyLimit const&) = delete;
+  ConcurrencyLimit& operator=(ConcurrencyLimit&&) = delete;
 
-    if (mock_callbacks_it == callbacks_.end()) {
-      return {};
+  ~ConcurrencyLimit() {
+    if (limits_) {
+      limits_->remove(*limit_);
     }
+  }
 
-    auto const& mock_callbacks = mock_callbacks_it->second;
+  // Calls that are running right now.
+  std::size_t inFlight() const { return limit_->in_flight.load(); }
 
-    for (auto callback_it = mock_callbacks.rbegin();
-         callback_it != mock_callbacks.rend(); ++callback_it) {
-      auto const method_ptr = std::any_cast<Method>(&std::get<0>(*callback_it));
+  // Largest number of calls that were running at the same time.
+  std::size_t peak() const { return limit_->peak.load(); }
 
-      if (method_ptr && *method_ptr == method) {
-        return std::any_cast<Callback>(std::get<1>(*callback_it));
-      }
-    }
+ private:
+  friend class Repo;
 
-    return {};
-  }
+  ConcurrencyLimit(internal::ConcurrencyLimits& limits,
+                   std::unique_ptr<internal::ConcurrencyLimits::Limit> limit)
+      : limits_{&limits}, limit_{std::move(limit)} {}
 
  private:
-  std::unordered_map<uintptr_t, std::vector<std::tuple<std::any, std::any>>>
-      callbacks_;
+  internal::ConcurrencyLimits* limits_;
+  std::unique_ptr<internal::ConcurrencyLimits::Limit> limit_;
 };
 
-struct RepoState {
-  bool expectations_paused = false;
-  ExpectedCallbackQueue expected_callback_queue = {};
-  FallbackCallbacks fallback_callbacks = {};
-  std::function<void(std::optional<std::string> const&)>
-      unexpected_call_handler = {};
-  std::function<void(std::string const&)> missing_call_handler = {};
-};
+class ExpectationScript;
 
-template <class T>
-class MockBase : public T {
- public:
+// Expectations and fallback callbacks saved by Repo::snapshot. Restoring a
+// snapshot shares its storage instead of copying it.
+class RepoSnapshot {
+ private:
   friend class Repo;
 
-  using MockedType = T;
+  RepoSnapshot(
+      internal::RepoState const& repo_state,
+      std::shared_ptr<internal::ExpectedCallbackQueue::Script const>
+          expectations,
+      std::shared_ptr<internal::FallbackCallbacks const> fallbacks)
+      : repo_state_{&repo_state},
+        expectations_{std::move(expectations)},
+        fallbacks_{std::move(fallbacks)} {}
 
-  template <typename... Args>
-  MockBase(RepoState& repo_state, Args... args)
-      : T(std::forward<Args>(args)...), repo_state_(repo_state) {}
+ private:
+  internal::RepoState const* repo_state_;
+  std::shared_ptr<internal::ExpectedCallbackQueue::Script const> expectations_;
+  std::shared_ptr<internal::FallbackCallbacks const> fallbacks_;
+};
 
- protected:
-  template <typename ReturnType, typename... Args>
-  ReturnType call(std::function<ReturnType(Args...)> const& default_callback,
-                  ReturnType (T::*this_method)(Args...),
-                  Args... args) {
-    return callInternal(default_callback, this_method, std::move(args)...);
-  }
+// Mocks created by Repo::createMany, constructed side by side in a single
+// allocation.
+template <class Mock>
+class MockArray {
+ public:
+  MockArray(MockArray&& other) noexcept
+      : mocks_{std::exchange(other.mocks_, nullptr)},
+        size_{std::exchange(other.size_, 0)},
+        capacity_{std::exchange(other.capacity_, 0)} {}
+
+  MockArray(MockArray const&) = delete;
+  MockArray& operator=(MockArray const&) = delete;
+  MockArray& operator=(MockArray&&) = delete;
+
+  ~MockArray() {
+    while (size_ > 0) {
+      mocks_[--size_].~Mock();
+    }
 
-  template <typename ReturnType, typename... Args>
-  ReturnType call(std::function<ReturnType(Args...)> const& default_callback,
-                  ReturnType (T::*this_method)(Args...) const,
-                  Args... args) const {
-    return callInternal(default_callback, this_method, std::move(args)...);
+    if (mocks_) {
+      std::allocator<Mock>{}.deallocate(mocks_, capacity_);
+    }
   }
 
- private:
-  template <typename Method, typename ReturnType, typename... Args>
-  ReturnType callInternal(
-      std::function<ReturnType(Args...)> const& default_callback,
-      Method this_method,
-      Args... args) const {
-    auto expectation_description = std::optional<std::string>{};
+  std::size_t size() const { return size_; }
 
-    if (!repo_state_.expectations_paused &&
-        !repo_state_.expected_callback_queue.isEmpty()) {
-      if (repo_state_.expected_callback_queue.peekMatch(*this, this_method)) {
-        auto const expected_callback = repo_state_.expected_callback_queue
-                                           .peekCallback<ReturnType, Args...>();
-        repo_state_.expected_callback_queue.pop();
-        return expected_callback(std::move(args)...);
-      }
+  Mock& operator[](std::size_t const index) const { return mocks_[index]; }
 
-      expectation_description =
-          repo_state_.expected_callback_queue.peekDescription();
-      repo_state_.expected_callback_queue.pop();
-    }
+  Mock* begin() const { return mocks_; }
 
-    auto const fallback_callback =
-        repo_state_.fallback_callbacks.get(*this, this_method);
+  Mock* end() const { return mocks_ + size_; }
 
-    if (fallback_callback) {
-      return fallback_callback(std::move(args)...);
-    }
+ private:
+  friend class Repo;
 
-    if (!repo_state_.expectations_paused &&
-        repo_state_.unexpected_call_handler) {
-      repo_state_.unexpected_call_handler(expectation_description);
-    }
+  explicit MockArray(std::size_t const capacity)
+      : mocks_{capacity > 0 ? std::allocator<Mock>{}.allocate(capacity)
+                            : nullptr},
+        capacity_{capacity} {}
 
-    return default_callback(std::move(args)...);
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    new (mocks_ + size_) Mock(std::forward<Args>(args)...);
+    ++size_;
   }
 
  private:
-  RepoState& repo_state_;
+  Mock* mocks_;
+  std::size_t size_ = 0;
+  std::size_t capacity_;
 };
 
-}  // namespace internal
-
 class Repo {
  public:
   ~Repo() {
-    while (!state_.expected_callback_queue.isEmpty()) {
-      auto const description = state_.expected_callback_queue.peekDescription();
-      state_.expected_callback_queue.pop();
+    reportMissingCalls();
 
-      if (state_.missing_call_handler) {
-        state_.missing_call_handler(description);
-      }
+    if (!state_.batching.isEmpty() && state_.batching_report_handler) {
+      state_.batching_report_handler(state_.batching.report());
     }
   }
 
@@ -274,17 +1880,101 @@ class Repo {
     state_.missing_call_handler = std::move(handler);
   }
 
+  void setCallBudgetHandler(std::function<void(std::string const&)> handler) {
+    state_.call_budget_handler = std::move(handler);
+  }
+
+  // The handler receives the batching report when the repository is
+  // destroyed. By default the report is printed.
+  void setBatchingReportHandler(
+      std::function<void(BatchingReport const&)> handler) {
+    state_.batching_report_handler = std::move(handler);
+  }
+
+  // The handler is called from the thread that exceeds the limit.
+  void setConcurrencyLimitHandler(
+      std::function<void(std::string const&)> handler) {
+    state_.concurrency_limit_handler = std::move(handler);
+  }
+
+  // The observer has to outlive the repository or be removed first.
+  void addCallObserver(CallObserver& observer) {
+    state_.call_observers.push_back(&observer);
+  }
+
+  void removeCallObserver(CallObserver& observer) {
+    auto& observers = state_.call_observers;
+    observers.erase(std::remove(observers.begin(), observers.end(), &observer),
+                    observers.end());
+  }
+
   void pauseExpectations() { state_.expectations_paused = true; }
 
   void resumeExpectations() { state_.expectations_paused = false; }
 
+  // Drops every expectation and fallback callback, e.g. between the
+  // iterations of a randomized test. The callbacks are destroyed right away,
+  // their storage is reused. Mocks and the rest of the configuration are
+  // kept.
+  void reset() {
+    state_.expected_callback_queue.clear();
+    state_.fallback_callbacks.clear();
+  }
+
+  // Reports the expectations that were not satisfied, then resets.
+  void verifyAndReset() {
+    reportMissingCalls();
+    reset();
+  }
+
+  // Saves the expectations and fallback callbacks, e.g. a setup shared by
+  // the variants of a test. Later registrations are not part of the snapshot.
+  RepoSnapshot snapshot() {
+    return {state_, state_.expected_callback_queue.snapshot(),
+            state_.fallback_callbacks.snapshot()};
+  }
+
+  // Replaces the expectations and fallback callbacks with the snapshot of
+  // this repository in constant time.
+  void restore(RepoSnapshot const& snapshot) {
+    if (snapshot.repo_state_ != &state_) {
+      throw std::invalid_argument{
+          "[comock] Cannot restore a snapshot of another repository."};
+    }
+
+    state_.expected_callback_queue.bind(snapshot.expectations_);
+    state_.fallback_callbacks.restore(snapshot.fallbacks_);
+  }
+
+  // Replaces the expectations with the script of this repository in constant
+  // time. Fallback callbacks are kept.
+  void bind(ExpectationScript const& script);
+
   template <class Mock, class... Args>
   std::unique_ptr<Mock> create(Args... args) {
     auto mock = std::make_unique<Mock>(state_, std::forward<Args>(args)...);
-    mocks_.insert(reinterpret_cast<uintptr_t>(mock.get()));
+    mocks_.insert(mockId(*mock));
     return mock;
   }
 
+  // Creates count mocks in one allocation, constructing each with the given
+  // arguments.
+  template <class Mock, class... Args>
+  MockArray<Mock> createMany(std::size_t const count, Args const&... args) {
+    auto mocks = MockArray<Mock>{count};
+
+    for (auto index = std::size_t{0}; index < count; ++index) {
+      mocks.emplace(state_, args...);
+    }
+
+    mocks_.reserve(mocks_.size() + count);
+    for (auto const& mock : mocks) {
+      mocks_.insert(mockId(mock));
+    }
+
+    return mocks;
+  }
+
   template <typename Callback,
             typename Mock,
             typename ReturnType,
@@ -294,8 +1984,9 @@ class Repo {
                   ReturnType (Mock::MockedType::*method)(Args...),
                   Callback&& callback) {
     expectedCallInternal(
-        std::move(description), mock, method,
-        std::function<ReturnType(Args...)>(std::forward<Callback>(callback)));
+        std::move(description), mockId(mock), methodKey<Mock>(method),
+        internal::eraseCallback(std::function<ReturnType(Args...)>(
+            std::forward<Callback>(callback))));
   }
 
   template <typename Callback,
@@ -307,8 +1998,39 @@ class Repo {
                   ReturnType (Mock::MockedType::*method)(Args...) const,
                   Callback&& callback) {
     expectedCallInternal(
-        std::move(description), mock, method,
-        std::function<ReturnType(Args...)>(std::forward<Callback>(callback)));
+        std::move(description), mockId(mock), methodKey<Mock>(method),
+        internal::eraseCallback(std::function<ReturnType(Args...)>(
+            std::forward<Callback>(callback))));
+  }
+
+  // Expects a call of the method on any mock of the Mock type, e.g. on any
+  // member of a pool of identical mocks.
+  template <class Mock,
+            typename Callback,
+            typename ReturnType,
+            typename... Args>
+  void expectCall(std::string description,
+                  ReturnType (Mock::MockedType::*method)(Args...),
+                  Callback&& callback) {
+    state_.expected_callback_queue.push(
+        std::move(description), internal::ExpectedCallbackQueue::any_mock,
+        methodKey<Mock>(method),
+        internal::eraseCallback(std::function<ReturnType(Args...)>(
+            std::forward<Callback>(callback))));
+  }
+
+  template <class Mock,
+            typename Callback,
+            typename ReturnType,
+            typename... Args>
+  void expectCall(std::string description,
+                  ReturnType (Mock::MockedType::*method)(Args...) const,
+                  Callback&& callback) {
+    state_.expected_callback_queue.push(
+        std::move(description), internal::ExpectedCallbackQueue::any_mock,
+        methodKey<Mock>(method),
+        internal::eraseCallback(std::function<ReturnType(Args...)>(
+            std::forward<Callback>(callback))));
   }
 
   template <typename Callback,
@@ -319,8 +2041,9 @@ class Repo {
               ReturnType (Mock::MockedType::*method)(Args...),
               Callback&& callback) {
     state_.fallback_callbacks.add(
-        mock, method,
-        std::function<ReturnType(Args...)>(std::forward<Callback>(callback)));
+        mockId(mock), methodKey<Mock>(method),
+        internal::eraseCallback(std::function<ReturnType(Args...)>(
+            std::forward<Callback>(callback))));
   }
 
   template <typename Callback,
@@ -331,24 +2054,333 @@ class Repo {
               ReturnType (Mock::MockedType::*method)(Args...) const,
               Callback&& callback) {
     state_.fallback_callbacks.add(
-        mock, method,
-        std::function<ReturnType(Args...)>(std::forward<Callback>(callback)));
+        mockId(mock), methodKey<Mock>(method),
+        internal::eraseCallback(std::function<ReturnType(Args...)>(
+            std::forward<Callback>(callback))));
+  }
+
+  // Registers a fallback callback for every mock of the Mock type, used by
+  // the mocks that have no fallback of their own for the method.
+  template <class Mock,
+            typename Callback,
+            typename ReturnType,
+            typename... Args>
+  void onCall(ReturnType (Mock::MockedType::*method)(Args...),
+              Callback&& callback) {
+    state_.fallback_callbacks.addShared(
+        methodKey<Mock>(method),
+        internal::eraseCallback(std::function<ReturnType(Args...)>(
+            std::forward<Callback>(callback))));
+  }
+
+  template <class Mock,
+            typename Callback,
+            typename ReturnType,
+            typename... Args>
+  void onCall(ReturnType (Mock::MockedType::*method)(Args...) const,
+              Callback&& callback) {
+    state_.fallback_callbacks.addShared(
+        methodKey<Mock>(method),
+        internal::eraseCallback(std::function<ReturnType(Args...)>(
+            std::forward<Callback>(callback))));
+  }
+
+  // Attributes a synthetic cost, e.g. simulated microseconds or bytes, to
+  // every call of the method on the mock. The cost is either a number or a
+  // callable computing it from the call arguments.
+  template <typename Cost,
+            typename Mock,
+            typename ReturnType,
+            typename... Args>
+  void setCallCost(Mock const& mock,
+                   ReturnType (Mock::MockedType::*method)(Args...),
+                   Cost&& cost) {
+    setCallCostInternal<Args...>(mockId(mock), methodKey<Mock>(method),
+                                 std::forward<Cost>(cost));
+  }
+
+  template <typename Cost,
+            typename Mock,
+            typename ReturnType,
+            typename... Args>
+  void setCallCost(Mock const& mock,
+                   ReturnType (Mock::MockedType::*method)(Args...) const,
+                   Cost&& cost) {
+    setCallCostInternal<Args...>(mockId(mock), methodKey<Mock>(method),
+                                 std::forward<Cost>(cost));
+  }
+
+  // Makes every call of the method on the mock advance the virtual clock by
+  // the given latency before its callback runs.
+  template <typename Mock, typename ReturnType, typename... Args>
+  void setLatency(Mock const& mock,
+                  ReturnType (Mock::MockedType::*method)(Args...),
+                  Latency latency) {
+    state_.call_latencies.set(mockId(mock), methodKey<Mock>(method),
+                              std::move(latency));
+  }
+
+  template <typename Mock, typename ReturnType, typename... Args>
+  void setLatency(Mock const& mock,
+                  ReturnType (Mock::MockedType::*method)(Args...) const,
+                  Latency latency) {
+    state_.call_latencies.set(mockId(mock), methodKey<Mock>(method),
+                              std::move(latency));
+  }
+
+  // Counts calls of the method on the mock that repeat the arguments of an
+  // earlier call, e.g. to find missing caches in the code under test. The
+  // arguments are compared by hash, std::hash of each argument by default.
+  template <typename Hasher = internal::ArgumentHash,
+            typename Mock,
+            typename ReturnType,
+            typename... Args>
+  void detectRedundantCalls(Mock const& mock,
+                            ReturnType (Mock::MockedType::*method)(Args...),
+                            Hasher&& hasher = Hasher{}) {
+    detectRedundantCallsInternal<Args...>(mockId(mock), methodKey<Mock>(method),
+                                          std::forward<Hasher>(hasher));
+  }
+
+  template <typename Hasher = internal::ArgumentHash,
+            typename Mock,
+            typename ReturnType,
+            typename... Args>
+  void detectRedundantCalls(
+      Mock const& mock,
+      ReturnType (Mock::MockedType::*method)(Args...) const,
+      Hasher&& hasher = Hasher{}) {
+    detectRedundantCallsInternal<Args...>(mockId(mock), methodKey<Mock>(method),
+                                          std::forward<Hasher>(hasher));
+  }
+
+  // Collects runs of consecutive calls of the method on the mock. A run ends
+  // with a call of any other mocked method. batch_method names the batch
+  // alternative in the report, e.g. "Store::multiGet".
+  template <typename Method, typename Mock>
+  void detectBatchingOpportunities(Mock const& mock,
+                                   Method const method,
+                                   std::string batch_method = {}) {
+    state_.batching.add(mockId(mock), methodKey<Mock>(method),
+                        std::move(batch_method));
+  }
+
+  BatchingReport batchingReport() const { return state_.batching.report(); }
+
+  RedundantCallReport redundantCallReport() const {
+    return state_.redundant_calls.report();
+  }
+
+  // Counts the calls of every mocked method from now on. Each thread counts
+  // in its own shard, the shards are merged by callCount.
+  void enableCallCounts() { state_.call_counts.enable(); }
+
+  template <typename Method, typename Mock>
+  std::size_t callCount(Mock const& mock, Method const method) const {
+    return state_.call_counts.count(mockId(mock), methodKey<Mock>(method));
+  }
+
+  VirtualClock& clock() { return state_.clock; }
+
+  // Replaces a fallback call of the method on the mock with the fault callback
+  // at the given rate, e.g. to throw or to return an error value. Calls
+  // matched by an expectation are never faulted.
+  template <typename Fault,
+            typename Mock,
+            typename ReturnType,
+            typename... Args>
+  void injectFault(Mock const& mock,
+                   ReturnType (Mock::MockedType::*method)(Args...),
+                   double const rate,
+                   Fault&& fault) {
+    state_.fault_injections.add(
+        mockId(mock), methodKey<Mock>(method), rate,
+        internal::eraseCallback(
+            std::function<ReturnType(Args...)>(std::forward<Fault>(fault))),
+        {});
+  }
+
+  template <typename Fault,
+            typename Mock,
+            typename ReturnType,
+            typename... Args>
+  void injectFault(Mock const& mock,
+                   ReturnType (Mock::MockedType::*method)(Args...) const,
+                   double const rate,
+                   Fault&& fault) {
+    state_.fault_injections.add(
+        mockId(mock), methodKey<Mock>(method), rate,
+        internal::eraseCallback(
+            std::function<ReturnType(Args...)>(std::forward<Fault>(fault))),
+        {});
+  }
+
+  // Advances the virtual clock by the extra latency at the given rate. The
+  // call itself proceeds as usual.
+  template <typename Mock, typename ReturnType, typename... Args>
+  void injectLatency(Mock const& mock,
+                     ReturnType (Mock::MockedType::*method)(Args...),
+                     double const rate,
+                     Clock::duration const latency) {
+    state_.fault_injections.add(mockId(mock), methodKey<Mock>(method), rate,
+                                {}, latency);
+  }
+
+  template <typename Mock, typename ReturnType, typename... Args>
+  void injectLatency(Mock const& mock,
+                     ReturnType (Mock::MockedType::*method)(Args...) const,
+                     double const rate,
+                     Clock::duration const latency) {
+    state_.fault_injections.add(mockId(mock), methodKey<Mock>(method), rate,
+                                {}, latency);
+  }
+
+  // The seed is printed before an unexpected or missing call is reported.
+  void setFaultSeed(std::uint64_t const seed) {
+    state_.fault_injections.seed(seed);
+  }
+
+  std::uint64_t faultSeed() { return state_.fault_injections.seed(); }
+
+  // Starts a new cost scenario. Costs recorded before the first scenario is
+  // started belong to the "default" scenario.
+  void beginCostScenario(std::string name) {
+    state_.call_costs.beginScenario(std::move(name));
+  }
+
+  CostReport costReport() const { return state_.call_costs.report(); }
+
+  // Allows at most max_calls calls to the method across the given mocks while
+  // the returned budget is alive. Every call beyond that is reported to the
+  // call budget handler.
+  template <typename Method, typename Mock, typename... Mocks>
+  [[nodiscard]] CallBudget limitCalls(std::string description,
+                                      std::size_t const max_calls,
+                                      Method const method,
+                                      Mock const& mock,
+                                      Mocks const&... mocks) {
+    auto targets = std::vector<internal::CallBudgets::Target>{
+        {mockId(mock), methodKey<Mock>(method)},
+        {mockId(mocks), methodKey<Mocks>(method)}...};
+
+    for (auto const& target : targets) {
+      if (mocks_.count(target.first) == 0) {
+        throw std::invalid_argument{
+            "[comock] Cannot set a call budget for a mock object that was "
+            "not created in the repository."};
+      }
+    }
+
+    auto const id = state_.call_budgets.add(std::move(description), max_calls,
+                                            std::move(targets));
+    return CallBudget{state_.call_budgets, id};
+  }
+
+  // Allows at most max_in_flight calls to the method across the given mocks
+  // to run at the same time while the returned limit is alive. Every call
+  // beyond that is reported to the concurrency limit handler.
+  template <typename Method, typename Mock, typename... Mocks>
+  [[nodiscard]] ConcurrencyLimit limitConcurrency(
+      std::string description,
+      std::size_t const max_in_flight,
+      Method const method,
+      Mock const& mock,
+      Mocks const&... mocks) {
+    auto targets = std::vector<internal::ConcurrencyLimits::Target>{
+        {mockId(mock), methodKey<Mock>(method)},
+        {mockId(mocks), methodKey<Mocks>(method)}...};
+
+    for (auto const& target : targets) {
+      if (mocks_.count(target.first) == 0) {
+        throw std::invalid_argument{
+            "[comock] Cannot set a concurrency limit for a mock object that "
+            "was not created in the repository."};
+      }
+    }
+
+    auto limit = state_.concurrency_limits.add(
+        std::move(description), max_in_flight, std::move(targets));
+    return ConcurrencyLimit{state_.concurrency_limits, std::move(limit)};
   }
 
  private:
-  template <typename Mock, typename Method, typename Callback>
+  friend struct internal::ScriptAccess;
+  friend class ExpectationScript;
+
+  template <typename Mock>
+  static uintptr_t mockId(Mock const& mock) {
+    return reinterpret_cast<uintptr_t>(
+        static_cast<internal::MockBase<typename Mock::MockedType> const*>(
+            &mock));
+  }
+
+  template <typename Mock, typename Method>
+  static internal::MethodKey methodKey(Method const method) {
+    auto const key = Mock::comockMethodKey(method);
+
+    if (!key) {
+      throw std::invalid_argument{
+          "[comock] Cannot register a callback for a method that is not "
+          "mocked."};
+    }
+
+    return key;
+  }
+
+  template <typename... Args, typename Cost>
+  void setCallCostInternal(uintptr_t const mock,
+                           internal::MethodKey const method,
+                           Cost&& cost) {
+    using CostFunction = std::function<double(Args const&...)>;
+
+    if constexpr (std::is_arithmetic_v<std::decay_t<Cost>>) {
+      auto const fixed_cost = static_cast<double>(cost);
+      state_.call_costs.set(
+          mock, method,
+          internal::eraseCallback(CostFunction{
+              [fixed_cost](Args const&...) { return fixed_cost; }}));
+    } else {
+      state_.call_costs.set(
+          mock, method,
+          internal::eraseCallback(CostFunction{std::forward<Cost>(cost)}));
+    }
+  }
+
+  template <typename... Args, typename Hasher>
+  void detectRedundantCallsInternal(uintptr_t const mock,
+                                    internal::MethodKey const method,
+                                    Hasher&& hasher) {
+    using HashFunction = std::function<std::size_t(Args const&...)>;
+
+    state_.redundant_calls.set(
+        mock, method,
+        internal::eraseCallback(HashFunction{std::forward<Hasher>(hasher)}));
+  }
+
+  void reportMissingCalls() {
+    while (!state_.expected_callback_queue.isEmpty()) {
+      auto const description = state_.expected_callback_queue.peekDescription();
+      state_.expected_callback_queue.pop();
+
+      if (state_.missing_call_handler) {
+        state_.fault_injections.reportSeed();
+        state_.missing_call_handler(description);
+      }
+    }
+  }
+
   void expectedCallInternal(std::string description,
-                            Mock const& mock,
-                            Method method,
-                            Callback&& callback) {
-    if (mocks_.count(reinterpret_cast<uintptr_t>(&mock)) == 0) {
+                            uintptr_t const mock,
+                            internal::MethodKey const method,
+                            internal::ErasedCallback callback) {
+    if (mocks_.count(mock) == 0) {
       throw std::invalid_argument{
           "[comock] Cannot set a method call expectation for a mock "
           "object that was not created in the repository."};
     }
 
     state_.expected_callback_queue.push(std::move(description), mock, method,
-                                        std::forward<Callback>(callback));
+                                        std::move(callback));
   }
 
  private:
@@ -366,137 +2398,154 @@ class Repo {
       [](std::string const& description) {
         std::cerr << "[comock] Missing method call. Expectation violated: "
                   << description << std::endl;
-      }};
+      },
+      {},
+      [](std::string const& description) {
+        std::cerr << "[comock] Call budget exceeded: " << description
+                  << std::endl;
+      },
+      {},
+      [](std::string const& description) {
+        std::cerr << "[comock] Concurrency limit exceeded: " << description
+                  << std::endl;
+      },
+      {},
+      [](BatchingReport const& report) { std::cerr << report; }};
+};
+
+// Expectations built once and bound to their repository any number of times,
+// e.g. once per iteration of a randomized test:
+//
+//   auto script = comock::ExpectationScript{repo};
+//   script.expectCall("connect", *mock, &Client::connect, connect)
+//       .expectCall("send", *mock, &Client::send, send, 3);
+//
+//   repo.bind(script);
+//
+// Binding shares the expectations with the repository instead of copying
+// them.
+class ExpectationScript {
+ public:
+  explicit ExpectationScript(Repo const& repo)
+      : repo_{&repo},
+        expectations_{
+            std::make_shared<internal::ExpectedCallbackQueue::Script>()} {}
+
+  // Expects times consecutive calls of the method on the mock.
+  template <typename Callback,
+            typename Mock,
+            typename ReturnType,
+            typename... Args>
+  ExpectationScript& expectCall(std::string description,
+                                Mock const& mock,
+                                ReturnType (Mock::MockedType::*method)(Args...),
+                                Callback&& callback,
+                                std::size_t const times = 1) {
+    return add(std::move(description), Repo::mockId(mock),
+               Repo::methodKey<Mock>(method),
+               internal::eraseCallback(std::function<ReturnType(Args...)>(
+                   std::forward<Callback>(callback))),
+               times);
+  }
+
+  template <typename Callback,
+            typename Mock,
+            typename ReturnType,
+            typename... Args>
+  ExpectationScript& expectCall(
+      std::string description,
+      Mock const& mock,
+      ReturnType (Mock::MockedType::*method)(Args...) const,
+      Callback&& callback,
+      std::size_t const times = 1) {
+    return add(std::move(description), Repo::mockId(mock),
+               Repo::methodKey<Mock>(method),
+               internal::eraseCallback(std::function<ReturnType(Args...)>(
+                   std::forward<Callback>(callback))),
+               times);
+  }
+
+  // Expects times consecutive calls of the method on any mock of the Mock
+  // type.
+  template <class Mock,
+            typename Callback,
+            typename ReturnType,
+            typename... Args>
+  ExpectationScript& expectCall(std::string description,
+                                ReturnType (Mock::MockedType::*method)(Args...),
+                                Callback&& callback,
+                                std::size_t const times = 1) {
+    return add(std::move(description),
+               internal::ExpectedCallbackQueue::any_mock,
+               Repo::methodKey<Mock>(method),
+               internal::eraseCallback(std::function<ReturnType(Args...)>(
+                   std::forward<Callback>(callback))),
+               times);
+  }
+
+  template <class Mock,
+            typename Callback,
+            typename ReturnType,
+            typename... Args>
+  ExpectationScript& expectCall(
+      std::string description,
+      ReturnType (Mock::MockedType::*method)(Args...) const,
+      Callback&& callback,
+      std::size_t const times = 1) {
+    return add(std::move(description),
+               internal::ExpectedCallbackQueue::any_mock,
+               Repo::methodKey<Mock>(method),
+               internal::eraseCallback(std::function<ReturnType(Args...)>(
+                   std::forward<Callback>(callback))),
+               times);
+  }
+
+ private:
+  friend class Repo;
+
+  ExpectationScript& add(std::string description,
+                         uintptr_t const mock,
+                         internal::MethodKey const method,
+                         internal::ErasedCallback callback,
+                         std::size_t const times) {
+    if (mock != internal::ExpectedCallbackQueue::any_mock &&
+        repo_->mocks_.count(mock) == 0) {
+      throw std::invalid_argument{
+          "[comock] Cannot set a method call expectation for a mock "
+          "object that was not created in the repository."};
+    }
+
+    if (times == 0) {
+      throw std::invalid_argument{
+          "[comock] Cannot expect a method call zero times."};
+    }
+
+    // Repositories bound to the script keep reading the old expectations.
+    if (expectations_.use_count() > 1) {
+      expectations_ =
+          std::make_shared<internal::ExpectedCallbackQueue::Script>(
+              *expectations_);
+    }
+
+    expectations_->push_back(
+        {std::move(description), mock, method, std::move(callback), times});
+    return *this;
+  }
+
+ private:
+  Repo const* repo_;
+  std::shared_ptr<internal::ExpectedCallbackQueue::Script> expectations_;
 };
 
+inline void Repo::bind(ExpectationScript const& script) {
+  if (script.repo_ != this) {
+    throw std::invalid_argument{
+        "[comock] Cannot bind an expectation script of another repository."};
+  }
+
+  state_.expected_callback_queue.bind(script.expectations_);
+}
+
 }  // namespace comock
 
-#define COMOCK_DEFINE_BEGIN(MockType, MockedType)                   \
-  class MockType : public comock::internal::MockBase<MockedType> {  \
-   public:                                                          \
-    template <typename... Args>                                     \
-    MockType(comock::internal::RepoState& repo_state, Args... args) \
-        : comock::internal::MockBase<MockedType>{                   \
-              repo_state, std::forward<Args>(args)...} {}
-
-#define COMOCK_DEFINE_END \
-  }                       \
-  ;
-
-#define COMOCK_METHOD(MethodName, ReturnType, ArgTypeSeq, SpecifierSeq)       \
-  _COMOCK_PREFIX_SPECIFIERS(SpecifierSeq)                                     \
-  ReturnType MethodName(_COMOCK_TO_PARAMS((void)ArgTypeSeq))                  \
-      _COMOCK_POSTFIX_SPECIFIERS(SpecifierSeq) {                              \
-    using Method =                                                            \
-        ReturnType (MockedType::*)(COMOCK_TO_TYPES((void)ArgTypeSeq))         \
-            _COMOCK_CONST_SPECIFIER((void)SpecifierSeq);                      \
-    auto const method = static_cast<Method>(&MockedType::MethodName);         \
-    auto const default_callback =                                             \
-        [this](_COMOCK_TO_PARAMS((void)ArgTypeSeq)) {                         \
-          if constexpr (std::is_abstract_v<MockedType>) {                     \
-            return ReturnType();                                              \
-          } else {                                                            \
-            return MockedType::MethodName(_COMOCK_TO_ARGS((void)ArgTypeSeq)); \
-          }                                                                   \
-        };                                                                    \
-    using Mock = comock::internal::MockBase<MockedType>;                      \
-    return Mock::call(std::function{default_callback},                        \
-                      method _COMOCK_COMMA_IF((void)ArgTypeSeq)               \
-                          _COMOCK_TO_ARGS((void)ArgTypeSeq));                 \
-  }
-
-#define _COMOCK_TO_PARAMS(ArgTypeSeq) \
-  BOOST_PP_SEQ_FOR_EACH_I(_COMOCK_EXPAND_PARAM, arg, ArgTypeSeq)
-
-#define _COMOCK_EXPAND_PARAM(unused, Name, Index, Type)                        \
-  BOOST_PP_IF(Index, _COMOCK_EXPAND_PARAM1, _COMOCK_EXPAND_PARAM2)(Type, Name, \
-                                                                   Index)
-
-#define _COMOCK_EXPAND_PARAM1(Type, Name, Index) \
-  BOOST_PP_COMMA_IF(BOOST_PP_GREATER(Index, 1))  \
-  Type BOOST_PP_CAT(Name, Index)
-
-#define _COMOCK_EXPAND_PARAM2(Type, Name, Index)
-
-#define COMOCK_TO_TYPES(ArgTypeSeq) \
-  BOOST_PP_SEQ_FOR_EACH_I(_COMOCK_EXPAND_TYPE, arg, ArgTypeSeq)
-
-#define _COMOCK_EXPAND_TYPE(unused1, unused2, Index, Type) \
-  BOOST_PP_IF(Index, _COMOCK_EXPAND_TYPE1, _COMOCK_EXPAND_TYPE2)(Type, Index)
-
-#define _COMOCK_EXPAND_TYPE1(Type, Index) \
-  BOOST_PP_COMMA_IF(BOOST_PP_GREATER(Index, 1)) Type
-
-#define _COMOCK_EXPAND_TYPE2(Type, Index)
-
-#define _COMOCK_TO_ARGS(ArgTypeSeq) \
-  BOOST_PP_SEQ_FOR_EACH_I(_COMOCK_EXPAND_ARG, arg, ArgTypeSeq)
-
-#define _COMOCK_EXPAND_ARG(unused1, Name, Index, unused2) \
-  BOOST_PP_IF(Index, _COMOCK_EXPAND_ARG1, _COMOCK_EXPAND_ARG2)(Name, Index)
-
-#define _COMOCK_EXPAND_ARG1(Name, Index)        \
-  BOOST_PP_COMMA_IF(BOOST_PP_GREATER(Index, 1)) \
-  std::move(BOOST_PP_CAT(Name, Index))
-
-#define _COMOCK_EXPAND_ARG2(Name, Index)
-
-#define _COMOCK_COMMA_IF(ArgTypeSeq) \
-  BOOST_PP_COMMA_IF(BOOST_PP_DEC(BOOST_PP_SEQ_SIZE(ArgTypeSeq)))
-
-#define _COMOCK_CONST_SPECIFIER(SpecifierSeq) \
-  BOOST_PP_SEQ_FOR_EACH_I(_COMOCK_EXPAND_CONST, _, SpecifierSeq)
-
-#define _COMOCK_EXPAND_CONST(unused1, unused2, unused3, Specifier) \
-  BOOST_PP_CAT(_COMOCK_CONST_SPECIFIER_, Specifier)
-
-#define _COMOCK_CONST_SPECIFIER_const const
-#define _COMOCK_CONST_SPECIFIER_inline
-#define _COMOCK_CONST_SPECIFIER_constexpr
-#define _COMOCK_CONST_SPECIFIER_consteval
-#define _COMOCK_CONST_SPECIFIER_virtual
-#define _COMOCK_CONST_SPECIFIER_friend
-#define _COMOCK_CONST_SPECIFIER_static
-#define _COMOCK_CONST_SPECIFIER_volatile
-#define _COMOCK_CONST_SPECIFIER_noexcept
-#define _COMOCK_CONST_SPECIFIER_override
-#define _COMOCK_CONST_SPECIFIER_final
-#define _COMOCK_CONST_SPECIFIER_void
-
-#define _COMOCK_POSTFIX_SPECIFIERS(SpecifierSeq) \
-  BOOST_PP_SEQ_FOR_EACH_I(_COMOCK_EXPAND_POSTFIX_SPECIFIER, _, SpecifierSeq)
-
-#define _COMOCK_EXPAND_POSTFIX_SPECIFIER(unused1, unused2, unused3, Specifier) \
-  BOOST_PP_CAT(_COMOCK_POSTFIX_SPECIFIER_, Specifier)
-
-#define _COMOCK_POSTFIX_SPECIFIER_const const
-#define _COMOCK_POSTFIX_SPECIFIER_volatile volatile
-#define _COMOCK_POSTFIX_SPECIFIER_noexcept noexcept
-#define _COMOCK_POSTFIX_SPECIFIER_override override
-#define _COMOCK_POSTFIX_SPECIFIER_final final
-#define _COMOCK_POSTFIX_SPECIFIER_inline
-#define _COMOCK_POSTFIX_SPECIFIER_constexpr
-#define _COMOCK_POSTFIX_SPECIFIER_consteval
-#define _COMOCK_POSTFIX_SPECIFIER_virtual
-#define _COMOCK_POSTFIX_SPECIFIER_friend
-#define _COMOCK_POSTFIX_SPECIFIER_static
-#define _COMOCK_POSTFIX_SPECIFIER_void
-
-#define _COMOCK_PREFIX_SPECIFIERS(SpecifierSeq) \
-  BOOST_PP_SEQ_FOR_EACH_I(_COMOCK_EXPAND_PREFIX_SPECIFIER, _, SpecifierSeq)
-
-#define _COMOCK_EXPAND_PREFIX_SPECIFIER(unused1, unused2, unused3, Specifier) \
-  BOOST_PP_CAT(_COMOCK_PREFIX_SPECIFIER_, Specifier)
-
-#define _COMOCK_PREFIX_SPECIFIER_inline inline
-#define _COMOCK_PREFIX_SPECIFIER_constexpr constexpr
-#define _COMOCK_PREFIX_SPECIFIER_consteval consteval
-#define _COMOCK_PREFIX_SPECIFIER_virtual virtual
-#define _COMOCK_PREFIX_SPECIFIER_friend friend
-#define _COMOCK_PREFIX_SPECIFIER_static static
-#define _COMOCK_PREFIX_SPECIFIER_const
-#define _COMOCK_PREFIX_SPECIFIER_volatile
-#define _COMOCK_PREFIX_SPECIFIER_noexcept
-#define _COMOCK_PREFIX_SPECIFIER_override
-#define _COMOCK_PREFIX_SPECIFIER_final
-#define _COMOCK_PREFIX_SPECIFIER_void
+#include <comock/comock_macros.h>
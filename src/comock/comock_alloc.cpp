@@ -0,0 +1,195 @@
+// MIT License
+//
+// Copyright (c) 2025 Siarhei Homan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <comock/comock_alloc.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+thread_local comock::AllocationTracker* active_tracker = nullptr;
+
+// Method names are compared by content as well, a name literal may be
+// duplicated across translation units.
+bool sameName(char const* const lhs, char const* const rhs) {
+  return lhs == rhs ||
+         (lhs != nullptr && rhs != nullptr && std::strcmp(lhs, rhs) == 0);
+}
+
+// Suspends tracking on the current thread, e.g. while a report is built.
+class TrackingPause {
+ public:
+  TrackingPause() : tracker_{std::exchange(active_tracker, nullptr)} {}
+
+  TrackingPause(TrackingPause const&) = delete;
+  TrackingPause& operator=(TrackingPause const&) = delete;
+
+  ~TrackingPause() { active_tracker = tracker_; }
+
+ private:
+  comock::AllocationTracker* tracker_;
+};
+
+}  // namespace
+
+void* operator new(std::size_t const size) {
+  if (auto* const tracker = active_tracker) {
+    tracker->recordAllocation(size);
+  }
+
+  if (auto* const pointer = std::malloc(size == 0 ? 1 : size)) {
+    return pointer;
+  }
+
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* const pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* const pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+namespace comock {
+
+AllocationScope const* AllocationReport::scope(std::string const& name) const {
+  for (auto const& scope : scopes) {
+    if (scope.name == name) {
+      return &scope;
+    }
+  }
+  return nullptr;
+}
+
+std::ostream& operator<<(std::ostream& stream, AllocationReport const& report) {
+  for (auto const& scope : report.scopes) {
+    stream << "[comock] " << scope.name << ": " << scope.allocations
+           << " allocations, " << scope.bytes << " bytes\n";
+  }
+  return stream;
+}
+
+AllocationTracker::AllocationTracker(Repo& repo) : repo_{repo} {
+  if (active_tracker) {
+    throw std::invalid_argument{
+        "[comock] Another allocation tracker is active on this thread."};
+  }
+
+  repo_.addCallObserver(*this);
+  current_ = findScope(nullptr, nullptr, false);
+  active_tracker = this;
+}
+
+AllocationTracker::~AllocationTracker() {
+  active_tracker = nullptr;
+  repo_.removeCallObserver(*this);
+}
+
+AllocationReport AllocationTracker::report() const {
+  auto const pause = TrackingPause{};
+  auto report = AllocationReport{};
+
+  for (auto i = std::size_t{0}; i < scope_count_; ++i) {
+    auto const& scope = scopes_[i];
+    auto name = std::string{};
+
+    if (scope.type == nullptr) {
+      name = "before calls";
+    } else {
+      name = std::string{scope.inside ? "" : "after "} + scope.type +
+             "::" + scope.method;
+    }
+
+    report.scopes.push_back({std::move(name), scope.allocations, scope.bytes});
+  }
+
+  return report;
+}
+
+void AllocationTracker::reset() {
+  for (auto i = std::size_t{0}; i < scope_count_; ++i) {
+    scopes_[i].allocations = 0;
+    scopes_[i].bytes = 0;
+  }
+}
+
+void AllocationTracker::callStarted(char const* const type,
+                                    char const* const method) {
+  if (active_tracker != this) {
+    return;
+  }
+
+  if (depth_ < max_depth) {
+    stack_[depth_] = current_;
+  }
+  ++depth_;
+  current_ = findScope(type, method, true);
+}
+
+void AllocationTracker::callFinished(char const* const type,
+                                     char const* const method) {
+  if (active_tracker != this || depth_ == 0) {
+    return;
+  }
+
+  --depth_;
+  // Nested calls return to the scope of the enclosing call.
+  if (depth_ > 0 && depth_ < max_depth) {
+    current_ = stack_[depth_];
+  } else {
+    current_ = findScope(type, method, false);
+  }
+}
+
+void AllocationTracker::recordAllocation(std::size_t const size) {
+  ++scopes_[current_].allocations;
+  scopes_[current_].bytes += size;
+}
+
+std::size_t AllocationTracker::findScope(char const* const type,
+                                         char const* const method,
+                                         bool const inside) {
+  for (auto i = std::size_t{0}; i < scope_count_; ++i) {
+    auto const& scope = scopes_[i];
+    if (scope.inside == inside && sameName(scope.type, type) &&
+        sameName(scope.method, method)) {
+      return i;
+    }
+  }
+
+  if (scope_count_ == max_scopes) {
+    // Out of storage, the scope shares the counters of the last one.
+    return max_scopes - 1;
+  }
+
+  scopes_[scope_count_] = {type, method, inside, 0, 0};
+  return scope_count_++;
+}
+
+}  // namespace comock
@@ -0,0 +1,99 @@
+// MIT License
+//
+// Copyright (c) 2025 Siarhei Homan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <comock/comock.h>
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Optional allocation tracker. Linking the comock_alloc library replaces the
+// global operator new and operator delete of the program.
+
+namespace comock {
+
+struct AllocationScope {
+  std::string name;
+  std::size_t allocations;
+  std::size_t bytes;
+};
+
+// Allocations of the tracking thread, attributed to the mocked call that was
+// running ("Type::method") or that returned last ("after Type::method").
+struct AllocationReport {
+  std::vector<AllocationScope> scopes;
+
+  AllocationScope const* scope(std::string const& name) const;
+};
+
+std::ostream& operator<<(std::ostream& stream, AllocationReport const& report);
+
+// Tracks the allocations of the thread that created it while it is alive.
+// Only one tracker per thread can be alive at a time.
+class AllocationTracker : public CallObserver {
+ public:
+  explicit AllocationTracker(Repo& repo);
+
+  AllocationTracker(AllocationTracker const&) = delete;
+  AllocationTracker& operator=(AllocationTracker const&) = delete;
+
+  ~AllocationTracker() override;
+
+  AllocationReport report() const;
+
+  // Forgets the allocations recorded so far, e.g. after a warm-up run.
+  void reset();
+
+  void callStarted(char const* type, char const* method) override;
+
+  void callFinished(char const* type, char const* method) override;
+
+  void recordAllocation(std::size_t size);
+
+ private:
+  // Scopes are kept in fixed storage, recording must not allocate.
+  struct Scope {
+    char const* type;
+    char const* method;
+    bool inside;
+    std::size_t allocations;
+    std::size_t bytes;
+  };
+
+  static constexpr std::size_t max_scopes = 64;
+  static constexpr std::size_t max_depth = 16;
+
+  std::size_t findScope(char const* type, char const* method, bool inside);
+
+  Repo& repo_;
+  Scope scopes_[max_scopes] = {};
+  std::size_t scope_count_ = 0;
+  std::size_t current_ = 0;
+  std::size_t stack_[max_depth] = {};
+  std::size_t depth_ = 0;
+};
+
+}  // namespace comock
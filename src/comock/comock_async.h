@@ -0,0 +1,140 @@
+// MIT License
+//
+// Copyright (c) 2025 Siarhei Homan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <comock/comock.h>
+
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// Mocked methods that return std::future. Their results are completed later,
+// either by an executor or manually through a Completion:
+//
+//   auto executor = comock::ManualExecutor{};
+//   repo.onCall(*mock, &Service::fetch,
+//               comock::completeOn(executor, [](int id) { return id * 2; }));
+//
+//   auto future = mock->fetch(21);  // Not ready yet.
+//   executor.runAll();              // future.get() == 42
+
+namespace comock {
+
+namespace internal {
+
+template <typename Result, typename Function>
+void fulfil(std::promise<Result>& promise, Function&& function) {
+  try {
+    if constexpr (std::is_void_v<Result>) {
+      function();
+      promise.set_value();
+    } else {
+      promise.set_value(function());
+    }
+  } catch (...) {
+    promise.set_exception(std::current_exception());
+  }
+}
+
+}  // namespace internal
+
+// Single-threaded executor that runs posted tasks in order, only when asked
+// to, so asynchronous results complete deterministically.
+class ManualExecutor {
+ public:
+  void post(std::function<void()> task) { tasks_.push_back(std::move(task)); }
+
+  // Runs the oldest pending task. Returns false if there is none.
+  bool runOne() {
+    if (tasks_.empty()) {
+      return false;
+    }
+
+    auto task = std::move(tasks_.front());
+    tasks_.pop_front();
+    task();
+    return true;
+  }
+
+  // Runs pending tasks, including the ones they post, until none is left.
+  std::size_t runAll() {
+    auto count = std::size_t{0};
+    while (runOne()) {
+      ++count;
+    }
+    return count;
+  }
+
+  std::size_t pending() const { return tasks_.size(); }
+
+ private:
+  std::deque<std::function<void()>> tasks_ = {};
+};
+
+// Result of an asynchronous call that the test completes by hand.
+template <typename T>
+class Completion {
+ public:
+  // Can be called once.
+  std::future<T> future() { return promise_.get_future(); }
+
+  template <typename... Value>
+  void complete(Value&&... value) {
+    promise_.set_value(std::forward<Value>(value)...);
+  }
+
+  void fail(std::exception_ptr exception) {
+    promise_.set_exception(std::move(exception));
+  }
+
+ private:
+  std::promise<T> promise_ = {};
+};
+
+// Callback for a method returning std::future. The callback computes the
+// result with the call arguments on the executor, any object with a
+// post(std::function<void()>) member. Exceptions complete the future.
+template <typename Executor, typename Callback>
+auto completeOn(Executor& executor, Callback callback) {
+  return [&executor, callback = std::move(callback)](auto... args) {
+    using Result = std::invoke_result_t<Callback const&, decltype(args)...>;
+
+    auto promise = std::make_shared<std::promise<Result>>();
+    auto future = promise->get_future();
+
+    executor.post([promise, callback, args...]() mutable {
+      internal::fulfil(*promise, [&]() -> Result {
+        return callback(std::move(args)...);
+      });
+    });
+
+    return future;
+  };
+}
+
+}  // namespace comock
@@ -0,0 +1,245 @@
+// MIT License
+//
+// Copyright (c) 2025 Siarhei Homan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <comock/comock.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Runs threads one at a time and switches between them only at mocked calls.
+// The switches are chosen by a seeded scheduler, so a test can explore many
+// interleavings of its threads and replay a failing one from its seed:
+//
+//   for (auto seed = 0u; seed < 1000; ++seed) {
+//     auto repo = comock::Repo{};
+//     ...
+//     auto interleaving = comock::Interleaving::random(repo, seed);
+//     interleaving.run({[&]() { worker(*mock); }, [&]() { worker(*mock); }});
+//     CHECK_MESSAGE(invariantHolds(), "Seed: " << seed);
+//   }
+//
+// Code under test must not wait for another thread of the interleaving
+// between two mocked calls, since that thread cannot run until the next
+// mocked call.
+
+namespace comock {
+
+class Interleaving : public CallObserver {
+ public:
+  // Switches to a uniformly chosen thread at every mocked call.
+  static Interleaving random(Repo& repo, std::uint64_t const seed) {
+    return Interleaving{repo, seed, 0, 0};
+  }
+
+  // Probabilistic concurrency testing (PCT): runs the thread with the
+  // highest priority and lowers the priority of the running thread at
+  // depth - 1 random steps out of the expected number of steps.
+  static Interleaving pct(Repo& repo,
+                          std::uint64_t const seed,
+                          std::size_t const depth,
+                          std::size_t const expected_steps) {
+    return Interleaving{repo, seed, depth, expected_steps};
+  }
+
+  Interleaving(Interleaving const&) = delete;
+  Interleaving& operator=(Interleaving const&) = delete;
+
+  ~Interleaving() override { repo_.removeCallObserver(*this); }
+
+  // Runs every function on its own thread and returns when all of them have
+  // finished. The first exception thrown by a function is rethrown.
+  void run(std::vector<std::function<void()>> functions) {
+    initialize(functions.size());
+
+    auto threads = std::vector<std::thread>{};
+    for (auto index = std::size_t{0}; index < functions.size(); ++index) {
+      threads.emplace_back([this, index, &functions]() {
+        runThread(index, functions[index]);
+      });
+    }
+
+    {
+      auto const lock = std::lock_guard<std::mutex>{mutex_};
+      switchThread();
+    }
+    condition_.notify_all();
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    if (exception_) {
+      std::rethrow_exception(exception_);
+    }
+  }
+
+  // Index of the thread that ran after every switch.
+  std::vector<std::size_t> const& schedule() const { return schedule_; }
+
+  std::uint64_t seed() const { return seed_; }
+
+  void callStarted(char const*, char const*) override {
+    if (current_interleaving != this) {
+      return;
+    }
+
+    auto lock = std::unique_lock<std::mutex>{mutex_};
+    ++steps_;
+    switchThread();
+    condition_.notify_all();
+    condition_.wait(lock, [this]() { return running_ == current_index; });
+  }
+
+  void callFinished(char const*, char const*) override {}
+
+ private:
+  static constexpr auto none = static_cast<std::size_t>(-1);
+
+  inline static thread_local Interleaving* current_interleaving = nullptr;
+  inline static thread_local std::size_t current_index = none;
+
+  Interleaving(Repo& repo,
+               std::uint64_t const seed,
+               std::size_t const depth,
+               std::size_t const expected_steps)
+      : repo_{repo},
+        seed_{seed},
+        depth_{depth},
+        expected_steps_{expected_steps},
+        random_{seed} {
+    repo_.addCallObserver(*this);
+  }
+
+  void initialize(std::size_t const threads) {
+    finished_.assign(threads, false);
+    schedule_.clear();
+    steps_ = 0;
+    running_ = none;
+    exception_ = nullptr;
+
+    // PCT: distinct initial priorities above the change point priorities.
+    priorities_.clear();
+    for (auto index = std::size_t{0}; index < threads; ++index) {
+      priorities_.push_back(depth_ + index);
+    }
+    for (auto index = threads; index > 1; --index) {
+      std::swap(priorities_[index - 1],
+                priorities_[random_.next() % index]);
+    }
+
+    change_points_.clear();
+    for (auto point = std::size_t{1}; point < depth_; ++point) {
+      change_points_.push_back(
+          1 + random_.next() % std::max<std::size_t>(expected_steps_, 1));
+    }
+  }
+
+  void runThread(std::size_t const index,
+                 std::function<void()> const& function) {
+    current_interleaving = this;
+    current_index = index;
+
+    {
+      auto lock = std::unique_lock<std::mutex>{mutex_};
+      condition_.wait(lock, [this, index]() { return running_ == index; });
+    }
+
+    try {
+      function();
+    } catch (...) {
+      auto const lock = std::lock_guard<std::mutex>{mutex_};
+      if (!exception_) {
+        exception_ = std::current_exception();
+      }
+    }
+
+    {
+      auto const lock = std::lock_guard<std::mutex>{mutex_};
+      finished_[index] = true;
+      switchThread();
+    }
+    condition_.notify_all();
+
+    current_interleaving = nullptr;
+    current_index = none;
+  }
+
+  // Chooses the next thread to run, called with the lock held.
+  void switchThread() {
+    auto runnable = std::vector<std::size_t>{};
+    for (auto index = std::size_t{0}; index < finished_.size(); ++index) {
+      if (!finished_[index]) {
+        runnable.push_back(index);
+      }
+    }
+
+    if (runnable.empty()) {
+      running_ = none;
+      return;
+    }
+
+    if (depth_ == 0) {
+      running_ = runnable[random_.next() % runnable.size()];
+    } else {
+      for (auto point = std::size_t{0}; point < change_points_.size();
+           ++point) {
+        if (change_points_[point] == steps_ && running_ != none) {
+          priorities_[running_] = point;
+        }
+      }
+
+      running_ = *std::max_element(
+          runnable.begin(), runnable.end(),
+          [this](std::size_t const lhs, std::size_t const rhs) {
+            return priorities_[lhs] < priorities_[rhs];
+          });
+    }
+
+    schedule_.push_back(running_);
+  }
+
+  Repo& repo_;
+  std::uint64_t seed_;
+  std::size_t depth_;
+  std::size_t expected_steps_;
+  internal::Random random_;
+
+  std::mutex mutex_ = {};
+  std::condition_variable condition_ = {};
+  std::size_t running_ = none;
+  std::size_t steps_ = 0;
+  std::vector<bool> finished_ = {};
+  std::vector<std::size_t> priorities_ = {};
+  std::vector<std::size_t> change_points_ = {};
+  std::vector<std::size_t> schedule_ = {};
+  std::exception_ptr exception_ = {};
+};
+
+}  // namespace comock
@@ -0,0 +1,380 @@
+// MIT License
+//
+// Copyright (c) 2025 Siarhei Homan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// Macros that define mocks. They are kept apart from the library so that
+// the `comock` module can be imported without textually including comock.h:
+//
+//   import comock;
+//   #include <comock/comock_macros.h>
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+// Every mocked method gets a compile-time key made of the mock type and the
+// address of MethodId for the mocked member function, so keys agree across
+// translation units. Every method also has a comockMethodKey overload for its
+// slot, the line of the method relative to COMOCK_DEFINE_BEGIN, which
+// translates a member function pointer into the key when an expectation or
+// fallback is registered; COMOCK_DEFINE_END tries all slots in one fold.
+// Methods that share a line, e.g. in a mock generated by a macro, share a
+// slot, so their member function types have to differ.
+#define COMOCK_DEFINE_BEGIN(MockType, MockedType)                  \
+  class MockType : public comock::internal::MockBase<MockedType> { \
+    static constexpr int comock_first_line = __LINE__;             \
+                                                                   \
+   public:                                                         \
+    static constexpr ComockMockTypeInfo comock_type_info = {       \
+        #MockType};                                                \
+                                                                   \
+    template <typename... Args>                                    \
+    MockType(ComockRepoState& repo_state, Args... args)            \
+        : comock::internal::MockBase<MockedType>{                  \
+              repo_state, std::forward<Args>(args)...} {}          \
+                                                                   \
+    template <int Slot, typename Method>                           \
+    static ComockMethodKey comockMethodKey(                        \
+        ComockMethodSlot<Slot>,                                    \
+        Method) {                                                  \
+      return {};                                                   \
+    }
+
+#define COMOCK_DEFINE_END                                                    \
+  static constexpr int comock_slot_count = __LINE__ - comock_first_line + 1; \
+                                                                             \
+  template <typename Method>                                                 \
+  static ComockMethodKey comockMethodKey(Method const method) {              \
+    return comockFindMethodKey(                                              \
+        method, std::make_integer_sequence<int, comock_slot_count>{});       \
+  }                                                                          \
+                                                                             \
+  template <typename Method, int... Slots>                                   \
+  static ComockMethodKey comockFindMethodKey(                                \
+      Method const method, std::integer_sequence<int, Slots...>) {           \
+    auto key = ComockMethodKey{};                                            \
+    static_cast<void>(                                                       \
+        ((key = comockMethodKey(ComockMethodSlot<Slots>{},                   \
+                                method)) ||                                  \
+         ...));                                                              \
+    return key;                                                              \
+  }                                                                          \
+  }                                                                          \
+  ;
+
+#define COMOCK_METHOD(MethodName, ReturnType, ArgTypeSeq, SpecifierSeq) \
+  _COMOCK_METHOD(MethodName, ReturnType, ArgTypeSeq, SpecifierSeq,      \
+                 _COMOCK_SEQ_SIZE(ArgTypeSeq), __LINE__)
+
+// The argument type sequence is walked once to count its elements and once
+// per declarator to produce the parameter list. Everything else (argument
+// types, forwarded arguments) is generated from the arity alone. Parameters
+// are numbered in descending order, i.e. the first parameter of a method with
+// arity 2 is `arg2`.
+#define _COMOCK_METHOD(MethodName, ReturnType, ArgTypeSeq, SpecifierSeq, \
+                       Arity, Line)                                      \
+  _COMOCK_METHOD_SLOT(MethodName, ReturnType, ArgTypeSeq, SpecifierSeq,  \
+                      Arity, Line)                                       \
+                                                                         \
+  _COMOCK_PREFIX_SPECIFIERS(SpecifierSeq)                                \
+  ReturnType MethodName(_COMOCK_CAT(_COMOCK_PARAMS_, Arity) ArgTypeSeq)  \
+      _COMOCK_POSTFIX_SPECIFIERS(SpecifierSeq) {                         \
+    constexpr auto key = _COMOCK_KEY(                                    \
+        MethodName,                                                      \
+        static_cast<_COMOCK_METHOD_POINTER(ReturnType, ArgTypeSeq,       \
+                                           SpecifierSeq, Arity)>(        \
+            &MockedType::MethodName));                                   \
+    _COMOCK_METHOD_BODY(MethodName, ReturnType, Arity)                   \
+  }
+
+// Out-of-line mocks: COMOCK_DECLARE_METHOD goes between COMOCK_DEFINE_BEGIN
+// and COMOCK_DEFINE_END in a shared header, COMOCK_IMPLEMENT_METHOD with the
+// mock type and the same arguments goes into exactly one source file. Method
+// bodies are then compiled once instead of in every including TU.
+#define COMOCK_DECLARE_METHOD(MethodName, ReturnType, ArgTypeSeq,          \
+                              SpecifierSeq)                                \
+  _COMOCK_DECLARE_METHOD(MethodName, ReturnType, ArgTypeSeq, SpecifierSeq, \
+                         _COMOCK_SEQ_SIZE(ArgTypeSeq), __LINE__)
+
+#define _COMOCK_DECLARE_METHOD(MethodName, ReturnType, ArgTypeSeq,      \
+                               SpecifierSeq, Arity, Line)               \
+  _COMOCK_METHOD_SLOT(MethodName, ReturnType, ArgTypeSeq, SpecifierSeq, \
+                      Arity, Line)                                      \
+                                                                        \
+  _COMOCK_PREFIX_SPECIFIERS(SpecifierSeq)                               \
+  ReturnType MethodName(_COMOCK_CAT(_COMOCK_PARAMS_, Arity) ArgTypeSeq) \
+      _COMOCK_POSTFIX_SPECIFIERS(SpecifierSeq);
+
+#define COMOCK_IMPLEMENT_METHOD(MockType, MethodName, ReturnType, ArgTypeSeq, \
+                                SpecifierSeq)                                 \
+  _COMOCK_IMPLEMENT_METHOD(MockType, MethodName, ReturnType, ArgTypeSeq,      \
+                           SpecifierSeq, _COMOCK_SEQ_SIZE(ArgTypeSeq))
+
+#define _COMOCK_IMPLEMENT_METHOD(MockType, MethodName, ReturnType, ArgTypeSeq, \
+                                 SpecifierSeq, Arity)                          \
+  ReturnType MockType::MethodName(                                             \
+      _COMOCK_CAT(_COMOCK_PARAMS_, Arity) ArgTypeSeq)                          \
+      _COMOCK_DEFINITION_SPECIFIERS(SpecifierSeq) {                            \
+    using Method = ComockMethodPointer<                                        \
+        decltype(this), ReturnType,                                            \
+        MockedType _COMOCK_COMMA_IF(Arity) _COMOCK_ENUM(Arity, _COMOCK_TYPE)>; \
+    constexpr auto key =                                                       \
+        _COMOCK_KEY(MethodName, static_cast<Method>(&MockedType::MethodName)); \
+    _COMOCK_METHOD_BODY(MethodName, ReturnType, Arity)                         \
+  }
+
+#define _COMOCK_KEY(MethodName, Method) \
+  ComockMethodKey{&comock_type_info, &ComockMethodId<Method>::id, #MethodName}
+
+#define _COMOCK_METHOD_POINTER(ReturnType, ArgTypeSeq, SpecifierSeq, Arity)  \
+  ReturnType (MockedType::*)(_COMOCK_CAT(_COMOCK_PARAMS_, Arity) ArgTypeSeq) \
+      _COMOCK_CONST_SPECIFIERS(SpecifierSeq)
+
+#define _COMOCK_METHOD_SLOT(MethodName, ReturnType, ArgTypeSeq, SpecifierSeq,  \
+                            Arity, Line)                                       \
+  static ComockMethodKey comockMethodKey(                                      \
+      ComockMethodSlot<Line - comock_first_line>,                              \
+      ReturnType (MockedType::*method)(                                        \
+          _COMOCK_CAT(_COMOCK_PARAMS_, Arity) ArgTypeSeq)                      \
+          _COMOCK_CONST_SPECIFIERS(SpecifierSeq)) {                            \
+    if (method == static_cast<decltype(method)>(&MockedType::MethodName)) {    \
+      return _COMOCK_KEY(                                                      \
+          MethodName, static_cast<decltype(method)>(&MockedType::MethodName)); \
+    }                                                                          \
+    return {};                                                                 \
+  }
+
+#define _COMOCK_METHOD_BODY(MethodName, ReturnType, Arity)         \
+  auto const default_callback =                                    \
+      [this](_COMOCK_ENUM(Arity, _COMOCK_DEFAULT_PARAM)) {         \
+        if constexpr (std::is_abstract_v<MockedType>) {            \
+          return ReturnType();                                     \
+        } else {                                                   \
+          return MockedType::MethodName(                           \
+              _COMOCK_ENUM(Arity, _COMOCK_DEFAULT_ARG));           \
+        }                                                          \
+      };                                                           \
+  return comock::internal::MockBase<MockedType>::call(             \
+      key, std::function{default_callback} _COMOCK_COMMA_IF(Arity) \
+               _COMOCK_ENUM(Arity, _COMOCK_ARG));
+
+#define _COMOCK_TYPE(Index) decltype(arg##Index)
+
+#define _COMOCK_ARG(Index) std::move(arg##Index)
+
+#define _COMOCK_DEFAULT_PARAM(Index) decltype(arg##Index) default_arg##Index
+
+#define _COMOCK_DEFAULT_ARG(Index) std::move(default_arg##Index)
+
+#if defined(_MSC_VER) && (!defined(_MSVC_TRADITIONAL) || _MSVC_TRADITIONAL)
+#define _COMOCK_CAT(A, B) _COMOCK_CAT_I(A, B)
+#define _COMOCK_CAT_I(A, B) _COMOCK_CAT_II(~, A##B)
+#define _COMOCK_CAT_II(Unused, Result) Result
+#else
+#define _COMOCK_CAT(A, B) _COMOCK_CAT_I(A, B)
+#define _COMOCK_CAT_I(A, B) A##B
+#endif
+
+#define _COMOCK_ENUM(Arity, Macro) _COMOCK_CAT(_COMOCK_ENUM_, Arity)(Macro)
+
+#define _COMOCK_COMMA_IF(Arity) _COMOCK_CAT(_COMOCK_COMMA_IF_, Arity)
+
+#define _COMOCK_SEQ_SIZE(Seq) \
+  _COMOCK_CAT(_COMOCK_SEQ_SIZE_, _COMOCK_SEQ_SIZE_0 Seq)
+
+#define _COMOCK_SEQ_SIZE_0(...) _COMOCK_SEQ_SIZE_1
+#define _COMOCK_SEQ_SIZE_1(...) _COMOCK_SEQ_SIZE_2
+#define _COMOCK_SEQ_SIZE_2(...) _COMOCK_SEQ_SIZE_3
+#define _COMOCK_SEQ_SIZE_3(...) _COMOCK_SEQ_SIZE_4
+#define _COMOCK_SEQ_SIZE_4(...) _COMOCK_SEQ_SIZE_5
+#define _COMOCK_SEQ_SIZE_5(...) _COMOCK_SEQ_SIZE_6
+#define _COMOCK_SEQ_SIZE_6(...) _COMOCK_SEQ_SIZE_7
+#define _COMOCK_SEQ_SIZE_7(...) _COMOCK_SEQ_SIZE_8
+#define _COMOCK_SEQ_SIZE_8(...) _COMOCK_SEQ_SIZE_9
+#define _COMOCK_SEQ_SIZE_9(...) _COMOCK_SEQ_SIZE_10
+#define _COMOCK_SEQ_SIZE_10(...) _COMOCK_SEQ_SIZE_11
+#define _COMOCK_SEQ_SIZE_11(...) _COMOCK_SEQ_SIZE_12
+#define _COMOCK_SEQ_SIZE_12(...) _COMOCK_SEQ_SIZE_13
+#define _COMOCK_SEQ_SIZE_13(...) _COMOCK_SEQ_SIZE_14
+#define _COMOCK_SEQ_SIZE_14(...) _COMOCK_SEQ_SIZE_15
+#define _COMOCK_SEQ_SIZE_15(...) _COMOCK_SEQ_SIZE_16
+
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_0 0
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_1 1
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_2 2
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_3 3
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_4 4
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_5 5
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_6 6
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_7 7
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_8 8
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_9 9
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_10 10
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_11 11
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_12 12
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_13 13
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_14 14
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_15 15
+#define _COMOCK_SEQ_SIZE__COMOCK_SEQ_SIZE_16 16
+
+#define _COMOCK_PARAMS_0
+#define _COMOCK_PARAMS_1(...) __VA_ARGS__ arg1
+#define _COMOCK_PARAMS_2(...) __VA_ARGS__ arg2, _COMOCK_PARAMS_1
+#define _COMOCK_PARAMS_3(...) __VA_ARGS__ arg3, _COMOCK_PARAMS_2
+#define _COMOCK_PARAMS_4(...) __VA_ARGS__ arg4, _COMOCK_PARAMS_3
+#define _COMOCK_PARAMS_5(...) __VA_ARGS__ arg5, _COMOCK_PARAMS_4
+#define _COMOCK_PARAMS_6(...) __VA_ARGS__ arg6, _COMOCK_PARAMS_5
+#define _COMOCK_PARAMS_7(...) __VA_ARGS__ arg7, _COMOCK_PARAMS_6
+#define _COMOCK_PARAMS_8(...) __VA_ARGS__ arg8, _COMOCK_PARAMS_7
+#define _COMOCK_PARAMS_9(...) __VA_ARGS__ arg9, _COMOCK_PARAMS_8
+#define _COMOCK_PARAMS_10(...) __VA_ARGS__ arg10, _COMOCK_PARAMS_9
+#define _COMOCK_PARAMS_11(...) __VA_ARGS__ arg11, _COMOCK_PARAMS_10
+#define _COMOCK_PARAMS_12(...) __VA_ARGS__ arg12, _COMOCK_PARAMS_11
+#define _COMOCK_PARAMS_13(...) __VA_ARGS__ arg13, _COMOCK_PARAMS_12
+#define _COMOCK_PARAMS_14(...) __VA_ARGS__ arg14, _COMOCK_PARAMS_13
+#define _COMOCK_PARAMS_15(...) __VA_ARGS__ arg15, _COMOCK_PARAMS_14
+#define _COMOCK_PARAMS_16(...) __VA_ARGS__ arg16, _COMOCK_PARAMS_15
+
+#define _COMOCK_ENUM_0(Macro)
+#define _COMOCK_ENUM_1(Macro) Macro(1)
+#define _COMOCK_ENUM_2(Macro) Macro(2), _COMOCK_ENUM_1(Macro)
+#define _COMOCK_ENUM_3(Macro) Macro(3), _COMOCK_ENUM_2(Macro)
+#define _COMOCK_ENUM_4(Macro) Macro(4), _COMOCK_ENUM_3(Macro)
+#define _COMOCK_ENUM_5(Macro) Macro(5), _COMOCK_ENUM_4(Macro)
+#define _COMOCK_ENUM_6(Macro) Macro(6), _COMOCK_ENUM_5(Macro)
+#define _COMOCK_ENUM_7(Macro) Macro(7), _COMOCK_ENUM_6(Macro)
+#define _COMOCK_ENUM_8(Macro) Macro(8), _COMOCK_ENUM_7(Macro)
+#define _COMOCK_ENUM_9(Macro) Macro(9), _COMOCK_ENUM_8(Macro)
+#define _COMOCK_ENUM_10(Macro) Macro(10), _COMOCK_ENUM_9(Macro)
+#define _COMOCK_ENUM_11(Macro) Macro(11), _COMOCK_ENUM_10(Macro)
+#define _COMOCK_ENUM_12(Macro) Macro(12), _COMOCK_ENUM_11(Macro)
+#define _COMOCK_ENUM_13(Macro) Macro(13), _COMOCK_ENUM_12(Macro)
+#define _COMOCK_ENUM_14(Macro) Macro(14), _COMOCK_ENUM_13(Macro)
+#define _COMOCK_ENUM_15(Macro) Macro(15), _COMOCK_ENUM_14(Macro)
+#define _COMOCK_ENUM_16(Macro) Macro(16), _COMOCK_ENUM_15(Macro)
+
+#define _COMOCK_COMMA_IF_0
+#define _COMOCK_COMMA_IF_1 ,
+#define _COMOCK_COMMA_IF_2 ,
+#define _COMOCK_COMMA_IF_3 ,
+#define _COMOCK_COMMA_IF_4 ,
+#define _COMOCK_COMMA_IF_5 ,
+#define _COMOCK_COMMA_IF_6 ,
+#define _COMOCK_COMMA_IF_7 ,
+#define _COMOCK_COMMA_IF_8 ,
+#define _COMOCK_COMMA_IF_9 ,
+#define _COMOCK_COMMA_IF_10 ,
+#define _COMOCK_COMMA_IF_11 ,
+#define _COMOCK_COMMA_IF_12 ,
+#define _COMOCK_COMMA_IF_13 ,
+#define _COMOCK_COMMA_IF_14 ,
+#define _COMOCK_COMMA_IF_15 ,
+#define _COMOCK_COMMA_IF_16 ,
+
+#define _COMOCK_POSTFIX_SPECIFIERS(SpecifierSeq) \
+  _COMOCK_CAT(_COMOCK_POSTFIX_A SpecifierSeq, _END)
+
+#define _COMOCK_POSTFIX_A(Specifier) \
+  _COMOCK_CAT(_COMOCK_POSTFIX_SPECIFIER_, Specifier) _COMOCK_POSTFIX_B
+#define _COMOCK_POSTFIX_B(Specifier) \
+  _COMOCK_CAT(_COMOCK_POSTFIX_SPECIFIER_, Specifier) _COMOCK_POSTFIX_A
+#define _COMOCK_POSTFIX_A_END
+#define _COMOCK_POSTFIX_B_END
+
+#define _COMOCK_POSTFIX_SPECIFIER_const const
+#define _COMOCK_POSTFIX_SPECIFIER_volatile volatile
+#define _COMOCK_POSTFIX_SPECIFIER_noexcept noexcept
+#define _COMOCK_POSTFIX_SPECIFIER_override override
+#define _COMOCK_POSTFIX_SPECIFIER_final final
+#define _COMOCK_POSTFIX_SPECIFIER_inline
+#define _COMOCK_POSTFIX_SPECIFIER_constexpr
+#define _COMOCK_POSTFIX_SPECIFIER_consteval
+#define _COMOCK_POSTFIX_SPECIFIER_virtual
+#define _COMOCK_POSTFIX_SPECIFIER_friend
+#define _COMOCK_POSTFIX_SPECIFIER_static
+
+#define _COMOCK_CONST_SPECIFIERS(SpecifierSeq) \
+  _COMOCK_CAT(_COMOCK_CONST_A SpecifierSeq, _END)
+
+#define _COMOCK_CONST_A(Specifier) \
+  _COMOCK_CAT(_COMOCK_CONST_SPECIFIER_, Specifier) _COMOCK_CONST_B
+#define _COMOCK_CONST_B(Specifier) \
+  _COMOCK_CAT(_COMOCK_CONST_SPECIFIER_, Specifier) _COMOCK_CONST_A
+#define _COMOCK_CONST_A_END
+#define _COMOCK_CONST_B_END
+
+#define _COMOCK_CONST_SPECIFIER_const const
+#define _COMOCK_CONST_SPECIFIER_volatile
+#define _COMOCK_CONST_SPECIFIER_noexcept
+#define _COMOCK_CONST_SPECIFIER_override
+#define _COMOCK_CONST_SPECIFIER_final
+#define _COMOCK_CONST_SPECIFIER_inline
+#define _COMOCK_CONST_SPECIFIER_constexpr
+#define _COMOCK_CONST_SPECIFIER_consteval
+#define _COMOCK_CONST_SPECIFIER_virtual
+#define _COMOCK_CONST_SPECIFIER_friend
+#define _COMOCK_CONST_SPECIFIER_static
+
+#define _COMOCK_DEFINITION_SPECIFIERS(SpecifierSeq) \
+  _COMOCK_CAT(_COMOCK_DEFINITION_A SpecifierSeq, _END)
+
+#define _COMOCK_DEFINITION_A(Specifier) \
+  _COMOCK_CAT(_COMOCK_DEFINITION_SPECIFIER_, Specifier) _COMOCK_DEFINITION_B
+#define _COMOCK_DEFINITION_B(Specifier) \
+  _COMOCK_CAT(_COMOCK_DEFINITION_SPECIFIER_, Specifier) _COMOCK_DEFINITION_A
+#define _COMOCK_DEFINITION_A_END
+#define _COMOCK_DEFINITION_B_END
+
+#define _COMOCK_DEFINITION_SPECIFIER_const const
+#define _COMOCK_DEFINITION_SPECIFIER_volatile volatile
+#define _COMOCK_DEFINITION_SPECIFIER_noexcept noexcept
+#define _COMOCK_DEFINITION_SPECIFIER_override
+#define _COMOCK_DEFINITION_SPECIFIER_final
+#define _COMOCK_DEFINITION_SPECIFIER_inline
+#define _COMOCK_DEFINITION_SPECIFIER_constexpr
+#define _COMOCK_DEFINITION_SPECIFIER_consteval
+#define _COMOCK_DEFINITION_SPECIFIER_virtual
+#define _COMOCK_DEFINITION_SPECIFIER_friend
+#define _COMOCK_DEFINITION_SPECIFIER_static
+
+#define _COMOCK_PREFIX_SPECIFIERS(SpecifierSeq) \
+  _COMOCK_CAT(_COMOCK_PREFIX_A SpecifierSeq, _END)
+
+#define _COMOCK_PREFIX_A(Specifier) \
+  _COMOCK_CAT(_COMOCK_PREFIX_SPECIFIER_, Specifier) _COMOCK_PREFIX_B
+#define _COMOCK_PREFIX_B(Specifier) \
+  _COMOCK_CAT(_COMOCK_PREFIX_SPECIFIER_, Specifier) _COMOCK_PREFIX_A
+#define _COMOCK_PREFIX_A_END
+#define _COMOCK_PREFIX_B_END
+
+#define _COMOCK_PREFIX_SPECIFIER_inline inline
+#define _COMOCK_PREFIX_SPECIFIER_constexpr constexpr
+#define _COMOCK_PREFIX_SPECIFIER_consteval consteval
+#define _COMOCK_PREFIX_SPECIFIER_virtual virtual
+#define _COMOCK_PREFIX_SPECIFIER_friend friend
+#define _COMOCK_PREFIX_SPECIFIER_static static
+#define _COMOCK_PREFIX_SPECIFIER_const
+#define _COMOCK_PREFIX_SPECIFIER_volatile
+#define _COMOCK_PREFIX_SPECIFIER_noexcept
+#define _COMOCK_PREFIX_SPECIFIER_override
+#define _COMOCK_PREFIX_SPECIFIER_final
@@ -0,0 +1,252 @@
+// MIT License
+//
+// Copyright (c) 2025 Siarhei Homan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <comock/comock.h>
+
+#if !defined(__cpp_impl_coroutine)
+#error "comock_script.h requires C++20 coroutines."
+#endif
+
+#include <coroutine>
+#include <exception>
+#include <tuple>
+
+// Expectations scripted as a C++20 coroutine. The script co_awaits the next
+// call of a mocked method, inspects its arguments and replies with the result:
+//
+//   comock::Script protocol(StoreMock const& mock) {
+//     auto& get = co_await comock::nextCall(mock, &Store::get);
+//     get.reply(std::get<0>(get.args()) * 2);
+//     co_await comock::nextCall(mock, &Store::flush);
+//   }
+//
+//   auto script = protocol(*mock);
+//   script.start(repo);
+//
+// Every co_await queues one expectation, so scripts interleave with
+// expectations set with Repo::expectCall. The state of the protocol lives in
+// the coroutine frame, and the callbacks are shared by all steps with the
+// same signature.
+
+namespace comock {
+
+class Script;
+
+namespace internal {
+
+template <typename ReturnType, typename... Args>
+inline constexpr char signature_tag = 0;
+
+struct ScriptPromise {
+  Repo* repo = nullptr;
+  // ScriptedCall of the call that resumed the script.
+  void* call = nullptr;
+  std::exception_ptr exception = {};
+  std::vector<std::pair<void const*, ErasedCallback>> callbacks = {};
+
+  Script get_return_object();
+
+  std::suspend_always initial_suspend() noexcept { return {}; }
+
+  std::suspend_always final_suspend() noexcept { return {}; }
+
+  void return_void() {}
+
+  void unhandled_exception() { exception = std::current_exception(); }
+};
+
+struct ScriptAccess {
+  template <typename Mock>
+  static uintptr_t mockId(Mock const& mock) {
+    return Repo::mockId(mock);
+  }
+
+  template <typename Mock, typename Method>
+  static MethodKey methodKey(Method const method) {
+    return Repo::methodKey<Mock>(method);
+  }
+
+  static void expectCall(Repo& repo,
+                         uintptr_t const mock,
+                         MethodKey const method,
+                         ErasedCallback callback) {
+    repo.expectedCallInternal(
+        std::string{method.type->name} + "::" + method.name, mock, method,
+        std::move(callback));
+  }
+};
+
+inline void rethrowScriptException(ScriptPromise& promise) {
+  if (promise.exception) {
+    std::rethrow_exception(std::exchange(promise.exception, nullptr));
+  }
+}
+
+}  // namespace internal
+
+// Call received by a script. It refers to the arguments of the mocked call
+// and is valid until the script awaits the next call.
+template <typename ReturnType, typename... Args>
+class ScriptedCall {
+ public:
+  explicit ScriptedCall(Args... args) : args_{std::move(args)...} {}
+
+  ScriptedCall(ScriptedCall const&) = delete;
+  ScriptedCall& operator=(ScriptedCall const&) = delete;
+
+  std::tuple<Args...> const& args() const { return args_; }
+
+  template <typename Result>
+    requires(!std::is_void_v<ReturnType>)
+  void reply(Result&& result) {
+    result_.emplace(std::forward<Result>(result));
+  }
+
+ private:
+  template <typename, typename...>
+  friend class NextCall;
+
+  using Result =
+      std::conditional_t<std::is_void_v<ReturnType>, char, ReturnType>;
+
+  std::tuple<Args...> args_;
+  std::optional<Result> result_ = {};
+};
+
+// Awaitable returned by nextCall.
+template <typename ReturnType, typename... Args>
+class NextCall {
+ public:
+  NextCall(uintptr_t const mock, internal::MethodKey const method)
+      : mock_{mock}, method_{method} {}
+
+  bool await_ready() const noexcept { return false; }
+
+  void await_suspend(std::coroutine_handle<internal::ScriptPromise> handle) {
+    handle_ = handle;
+    auto& promise = handle.promise();
+    internal::ScriptAccess::expectCall(*promise.repo, mock_, method_,
+                                       callback(promise));
+  }
+
+  ScriptedCall<ReturnType, Args...>& await_resume() const {
+    return *static_cast<ScriptedCall<ReturnType, Args...>*>(
+        handle_.promise().call);
+  }
+
+ private:
+  static internal::ErasedCallback callback(internal::ScriptPromise& promise) {
+    auto const tag = &internal::signature_tag<ReturnType, Args...>;
+
+    for (auto const& [callback_tag, callback] : promise.callbacks) {
+      if (callback_tag == tag) {
+        return callback;
+      }
+    }
+
+    auto callback = internal::eraseCallback(
+        std::function<ReturnType(Args...)>{[&promise](Args... args) {
+          auto call = ScriptedCall<ReturnType, Args...>{std::move(args)...};
+          promise.call = &call;
+          std::coroutine_handle<internal::ScriptPromise>::from_promise(promise)
+              .resume();
+          promise.call = nullptr;
+          internal::rethrowScriptException(promise);
+
+          if constexpr (!std::is_void_v<ReturnType>) {
+            if (!call.result_) {
+              throw std::invalid_argument{
+                  "[comock] Script did not reply to a call."};
+            }
+            return ReturnType(std::move(*call.result_));
+          }
+        }});
+    promise.callbacks.emplace_back(tag, callback);
+    return callback;
+  }
+
+  uintptr_t mock_;
+  internal::MethodKey method_;
+  std::coroutine_handle<internal::ScriptPromise> handle_ = {};
+};
+
+template <typename Mock, typename ReturnType, typename... Args>
+NextCall<ReturnType, Args...> nextCall(
+    Mock const& mock,
+    ReturnType (Mock::MockedType::*method)(Args...)) {
+  return {internal::ScriptAccess::mockId(mock),
+          internal::ScriptAccess::methodKey<Mock>(method)};
+}
+
+template <typename Mock, typename ReturnType, typename... Args>
+NextCall<ReturnType, Args...> nextCall(
+    Mock const& mock,
+    ReturnType (Mock::MockedType::*method)(Args...) const) {
+  return {internal::ScriptAccess::mockId(mock),
+          internal::ScriptAccess::methodKey<Mock>(method)};
+}
+
+// Coroutine that scripts expectations. It has to outlive the calls it
+// expects.
+class Script {
+ public:
+  using promise_type = internal::ScriptPromise;
+
+  Script(Script&& other) noexcept
+      : handle_{std::exchange(other.handle_, nullptr)} {}
+
+  Script(Script const&) = delete;
+  Script& operator=(Script const&) = delete;
+  Script& operator=(Script&&) = delete;
+
+  ~Script() {
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+  // Runs the script up to the first expected call.
+  void start(Repo& repo) {
+    handle_.promise().repo = &repo;
+    handle_.resume();
+    internal::rethrowScriptException(handle_.promise());
+  }
+
+  bool done() const { return handle_.done(); }
+
+ private:
+  friend struct internal::ScriptPromise;
+
+  explicit Script(std::coroutine_handle<promise_type> handle)
+      : handle_{handle} {}
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+inline Script internal::ScriptPromise::get_return_object() {
+  return Script{std::coroutine_handle<ScriptPromise>::from_promise(*this)};
+}
+
+}  // namespace comock
@@ -0,0 +1,6 @@
+#include "out_of_line_mock.h"
+
+// clang-format off
+COMOCK_IMPLEMENT_METHOD( OutOfLineMock , foo , int , (int)(std::string) ,                   (override) )
+COMOCK_IMPLEMENT_METHOD( OutOfLineMock , bar , int ,                    , (const)(noexcept)(override) )
+// clang-format on
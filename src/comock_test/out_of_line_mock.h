@@ -0,0 +1,18 @@
+#pragma once
+
+#include <comock/comock.h>
+
+class OutOfLineInterface {
+ public:
+  virtual ~OutOfLineInterface() = default;
+
+  virtual int foo(int a, std::string b) = 0;
+  virtual int bar() const noexcept = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(OutOfLineMock, OutOfLineInterface)
+  COMOCK_DECLARE_METHOD( foo , int , (int)(std::string) ,                   (override) )
+  COMOCK_DECLARE_METHOD( bar , int ,                    , (const)(noexcept)(override) )
+COMOCK_DEFINE_END
+// clang-format on
@@ -0,0 +1,75 @@
+#include <comock/comock_alloc.h>
+#include <doctest/doctest.h>
+
+namespace {
+
+class Queue {
+ public:
+  virtual ~Queue() = default;
+
+  virtual std::string pop() = 0;
+  virtual void ack(std::size_t size) = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(QueueMock, Queue)
+  COMOCK_METHOD( pop , std::string ,               , (override) )
+  COMOCK_METHOD( ack , void        , (std::size_t) , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  comock::Repo repo = {};
+  std::unique_ptr<QueueMock> mock = repo.create<QueueMock>();
+
+  Fixture() {
+    repo.onCall(*mock, &Queue::pop, []() { return std::string(100, 'm'); });
+    repo.onCall(*mock, &Queue::ack, [](std::size_t) {});
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Allocation tracker") {
+  SUBCASE("Processing without allocations") {
+    auto const tracker = comock::AllocationTracker{repo};
+
+    auto const message = mock->pop();
+    mock->ack(message.size());
+
+    auto const report = tracker.report();
+    REQUIRE(report.scope("QueueMock::pop")->allocations == 1);
+    REQUIRE(report.scope("QueueMock::pop")->bytes > 100);
+    REQUIRE(report.scope("after QueueMock::pop")->allocations == 0);
+    REQUIRE(report.scope("QueueMock::ack")->allocations == 0);
+  }
+
+  SUBCASE("Concurrency limit without allocations") {
+    auto const limit = repo.limitConcurrency("One ack", 1, &Queue::ack, *mock);
+    auto const tracker = comock::AllocationTracker{repo};
+
+    mock->ack(1);
+
+    REQUIRE(tracker.report().scope("QueueMock::ack")->allocations == 0);
+  }
+
+  SUBCASE("Processing with allocations") {
+    auto tracker = comock::AllocationTracker{repo};
+
+    auto const message = mock->pop();
+    auto const copies = std::vector<std::string>{message, message};
+    mock->ack(copies.size());
+
+    auto const report = tracker.report();
+    REQUIRE(report.scope("after QueueMock::pop")->allocations > 0);
+
+    tracker.reset();
+    REQUIRE(tracker.report().scope("QueueMock::pop")->allocations == 0);
+  }
+
+  SUBCASE("One tracker per thread") {
+    auto const tracker = comock::AllocationTracker{repo};
+
+    REQUIRE_THROWS_AS(comock::AllocationTracker{repo}, std::invalid_argument);
+  }
+}
@@ -0,0 +1,93 @@
+#include <comock/comock_async.h>
+#include <doctest/doctest.h>
+
+#include <stdexcept>
+
+namespace {
+
+class Service {
+ public:
+  virtual ~Service() = default;
+
+  virtual std::future<int> fetch(int id) = 0;
+  virtual std::future<void> store(int value) = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(ServiceMock, Service)
+  COMOCK_METHOD( fetch , std::future<int>  , (int) , (override) )
+  COMOCK_METHOD( store , std::future<void> , (int) , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+bool isReady(std::future<int> const& future) {
+  return future.wait_for(std::chrono::seconds{0}) ==
+         std::future_status::ready;
+}
+
+struct Fixture {
+  comock::Repo repo = {};
+  std::unique_ptr<ServiceMock> mock = repo.create<ServiceMock>();
+  comock::ManualExecutor executor = {};
+
+  Fixture() {
+    repo.setUnexpectedCallHandler([](std::optional<std::string> const&) {
+      REQUIRE_MESSAGE(false, "Unexpected call");
+    });
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Async calls") {
+  SUBCASE("Executor") {
+    auto order = std::vector<int>{};
+    repo.onCall(*mock, &Service::fetch,
+                comock::completeOn(executor, [&order](int id) {
+                  order.push_back(id);
+                  return id * 2;
+                }));
+
+    auto first = mock->fetch(1);
+    auto second = mock->fetch(2);
+    REQUIRE_FALSE(isReady(first));
+    REQUIRE(executor.pending() == 2);
+
+    REQUIRE(executor.runOne());
+    REQUIRE(isReady(first));
+    REQUIRE_FALSE(isReady(second));
+
+    REQUIRE(executor.runAll() == 1);
+    REQUIRE(first.get() == 2);
+    REQUIRE(second.get() == 4);
+    REQUIRE(order == std::vector<int>{1, 2});
+  }
+
+  SUBCASE("Failure") {
+    repo.expectCall("fetch", *mock, &Service::fetch,
+                    comock::completeOn(executor, [](int) -> int {
+                      throw std::runtime_error{"Timeout"};
+                    }));
+    repo.expectCall("store", *mock, &Service::store,
+                    comock::completeOn(executor, [](int) {}));
+
+    auto fetched = mock->fetch(1);
+    auto stored = mock->store(2);
+    executor.runAll();
+
+    REQUIRE_THROWS_AS(fetched.get(), std::runtime_error);
+    REQUIRE_NOTHROW(stored.get());
+  }
+
+  SUBCASE("Completion") {
+    auto completion = comock::Completion<int>{};
+    repo.expectCall("fetch", *mock, &Service::fetch,
+                    [&completion](int) { return completion.future(); });
+
+    auto future = mock->fetch(1);
+    REQUIRE_FALSE(isReady(future));
+
+    completion.complete(7);
+    REQUIRE(future.get() == 7);
+  }
+}
@@ -0,0 +1,90 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+
+namespace {
+
+class Store {
+ public:
+  virtual ~Store() = default;
+
+  virtual int get(int key) = 0;
+  virtual void put(int key, int value) = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(StoreMock, Store)
+  COMOCK_METHOD( get , int  , (int)      , (override) )
+  COMOCK_METHOD( put , void , (int)(int) , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  comock::Repo repo = {};
+  std::unique_ptr<StoreMock> mock = repo.create<StoreMock>();
+  std::unique_ptr<StoreMock> other_mock = repo.create<StoreMock>();
+
+  Fixture() {
+    repo.setBatchingReportHandler([](comock::BatchingReport const&) {});
+    repo.onCall(*mock, &Store::get, [](int key) { return key; });
+    repo.onCall(*mock, &Store::put, [](int, int) {});
+    repo.onCall(*other_mock, &Store::get, [](int key) { return key; });
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Batching opportunities") {
+  SUBCASE("Runs") {
+    repo.detectBatchingOpportunities(*mock, &Store::get, "Store::multiGet");
+
+    mock->get(1);
+    mock->get(2);
+    mock->get(3);
+    mock->put(1, 1);
+    mock->get(4);
+    mock->put(2, 2);
+    mock->get(5);
+    mock->get(6);
+
+    auto const report = repo.batchingReport();
+    auto const* const get = report.method("StoreMock::get");
+    REQUIRE(get->batch_method == "Store::multiGet");
+    REQUIRE(get->calls == 6);
+    REQUIRE(get->runs == 3);
+    REQUIRE(get->longest_run == 3);
+    REQUIRE(get->batchable_calls == 5);
+  }
+
+  SUBCASE("Other mock ends a run") {
+    repo.detectBatchingOpportunities(*mock, &Store::get);
+    repo.detectBatchingOpportunities(*other_mock, &Store::get);
+
+    mock->get(1);
+    other_mock->get(2);
+    mock->get(3);
+
+    auto const report = repo.batchingReport();
+    REQUIRE(report.methods.size() == 1);
+    REQUIRE(report.method("StoreMock::get")->runs == 3);
+    REQUIRE(report.method("StoreMock::get")->batchable_calls == 0);
+  }
+
+  SUBCASE("Report handler") {
+    auto reported_calls = std::size_t{0};
+    {
+      auto repo2 = comock::Repo{};
+      auto const mock2 = repo2.create<StoreMock>();
+      repo2.setBatchingReportHandler(
+          [&reported_calls](comock::BatchingReport const& report) {
+            reported_calls = report.methods.front().calls;
+          });
+      repo2.onCall(*mock2, &Store::get, [](int key) { return key; });
+      repo2.detectBatchingOpportunities(*mock2, &Store::get);
+
+      mock2->get(1);
+      mock2->get(2);
+    }
+
+    REQUIRE(reported_calls == 2);
+  }
+}
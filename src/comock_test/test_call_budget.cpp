@@ -0,0 +1,76 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+
+namespace {
+
+class Storage {
+ public:
+  virtual ~Storage() = default;
+
+  virtual std::string read(int key) = 0;
+  virtual void write(int key, std::string value) = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(StorageMock, Storage)
+  COMOCK_METHOD( read  , std::string , (int)              , (override) )
+  COMOCK_METHOD( write , void        , (int)(std::string) , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  comock::Repo repo = {};
+  std::unique_ptr<StorageMock> primary = repo.create<StorageMock>();
+  std::unique_ptr<StorageMock> replica = repo.create<StorageMock>();
+  std::vector<std::string> exceeded_budgets = {};
+
+  Fixture() {
+    repo.setUnexpectedCallHandler([](std::optional<std::string> const&) {});
+    repo.setCallBudgetHandler([this](std::string const& description) {
+      exceeded_budgets.push_back(description);
+    });
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Call budget") {
+  SUBCASE("Within budget") {
+    auto const budget =
+        repo.limitCalls("reads", 2, &Storage::read, *primary, *replica);
+    primary->read(1);
+    replica->read(1);
+    primary->write(1, "value");
+
+    REQUIRE(budget.calls() == 2);
+    REQUIRE(exceeded_budgets.empty());
+  }
+
+  SUBCASE("Exceeded across mocks") {
+    auto const budget =
+        repo.limitCalls("reads", 2, &Storage::read, *primary, *replica);
+    primary->read(1);
+    replica->read(2);
+    primary->read(3);
+
+    REQUIRE(budget.calls() == 3);
+    REQUIRE(exceeded_budgets == std::vector<std::string>{"reads"});
+  }
+
+  SUBCASE("Other mocks are not counted") {
+    auto const budget = repo.limitCalls("reads", 1, &Storage::read, *primary);
+    replica->read(1);
+    replica->read(2);
+
+    REQUIRE(budget.calls() == 0);
+  }
+
+  SUBCASE("Scope") {
+    {
+      auto const budget = repo.limitCalls("reads", 0, &Storage::read, *primary);
+    }
+    primary->read(1);
+
+    REQUIRE(exceeded_budgets.empty());
+  }
+}
@@ -0,0 +1,81 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+#include <sstream>
+
+namespace {
+
+class Storage {
+ public:
+  virtual ~Storage() = default;
+
+  virtual std::string read(int key) = 0;
+  virtual void write(int key, std::string value) = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(StorageMock, Storage)
+  COMOCK_METHOD( read  , std::string , (int)              , (override) )
+  COMOCK_METHOD( write , void        , (int)(std::string) , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  comock::Repo repo = {};
+  std::unique_ptr<StorageMock> mock = repo.create<StorageMock>();
+
+  Fixture() {
+    repo.setUnexpectedCallHandler([](std::optional<std::string> const&) {});
+    repo.setCallCost(*mock, &Storage::read, 10);
+    repo.setCallCost(*mock, &Storage::write,
+                     [](int, std::string const& value) {
+                       return static_cast<double>(value.size());
+                     });
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Call cost") {
+  SUBCASE("Default scenario") {
+    mock->read(1);
+    mock->read(2);
+    mock->write(1, "abc");
+
+    auto const report = repo.costReport();
+    REQUIRE(report.total() == 23.0);
+
+    auto const* const scenario = report.scenario("default");
+    REQUIRE(scenario);
+    REQUIRE(scenario->methods.size() == 2);
+    REQUIRE(scenario->methods[0].method == "StorageMock::read");
+    REQUIRE(scenario->methods[0].calls == 2);
+    REQUIRE(scenario->methods[0].cost == 20.0);
+    REQUIRE(scenario->methods[1].method == "StorageMock::write");
+    REQUIRE(scenario->methods[1].cost == 3.0);
+  }
+
+  SUBCASE("Scenarios") {
+    repo.beginCostScenario("cold");
+    mock->read(1);
+    mock->write(1, "abcd");
+    repo.beginCostScenario("warm");
+    mock->write(1, "ab");
+
+    auto const report = repo.costReport();
+    REQUIRE(report.scenario("cold")->total == 14.0);
+    REQUIRE(report.scenario("warm")->total == 2.0);
+    REQUIRE(report.total() == 16.0);
+
+    auto stream = std::ostringstream{};
+    stream << report;
+    REQUIRE(stream.str().find("StorageMock::write: 2 (1 calls)") !=
+            std::string::npos);
+  }
+
+  SUBCASE("Mocks without cost") {
+    auto const other = repo.create<StorageMock>();
+    other->read(1);
+
+    REQUIRE(repo.costReport().scenarios.empty());
+  }
+}
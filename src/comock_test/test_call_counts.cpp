@@ -0,0 +1,123 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+
+#include <thread>
+
+namespace {
+
+class Sink {
+ public:
+  virtual ~Sink() = default;
+
+  virtual void write(int value) = 0;
+  virtual void flush() = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(SinkMock, Sink)
+  COMOCK_METHOD( write , void , (int) , (override) )
+  COMOCK_METHOD( flush , void ,       , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  comock::Repo repo = {};
+  std::unique_ptr<SinkMock> mock = repo.create<SinkMock>();
+  std::unique_ptr<SinkMock> other_mock = repo.create<SinkMock>();
+
+  Fixture() {
+    repo.onCall(*mock, &Sink::write, [](int) {});
+    repo.onCall(*mock, &Sink::flush, []() {});
+    repo.onCall(*other_mock, &Sink::write, [](int) {});
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Call counts") {
+  SUBCASE("Disabled") {
+    mock->write(1);
+
+    REQUIRE(repo.callCount(*mock, &Sink::write) == 0);
+  }
+
+  SUBCASE("Single thread") {
+    repo.enableCallCounts();
+
+    mock->write(1);
+    mock->write(2);
+    mock->flush();
+    other_mock->write(3);
+
+    REQUIRE(repo.callCount(*mock, &Sink::write) == 2);
+    REQUIRE(repo.callCount(*mock, &Sink::flush) == 1);
+    REQUIRE(repo.callCount(*other_mock, &Sink::write) == 1);
+    REQUIRE(repo.callCount(*other_mock, &Sink::flush) == 0);
+  }
+
+  SUBCASE("Threads") {
+    repo.enableCallCounts();
+
+    auto threads = std::vector<std::thread>{};
+    for (auto thread = 0; thread < 8; ++thread) {
+      threads.emplace_back([this]() {
+        for (auto i = 0; i < 10000; ++i) {
+          mock->write(i);
+        }
+        mock->flush();
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    REQUIRE(repo.callCount(*mock, &Sink::write) == 80000);
+    REQUIRE(repo.callCount(*mock, &Sink::flush) == 8);
+  }
+
+  SUBCASE("Threads after expectations") {
+    repo.enableCallCounts();
+    repo.expectCall("first", *mock, &Sink::write, [](int) {});
+    repo.expectCall("second", *mock, &Sink::flush, []() {});
+
+    mock->write(0);
+    mock->flush();
+
+    auto threads = std::vector<std::thread>{};
+    for (auto thread = 0; thread < 8; ++thread) {
+      threads.emplace_back([this]() {
+        for (auto i = 0; i < 10000; ++i) {
+          mock->write(i);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    REQUIRE(repo.callCount(*mock, &Sink::write) == 80001);
+    REQUIRE(repo.callCount(*mock, &Sink::flush) == 1);
+  }
+
+  SUBCASE("Many mocks") {
+    repo.enableCallCounts();
+    auto const mocks = repo.createMany<SinkMock>(200);
+    repo.onCall<SinkMock>(&Sink::write, [](int) {});
+
+    auto threads = std::vector<std::thread>{};
+    for (auto thread = 0; thread < 4; ++thread) {
+      threads.emplace_back([&mocks]() {
+        for (auto& sink : mocks) {
+          sink.write(0);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    for (auto const& sink : mocks) {
+      REQUIRE(repo.callCount(sink, &Sink::write) == 4);
+    }
+  }
+}
@@ -0,0 +1,90 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+
+#include <sstream>
+
+namespace {
+
+class Logger {
+ public:
+  virtual ~Logger() = default;
+
+  virtual void log(int level) = 0;
+  virtual void flush() = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(LoggerMock, Logger)
+  COMOCK_METHOD( log   , void , (int) , (override) )
+  COMOCK_METHOD( flush , void ,       , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  comock::Repo repo = {};
+  int unexpected_calls = 0;
+
+  Fixture() {
+    repo.setUnexpectedCallHandler(
+        [this](std::optional<std::string> const&) { ++unexpected_calls; });
+  }
+};
+
+// Captures what is written to std::cerr while it is alive.
+class CerrCapture {
+ public:
+  CerrCapture() : previous_{std::cerr.rdbuf(stream_.rdbuf())} {}
+  ~CerrCapture() { std::cerr.rdbuf(previous_); }
+
+  std::string str() const { return stream_.str(); }
+
+ private:
+  std::ostringstream stream_;
+  std::streambuf* previous_;
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Call policy") {
+  SUBCASE("Default") {
+    auto const mock = repo.create<LoggerMock>();
+
+    mock->log(1);
+    REQUIRE(unexpected_calls == 1);
+  }
+
+  SUBCASE("Nice") {
+    auto const mock = repo.create<comock::Nice<LoggerMock>>();
+
+    mock->log(1);
+    REQUIRE(unexpected_calls == 0);
+
+    repo.expectCall("flush", *mock, &Logger::flush, []() {});
+    mock->log(2);
+    REQUIRE(unexpected_calls == 1);
+  }
+
+  SUBCASE("Naggy") {
+    auto const mock = repo.create<comock::Naggy<LoggerMock>>();
+    repo.onCall(*mock, &Logger::flush, []() {});
+    auto const cerr = CerrCapture{};
+
+    mock->log(1);
+    mock->flush();
+    REQUIRE(unexpected_calls == 0);
+    REQUIRE(cerr.str() ==
+            "[comock] Uninteresting method call: LoggerMock::log\n");
+  }
+
+  SUBCASE("Strict") {
+    auto const mock = repo.create<comock::Strict<LoggerMock>>();
+    repo.onCall(*mock, &Logger::log, [](int) {});
+    repo.expectCall("flush", *mock, &Logger::flush, []() {});
+
+    mock->log(1);
+    REQUIRE(unexpected_calls == 1);
+
+    mock->log(2);
+    REQUIRE(unexpected_calls == 1);
+  }
+}
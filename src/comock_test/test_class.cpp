@@ -79,3 +79,12 @@ TEST_CASE_FIXTURE(Fixture, "Pause expectations") {
 
   mock->incrementBoth();
 }
+
+TEST_CASE_FIXTURE(Fixture, "Not mocked method") {
+  REQUIRE_THROWS_AS(
+      repo.onCall(*mock, &Class::getA, []() { return 0; }),
+      std::invalid_argument);
+  REQUIRE_THROWS_AS(
+      repo.expectCall("getA", *mock, &Class::getA, []() { return 0; }),
+      std::invalid_argument);
+}
@@ -0,0 +1,125 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+
+#include <thread>
+
+namespace {
+
+class Database {
+ public:
+  virtual ~Database() = default;
+
+  virtual int query(int id) = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(DatabaseMock, Database)
+  COMOCK_METHOD( query , int , (int) , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  comock::Repo repo = {};
+  std::unique_ptr<DatabaseMock> mock = repo.create<DatabaseMock>();
+  std::atomic<int> violations = 0;
+
+  Fixture() {
+    repo.setConcurrencyLimitHandler(
+        [this](std::string const&) { ++violations; });
+  }
+
+  // Runs the query from the given number of threads, so that all of them are
+  // in flight at the same time.
+  void queryConcurrently(int const threads) {
+    auto entered = std::atomic<int>{0};
+    repo.onCall(*mock, &Database::query, [&entered, threads](int id) {
+      ++entered;
+      while (entered.load() < threads) {
+        std::this_thread::yield();
+      }
+      return id;
+    });
+
+    auto workers = std::vector<std::thread>{};
+    for (auto i = 0; i < threads; ++i) {
+      workers.emplace_back([this, i]() { mock->query(i); });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Concurrency limit") {
+  SUBCASE("Sequential calls") {
+    auto const limit =
+        repo.limitConcurrency("One query", 1, &Database::query, *mock);
+    repo.onCall(*mock, &Database::query, [](int id) { return id; });
+
+    mock->query(1);
+    mock->query(2);
+
+    REQUIRE(limit.peak() == 1);
+    REQUIRE(limit.inFlight() == 0);
+    REQUIRE(violations == 0);
+  }
+
+  SUBCASE("Peak") {
+    auto const limit =
+        repo.limitConcurrency("Pool size", 4, &Database::query, *mock);
+
+    queryConcurrently(4);
+
+    REQUIRE(limit.peak() == 4);
+    REQUIRE(limit.inFlight() == 0);
+    REQUIRE(violations == 0);
+  }
+
+  SUBCASE("Exceeded") {
+    auto const limit =
+        repo.limitConcurrency("Pool size", 2, &Database::query, *mock);
+
+    queryConcurrently(3);
+
+    REQUIRE(limit.peak() == 3);
+    REQUIRE(violations == 1);
+  }
+
+  SUBCASE("Limit removed") {
+    {
+      auto const limit =
+          repo.limitConcurrency("Pool size", 1, &Database::query, *mock);
+    }
+
+    queryConcurrently(2);
+
+    REQUIRE(violations == 0);
+  }
+
+  SUBCASE("Nested limits") {
+    auto const outer =
+        repo.limitConcurrency("Pool size", 3, &Database::query, *mock);
+    auto const inner =
+        repo.limitConcurrency("Hot path", 1, &Database::query, *mock, *mock);
+
+    queryConcurrently(2);
+
+    REQUIRE(outer.peak() == 2);
+    REQUIRE(inner.peak() == 2);
+    REQUIRE(violations == 1);
+  }
+
+  SUBCASE("Too many limits") {
+    auto limits = std::vector<comock::ConcurrencyLimit>{};
+    for (auto i = 0; i < 4; ++i) {
+      limits.push_back(
+          repo.limitConcurrency("Pool size", 1, &Database::query, *mock));
+    }
+
+    REQUIRE_THROWS_AS(static_cast<void>(repo.limitConcurrency(
+                          "Pool size", 1, &Database::query, *mock)),
+                      std::invalid_argument);
+  }
+}
@@ -0,0 +1,88 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+
+namespace {
+
+class Peer {
+ public:
+  explicit Peer(int const id) : id_{id} {}
+  virtual ~Peer() = default;
+
+  virtual int ping(int value) = 0;
+
+  int id() const { return id_; }
+
+ private:
+  int id_;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(PeerMock, Peer)
+  COMOCK_METHOD( ping , int , (int) , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  comock::Repo repo = {};
+
+  Fixture() {
+    repo.setUnexpectedCallHandler([](std::optional<std::string> const&) {
+      REQUIRE_MESSAGE(false, "Unexpected call");
+    });
+    repo.setMissingCallHandler(
+        [](std::string const&) { REQUIRE_MESSAGE(false, "Missing call"); });
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Create many") {
+  SUBCASE("Contiguous") {
+    auto const peers = repo.createMany<PeerMock>(1000, 7);
+
+    REQUIRE(peers.size() == 1000);
+    for (auto index = std::size_t{0}; index < peers.size(); ++index) {
+      REQUIRE(&peers[index] == peers.begin() + index);
+      REQUIRE(peers[index].id() == 7);
+    }
+  }
+
+  SUBCASE("Registered") {
+    auto const peers = repo.createMany<PeerMock>(3, 0);
+
+    repo.onCall(peers[0], &Peer::ping, [](int value) { return value; });
+    repo.expectCall("ping", peers[2], &Peer::ping,
+                    [](int value) { return -value; });
+
+    REQUIRE(peers[2].ping(5) == -5);
+    REQUIRE(peers[0].ping(5) == 5);
+  }
+
+  SUBCASE("Shared fallback") {
+    auto const peers = repo.createMany<PeerMock>(100, 0);
+
+    repo.onCall<PeerMock>(&Peer::ping, [](int value) { return value + 1; });
+
+    for (auto& peer : peers) {
+      REQUIRE(peer.ping(1) == 2);
+    }
+  }
+
+  SUBCASE("Moved") {
+    auto peers = repo.createMany<PeerMock>(2, 0);
+    auto* const first = &peers[0];
+
+    auto const moved_peers = std::move(peers);
+
+    REQUIRE(&moved_peers[0] == first);
+    REQUIRE(moved_peers.size() == 2);
+    REQUIRE(peers.size() == 0);
+  }
+
+  SUBCASE("Empty") {
+    auto const peers = repo.createMany<PeerMock>(0, 0);
+
+    REQUIRE(peers.size() == 0);
+    REQUIRE(peers.begin() == peers.end());
+  }
+}
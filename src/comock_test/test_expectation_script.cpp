@@ -0,0 +1,148 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+
+namespace {
+
+class Client {
+ public:
+  virtual ~Client() = default;
+
+  virtual bool connect() = 0;
+  virtual int send(int value) = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(ClientMock, Client)
+  COMOCK_METHOD( connect , bool ,       , (override) )
+  COMOCK_METHOD( send    , int  , (int) , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  std::vector<std::string> missing_calls = {};
+  std::vector<std::string> unexpected_calls = {};
+  comock::Repo repo = {};
+  std::unique_ptr<ClientMock> mock = repo.create<ClientMock>();
+  comock::ExpectationScript script = comock::ExpectationScript{repo};
+
+  Fixture() {
+    repo.setUnexpectedCallHandler(
+        [this](std::optional<std::string> const& description) {
+          unexpected_calls.push_back(description.value_or(""));
+        });
+    repo.setMissingCallHandler([this](std::string const& description) {
+      missing_calls.push_back(description);
+    });
+
+    script.expectCall("connect", *mock, &Client::connect, []() { return true; })
+        .expectCall("send", *mock, &Client::send,
+                    [](int value) { return value; }, 3);
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Expectation script") {
+  SUBCASE("Iterations") {
+    for (auto iteration = 0; iteration < 100; ++iteration) {
+      repo.bind(script);
+
+      REQUIRE(mock->connect());
+      for (auto value = 0; value < 3; ++value) {
+        REQUIRE(mock->send(value + iteration) == value + iteration);
+      }
+      repo.verifyAndReset();
+    }
+
+    REQUIRE(missing_calls.empty());
+    REQUIRE(unexpected_calls.empty());
+  }
+
+  SUBCASE("Missing calls") {
+    repo.bind(script);
+
+    mock->connect();
+    mock->send(0);
+    repo.verifyAndReset();
+
+    REQUIRE(missing_calls == std::vector<std::string>{"send", "send"});
+  }
+
+  SUBCASE("Followed by expectations") {
+    repo.bind(script);
+    repo.expectCall("connect again", *mock, &Client::connect,
+                    []() { return false; });
+
+    mock->connect();
+    mock->send(0);
+    mock->send(0);
+    mock->send(0);
+
+    REQUIRE(!mock->connect());
+    REQUIRE(unexpected_calls.empty());
+  }
+
+  SUBCASE("Out of order") {
+    repo.bind(script);
+
+    mock->send(0);
+    repo.reset();
+
+    REQUIRE(unexpected_calls == std::vector<std::string>{"connect"});
+  }
+
+  SUBCASE("Extended after binding") {
+    repo.bind(script);
+    script.expectCall<ClientMock>("any connect", &Client::connect,
+                                  []() { return false; });
+
+    mock->connect();
+    mock->send(0);
+    mock->send(0);
+    mock->send(0);
+    repo.verifyAndReset();
+    REQUIRE(unexpected_calls.empty());
+    REQUIRE(missing_calls.empty());
+
+    repo.bind(script);
+    mock->connect();
+    mock->send(0);
+    mock->send(0);
+    mock->send(0);
+
+    REQUIRE(!mock->connect());
+    REQUIRE(unexpected_calls.empty());
+  }
+
+  SUBCASE("Snapshot of a partially consumed script") {
+    repo.bind(script);
+    mock->connect();
+    mock->send(0);
+
+    auto const snapshot = repo.snapshot();
+
+    for (auto variant = 0; variant < 2; ++variant) {
+      repo.restore(snapshot);
+      mock->send(0);
+      mock->send(0);
+      repo.verifyAndReset();
+    }
+
+    REQUIRE(missing_calls.empty());
+    REQUIRE(unexpected_calls.empty());
+  }
+
+  SUBCASE("Invalid") {
+    auto other_repo = comock::Repo{};
+    auto const other_mock = other_repo.create<ClientMock>();
+
+    REQUIRE_THROWS_AS(other_repo.bind(script), std::invalid_argument);
+    REQUIRE_THROWS_AS(
+        script.expectCall("connect", *other_mock, &Client::connect,
+                          []() { return true; }),
+        std::invalid_argument);
+    REQUIRE_THROWS_AS(script.expectCall("connect", *mock, &Client::connect,
+                                        []() { return true; }, 0),
+                      std::invalid_argument);
+  }
+}
@@ -0,0 +1,94 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+
+#include <stdexcept>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+class Storage {
+ public:
+  virtual ~Storage() = default;
+
+  virtual int write(int value) = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(StorageMock, Storage)
+  COMOCK_METHOD( write , int , (int) , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  comock::Repo repo = {};
+  std::unique_ptr<StorageMock> mock = repo.create<StorageMock>();
+
+  Fixture() {
+    repo.onCall(*mock, &Storage::write, [](int value) { return value; });
+  }
+
+  std::vector<int> writeMany(int const count) {
+    auto results = std::vector<int>{};
+    for (auto i = 0; i < count; ++i) {
+      results.push_back(mock->write(i));
+    }
+    return results;
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Fault injection") {
+  SUBCASE("Always and never") {
+    repo.injectFault(*mock, &Storage::write, 0.0, [](int) { return -1; });
+    REQUIRE(mock->write(1) == 1);
+
+    repo.injectFault(*mock, &Storage::write, 1.0, [](int) -> int {
+      throw std::runtime_error{"Disk full"};
+    });
+    REQUIRE_THROWS_AS(mock->write(2), std::runtime_error);
+  }
+
+  SUBCASE("Rate") {
+    repo.setFaultSeed(7);
+    repo.injectFault(*mock, &Storage::write, 0.25, [](int) { return -1; });
+
+    auto const results = writeMany(10000);
+    auto const faults = std::count(results.begin(), results.end(), -1);
+
+    REQUIRE(faults > 2300);
+    REQUIRE(faults < 2700);
+  }
+
+  SUBCASE("Same seed, same faults") {
+    repo.setFaultSeed(42);
+    repo.injectFault(*mock, &Storage::write, 0.5, [](int) { return -1; });
+    auto const first = writeMany(100);
+
+    repo.setFaultSeed(42);
+    REQUIRE(writeMany(100) == first);
+    REQUIRE(repo.faultSeed() == 42);
+  }
+
+  SUBCASE("Latency") {
+    repo.injectLatency(*mock, &Storage::write, 1.0, 250ms);
+
+    REQUIRE(mock->write(3) == 3);
+    REQUIRE(repo.clock().now().time_since_epoch() == 250ms);
+  }
+
+  SUBCASE("Expected calls are not faulted") {
+    repo.injectFault(*mock, &Storage::write, 1.0, [](int) { return -1; });
+    repo.expectCall("write", *mock, &Storage::write,
+                    [](int value) { return value * 2; });
+
+    REQUIRE(mock->write(2) == 4);
+    REQUIRE(mock->write(2) == -1);
+  }
+
+  SUBCASE("Invalid rate") {
+    REQUIRE_THROWS_AS(repo.injectLatency(*mock, &Storage::write, 1.5, 1ms),
+                      std::invalid_argument);
+  }
+}
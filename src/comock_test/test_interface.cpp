@@ -10,6 +10,7 @@ class Interface {
   virtual void voidArgTest() = 0;
   virtual void oneArgTest(int a) = 0;
   virtual void twoArgTest(int a, std::string b) = 0;
+  virtual void commaArgTest(std::pair<int, int> a, int b) = 0;
 
   virtual int returnTest() = 0;
 
@@ -25,12 +26,23 @@ COMOCK_DEFINE_BEGIN(Mock, Interface)
   COMOCK_METHOD( voidArgTest  , void ,                    ,        (override) )
   COMOCK_METHOD( oneArgTest   , void , (int)              ,        (override) )
   COMOCK_METHOD( twoArgTest   , void , (int)(std::string) ,        (override) )
+  COMOCK_METHOD( commaArgTest , void , (std::pair<int, int>)(int), (override) )
   COMOCK_METHOD( returnTest   , int  ,                    ,        (override) )
   COMOCK_METHOD( overrideTest , void , (int)              ,        (override) )
   COMOCK_METHOD( overrideTest , void , (std::string)      ,        (override) )
   COMOCK_METHOD( constTest    , void ,                    ,        (override) )
   COMOCK_METHOD( constTest    , void ,                    , (const)(override) )
 COMOCK_DEFINE_END
+
+// Mocks generated by a macro have their methods on one line. Methods that
+// share a line need different member function types, the rest of the mock
+// follows on separate lines.
+#define ONE_LINE_MOCK_BEGIN(MockType) COMOCK_DEFINE_BEGIN(MockType, Interface) COMOCK_METHOD( voidArgTest , void , , (override) ) COMOCK_METHOD( oneArgTest , void , (int) , (override) ) COMOCK_METHOD( twoArgTest , void , (int)(std::string) , (override) ) COMOCK_METHOD( commaArgTest , void , (std::pair<int, int>)(int), (override) ) COMOCK_METHOD( returnTest , int , , (override) ) COMOCK_METHOD( overrideTest , void , (std::string) , (override) ) COMOCK_METHOD( constTest , void , , (const)(override) )
+
+ONE_LINE_MOCK_BEGIN(OneLineMock)
+  COMOCK_METHOD( overrideTest , void , (int) , (override) )
+  COMOCK_METHOD( constTest    , void ,       , (override) )
+COMOCK_DEFINE_END
 // clang-format on
 
 class CallTracker {
@@ -106,6 +118,22 @@ TEST_CASE_FIXTURE(Fixture, "On call") {
     REQUIRE(mock->returnTest() == 123);
     REQUIRE(mock->returnTest() == 321);
   }
+
+  SUBCASE("Fallback replaces itself") {
+    auto const value = std::make_shared<int>(123);
+
+    // Reallocates the storage of the running callback.
+    repo.onCall(*mock, &Interface::returnTest, [this, value]() {
+      for (auto i = 0; i < 100; ++i) {
+        repo.onCall(*mock, &Interface::voidArgTest, []() {});
+        repo.onCall(*mock, &Interface::returnTest, []() { return 321; });
+      }
+      return *value;
+    });
+
+    REQUIRE(mock->returnTest() == 123);
+    REQUIRE(mock->returnTest() == 321);
+  }
 }
 
 TEST_CASE_FIXTURE(Fixture, "Expected call") {
@@ -138,6 +166,18 @@ TEST_CASE_FIXTURE(Fixture, "Expected call") {
     mock->twoArgTest(123, "test");
   }
 
+  SUBCASE("Argument type with comma") {
+    auto call_tracker = CallTracker{};
+    repo.expectCall("void commaArgTest(std::pair<int, int>, int)", *mock,
+                    &Interface::commaArgTest,
+                    [&call_tracker](std::pair<int, int> const a, int const b) {
+                      REQUIRE(a == std::make_pair(1, 2));
+                      REQUIRE(b == 3);
+                      call_tracker.called();
+                    });
+    mock->commaArgTest({1, 2}, 3);
+  }
+
   SUBCASE("Return") {
     auto call_tracker = CallTracker{};
     repo.expectCall("int returnTest()", *mock, &Interface::returnTest,
@@ -220,3 +260,30 @@ TEST_CASE_FIXTURE(Fixture, "Expectations order") {
     mock->voidArgTest();
   }
 }
+
+TEST_CASE("One line mock") {
+  auto repo = comock::Repo{};
+  repo.setMissingCallHandler(
+      [](std::string const&) { REQUIRE_MESSAGE(false, "Missing call"); });
+
+  auto const mock = repo.create<OneLineMock>();
+  auto const const_test =
+      static_cast<void (Interface::*)() const>(&Interface::constTest);
+
+  auto unexpected_calls = 0;
+  repo.setUnexpectedCallHandler(
+      [&unexpected_calls](std::optional<std::string> const&) {
+        ++unexpected_calls;
+      });
+
+  repo.onCall(*mock, &Interface::returnTest, []() { return 1; });
+  repo.expectCall("constTest", *mock, const_test, []() {});
+
+  std::as_const(*mock).constTest();
+  REQUIRE(mock->returnTest() == 1);
+  REQUIRE(unexpected_calls == 0);
+
+  // Shares the line with returnTest, but not its key.
+  mock->voidArgTest();
+  REQUIRE(unexpected_calls == 1);
+}
@@ -0,0 +1,100 @@
+#include <comock/comock_interleaving.h>
+#include <doctest/doctest.h>
+
+namespace {
+
+class Counter {
+ public:
+  virtual ~Counter() = default;
+
+  virtual int get() = 0;
+  virtual void set(int value) = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(CounterMock, Counter)
+  COMOCK_METHOD( get , int  ,       , (override) )
+  COMOCK_METHOD( set , void , (int) , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+// Code under test: a racy read-modify-write.
+void increment(Counter& counter) {
+  counter.set(counter.get() + 1);
+}
+
+struct Run {
+  int value;
+  std::vector<std::size_t> schedule;
+};
+
+template <typename MakeInterleaving>
+Run runIncrements(MakeInterleaving make_interleaving) {
+  auto repo = comock::Repo{};
+  auto const mock = repo.create<CounterMock>();
+  auto value = 0;
+  repo.onCall(*mock, &Counter::get, [&value]() { return value; });
+  repo.onCall(*mock, &Counter::set, [&value](int new_value) {
+    value = new_value;
+  });
+
+  auto interleaving = make_interleaving(repo);
+  interleaving.run({[&mock]() { increment(*mock); },
+                    [&mock]() { increment(*mock); },
+                    [&mock]() { increment(*mock); }});
+
+  return {value, interleaving.schedule()};
+}
+
+}  // namespace
+
+TEST_CASE("Interleaving") {
+  SUBCASE("Random") {
+    auto lost_update_seed = std::optional<std::uint64_t>{};
+    auto correct_runs = 0;
+
+    for (auto seed = std::uint64_t{0}; seed < 200; ++seed) {
+      auto const run = runIncrements([seed](comock::Repo& repo) {
+        return comock::Interleaving::random(repo, seed);
+      });
+      correct_runs += run.value == 3 ? 1 : 0;
+      if (run.value < 3 && !lost_update_seed) {
+        lost_update_seed = seed;
+      }
+    }
+
+    REQUIRE(correct_runs > 0);
+    REQUIRE(lost_update_seed);
+
+    auto const replay = [&lost_update_seed](comock::Repo& repo) {
+      return comock::Interleaving::random(repo, *lost_update_seed);
+    };
+    auto const first = runIncrements(replay);
+    auto const second = runIncrements(replay);
+    REQUIRE(first.value < 3);
+    REQUIRE(first.value == second.value);
+    REQUIRE(first.schedule == second.schedule);
+  }
+
+  SUBCASE("PCT") {
+    auto lost_updates = 0;
+
+    for (auto seed = std::uint64_t{0}; seed < 200; ++seed) {
+      auto const run = runIncrements([seed](comock::Repo& repo) {
+        return comock::Interleaving::pct(repo, seed, 2, 9);
+      });
+      lost_updates += run.value < 3 ? 1 : 0;
+    }
+
+    REQUIRE(lost_updates > 0);
+  }
+
+  SUBCASE("Exception") {
+    auto repo = comock::Repo{};
+    auto interleaving = comock::Interleaving::random(repo, 1);
+
+    REQUIRE_THROWS_AS(
+        interleaving.run({[]() { throw std::runtime_error{"Failure"}; }}),
+        std::runtime_error);
+  }
+}
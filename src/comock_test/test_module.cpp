@@ -0,0 +1,68 @@
+#include <comock/comock_macros.h>
+#include <doctest/doctest.h>
+#include <chrono>
+#include <string>
+
+import comock;
+
+namespace {
+
+class Interface {
+ public:
+  virtual ~Interface() = default;
+
+  virtual int foo(int a, std::string b) = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(Mock, Interface)
+  COMOCK_METHOD( foo , int , (int)(std::string) , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+}  // namespace
+
+TEST_CASE("Module import") {
+  auto repo = comock::Repo{};
+  auto const mock = repo.create<Mock>();
+
+  repo.expectCall("foo", *mock, &Interface::foo, [](int a, std::string b) {
+    REQUIRE(b == "test");
+    return a;
+  });
+
+  REQUIRE(mock->foo(42, "test") == 42);
+}
+
+TEST_CASE("Module exports") {
+  auto repo = comock::Repo{};
+  auto const mocks = comock::MockArray<Mock>{repo.createMany<Mock>(2)};
+  auto const nice = repo.create<comock::Nice<Mock>>();
+
+  repo.setLatency(mocks[0], &Interface::foo,
+                  comock::Latency::fixed(std::chrono::milliseconds{5}));
+  repo.onCall<Mock>(&Interface::foo, [](int a, std::string) { return a; });
+
+  auto script = comock::ExpectationScript{repo};
+  script.expectCall("foo", mocks[1], &Interface::foo,
+                    [](int, std::string) { return -1; });
+  repo.bind(script);
+
+  auto const snapshot = comock::RepoSnapshot{repo.snapshot()};
+  auto const budget = comock::CallBudget{
+      repo.limitCalls("Budget", 10, &Interface::foo, mocks[0], mocks[1])};
+  auto const limit = comock::ConcurrencyLimit{
+      repo.limitConcurrency("Limit", 1, &Interface::foo, mocks[0])};
+
+  REQUIRE(mocks[1].foo(1, "test") == -1);
+  REQUIRE(mocks[0].foo(1, "test") == 1);
+  REQUIRE(nice->foo(2, "test") == 2);
+
+  comock::VirtualClock& clock = repo.clock();
+  REQUIRE(clock.now().time_since_epoch() == std::chrono::milliseconds{5});
+  REQUIRE(budget.calls() == 2);
+  REQUIRE(limit.peak() == 1);
+
+  auto const report = comock::CostReport{repo.costReport()};
+  REQUIRE(report.scenarios.empty());
+}
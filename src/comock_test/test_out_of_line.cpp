@@ -0,0 +1,18 @@
+#include <doctest/doctest.h>
+
+#include "out_of_line_mock.h"
+
+TEST_CASE("Out-of-line mock") {
+  auto repo = comock::Repo{};
+  auto const mock = repo.create<OutOfLineMock>();
+
+  repo.expectCall("foo", *mock, &OutOfLineInterface::foo,
+                  [](int const a, std::string const b) {
+                    REQUIRE(b == "test");
+                    return a;
+                  });
+  repo.onCall(*mock, &OutOfLineInterface::bar, []() { return 321; });
+
+  REQUIRE(mock->foo(123, "test") == 123);
+  REQUIRE(static_cast<OutOfLineMock const&>(*mock).bar() == 321);
+}
@@ -0,0 +1,81 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+
+namespace {
+
+struct Key {
+  int id;
+};
+
+class Store {
+ public:
+  virtual ~Store() = default;
+
+  virtual std::string get(std::string key) const = 0;
+  virtual int find(Key key) = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(StoreMock, Store)
+  COMOCK_METHOD( get  , std::string , (std::string) , (const)(override) )
+  COMOCK_METHOD( find , int         , (Key)         , (override)        )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  comock::Repo repo = {};
+  std::unique_ptr<StoreMock> mock = repo.create<StoreMock>();
+  std::unique_ptr<StoreMock> other_mock = repo.create<StoreMock>();
+
+  Fixture() {
+    repo.onCall(*mock, &Store::get, [](std::string key) { return key; });
+    repo.onCall(*other_mock, &Store::get, [](std::string key) { return key; });
+    repo.onCall(*mock, &Store::find, [](Key key) { return key.id; });
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Redundant calls") {
+  SUBCASE("Default hasher") {
+    repo.detectRedundantCalls(*mock, &Store::get);
+
+    mock->get("a");
+    mock->get("b");
+    mock->get("a");
+    mock->get("a");
+
+    auto const report = repo.redundantCallReport();
+    REQUIRE(report.methods.size() == 1);
+    REQUIRE(report.method("StoreMock::get")->calls == 4);
+    REQUIRE(report.method("StoreMock::get")->redundant_calls == 2);
+  }
+
+  SUBCASE("Mocks are distinguished") {
+    repo.detectRedundantCalls(*mock, &Store::get);
+    repo.detectRedundantCalls(*other_mock, &Store::get);
+
+    mock->get("a");
+    other_mock->get("a");
+
+    REQUIRE(repo.redundantCallReport().method("StoreMock::get")->calls == 2);
+    REQUIRE(repo.redundantCallReport()
+                .method("StoreMock::get")
+                ->redundant_calls == 0);
+  }
+
+  SUBCASE("Custom hasher") {
+    repo.detectRedundantCalls(*mock, &Store::find, [](Key const& key) {
+      return std::hash<int>{}(key.id);
+    });
+
+    mock->find({1});
+    mock->find({1});
+    mock->get("untracked");
+    mock->get("untracked");
+
+    auto const report = repo.redundantCallReport();
+    REQUIRE(report.method("StoreMock::find")->redundant_calls == 1);
+    REQUIRE(report.method("StoreMock::get") == nullptr);
+  }
+}
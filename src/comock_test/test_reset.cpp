@@ -0,0 +1,120 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+
+namespace {
+
+class Store {
+ public:
+  virtual ~Store() = default;
+
+  virtual int get(int key) = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(StoreMock, Store)
+  COMOCK_METHOD( get , int , (int) , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  comock::Repo repo = {};
+  std::unique_ptr<StoreMock> mock = repo.create<StoreMock>();
+  std::vector<std::string> missing_calls = {};
+  std::size_t unexpected_calls = 0;
+
+  Fixture() {
+    repo.setUnexpectedCallHandler(
+        [this](std::optional<std::string> const&) { ++unexpected_calls; });
+    repo.setMissingCallHandler([this](std::string const& description) {
+      missing_calls.push_back(description);
+    });
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Reset") {
+  SUBCASE("Reset drops expectations") {
+    repo.expectCall("get", *mock, &Store::get, [](int) { return 1; });
+
+    repo.reset();
+    mock->get(0);
+
+    REQUIRE(missing_calls.empty());
+    REQUIRE(unexpected_calls == 1);
+  }
+
+  SUBCASE("Verify and reset reports missing calls") {
+    repo.expectCall("first", *mock, &Store::get, [](int) { return 1; });
+    repo.expectCall("second", *mock, &Store::get, [](int) { return 2; });
+
+    REQUIRE(mock->get(0) == 1);
+    repo.verifyAndReset();
+
+    REQUIRE(missing_calls == std::vector<std::string>{"second"});
+  }
+
+  SUBCASE("Reset drops fallbacks") {
+    repo.onCall(*mock, &Store::get, [](int) { return 1; });
+    repo.onCall<StoreMock>(&Store::get, [](int) { return 2; });
+
+    repo.reset();
+    mock->get(0);
+
+    REQUIRE(unexpected_calls == 1);
+  }
+
+  SUBCASE("Reset from a fallback") {
+    auto const value = std::make_shared<int>(1);
+
+    repo.onCall(*mock, &Store::get, [this, value](int) {
+      repo.reset();
+      repo.onCall(*mock, &Store::get, [](int) { return 2; });
+      return *value;
+    });
+
+    REQUIRE(mock->get(0) == 1);
+    REQUIRE(mock->get(0) == 2);
+    REQUIRE(value.use_count() == 1);
+  }
+
+  SUBCASE("Reset releases fallbacks") {
+    auto const state = std::make_shared<int>(0);
+
+    repo.onCall(*mock, &Store::get, [state](int) { return *state; });
+    repo.onCall<StoreMock>(&Store::get, [state](int) { return *state; });
+    REQUIRE(state.use_count() == 3);
+
+    repo.reset();
+
+    REQUIRE(state.use_count() == 1);
+  }
+
+  SUBCASE("Popped expectations are released") {
+    auto const state = std::make_shared<int>(0);
+
+    repo.expectCall("first", *mock, &Store::get,
+                    [state](int) { return *state; });
+    repo.expectCall("second", *mock, &Store::get, [](int) { return 2; });
+    mock->get(0);
+
+    REQUIRE(state.use_count() == 1);
+    REQUIRE(mock->get(0) == 2);
+  }
+
+  SUBCASE("Iterations") {
+    for (auto iteration = 0; iteration < 100; ++iteration) {
+      repo.onCall(*mock, &Store::get,
+                  [iteration](int key) { return key + iteration; });
+      repo.expectCall("get", *mock, &Store::get,
+                      [iteration](int key) { return key * iteration; });
+
+      REQUIRE(mock->get(2) == 2 * iteration);
+      REQUIRE(mock->get(2) == 2 + iteration);
+      repo.verifyAndReset();
+    }
+
+    REQUIRE(missing_calls.empty());
+    REQUIRE(unexpected_calls == 0);
+  }
+}
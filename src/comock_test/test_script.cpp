@@ -0,0 +1,105 @@
+#include <comock/comock_script.h>
+#include <doctest/doctest.h>
+
+namespace {
+
+class Connection {
+ public:
+  virtual ~Connection() = default;
+
+  virtual void open() = 0;
+  virtual int send(int request) = 0;
+  virtual void close() = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(ConnectionMock, Connection)
+  COMOCK_METHOD( open  , void ,       , (override) )
+  COMOCK_METHOD( send  , int  , (int) , (override) )
+  COMOCK_METHOD( close , void ,       , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+comock::Script echoProtocol(ConnectionMock const& mock, int const requests) {
+  co_await comock::nextCall(mock, &Connection::open);
+
+  for (auto i = 0; i < requests; ++i) {
+    auto& send = co_await comock::nextCall(mock, &Connection::send);
+    send.reply(std::get<0>(send.args()) + 1);
+  }
+
+  co_await comock::nextCall(mock, &Connection::close);
+}
+
+comock::Script silentProtocol(ConnectionMock const& mock) {
+  co_await comock::nextCall(mock, &Connection::send);
+}
+
+struct Fixture {
+  comock::Repo repo = {};
+  std::unique_ptr<ConnectionMock> mock = repo.create<ConnectionMock>();
+  std::vector<std::string> unexpected_calls = {};
+
+  Fixture() {
+    repo.setUnexpectedCallHandler(
+        [this](std::optional<std::string> const& description) {
+          unexpected_calls.push_back(description.value_or(""));
+        });
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Script") {
+  SUBCASE("Protocol") {
+    auto script = echoProtocol(*mock, 100);
+    script.start(repo);
+
+    mock->open();
+    for (auto i = 0; i < 100; ++i) {
+      REQUIRE(mock->send(i) == i + 1);
+    }
+    REQUIRE_FALSE(script.done());
+    mock->close();
+
+    REQUIRE(script.done());
+    REQUIRE(unexpected_calls.empty());
+  }
+
+  SUBCASE("Unexpected call") {
+    auto script = echoProtocol(*mock, 1);
+    script.start(repo);
+
+    mock->close();
+
+    REQUIRE(unexpected_calls ==
+            std::vector<std::string>{"ConnectionMock::open"});
+  }
+
+  SUBCASE("Missing reply") {
+    auto script = silentProtocol(*mock);
+    script.start(repo);
+
+    REQUIRE_THROWS_AS(mock->send(1), std::invalid_argument);
+    REQUIRE(script.done());
+  }
+
+  SUBCASE("Missing call") {
+    auto missing_calls_after_repo = std::vector<std::string>{};
+    {
+      auto other_repo = comock::Repo{};
+      other_repo.setMissingCallHandler(
+          [&missing_calls_after_repo](std::string const& description) {
+            missing_calls_after_repo.push_back(description);
+          });
+      auto const other_mock = other_repo.create<ConnectionMock>();
+      auto script = echoProtocol(*other_mock, 1);
+      script.start(other_repo);
+
+      other_mock->open();
+    }
+
+    REQUIRE(missing_calls_after_repo ==
+            std::vector<std::string>{"ConnectionMock::send"});
+  }
+}
@@ -0,0 +1,84 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+
+namespace {
+
+class Connection {
+ public:
+  virtual ~Connection() = default;
+
+  virtual int send(int value) = 0;
+  virtual bool isOpen() const = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(ConnectionMock, Connection)
+  COMOCK_METHOD( send   , int  , (int) ,        (override) )
+  COMOCK_METHOD( isOpen , bool ,       , (const)(override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  comock::Repo repo = {};
+  std::optional<std::string> unexpected_call = {};
+
+  Fixture() {
+    repo.setUnexpectedCallHandler(
+        [this](std::optional<std::string> const& description) {
+          unexpected_call = description.value_or("");
+        });
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Shared fallback") {
+  SUBCASE("Every instance") {
+    auto mocks = std::vector<std::unique_ptr<ConnectionMock>>{};
+    for (auto i = 0; i < 100; ++i) {
+      mocks.push_back(repo.create<ConnectionMock>());
+    }
+
+    repo.onCall<ConnectionMock>(&Connection::send,
+                                [](int value) { return value * 2; });
+    repo.onCall<ConnectionMock>(&Connection::isOpen, []() { return true; });
+
+    for (auto const& mock : mocks) {
+      REQUIRE(mock->send(21) == 42);
+      REQUIRE(mock->isOpen());
+    }
+    REQUIRE(!unexpected_call);
+  }
+
+  SUBCASE("Instance fallback takes precedence") {
+    auto const mock = repo.create<ConnectionMock>();
+    auto const other_mock = repo.create<ConnectionMock>();
+
+    repo.onCall(*mock, &Connection::send, [](int) { return 1; });
+    repo.onCall<ConnectionMock>(&Connection::send, [](int) { return 2; });
+
+    REQUIRE(mock->send(0) == 1);
+    REQUIRE(other_mock->send(0) == 2);
+  }
+
+  SUBCASE("Expectations take precedence") {
+    auto const mock = repo.create<ConnectionMock>();
+
+    repo.onCall<ConnectionMock>(&Connection::send, [](int) { return 2; });
+    repo.expectCall("send", *mock, &Connection::send, [](int) { return 1; });
+
+    REQUIRE(mock->send(0) == 1);
+    REQUIRE(mock->send(0) == 2);
+    REQUIRE(!unexpected_call);
+  }
+
+  SUBCASE("Uncovered method") {
+    auto const mock = repo.create<ConnectionMock>();
+
+    repo.onCall<ConnectionMock>(&Connection::send, [](int) { return 2; });
+
+    mock->isOpen();
+
+    REQUIRE(unexpected_call);
+  }
+}
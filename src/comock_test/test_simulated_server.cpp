@@ -0,0 +1,88 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+class Backend {
+ public:
+  virtual ~Backend() = default;
+
+  virtual bool send(int request) = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(BackendMock, Backend)
+  COMOCK_METHOD( send , bool , (int) , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  comock::Repo repo = {};
+  std::unique_ptr<BackendMock> mock = repo.create<BackendMock>();
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Simulated server") {
+  SUBCASE("Load shedding") {
+    auto server = comock::SimulatedServer{
+        repo.clock(), {1, 2, comock::Latency::fixed(10ms), false}};
+    repo.onCall(*mock, &Backend::send,
+                server.serve([](int) { return true; }, [](int) {
+                  return false;
+                }));
+
+    REQUIRE(mock->send(1));
+    REQUIRE(mock->send(2));
+    REQUIRE(mock->send(3));
+    REQUIRE_FALSE(mock->send(4));
+
+    repo.clock().advance(10ms);
+    REQUIRE(mock->send(5));
+    REQUIRE_FALSE(mock->send(6));
+
+    REQUIRE(server.accepted() == 4);
+    REQUIRE(server.rejected() == 2);
+    REQUIRE(server.maxQueueLength() == 2);
+  }
+
+  SUBCASE("Admission") {
+    auto server = comock::SimulatedServer{
+        repo.clock(), {2, 1, comock::Latency::fixed(10ms), false}};
+    auto finish_times = std::vector<comock::Clock::duration>{};
+    repo.onCall(*mock, &Backend::send,
+                server.serve(
+                    [&finish_times](
+                        comock::SimulatedServer::Admission const& admission,
+                        int) {
+                      finish_times.push_back(
+                          admission.finish.time_since_epoch());
+                      return true;
+                    },
+                    [](int) { return false; }));
+
+    mock->send(1);
+    mock->send(2);
+    mock->send(3);
+
+    REQUIRE(finish_times ==
+            std::vector<comock::Clock::duration>{10ms, 10ms, 20ms});
+  }
+
+  SUBCASE("Blocking callers") {
+    auto server = comock::SimulatedServer{
+        repo.clock(), {1, 0, comock::Latency::sequence({5ms, 15ms}), true}};
+    repo.onCall(*mock, &Backend::send,
+                server.serve([](int) { return true; }, [](int) {
+                  return false;
+                }));
+
+    mock->send(1);
+    REQUIRE(repo.clock().now().time_since_epoch() == 5ms);
+    mock->send(2);
+    REQUIRE(repo.clock().now().time_since_epoch() == 20ms);
+    REQUIRE(server.rejected() == 0);
+  }
+}
@@ -0,0 +1,107 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+
+namespace {
+
+class Store {
+ public:
+  virtual ~Store() = default;
+
+  virtual int get(int key) = 0;
+  virtual void put(int key) = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(StoreMock, Store)
+  COMOCK_METHOD( get , int  , (int) , (override) )
+  COMOCK_METHOD( put , void , (int) , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  std::vector<std::string> missing_calls = {};
+  std::size_t unexpected_calls = 0;
+  comock::Repo repo = {};
+  std::unique_ptr<StoreMock> mock = repo.create<StoreMock>();
+
+  Fixture() {
+    repo.setUnexpectedCallHandler(
+        [this](std::optional<std::string> const&) { ++unexpected_calls; });
+    repo.setMissingCallHandler([this](std::string const& description) {
+      missing_calls.push_back(description);
+    });
+
+    repo.onCall(*mock, &Store::get, [](int key) { return key; });
+    repo.expectCall("put", *mock, &Store::put, [](int) {});
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Snapshot") {
+  auto const snapshot = repo.snapshot();
+
+  SUBCASE("Variants") {
+    for (auto variant = 0; variant < 10; ++variant) {
+      repo.restore(snapshot);
+      repo.onCall(*mock, &Store::get,
+                  [variant](int key) { return key + variant; });
+      repo.expectCall("get", *mock, &Store::get, [](int) { return -1; });
+
+      mock->put(0);
+      REQUIRE(mock->get(1) == -1);
+      REQUIRE(mock->get(1) == 1 + variant);
+      repo.verifyAndReset();
+    }
+
+    REQUIRE(missing_calls.empty());
+    REQUIRE(unexpected_calls == 0);
+  }
+
+  SUBCASE("Restore drops later registrations") {
+    repo.onCall(*mock, &Store::get, [](int) { return -1; });
+    repo.expectCall("get", *mock, &Store::get, [](int) { return -2; });
+
+    repo.restore(snapshot);
+
+    mock->put(0);
+    REQUIRE(mock->get(1) == 1);
+    REQUIRE(unexpected_calls == 0);
+  }
+
+  SUBCASE("Restore reports nothing") {
+    repo.restore(snapshot);
+    repo.restore(snapshot);
+
+    REQUIRE(missing_calls.empty());
+    mock->put(0);
+  }
+
+  SUBCASE("Nested snapshot") {
+    repo.onCall<StoreMock>(&Store::put, [](int) {});
+    repo.expectCall("get", *mock, &Store::get, [](int) { return -1; });
+    auto const nested_snapshot = repo.snapshot();
+
+    for (auto variant = 0; variant < 2; ++variant) {
+      repo.restore(nested_snapshot);
+
+      mock->put(0);
+      REQUIRE(mock->get(1) == -1);
+      REQUIRE(mock->get(1) == 1);
+      mock->put(0);
+    }
+
+    repo.restore(snapshot);
+    mock->put(0);
+    mock->put(0);
+
+    REQUIRE(unexpected_calls == 1);
+  }
+
+  SUBCASE("Another repository") {
+    auto other_repo = comock::Repo{};
+
+    REQUIRE_THROWS_AS(other_repo.restore(snapshot), std::invalid_argument);
+    repo.reset();
+  }
+}
@@ -0,0 +1,89 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+
+namespace {
+
+class Worker {
+ public:
+  virtual ~Worker() = default;
+
+  virtual int run(int task) = 0;
+  virtual int load() const = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(WorkerMock, Worker)
+  COMOCK_METHOD( run  , int , (int) ,        (override) )
+  COMOCK_METHOD( load , int ,       , (const)(override) )
+COMOCK_DEFINE_END
+
+COMOCK_DEFINE_BEGIN(OtherWorkerMock, Worker)
+  COMOCK_METHOD( run  , int , (int) ,        (override) )
+  COMOCK_METHOD( load , int ,       , (const)(override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+struct Fixture {
+  comock::Repo repo = {};
+  std::optional<std::string> unexpected_call = {};
+  std::unique_ptr<WorkerMock> first = repo.create<WorkerMock>();
+  std::unique_ptr<WorkerMock> second = repo.create<WorkerMock>();
+
+  Fixture() {
+    repo.setUnexpectedCallHandler(
+        [this](std::optional<std::string> const& description) {
+          unexpected_call = description.value_or("");
+        });
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Type expectation") {
+  SUBCASE("Any instance") {
+    repo.expectCall<WorkerMock>("run 1", &Worker::run,
+                                [](int task) { return task; });
+    repo.expectCall<WorkerMock>("load", &Worker::load, []() { return 7; });
+    repo.expectCall<WorkerMock>("run 2", &Worker::run,
+                                [](int task) { return task; });
+
+    REQUIRE(second->run(1) == 1);
+    REQUIRE(second->load() == 7);
+    REQUIRE(first->run(2) == 2);
+    REQUIRE(!unexpected_call);
+  }
+
+  SUBCASE("Mixed with instance expectations") {
+    repo.expectCall("run", *first, &Worker::run, [](int) { return 1; });
+    repo.expectCall<WorkerMock>("any run", &Worker::run, [](int) { return 2; });
+
+    REQUIRE(first->run(0) == 1);
+    REQUIRE(first->run(0) == 2);
+    REQUIRE(!unexpected_call);
+  }
+
+  SUBCASE("Other type") {
+    auto const other = repo.create<OtherWorkerMock>();
+
+    repo.expectCall<WorkerMock>("run", &Worker::run, [](int) { return 1; });
+
+    other->run(0);
+
+    REQUIRE(unexpected_call == "run");
+  }
+}
+
+TEST_CASE("Missing type expectation") {
+  auto missing_call = std::optional<std::string>{};
+
+  {
+    auto repo = comock::Repo{};
+    repo.setMissingCallHandler([&missing_call](std::string const& description) {
+      missing_call = description;
+    });
+
+    repo.expectCall<WorkerMock>("run", &Worker::run, [](int) { return 1; });
+  }
+
+  REQUIRE(missing_call == "run");
+}
@@ -0,0 +1,92 @@
+#include <comock/comock.h>
+#include <doctest/doctest.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+class Service {
+ public:
+  virtual ~Service() = default;
+
+  virtual bool request(int attempt) = 0;
+};
+
+// clang-format off
+COMOCK_DEFINE_BEGIN(ServiceMock, Service)
+  COMOCK_METHOD( request , bool , (int) , (override) )
+COMOCK_DEFINE_END
+// clang-format on
+
+// Code under test: retries the request until it succeeds or the deadline
+// passes.
+int requestWithDeadline(Service& service,
+                        comock::Clock const& clock,
+                        comock::Clock::duration const timeout) {
+  auto const deadline = clock.now() + timeout;
+  auto attempt = 0;
+
+  while (clock.now() < deadline) {
+    if (service.request(++attempt)) {
+      return attempt;
+    }
+  }
+
+  return -attempt;
+}
+
+struct Fixture {
+  comock::Repo repo = {};
+  std::unique_ptr<ServiceMock> mock = repo.create<ServiceMock>();
+
+  Fixture() {
+    repo.setUnexpectedCallHandler([](std::optional<std::string> const&) {
+      REQUIRE_MESSAGE(false, "Unexpected call");
+    });
+  }
+};
+
+}  // namespace
+
+TEST_CASE_FIXTURE(Fixture, "Virtual clock") {
+  SUBCASE("Advance") {
+    auto const start = repo.clock().now();
+    repo.clock().advance(5s);
+    REQUIRE(repo.clock().now() - start == 5s);
+  }
+
+  SUBCASE("Fixed latency") {
+    repo.onCall(*mock, &Service::request, [](int) { return false; });
+    repo.setLatency(*mock, &Service::request, comock::Latency::fixed(300ms));
+
+    REQUIRE(requestWithDeadline(*mock, repo.clock(), 1s) == -4);
+    REQUIRE(repo.clock().now().time_since_epoch() == 1200ms);
+  }
+
+  SUBCASE("Latency sequence") {
+    repo.onCall(*mock, &Service::request, [](int attempt) {
+      return attempt == 3;
+    });
+    repo.setLatency(*mock, &Service::request,
+                    comock::Latency::sequence({900ms, 50ms, 10ms}));
+
+    REQUIRE(requestWithDeadline(*mock, repo.clock(), 1s) == 3);
+    REQUIRE(repo.clock().now().time_since_epoch() == 960ms);
+  }
+
+  SUBCASE("Seeded distribution") {
+    auto const measure = [](comock::Latency latency) {
+      auto total = comock::Clock::duration{};
+      for (auto i = 0; i < 100; ++i) {
+        auto const value = latency();
+        REQUIRE(value >= 10ms);
+        REQUIRE(value < 20ms);
+        total += value;
+      }
+      return total;
+    };
+
+    REQUIRE(measure(comock::Latency::uniform(10ms, 20ms, 42)) ==
+            measure(comock::Latency::uniform(10ms, 20ms, 42)));
+  }
+}